@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+using namespace std::chrono_literals;
+
+namespace holoscan::benchmarks {
+
+namespace {
+
+/// Number of frames emitted by the source per benchmark iteration.
+constexpr int64_t kNumFrames = 400;
+/// Period of the source.
+constexpr auto kFramePeriod = 5ms;
+/// Deadline of the latency-critical operator, relative to the release of a frame.
+constexpr auto kCriticalDeadline = 4ms;
+/// CPU time spent by the latency-critical operator per frame.
+constexpr auto kCriticalWork = 500us;
+/// CPU time spent by each background operator per frame.
+constexpr auto kBackgroundWork = 1500us;
+/// Number of background operators.
+constexpr int kNumBackgroundOps = 3;
+
+/// Spin for a duration of wall-clock time, as CPU-bound work would
+void busy_wait(std::chrono::nanoseconds duration) {
+  const auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end) {}
+}
+
+class FrameSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameSourceOp)
+
+  FrameSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int64_t>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(index_++, "out");
+  }
+
+ private:
+  int64_t index_ = 0;
+};
+
+class BusyOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BusyOp)
+
+  BusyOp() = default;
+  explicit BusyOp(std::chrono::nanoseconds work) : work_(work) {}
+
+  void setup(OperatorSpec& spec) override { spec.input<int64_t>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    op_input.receive<int64_t>("in").value();
+    busy_wait(work_);
+  }
+
+ private:
+  std::chrono::nanoseconds work_{0};
+};
+
+/**
+ * @brief Mixed-criticality application.
+ *
+ * A periodic source feeds a latency-critical operator with a deadline (e.g. a display) and
+ * background operators without deadlines (e.g. a recorder and analytics).
+ */
+class MixedCriticalityApp : public holoscan::Application {
+ public:
+  explicit MixedCriticalityApp(bool deadline_scheduling) {
+    this->deadline_scheduling(deadline_scheduling);
+  }
+
+  void compose() override {
+    auto source = make_operator<FrameSourceOp>(
+        "source",
+        make_condition<CountCondition>("source-count", kNumFrames),
+        make_condition<PeriodicCondition>("source-period", kFramePeriod));
+    source->period(kFramePeriod);
+
+    critical_ = make_operator<BusyOp>("critical", kCriticalWork);
+    critical_->deadline(kCriticalDeadline);
+    add_flow(source, critical_);
+
+    for (int i = 0; i < kNumBackgroundOps; ++i) {
+      add_flow(source, make_operator<BusyOp>(fmt::format("background{}", i), kBackgroundWork));
+    }
+  }
+
+  std::shared_ptr<BusyOp> critical_;
+};
+
+/// Threads spinning on the CPUs while the application runs
+class CpuContention {
+ public:
+  explicit CpuContention(int64_t num_threads) {
+    for (int64_t i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        while (!stop_.load(std::memory_order_relaxed)) { busy_wait(100us); }
+      });
+    }
+  }
+
+  ~CpuContention() {
+    stop_ = true;
+    for (auto& thread : threads_) { thread.join(); }
+  }
+
+ private:
+  std::atomic<bool> stop_{false};
+  std::vector<std::thread> threads_;
+};
+
+/**
+ * @brief Run the mixed-criticality application and report the deadline misses of the
+ * latency-critical operator.
+ *
+ * Benchmark arguments: number of worker threads of the EventBasedScheduler, number of threads
+ * competing for the CPUs and whether deadline scheduling is enabled.
+ */
+void BM_DeadlineScheduling(benchmark::State& state) {
+  const int64_t num_workers = state.range(0);
+  const int64_t num_contention_threads = state.range(1);
+  const bool deadline_scheduling = state.range(2) != 0;
+
+  uint64_t total_ticks = 0;
+  uint64_t total_misses = 0;
+  double max_lateness_ms = 0.0;
+  double compute_time_p99_ms = 0.0;
+
+  for (auto _ : state) {
+    auto app = make_application<MixedCriticalityApp>(deadline_scheduling);
+    app->scheduler(app->make_scheduler<EventBasedScheduler>(
+        "event-based",
+        Arg("worker_thread_number", num_workers),
+        Arg("stop_on_deadlock_timeout", int64_t{0})));
+
+    CpuContention contention(num_contention_threads);
+    app->run();
+
+    const auto stats = app->critical_->metrics().statistics();
+    total_ticks += stats.tick_count;
+    total_misses += stats.deadline_miss_count;
+    max_lateness_ms = std::max(max_lateness_ms, stats.max_lateness_ms);
+    compute_time_p99_ms = std::max(compute_time_p99_ms, stats.compute_time_p99_ms);
+  }
+
+  state.counters["deadline_miss_rate"] =
+      total_ticks > 0 ? static_cast<double>(total_misses) / static_cast<double>(total_ticks) : 0.0;
+  state.counters["max_lateness_ms"] = max_lateness_ms;
+  state.counters["critical_compute_p99_ms"] = compute_time_p99_ms;
+}
+
+bool register_deadline_scheduling_benchmarks() {
+  const int64_t num_cpus = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+  auto* bench = benchmark::RegisterBenchmark("BM_DeadlineScheduling/event_based",
+                                             BM_DeadlineScheduling);
+  bench->ArgNames({"workers", "contention", "edf"})->Unit(benchmark::kMillisecond)->Iterations(3);
+  for (int64_t workers : {1, 2}) {
+    for (int64_t contention : {int64_t{0}, num_cpus}) {
+      for (int64_t edf : {0, 1}) { bench->Args({workers, contention, edf}); }
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool deadline_scheduling_benchmarks_registered =
+    register_deadline_scheduling_benchmarks();
+
+}  // namespace
+
+}  // namespace holoscan::benchmarks
@@ -0,0 +1,254 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+#include "./message_path_ops.hpp"
+
+namespace holoscan::benchmarks {
+
+namespace {
+
+/// Number of messages emitted by each source operator per benchmark iteration.
+constexpr int64_t kNumMessages = 2000;
+
+enum class Topology {
+  kPing,       ///< tx -> rx
+  kFanIn,      ///< N tx -> rx with N input ports
+  kFanOut,     ///< tx with N output ports -> N rx
+  kBroadcast,  ///< one tx output port -> N rx (implicit Broadcast entity)
+  kFanOutTx,   ///< one tx output port -> N rx (fan-out transmitter)
+  kCycle,      ///< cycle of N operators
+};
+
+enum class SchedulerType { kGreedy, kMultiThread, kEventBased };
+
+struct MessagePathConfig {
+  Topology topology = Topology::kPing;
+  size_t width = 1;  ///< number of ports/operators (N) of the topology
+  MessageStats* stats = nullptr;
+};
+
+template <typename PayloadT>
+class MessagePathApp : public holoscan::Application {
+ public:
+  explicit MessagePathApp(const MessagePathConfig& config) : config_(config) {}
+
+  void compose() override {
+    auto* stats = config_.stats;
+    const size_t n = config_.width;
+    auto count = [this]() { return make_condition<CountCondition>(kNumMessages); };
+
+    switch (config_.topology) {
+      case Topology::kPing: {
+        auto tx = make_operator<BenchTxOp<PayloadT>>("tx", 1, false, stats, count());
+        auto rx = make_operator<BenchRxOp<PayloadT>>("rx", 1, stats);
+        add_flow(tx, rx, {{"out0", "in0"}});
+      } break;
+      case Topology::kFanIn: {
+        auto rx = make_operator<BenchRxOp<PayloadT>>("rx", n, stats);
+        for (size_t i = 0; i < n; ++i) {
+          auto tx = make_operator<BenchTxOp<PayloadT>>(
+              fmt::format("tx{}", i), 1, false, stats, count());
+          add_flow(tx, rx, {{"out0", fmt::format("in{}", i)}});
+        }
+      } break;
+      case Topology::kFanOut: {
+        auto tx = make_operator<BenchTxOp<PayloadT>>("tx", n, false, stats, count());
+        for (size_t i = 0; i < n; ++i) {
+          auto rx = make_operator<BenchRxOp<PayloadT>>(fmt::format("rx{}", i), 1, stats);
+          add_flow(tx, rx, {{fmt::format("out{}", i), "in0"}});
+        }
+      } break;
+      case Topology::kBroadcast:
+      case Topology::kFanOutTx: {
+        bool fan_out = config_.topology == Topology::kFanOutTx;
+        auto tx = make_operator<BenchTxOp<PayloadT>>("tx", 1, fan_out, stats, count());
+        for (size_t i = 0; i < n; ++i) {
+          auto rx = make_operator<BenchRxOp<PayloadT>>(fmt::format("rx{}", i), 1, stats);
+          add_flow(tx, rx, {{"out0", "in0"}});
+        }
+      } break;
+      case Topology::kCycle: {
+        auto head = make_operator<BenchForwardOp<PayloadT>>("op0", true, stats, count());
+        auto prev = head;
+        for (size_t i = 1; i < n; ++i) {
+          auto op = make_operator<BenchForwardOp<PayloadT>>(fmt::format("op{}", i), false, stats);
+          add_flow(prev, op, {{"out", "in"}});
+          prev = op;
+        }
+        add_flow(prev, head, {{"out", "in"}});
+      } break;
+    }
+  }
+
+ private:
+  MessagePathConfig config_;
+};
+
+/**
+ * @brief Run the application of a topology and report its throughput.
+ *
+ * Benchmark arguments: number of worker threads, width of the topology and whether data flow
+ * tracking is enabled. With tracking, the end-to-end latency percentiles of the slowest path, the
+ * number of hops of the longest path and the latency percentiles of all the hops (from the
+ * publish timestamp of an operator to the receive timestamp of the next one, taken from the
+ * message labels) are reported as well. The tracking overhead is then part of the throughput.
+ */
+template <typename PayloadT>
+void BM_MessagePath(benchmark::State& state, Topology topology, SchedulerType scheduler_type) {
+  const int64_t num_workers = state.range(0);
+  const auto width = static_cast<size_t>(state.range(1));
+  const bool track = state.range(2) != 0;
+
+  MessageStats stats;
+  uint64_t total_received = 0;
+  double total_seconds = 0.0;
+  std::vector<double> e2e_latencies_ms(4, 0.0);  // p50, p90, p99, max
+  int64_t max_num_hops = 0;
+
+  for (auto _ : state) {
+    stats.reset();
+    auto app = make_application<MessagePathApp<PayloadT>>(
+        MessagePathConfig{topology, width, &stats});
+
+    switch (scheduler_type) {
+      case SchedulerType::kGreedy:
+        app->scheduler(app->template make_scheduler<GreedyScheduler>("greedy"));
+        break;
+      case SchedulerType::kMultiThread:
+        app->scheduler(app->template make_scheduler<MultiThreadScheduler>(
+            "multithread",
+            Arg("worker_thread_number", num_workers),
+            Arg("check_recession_period_ms", 0.0),
+            Arg("stop_on_deadlock_timeout", int64_t{0})));
+        break;
+      case SchedulerType::kEventBased:
+        app->scheduler(app->template make_scheduler<EventBasedScheduler>(
+            "event-based",
+            Arg("worker_thread_number", num_workers),
+            Arg("stop_on_deadlock_timeout", int64_t{0})));
+        break;
+    }
+
+    DataFlowTracker* tracker = track ? &app->track() : nullptr;
+    app->run();
+
+    const double seconds = stats.elapsed_seconds();
+    state.SetIterationTime(seconds);
+    total_seconds += seconds;
+    total_received += stats.num_received.load();
+
+    if (tracker) {
+      for (const auto& path : tracker->get_path_strings()) {
+        max_num_hops = std::max<int64_t>(max_num_hops, std::count(path.begin(), path.end(), ','));
+        const DataFlowMetric metrics[] = {DataFlowMetric::kP50E2ELatency,
+                                          DataFlowMetric::kP90E2ELatency,
+                                          DataFlowMetric::kP99E2ELatency,
+                                          DataFlowMetric::kMaxE2ELatency};
+        for (size_t i = 0; i < e2e_latencies_ms.size(); ++i) {
+          e2e_latencies_ms[i] =
+              std::max(e2e_latencies_ms[i], tracker->get_metric(path, metrics[i]));
+        }
+      }
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(total_received));
+  state.counters["messages_per_second"] =
+      total_seconds > 0.0 ? static_cast<double>(total_received) / total_seconds : 0.0;
+  if (track) {
+    state.counters["e2e_latency_p50_us"] = e2e_latencies_ms[0] * 1000.0;
+    state.counters["e2e_latency_p90_us"] = e2e_latencies_ms[1] * 1000.0;
+    state.counters["e2e_latency_p99_us"] = e2e_latencies_ms[2] * 1000.0;
+    state.counters["e2e_latency_max_us"] = e2e_latencies_ms[3] * 1000.0;
+    state.counters["path_hops"] = static_cast<double>(max_num_hops);
+    state.counters["hop_latency_p50_us"] = stats.hop_latency_us.value_at_percentile(50.0);
+    state.counters["hop_latency_p90_us"] = stats.hop_latency_us.value_at_percentile(90.0);
+    state.counters["hop_latency_p99_us"] = stats.hop_latency_us.value_at_percentile(99.0);
+  }
+}
+
+template <typename PayloadT>
+void register_message_path_benchmarks(const std::string& payload_name) {
+  struct TopologyInfo {
+    Topology topology;
+    const char* name;
+    std::vector<int64_t> widths;
+  };
+  const TopologyInfo topologies[] = {
+      {Topology::kPing, "ping", {1}},
+      {Topology::kFanIn, "fan_in", {2, 8}},
+      {Topology::kFanOut, "fan_out", {2, 8}},
+      {Topology::kBroadcast, "broadcast", {2, 8}},
+      {Topology::kFanOutTx, "fan_out_tx", {2, 8}},
+      {Topology::kCycle, "cycle", {2, 4}},
+  };
+  struct SchedulerInfo {
+    SchedulerType type;
+    const char* name;
+    std::vector<int64_t> workers;
+  };
+  const SchedulerInfo schedulers[] = {
+      {SchedulerType::kGreedy, "greedy", {1}},
+      {SchedulerType::kMultiThread, "multithread", {1, 2, 4}},
+      {SchedulerType::kEventBased, "event_based", {1, 2, 4}},
+  };
+
+  for (const auto& topology : topologies) {
+    for (const auto& scheduler : schedulers) {
+      auto name =
+          fmt::format("BM_MessagePath/{}/{}/{}", topology.name, payload_name, scheduler.name);
+      auto* bench = benchmark::RegisterBenchmark(
+          name.c_str(), BM_MessagePath<PayloadT>, topology.topology, scheduler.type);
+      bench->ArgNames({"workers", "width", "track"})
+          ->UseManualTime()
+          ->Unit(benchmark::kMillisecond);
+      for (int64_t workers : scheduler.workers) {
+        for (int64_t width : topology.widths) {
+          for (int64_t track : {0, 1}) {
+            bench->Args({workers, width, track});
+          }
+        }
+      }
+    }
+  }
+}
+
+bool register_all_message_path_benchmarks() {
+  register_message_path_benchmarks<std::shared_ptr<BenchValue>>("shared_ptr");
+  register_message_path_benchmarks<std::any>("any");
+  register_message_path_benchmarks<gxf::Entity>("entity");
+  register_message_path_benchmarks<TensorMap>("tensormap");
+  return true;
+}
+
+[[maybe_unused]] const bool message_path_benchmarks_registered =
+    register_all_message_path_benchmarks();
+
+}  // namespace
+
+}  // namespace holoscan::benchmarks
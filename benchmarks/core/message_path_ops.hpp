@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCHMARKS_CORE_MESSAGE_PATH_OPS_HPP
+#define BENCHMARKS_CORE_MESSAGE_PATH_OPS_HPP
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include "holoscan/core/latency_histogram.hpp"
+#include "holoscan/core/messagelabel.hpp"
+
+namespace holoscan::benchmarks {
+
+/// Value carried by the `std::shared_ptr<T>` and `std::any` payloads.
+struct BenchValue {
+  int64_t value = 0;
+};
+
+/**
+ * @brief Message counters and timestamps shared by the operators of a benchmark application.
+ *
+ * The measured interval starts at the first emit and ends at the last receive, so the
+ * initialization and the teardown of the application are not part of the measurement.
+ */
+struct MessageStats {
+  std::atomic<int64_t> first_emit_ns{0};
+  std::atomic<int64_t> last_receive_ns{0};
+  std::atomic<uint64_t> num_received{0};
+  /// The latencies (in microseconds) of the hops between operators, only recorded with data flow
+  /// tracking. Not cleared by reset(), so that it covers all the benchmark iterations.
+  LatencyHistogram hop_latency_us;
+
+  static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  void reset() {
+    first_emit_ns = 0;
+    last_receive_ns = 0;
+    num_received = 0;
+  }
+
+  void mark_emit() {
+    int64_t unset = 0;
+    first_emit_ns.compare_exchange_strong(unset, now_ns(), std::memory_order_relaxed);
+  }
+
+  void mark_receive(uint64_t count) {
+    num_received.fetch_add(count, std::memory_order_relaxed);
+    last_receive_ns.store(now_ns(), std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Record the latency of the last hop of every path of the input message label of an
+   * operator: from the publish timestamp of the upstream operator to the receive timestamp of the
+   * operator.
+   */
+  void record_hop_latencies(const MessageLabel& label) {
+    for (const auto& path : label.paths()) {
+      if (path.size() < 2) { continue; }
+      const auto& upstream = path[path.size() - 2];
+      hop_latency_us.record(path.back().rec_timestamp - upstream.pub_timestamp);
+    }
+  }
+
+  double elapsed_seconds() const {
+    int64_t first = first_emit_ns.load();
+    int64_t last = last_receive_ns.load();
+    return (first == 0 || last <= first) ? 0.0 : static_cast<double>(last - first) * 1e-9;
+  }
+};
+
+/**
+ * @brief Create the payload of a message.
+ *
+ * `std::shared_ptr<BenchValue>`, `std::any` and `TensorMap` payloads are created once and reused,
+ * so that only the message path is measured. A `gxf::Entity` payload is created for every message
+ * as an entity can't be emitted twice.
+ */
+template <typename PayloadT>
+class PayloadFactory {
+ public:
+  PayloadFactory() {
+    if constexpr (std::is_same_v<PayloadT, std::shared_ptr<BenchValue>>) {
+      payload_ = std::make_shared<BenchValue>();
+    } else if constexpr (std::is_same_v<PayloadT, std::any>) {
+      payload_ = std::make_shared<BenchValue>();
+    } else if constexpr (std::is_same_v<PayloadT, TensorMap>) {
+      payload_.insert({"tensor", make_host_tensor(1024)});
+    }
+  }
+
+  PayloadT create(ExecutionContext& context) {
+    if constexpr (std::is_same_v<PayloadT, gxf::Entity>) {
+      return gxf::Entity::New(&context);
+    } else {
+      return payload_;
+    }
+  }
+
+ private:
+  /// Create a 1-D host tensor of `size` bytes.
+  static std::shared_ptr<Tensor> make_host_tensor(int64_t size) {
+    struct HostTensorContext {
+      std::vector<uint8_t> data;
+      int64_t shape[1];
+      DLManagedTensor tensor;
+    };
+    auto* ctx = new HostTensorContext{std::vector<uint8_t>(size), {size}, {}};
+    ctx->tensor.dl_tensor.data = ctx->data.data();
+    ctx->tensor.dl_tensor.device = DLDevice{kDLCPU, 0};
+    ctx->tensor.dl_tensor.ndim = 1;
+    ctx->tensor.dl_tensor.dtype = DLDataType{kDLUInt, 8, 1};
+    ctx->tensor.dl_tensor.shape = ctx->shape;
+    ctx->tensor.dl_tensor.strides = nullptr;
+    ctx->tensor.dl_tensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](DLManagedTensor* self) {
+      delete static_cast<HostTensorContext*>(self->manager_ctx);
+    };
+    return std::make_shared<Tensor>(&ctx->tensor);
+  }
+
+  PayloadT payload_{};
+};
+
+/// Return true if a message was received by `InputContext::receive()`.
+template <typename PayloadT, typename ReceivedT>
+bool has_message(const ReceivedT& received) {
+  if (!received) { return false; }
+  // An empty input port yields a `nullptr` when receiving `std::any`
+  if constexpr (std::is_same_v<PayloadT, std::any>) {
+    return received.value().type() != typeid(std::nullptr_t);
+  }
+  return true;
+}
+
+/// Emits one message on each of its `out<i>` output ports per tick.
+template <typename PayloadT>
+class BenchTxOp : public Operator {
+ public:
+  template <typename... ArgsT>
+  BenchTxOp(size_t num_ports, bool fan_out, MessageStats* stats, ArgsT&&... args)
+      : Operator(std::forward<ArgsT>(args)...),
+        num_ports_(num_ports),
+        fan_out_(fan_out),
+        stats_(stats) {}
+
+  void setup(OperatorSpec& spec) override {
+    for (size_t i = 0; i < num_ports_; ++i) {
+      port_names_.push_back(fmt::format("out{}", i));
+      spec.output<PayloadT>(port_names_.back()).fan_out(fan_out_);
+    }
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext& context) override {
+    stats_->mark_emit();
+    for (const auto& port_name : port_names_) {
+      auto payload = payload_factory_.create(context);
+      op_output.emit(payload, port_name.c_str());
+    }
+  }
+
+ private:
+  size_t num_ports_;
+  bool fan_out_;
+  MessageStats* stats_;
+  std::vector<std::string> port_names_;
+  PayloadFactory<PayloadT> payload_factory_;
+};
+
+/// Receives one message on each of its `in<i>` input ports per tick.
+template <typename PayloadT>
+class BenchRxOp : public Operator {
+ public:
+  template <typename... ArgsT>
+  BenchRxOp(size_t num_ports, MessageStats* stats, ArgsT&&... args)
+      : Operator(std::forward<ArgsT>(args)...), num_ports_(num_ports), stats_(stats) {}
+
+  void setup(OperatorSpec& spec) override {
+    for (size_t i = 0; i < num_ports_; ++i) {
+      port_names_.push_back(fmt::format("in{}", i));
+      spec.input<PayloadT>(port_names_.back());
+    }
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    uint64_t count = 0;
+    for (const auto& port_name : port_names_) {
+      if (has_message<PayloadT>(op_input.receive<PayloadT>(port_name.c_str()))) { ++count; }
+    }
+    stats_->mark_receive(count);
+    if (fragment()->data_flow_tracker()) {
+      stats_->record_hop_latencies(get_consolidated_input_label());
+    }
+  }
+
+ private:
+  size_t num_ports_;
+  MessageStats* stats_;
+  std::vector<std::string> port_names_;
+};
+
+/**
+ * @brief Forwards the message of its `in` port to its `out` port.
+ *
+ * The head of a cycle doesn't wait for an input message: it emits a new message on every tick
+ * and counts the messages which made it around the cycle. The hop closing the cycle is not
+ * recorded in MessageStats::hop_latency_us, as the receiver of the head consumes the cyclic path.
+ */
+template <typename PayloadT>
+class BenchForwardOp : public Operator {
+ public:
+  template <typename... ArgsT>
+  BenchForwardOp(bool cycle_head, MessageStats* stats, ArgsT&&... args)
+      : Operator(std::forward<ArgsT>(args)...), cycle_head_(cycle_head), stats_(stats) {}
+
+  void setup(OperatorSpec& spec) override {
+    if (cycle_head_) {
+      spec.input<PayloadT>("in").condition(ConditionType::kNone);
+    } else {
+      spec.input<PayloadT>("in");
+    }
+    spec.output<PayloadT>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output,
+               ExecutionContext& context) override {
+    auto message = op_input.receive<PayloadT>("in");
+    if (cycle_head_) {
+      if (has_message<PayloadT>(message)) { stats_->mark_receive(1); }
+      stats_->mark_emit();
+      auto payload = payload_factory_.create(context);
+      op_output.emit(payload, "out");
+    } else if (has_message<PayloadT>(message)) {
+      if (fragment()->data_flow_tracker()) {
+        stats_->record_hop_latencies(get_consolidated_input_label());
+      }
+      op_output.emit(message.value(), "out");
+    }
+  }
+
+ private:
+  bool cycle_head_;
+  MessageStats* stats_;
+  PayloadFactory<PayloadT> payload_factory_;
+};
+
+}  // namespace holoscan::benchmarks
+
+#endif /* BENCHMARKS_CORE_MESSAGE_PATH_OPS_HPP */
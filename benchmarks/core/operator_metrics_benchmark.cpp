@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gxf/core/entity.hpp>
+#include <gxf/core/gxf.h>
+#include <gxf/std/receiver.hpp>
+#include <holoscan/holoscan.hpp>
+#include "holoscan/core/gxf/gxf_execution_context.hpp"
+#include "holoscan/core/gxf/gxf_wrapper.hpp"
+
+namespace holoscan::benchmarks {
+
+namespace {
+
+/// Operator with input ports that are never received from and an empty compute(), so that a tick
+/// only measures the work of the executor around compute().
+class EmptyComputeOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(EmptyComputeOp)
+
+  EmptyComputeOp() = default;
+  explicit EmptyComputeOp(int64_t num_inputs) : num_inputs_(num_inputs) {}
+
+  void setup(OperatorSpec& spec) override {
+    for (int64_t i = 0; i < num_inputs_; ++i) { spec.input<int64_t>(fmt::format("in{}", i)); }
+  }
+
+  void compute(InputContext&, OutputContext&, ExecutionContext&) override {
+    benchmark::ClobberMemory();
+  }
+
+ private:
+  int64_t num_inputs_ = 0;
+};
+
+/**
+ * @brief GXF entity with a double-buffer receiver per input port, each holding one message.
+ *
+ * The ports of an operator ticked outside of an application have no receivers. Connecting them to
+ * these receivers lets GXFWrapper::tick() scan the depths of real input queues.
+ */
+class QueuedInputs {
+ public:
+  QueuedInputs(gxf_context_t context, int64_t num_inputs) : context_(context) {
+    const GxfEntityCreateInfo entity_create_info = {"queued_inputs",
+                                                    GXF_ENTITY_CREATE_PROGRAM_BIT};
+    gxf_tid_t tid{};
+    if (GxfCreateEntity(context_, &entity_create_info, &eid_) != GXF_SUCCESS ||
+        GxfComponentTypeId(context_, "nvidia::gxf::DoubleBufferReceiver", &tid) != GXF_SUCCESS) {
+      return;
+    }
+    std::vector<gxf_uid_t> cids(num_inputs);
+    for (int64_t i = 0; i < num_inputs; ++i) {
+      const auto name = fmt::format("in{}", i);
+      if (GxfComponentAdd(context_, eid_, tid, name.c_str(), &cids[i]) != GXF_SUCCESS) { return; }
+    }
+    // Activating the entity allocates the queues of the receivers
+    if (GxfEntityActivate(context_, eid_) != GXF_SUCCESS) { return; }
+    active_ = true;
+    for (auto cid : cids) {
+      void* pointer = nullptr;
+      auto message = nvidia::gxf::Entity::New(context_);
+      if (GxfComponentPointer(context_, cid, tid, &pointer) != GXF_SUCCESS || !message) { return; }
+      auto* receiver = static_cast<nvidia::gxf::Receiver*>(pointer);
+      if (!receiver->push(message.value()) || !receiver->sync()) { return; }
+      receivers_.push_back(receiver);
+    }
+  }
+
+  ~QueuedInputs() {
+    if (active_) { GxfEntityDeactivate(context_, eid_); }
+    if (eid_ != 0) { GxfEntityDestroy(context_, eid_); }
+  }
+
+  QueuedInputs(const QueuedInputs&) = delete;
+  QueuedInputs& operator=(const QueuedInputs&) = delete;
+
+  /// Receivers in the order of the input ports, empty if they could not be created
+  const std::vector<nvidia::gxf::Receiver*>& receivers() const { return receivers_; }
+
+ private:
+  gxf_context_t context_ = nullptr;
+  gxf_uid_t eid_ = 0;
+  bool active_ = false;
+  std::vector<nvidia::gxf::Receiver*> receivers_;
+};
+
+/**
+ * @brief Record the metrics of a tick, with the clock reads done by GXFWrapper::tick().
+ */
+void BM_OperatorMetricsRecordTick(benchmark::State& state) {
+  OperatorMetrics metrics;
+  metrics.log_period(0);
+  uint64_t input_queue_depth = 0;
+
+  for (auto _ : state) {
+    const auto begin = OperatorMetrics::Clock::now();
+    const auto end = OperatorMetrics::Clock::now();
+    benchmark::DoNotOptimize(metrics.record_tick(begin, end, input_queue_depth++ & 7));
+  }
+
+  state.counters["tick_count"] = static_cast<double>(metrics.statistics().tick_count);
+}
+
+/**
+ * @brief Tick an operator with an empty compute().
+ *
+ * With metrics, the operator is ticked by GXFWrapper::tick(), which scans the depths of the input
+ * queues, each holding one message, and records the metrics of the tick. Without metrics,
+ * compute() is called directly with the contexts reused by GXFWrapper, so that the difference
+ * between the two is the cost of the metrics per tick.
+ *
+ * Benchmark arguments: whether metrics are recorded and number of input ports of the operator.
+ */
+void BM_OperatorTick(benchmark::State& state) {
+  const bool record_metrics = state.range(0) != 0;
+  const int64_t num_inputs = state.range(1);
+
+  Fragment fragment;
+  auto op = fragment.make_operator<EmptyComputeOp>("op", num_inputs);
+
+  if (record_metrics) {
+    if (!fragment.executor().extension_manager()->load_extension("libgxf_std.so")) {
+      state.SkipWithError("Failed to load the GXF std extension");
+      return;
+    }
+    QueuedInputs queued_inputs(fragment.executor().context(), num_inputs);
+    if (queued_inputs.receivers().size() != static_cast<size_t>(num_inputs)) {
+      state.SkipWithError("Failed to create the receivers of the input ports");
+      return;
+    }
+    gxf::GXFWrapper wrapper;
+    wrapper.set_operator(op.get());
+    if (wrapper.start() != GXF_SUCCESS) {
+      state.SkipWithError("GXFWrapper::start() failed");
+      return;
+    }
+    // start() clears the handles of the ports without connectors, so connect them afterwards
+    for (int64_t i = 0; i < num_inputs; ++i) {
+      op->spec()->inputs().at(fmt::format("in{}", i))->connector_handle(
+          queued_inputs.receivers()[i]);
+    }
+    for (auto _ : state) { benchmark::DoNotOptimize(wrapper.tick()); }
+    wrapper.stop();
+  } else {
+    gxf::GXFExecutionContext exec_context(nullptr, op.get());
+    InputContext* op_input = exec_context.input();
+    OutputContext* op_output = exec_context.output();
+    for (auto _ : state) { op->compute(*op_input, *op_output, exec_context); }
+  }
+}
+
+bool register_operator_metrics_benchmarks() {
+  benchmark::RegisterBenchmark("BM_OperatorMetrics/record_tick", BM_OperatorMetricsRecordTick);
+  auto* bench = benchmark::RegisterBenchmark("BM_OperatorTick", BM_OperatorTick);
+  bench->ArgNames({"metrics", "inputs"});
+  for (int64_t metrics : {0, 1}) {
+    for (int64_t inputs : {0, 1, 4}) { bench->Args({metrics, inputs}); }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool operator_metrics_benchmarks_registered =
+    register_operator_metrics_benchmarks();
+
+}  // namespace
+
+}  // namespace holoscan::benchmarks
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <holoinfer.hpp>
+
+// Latency of the generate_boxes transform on synthetic detector outputs, with the legacy
+// first-come selection and with top-K selection and non-max suppression.
+
+namespace holoscan::benchmarks {
+
+namespace {
+
+namespace HoloInfer = holoscan::inference;
+
+constexpr int kClasses = 8;
+
+/// Writes the label file and the generate_boxes configuration, returns the configuration path
+std::string write_config(bool top_k_nms) {
+  auto directory = std::filesystem::temp_directory_path() /
+                   (top_k_nms ? "holoscan_bench_boxes_nms" : "holoscan_bench_boxes");
+  std::filesystem::create_directories(directory);
+  std::ofstream labels(directory / "labels.txt");
+  for (int i = 0; i < kClasses; i++) { labels << "class" << i << "\n"; }
+
+  auto config_path = directory / "postprocessing.yaml";
+  std::ofstream config(config_path);
+  config << "generate_boxes:\n"
+            "  params:\n"
+            "    label_file: labels.txt\n"
+            "    threshold: 0.5\n";
+  if (top_k_nms) {
+    config << "    top_k: 200\n"
+              "    nms_threshold: 0.45\n";
+  }
+  config << "  objects:\n";
+  for (int i = 0; i < kClasses; i++) { config << "    class" << i << ": 10\n"; }
+  config << "  display:\n"
+            "    width: 1920\n"
+            "    height: 1080\n";
+  return config_path.string();
+}
+
+void BM_GenerateBoxes(benchmark::State& state, bool top_k_nms) {
+  const size_t anchors = static_cast<size_t>(state.range(0));
+  const std::string tensors = "bench_scores:bench_labels:bench_boxes";
+
+  auto scores = std::make_shared<HoloInfer::DataBuffer>();
+  auto labels = std::make_shared<HoloInfer::DataBuffer>(HoloInfer::holoinfer_datatype::h_Int64);
+  auto boxes = std::make_shared<HoloInfer::DataBuffer>();
+  scores->host_buffer.resize(anchors);
+  labels->host_buffer.resize(anchors);
+  boxes->host_buffer.resize(anchors * 4);
+
+  // Anchors are clustered around a few objects, as produced by a detector before suppression
+  auto score_data = static_cast<float*>(scores->host_buffer.data());
+  auto label_data = static_cast<int64_t*>(labels->host_buffer.data());
+  auto box_data = static_cast<float*>(boxes->host_buffer.data());
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> score_distribution(0.0f, 1.0f);
+  std::uniform_real_distribution<float> center_distribution(0.0f, 1.0f);
+  std::normal_distribution<float> jitter(0.0f, 8.0f);
+  std::vector<float> centers(64 * 2);
+  for (auto& c : centers) { c = center_distribution(generator); }
+  for (size_t i = 0; i < anchors; i++) {
+    const size_t object = i % 64;
+    const float x = centers[2 * object] * 1800 + jitter(generator);
+    const float y = centers[2 * object + 1] * 1000 + jitter(generator);
+    score_data[i] = score_distribution(generator);
+    label_data[i] = 1 + static_cast<int64_t>(object % kClasses);
+    box_data[4 * i] = x;
+    box_data[4 * i + 1] = y;
+    box_data[4 * i + 2] = x + 80 + jitter(generator);
+    box_data[4 * i + 3] = y + 60 + jitter(generator);
+  }
+
+  HoloInfer::MultiMappings operations = {{tensors, {"generate_boxes"}}};
+  HoloInfer::DataMap data_map = {
+      {"bench_scores", scores}, {"bench_labels", labels}, {"bench_boxes", boxes}};
+  std::map<std::string, std::vector<int>> dims_map = {
+      {"bench_scores", {1, static_cast<int>(anchors)}},
+      {"bench_labels", {1, static_cast<int>(anchors)}},
+      {"bench_boxes", {1, static_cast<int>(anchors), 4}}};
+
+  auto context = std::make_unique<HoloInfer::ProcessorContext>();
+  auto status = context->initialize(operations, write_config(top_k_nms));
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+    state.SkipWithError(status.get_message().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    status = context->process(operations, {}, data_map, dims_map);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      state.SkipWithError(status.get_message().c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(anchors));
+}
+
+bool register_generate_boxes_benchmarks() {
+  for (bool top_k_nms : {false, true}) {
+    auto name = std::string("BM_GenerateBoxes/") + (top_k_nms ? "top_k_nms" : "legacy");
+    benchmark::RegisterBenchmark(name.c_str(), BM_GenerateBoxes, top_k_nms)
+        ->Arg(8400)
+        ->Arg(25200)
+        ->Arg(100000)
+        ->Unit(benchmark::kMicrosecond);
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool generate_boxes_benchmarks_registered =
+    register_generate_boxes_benchmarks();
+
+}  // namespace
+
+}  // namespace holoscan::benchmarks
@@ -0,0 +1,928 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime_api.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gxf/std/tensor.hpp>
+#include <holoinfer.hpp>
+#include <holoscan/holoscan.hpp>
+#include <holoscan/utils/holoinfer_utils.hpp>
+
+// Runs the models of an InferenceOp configuration in a minimal application, on synthetic or
+// replayed tensors, and reports the latency of each stage of a frame.
+
+namespace {
+
+namespace HoloInfer = holoscan::inference;
+
+constexpr const char* kUsage = R"(Usage: holoinfer_bench <config.yaml> [options]
+
+Runs the models of an InferenceOp configuration on synthetic or replayed tensors and reports the
+throughput and the latency of each stage of a frame.
+
+Options:
+  --inference <key>        Key of the InferenceOp settings (default: inference)
+  --processor <key>        Key of the InferenceProcessorOp settings applied to the inferred
+                           tensors, processing is skipped without it
+  --data <dir>             Directory of the relative model and processing configuration paths
+  --input <tensor>=<file>  Replays the frames stored back to back in a raw file, in the data type
+                           of the model input, instead of random data
+  --frames <n>             Number of measured frames (default: 1000)
+  --warmup <n>             Number of frames run before measuring (default: 20)
+  --json <file>            Writes the results as JSON
+  --verbose                Keeps the HoloInfer logs
+)";
+
+constexpr const char* kModule = "holoinfer_bench";
+
+/// Stages of a frame, in order
+enum Stage : size_t {
+  kUpload,
+  kExtract,
+  kInference,
+  kTransmit,
+  kProcessExtract,
+  kProcessing,
+  kProcessTransmit,
+  kStageCount
+};
+constexpr const char* kStageNames[kStageCount] = {"upload",
+                                                  "extract",
+                                                  "inference",
+                                                  "transmit",
+                                                  "process_extract",
+                                                  "processing",
+                                                  "process_transmit"};
+
+struct Options {
+  std::string config_path;
+  std::string inference_key = "inference";
+  std::string processor_key;
+  std::string data_dir;
+  std::map<std::string, std::string> input_files;
+  size_t frames = 1000;
+  size_t warmup = 20;
+  std::string json_path;
+  bool verbose = false;
+};
+
+/// Settings of InferenceOp and InferenceProcessorOp used by the tool
+struct Settings {
+  std::shared_ptr<HoloInfer::InferenceSpecs> specs;
+  std::vector<std::string> in_tensor_names;
+  std::vector<std::string> out_tensor_names;
+  bool transmit_on_cuda = false;
+  bool process = false;
+  HoloInfer::MultiMappings process_operations;
+  HoloInfer::MultiMappings processed_map;
+  std::string process_config_path;
+  bool fuse_operations = false;
+  std::vector<std::string> process_in_tensor_names;
+  std::vector<std::string> process_out_tensor_names;
+  bool process_transmit_on_cuda = false;
+};
+
+/// Input tensor fed to the models, frames are used in turn
+struct InputTensor {
+  std::string name;
+  HoloInfer::holoinfer_datatype dtype = HoloInfer::holoinfer_datatype::h_Float32;
+  nvidia::gxf::PrimitiveType element_type = nvidia::gxf::PrimitiveType::kFloat32;
+  nvidia::gxf::Shape shape;
+  size_t frame_bytes = 0;
+  size_t frame_count = 0;
+  std::vector<HoloInfer::byte> frames;
+};
+
+using Clock = std::chrono::steady_clock;
+
+/// Stage latencies of every frame, written by the operators of the application
+struct Recording {
+  explicit Recording(size_t frame_count)
+      : stage_ms(frame_count), frame_start(frame_count), frame_end(frame_count) {}
+
+  std::vector<std::array<double, kStageCount>> stage_ms;
+  std::vector<Clock::time_point> frame_start;
+  std::vector<Clock::time_point> frame_end;
+  size_t completed = 0;
+};
+
+struct Summary {
+  double mean = 0.0;
+  double p50 = 0.0;
+  double p99 = 0.0;
+  double max = 0.0;
+};
+
+/// Milliseconds elapsed since start, start is moved to now
+double lap_ms(Clock::time_point& start) {
+  const auto now = Clock::now();
+  const double ms = std::chrono::duration<double, std::milli>(now - start).count();
+  start = now;
+  return ms;
+}
+
+bool has_cuda_device() {
+  int count = 0;
+  return cudaGetDeviceCount(&count) == cudaSuccess && count > 0;
+}
+
+template <typename T>
+T get_value(const YAML::Node& node, const char* key, const T& default_value) {
+  return node[key] ? node[key].as<T>() : default_value;
+}
+
+HoloInfer::Mappings get_map(const YAML::Node& node, const char* key) {
+  HoloInfer::Mappings map;
+  if (!node[key]) { return map; }
+  for (const auto& entry : node[key]) {
+    map[entry.first.as<std::string>()] = entry.second.as<std::string>();
+  }
+  return map;
+}
+
+/// Values are lists of names, or a single name as accepted by the operators
+HoloInfer::MultiMappings get_vector_map(const YAML::Node& node, const char* key) {
+  HoloInfer::MultiMappings map;
+  if (!node[key]) { return map; }
+  for (const auto& entry : node[key]) {
+    auto name = entry.first.as<std::string>();
+    if (entry.second.IsSequence()) {
+      map[name] = entry.second.as<std::vector<std::string>>();
+    } else {
+      map[name] = {entry.second.as<std::string>()};
+    }
+  }
+  return map;
+}
+
+/// Tensor names of the settings, or the names of a map when they are not given
+std::vector<std::string> get_names(const YAML::Node& node, const char* key,
+                                   const HoloInfer::MultiMappings& map, bool use_values) {
+  if (node[key]) { return node[key].as<std::vector<std::string>>(); }
+  std::vector<std::string> names;
+  for (const auto& [name, values] : map) {
+    if (!use_values) {
+      names.push_back(name);
+      continue;
+    }
+    for (const auto& value : values) {
+      if (std::find(names.begin(), names.end(), value) == names.end()) { names.push_back(value); }
+    }
+  }
+  return names;
+}
+
+std::string resolve_path(const std::string& directory, const std::string& path) {
+  if (directory.empty() || std::filesystem::path(path).is_absolute()) { return path; }
+  return (std::filesystem::path(directory) / path).string();
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+    const char* value = nullptr;
+    if (argument == "--verbose") {
+      options.verbose = true;
+      continue;
+    }
+    if (argument.rfind("--", 0) == 0) {
+      value = next();
+      if (!value) {
+        std::fprintf(stderr, "Missing value of %s\n", argument.c_str());
+        return false;
+      }
+    }
+    if (argument == "--inference") {
+      options.inference_key = value;
+    } else if (argument == "--processor") {
+      options.processor_key = value;
+    } else if (argument == "--data") {
+      options.data_dir = value;
+    } else if (argument == "--input") {
+      const std::string input = value;
+      const auto separator = input.find('=');
+      if (separator == std::string::npos) {
+        std::fprintf(stderr, "Expected <tensor>=<file> for --input, got %s\n", value);
+        return false;
+      }
+      options.input_files[input.substr(0, separator)] = input.substr(separator + 1);
+    } else if (argument == "--frames") {
+      options.frames = std::stoul(value);
+    } else if (argument == "--warmup") {
+      options.warmup = std::stoul(value);
+    } else if (argument == "--json") {
+      options.json_path = value;
+    } else if (argument.rfind("--", 0) != 0 && options.config_path.empty()) {
+      options.config_path = argument;
+    } else {
+      std::fprintf(stderr, "Unknown argument %s\n", argument.c_str());
+      return false;
+    }
+  }
+  return !options.config_path.empty() && options.frames > 0;
+}
+
+bool read_settings(const Options& options, Settings& settings) {
+  const auto config = YAML::LoadFile(options.config_path);
+  const auto inference = config[options.inference_key];
+  if (!inference) {
+    std::fprintf(stderr, "No '%s' settings in %s\n", options.inference_key.c_str(),
+                 options.config_path.c_str());
+    return false;
+  }
+
+  auto model_path_map = get_map(inference, "model_path_map");
+  for (auto& [_, path] : model_path_map) { path = resolve_path(options.data_dir, path); }
+
+  // Same defaults as InferenceOp, except that buffers are kept on the host without a GPU
+  const bool cuda = has_cuda_device();
+  settings.specs = std::make_shared<HoloInfer::InferenceSpecs>(
+      get_value<std::string>(inference, "backend", ""),
+      get_map(inference, "backend_map"),
+      model_path_map,
+      get_vector_map(inference, "pre_processor_map"),
+      get_vector_map(inference, "inference_map"),
+      get_map(inference, "device_map"),
+      get_value(inference, "is_engine_path", false),
+      get_value(inference, "infer_on_cpu", false),
+      get_value(inference, "parallel_inference", true),
+      get_value(inference, "enable_fp16", false),
+      get_value(inference, "input_on_cuda", cuda),
+      get_value(inference, "output_on_cuda", cuda));
+  auto& onnx_options = settings.specs->onnx_options_;
+  onnx_options.intra_op_num_threads = get_value(inference, "intra_op_num_threads", 1);
+  onnx_options.inter_op_num_threads = get_value(inference, "inter_op_num_threads", 1);
+  onnx_options.graph_optimization_level =
+      get_value<std::string>(inference, "graph_optimization_level", "extended");
+  onnx_options.execution_mode = get_value<std::string>(inference, "execution_mode", "sequential");
+  onnx_options.use_global_thread_pool = get_value(inference, "use_global_thread_pool", false);
+  onnx_options.optimized_model_cache_dir =
+      get_value<std::string>(inference, "optimized_model_cache_dir", "");
+  settings.in_tensor_names =
+      get_names(inference, "in_tensor_names", settings.specs->pre_processor_map_, true);
+  if (inference["out_tensor_names"]) {
+    settings.out_tensor_names = inference["out_tensor_names"].as<std::vector<std::string>>();
+  }
+  settings.transmit_on_cuda = get_value(inference, "transmit_on_cuda", cuda);
+
+  if (!options.processor_key.empty()) {
+    const auto processor = config[options.processor_key];
+    if (!processor) {
+      std::fprintf(stderr, "No '%s' settings in %s\n", options.processor_key.c_str(),
+                   options.config_path.c_str());
+      return false;
+    }
+    settings.process = true;
+    settings.process_operations = get_vector_map(processor, "process_operations");
+    settings.processed_map = get_vector_map(processor, "processed_map");
+    const auto config_path = get_value<std::string>(processor, "config_path", "");
+    if (!config_path.empty()) {
+      settings.process_config_path = resolve_path(options.data_dir, config_path);
+    }
+    settings.fuse_operations = get_value(processor, "fuse_operations", false);
+    settings.process_in_tensor_names =
+        get_names(processor, "in_tensor_names", settings.process_operations, false);
+    settings.process_out_tensor_names =
+        get_names(processor, "out_tensor_names", settings.processed_map, true);
+    settings.process_transmit_on_cuda = get_value(processor, "transmit_on_cuda", false);
+    if (get_value(processor, "input_on_cuda", false) ||
+        get_value(processor, "output_on_cuda", false)) {
+      std::fprintf(stderr, "CUDA based data not supported in processor\n");
+      return false;
+    }
+  }
+
+  const bool uses_cuda = settings.specs->cuda_buffer_in_ || settings.specs->cuda_buffer_out_ ||
+                         settings.transmit_on_cuda || settings.process_transmit_on_cuda;
+  if (uses_cuda && !cuda) {
+    std::fprintf(stderr,
+                 "No CUDA device: input_on_cuda, output_on_cuda and transmit_on_cuda must be "
+                 "false\n");
+    return false;
+  }
+  return true;
+}
+
+/// GXF element type of the tensors received for a HoloInfer data type
+bool get_element_type(HoloInfer::holoinfer_datatype dtype, nvidia::gxf::PrimitiveType& type) {
+  switch (dtype) {
+    case HoloInfer::holoinfer_datatype::h_Float32:
+      type = nvidia::gxf::PrimitiveType::kFloat32;
+      return true;
+    case HoloInfer::holoinfer_datatype::h_Int8:
+      type = nvidia::gxf::PrimitiveType::kInt8;
+      return true;
+    case HoloInfer::holoinfer_datatype::h_Int32:
+      type = nvidia::gxf::PrimitiveType::kInt32;
+      return true;
+    case HoloInfer::holoinfer_datatype::h_Int64:
+      type = nvidia::gxf::PrimitiveType::kInt64;
+      return true;
+    case HoloInfer::holoinfer_datatype::h_UInt8:
+      type = nvidia::gxf::PrimitiveType::kUnsigned8;
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// GXF shape of a tensor, with up to 4 dimensions as transmitted by the operators
+bool get_shape(const std::vector<int64_t>& dims, nvidia::gxf::Shape& shape) {
+  const std::vector<int32_t> d(dims.begin(), dims.end());
+  switch (d.size()) {
+    case 1:
+      shape = nvidia::gxf::Shape{d[0]};
+      return true;
+    case 2:
+      shape = nvidia::gxf::Shape{d[0], d[1]};
+      return true;
+    case 3:
+      shape = nvidia::gxf::Shape{d[0], d[1], d[2]};
+      return true;
+    case 4:
+      shape = nvidia::gxf::Shape{d[0], d[1], d[2], d[3]};
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T, typename Distribution>
+void fill_values(std::vector<HoloInfer::byte>& frames, Distribution& distribution,
+                 std::mt19937& generator) {
+  auto* values = reinterpret_cast<T*>(frames.data());
+  for (size_t i = 0; i < frames.size() / sizeof(T); i++) {
+    values[i] = static_cast<T>(distribution(generator));
+  }
+}
+
+/// Fills the frames with random values of the data type of the tensor
+void fill_random(InputTensor& input, std::mt19937& generator) {
+  std::normal_distribution<float> real(0.0f, 1.0f);
+  std::uniform_int_distribution<int> integer(0, 127);
+  switch (input.dtype) {
+    case HoloInfer::holoinfer_datatype::h_Float32:
+      fill_values<float>(input.frames, real, generator);
+      break;
+    case HoloInfer::holoinfer_datatype::h_Int8:
+      fill_values<int8_t>(input.frames, integer, generator);
+      break;
+    case HoloInfer::holoinfer_datatype::h_Int32:
+      fill_values<int32_t>(input.frames, integer, generator);
+      break;
+    case HoloInfer::holoinfer_datatype::h_Int64:
+      fill_values<int64_t>(input.frames, integer, generator);
+      break;
+    default:
+      fill_values<uint8_t>(input.frames, integer, generator);
+      break;
+  }
+}
+
+/// Creates the input tensors of all models, in the data type of the models, with random data or
+/// frames read from files
+bool create_inputs(const Options& options, const Settings& settings,
+                   const HoloInfer::DimType& input_dims, const HoloInfer::DataTypeMap& input_types,
+                   std::vector<InputTensor>& inputs) {
+  std::mt19937 generator(5);
+
+  for (const auto& [model_name, tensor_names] : settings.specs->pre_processor_map_) {
+    const auto& model_dims = input_dims.at(model_name);
+    const auto& model_types = input_types.at(model_name);
+    for (size_t t = 0; t < tensor_names.size() && t < model_dims.size(); t++) {
+      const auto& name = tensor_names[t];
+      auto same_name = [&name](const InputTensor& input) { return input.name == name; };
+      if (std::any_of(inputs.begin(), inputs.end(), same_name)) { continue; }
+
+      InputTensor input;
+      input.name = name;
+      input.dtype = model_types.at(t);
+      if (!get_element_type(input.dtype, input.element_type)) {
+        std::fprintf(stderr, "Tensor %s has an unsupported data type\n", name.c_str());
+        return false;
+      }
+      if (std::any_of(model_dims[t].begin(), model_dims[t].end(), [](auto dim) {
+            return dim <= 0;
+          })) {
+        std::fprintf(stderr, "Tensor %s has a dynamic dimension\n", name.c_str());
+        return false;
+      }
+      if (!get_shape(model_dims[t], input.shape)) {
+        std::fprintf(stderr, "Tensor %s has more than 4 dimensions\n", name.c_str());
+        return false;
+      }
+      input.frame_bytes = input.shape.size() * HoloInfer::get_element_size(input.dtype);
+
+      auto file = options.input_files.find(name);
+      if (file != options.input_files.end()) {
+        const auto bytes = std::filesystem::file_size(file->second);
+        if (bytes == 0 || bytes % input.frame_bytes != 0) {
+          std::fprintf(stderr, "%s does not hold frames of %zu bytes for tensor %s\n",
+                       file->second.c_str(), input.frame_bytes, name.c_str());
+          return false;
+        }
+        input.frame_count = bytes / input.frame_bytes;
+        input.frames.resize(bytes);
+        std::ifstream stream(file->second, std::ios::binary);
+        stream.read(reinterpret_cast<char*>(input.frames.data()), bytes);
+      } else {
+        // a few different frames, the data is not compressed or cached across frames
+        input.frame_count = 4;
+        input.frames.resize(input.frame_count * input.frame_bytes);
+        fill_random(input, generator);
+      }
+      inputs.push_back(std::move(input));
+    }
+  }
+  return true;
+}
+
+/// Emits the frames of the input tensors, copied to the device when the models take their
+/// inputs on CUDA as sent by an upstream GPU operator
+class FrameSourceOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameSourceOp)
+
+  FrameSourceOp() = default;
+  FrameSourceOp(std::vector<InputTensor>* inputs, bool on_device, Recording* recording)
+      : inputs_(inputs), on_device_(on_device), recording_(recording) {}
+
+  void setup(holoscan::OperatorSpec& spec) override {
+    spec.output<holoscan::gxf::Entity>("out");
+  }
+
+  void start() override {
+    if (!on_device_) { return; }
+    for (const auto& input : *inputs_) {
+      void* data = nullptr;
+      const auto result = cudaMalloc(&data, input.frame_bytes);
+      if (result != cudaSuccess) {
+        throw std::runtime_error(std::string("cudaMalloc failed: ") + cudaGetErrorString(result));
+      }
+      device_frames_.emplace_back(data, cudaFree);
+    }
+  }
+
+  void stop() override { device_frames_.clear(); }
+
+  void compute(holoscan::InputContext&, holoscan::OutputContext& op_output,
+               holoscan::ExecutionContext& context) override {
+    const size_t frame = frame_++;
+    auto start = Clock::now();
+    recording_->frame_start[frame] = start;
+
+    auto message = nvidia::gxf::Entity::New(context.context());
+    if (!message) { throw std::runtime_error("Input message allocation failed"); }
+    for (size_t i = 0; i < inputs_->size(); i++) {
+      auto& input = (*inputs_)[i];
+      void* data = input.frames.data() + (frame % input.frame_count) * input.frame_bytes;
+      auto storage_type = nvidia::gxf::MemoryStorageType::kHost;
+      if (on_device_) {
+        const auto result = cudaMemcpy(
+            device_frames_[i].get(), data, input.frame_bytes, cudaMemcpyHostToDevice);
+        if (result != cudaSuccess) {
+          throw std::runtime_error(std::string("Input upload failed: ") +
+                                   cudaGetErrorString(result));
+        }
+        data = device_frames_[i].get();
+        storage_type = nvidia::gxf::MemoryStorageType::kDevice;
+      }
+
+      // the frames outlive the messages, the tensors only reference them
+      auto tensor = message.value().add<nvidia::gxf::Tensor>(input.name.c_str());
+      const auto element_size = nvidia::gxf::PrimitiveTypeSize(input.element_type);
+      if (!tensor || !tensor.value()->wrapMemory(
+                         input.shape,
+                         input.element_type,
+                         element_size,
+                         nvidia::gxf::ComputeTrivialStrides(input.shape, element_size),
+                         storage_type,
+                         data,
+                         [](void*) { return nvidia::gxf::Success; })) {
+        throw std::runtime_error("Input tensor creation failed for " + input.name);
+      }
+    }
+    recording_->stage_ms[frame][kUpload] = lap_ms(start);
+
+    auto result = holoscan::gxf::Entity(std::move(message.value()));
+    op_output.emit(result, "out");
+  }
+
+ private:
+  std::vector<InputTensor>* inputs_ = nullptr;
+  bool on_device_ = false;
+  Recording* recording_ = nullptr;
+  std::vector<std::shared_ptr<void>> device_frames_;
+  size_t frame_ = 0;
+};
+
+/// Runs the data extraction, inference and transmission of InferenceOp
+class InferenceStagesOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(InferenceStagesOp)
+
+  InferenceStagesOp() = default;
+  InferenceStagesOp(Settings* settings, HoloInfer::InferContext* infer_context,
+                    Recording* recording)
+      : settings_(settings), infer_context_(infer_context), recording_(recording) {}
+
+  void setup(holoscan::OperatorSpec& spec) override {
+    spec.output<holoscan::gxf::Entity>("transmitter");
+    spec.param(allocator_, "allocator", "Allocator", "Output Allocator");
+    spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
+    cuda_stream_handler_.define_params(spec);
+  }
+
+  void compute(holoscan::InputContext& op_input, holoscan::OutputContext& op_output,
+               holoscan::ExecutionContext& context) override {
+    auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
+                                                                         allocator_->gxf_cid());
+    auto cont = context.context();
+    auto& specs = *settings_->specs;
+    auto& ms = recording_->stage_ms[frame_++];
+    auto start = Clock::now();
+
+    auto stat = holoscan::utils::get_data_per_model(op_input,
+                                                    settings_->in_tensor_names,
+                                                    specs.data_per_tensor_,
+                                                    dims_per_tensor_,
+                                                    specs.cuda_buffer_in_,
+                                                    kModule,
+                                                    cont,
+                                                    cuda_stream_handler_);
+    if (stat != GXF_SUCCESS) { throw std::runtime_error("Data extraction failed"); }
+    ms[kExtract] = lap_ms(start);
+
+    auto status = infer_context_->execute_inference(specs.data_per_tensor_,
+                                                    specs.output_per_model_);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      throw std::runtime_error("Inference failed: " + status.get_message());
+    }
+    // release the input tensors referenced without copy, as done by the operator
+    for (auto& [_, buffer] : specs.data_per_tensor_) {
+      if (buffer->host_buffer.is_borrowed()) { buffer->host_buffer.clear(); }
+    }
+    ms[kInference] = lap_ms(start);
+
+    auto output_dims = infer_context_->get_output_dimensions();
+    stat = holoscan::utils::transmit_data_per_model(cont,
+                                                    specs.inference_map_,
+                                                    specs.output_per_model_,
+                                                    op_output,
+                                                    settings_->out_tensor_names,
+                                                    output_dims,
+                                                    specs.cuda_buffer_out_,
+                                                    settings_->transmit_on_cuda,
+                                                    allocator.value(),
+                                                    kModule,
+                                                    cuda_stream_handler_);
+    if (stat != GXF_SUCCESS) { throw std::runtime_error("Data transmission failed"); }
+    ms[kTransmit] = lap_ms(start);
+  }
+
+ private:
+  holoscan::Parameter<std::shared_ptr<holoscan::Allocator>> allocator_;
+  holoscan::Parameter<std::vector<holoscan::IOSpec*>> receivers_;
+  holoscan::CudaStreamHandler cuda_stream_handler_;
+  std::map<std::string, std::vector<int>> dims_per_tensor_;
+  Settings* settings_ = nullptr;
+  HoloInfer::InferContext* infer_context_ = nullptr;
+  Recording* recording_ = nullptr;
+  size_t frame_ = 0;
+};
+
+/// Runs the data extraction, processing and transmission of InferenceProcessorOp
+class ProcessorStagesOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ProcessorStagesOp)
+
+  ProcessorStagesOp() = default;
+  ProcessorStagesOp(Settings* settings, HoloInfer::ProcessorContext* processor_context,
+                    Recording* recording)
+      : settings_(settings), processor_context_(processor_context), recording_(recording) {}
+
+  void setup(holoscan::OperatorSpec& spec) override {
+    spec.output<holoscan::gxf::Entity>("transmitter");
+    spec.param(allocator_, "allocator", "Allocator", "Output Allocator");
+    spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
+    cuda_stream_handler_.define_params(spec);
+  }
+
+  void compute(holoscan::InputContext& op_input, holoscan::OutputContext& op_output,
+               holoscan::ExecutionContext& context) override {
+    auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
+                                                                         allocator_->gxf_cid());
+    auto cont = context.context();
+    auto& ms = recording_->stage_ms[frame_++];
+    auto start = Clock::now();
+
+    // processing is done on the host
+    auto stat = holoscan::utils::get_data_per_model(op_input,
+                                                    settings_->process_in_tensor_names,
+                                                    data_per_tensor_,
+                                                    dims_per_tensor_,
+                                                    false,
+                                                    kModule,
+                                                    cont,
+                                                    cuda_stream_handler_);
+    if (stat != GXF_SUCCESS) { throw std::runtime_error("Processor data extraction failed"); }
+    ms[kProcessExtract] = lap_ms(start);
+
+    auto status = processor_context_->process(
+        settings_->process_operations, settings_->processed_map, data_per_tensor_,
+        dims_per_tensor_);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      throw std::runtime_error("Processing failed: " + status.get_message());
+    }
+    data_per_tensor_.clear();
+    dims_per_tensor_.clear();
+    ms[kProcessing] = lap_ms(start);
+
+    auto processed_data = processor_context_->get_processed_data();
+    auto processed_dims = processor_context_->get_processed_data_dims();
+    if (processed_data.empty()) {
+      throw std::runtime_error("Processing did not produce tensors to transmit");
+    }
+    stat = holoscan::utils::transmit_data_per_model(cont,
+                                                    settings_->processed_map,
+                                                    processed_data,
+                                                    op_output,
+                                                    settings_->process_out_tensor_names,
+                                                    processed_dims,
+                                                    false,
+                                                    settings_->process_transmit_on_cuda,
+                                                    allocator.value(),
+                                                    kModule,
+                                                    cuda_stream_handler_);
+    if (stat != GXF_SUCCESS) { throw std::runtime_error("Processor data transmission failed"); }
+    ms[kProcessTransmit] = lap_ms(start);
+  }
+
+ private:
+  holoscan::Parameter<std::shared_ptr<holoscan::Allocator>> allocator_;
+  holoscan::Parameter<std::vector<holoscan::IOSpec*>> receivers_;
+  holoscan::CudaStreamHandler cuda_stream_handler_;
+  HoloInfer::DataMap data_per_tensor_;
+  std::map<std::string, std::vector<int>> dims_per_tensor_;
+  Settings* settings_ = nullptr;
+  HoloInfer::ProcessorContext* processor_context_ = nullptr;
+  Recording* recording_ = nullptr;
+  size_t frame_ = 0;
+};
+
+/// Consumes the output messages, completing the frames
+class FrameSinkOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameSinkOp)
+
+  FrameSinkOp() = default;
+  explicit FrameSinkOp(Recording* recording) : recording_(recording) {}
+
+  void setup(holoscan::OperatorSpec& spec) override { spec.input<holoscan::gxf::Entity>("in"); }
+
+  void compute(holoscan::InputContext& op_input, holoscan::OutputContext&,
+               holoscan::ExecutionContext&) override {
+    op_input.receive<holoscan::gxf::Entity>("in");
+    recording_->frame_end[recording_->completed++] = Clock::now();
+  }
+
+ private:
+  Recording* recording_ = nullptr;
+};
+
+/// source -> inference stages [-> processor stages] -> sink
+class BenchApp : public holoscan::Application {
+ public:
+  BenchApp(Settings* settings, HoloInfer::InferContext* infer_context,
+           HoloInfer::ProcessorContext* processor_context, std::vector<InputTensor>* inputs,
+           Recording* recording)
+      : settings_(settings),
+        infer_context_(infer_context),
+        processor_context_(processor_context),
+        inputs_(inputs),
+        recording_(recording) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto allocator = make_resource<UnboundedAllocator>("allocator");
+    auto source = make_operator<FrameSourceOp>(
+        "source", inputs_, settings_->specs->cuda_buffer_in_, recording_);
+    source->add_arg(make_condition<CountCondition>(
+        "count", static_cast<int64_t>(recording_->frame_start.size())));
+    auto inference =
+        make_operator<InferenceStagesOp>("inference", settings_, infer_context_, recording_);
+    inference->add_arg(Arg("allocator", allocator));
+    auto sink = make_operator<FrameSinkOp>("sink", recording_);
+
+    add_flow(source, inference, {{"out", "receivers"}});
+    if (processor_context_) {
+      auto processor = make_operator<ProcessorStagesOp>(
+          "processor", settings_, processor_context_, recording_);
+      processor->add_arg(Arg("allocator", allocator));
+      add_flow(inference, processor, {{"transmitter", "receivers"}});
+      add_flow(processor, sink, {{"transmitter", "in"}});
+    } else {
+      add_flow(inference, sink, {{"transmitter", "in"}});
+    }
+  }
+
+ private:
+  Settings* settings_;
+  HoloInfer::InferContext* infer_context_;
+  HoloInfer::ProcessorContext* processor_context_;
+  std::vector<InputTensor>* inputs_;
+  Recording* recording_;
+};
+
+Summary summarize(std::vector<double> values) {
+  Summary summary;
+  if (values.empty()) { return summary; }
+  std::sort(values.begin(), values.end());
+  auto rank = [&values](double percentile) {
+    const auto index = static_cast<size_t>(std::ceil(percentile * values.size()));
+    return values[std::min(std::max<size_t>(index, 1), values.size()) - 1];
+  };
+  for (double value : values) { summary.mean += value; }
+  summary.mean /= values.size();
+  summary.p50 = rank(0.5);
+  summary.p99 = rank(0.99);
+  summary.max = values.back();
+  return summary;
+}
+
+std::string json_string(const std::string& value) {
+  std::string escaped = "\"";
+  for (char c : value) {
+    if (c == '"' || c == '\\') { escaped += '\\'; }
+    escaped += c;
+  }
+  return escaped + "\"";
+}
+
+std::string json_summary(const Summary& summary) {
+  char text[160];
+  std::snprintf(text, sizeof(text),
+                "{\"mean_ms\": %.4f, \"p50_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f}",
+                summary.mean, summary.p50, summary.p99, summary.max);
+  return text;
+}
+
+int run(const Options& options) {
+  Settings settings;
+  if (!read_settings(options, settings)) { return 1; }
+  auto& specs = settings.specs;
+
+  auto infer_context = std::make_unique<HoloInfer::InferContext>();
+  auto status = infer_context->set_inference_params(specs);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+    std::fprintf(stderr, "Model setup failed: %s\n", status.get_message().c_str());
+    return 1;
+  }
+
+  std::unique_ptr<HoloInfer::ProcessorContext> processor_context;
+  if (settings.process) {
+    processor_context = std::make_unique<HoloInfer::ProcessorContext>();
+    status = processor_context->initialize(
+        settings.process_operations, settings.process_config_path, settings.fuse_operations);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      std::fprintf(stderr, "Processing setup failed: %s\n", status.get_message().c_str());
+      return 1;
+    }
+  }
+
+  std::vector<InputTensor> inputs;
+  if (!create_inputs(options,
+                     settings,
+                     infer_context->get_input_dimensions(),
+                     infer_context->get_input_datatypes(),
+                     inputs)) {
+    return 1;
+  }
+
+  const size_t frame_count = options.warmup + options.frames;
+  Recording recording(frame_count);
+  auto app = holoscan::make_application<BenchApp>(
+      &settings, infer_context.get(), processor_context.get(), &inputs, &recording);
+  if (!options.verbose) { holoscan::set_log_level(holoscan::LogLevel::WARN); }
+  app->run();
+  if (recording.completed != frame_count) {
+    std::fprintf(stderr, "The application stopped after %zu of %zu frames\n",
+                 recording.completed, frame_count);
+    return 1;
+  }
+
+  // Stages of the processor are only reported when processing is enabled
+  std::vector<size_t> stages;
+  for (size_t stage = 0; stage < kStageCount; stage++) {
+    if (settings.process || stage < kProcessExtract) { stages.push_back(stage); }
+  }
+  std::array<std::vector<double>, kStageCount> stage_ms;
+  std::vector<double> frame_ms;
+  for (size_t frame = options.warmup; frame < frame_count; frame++) {
+    for (size_t stage : stages) { stage_ms[stage].push_back(recording.stage_ms[frame][stage]); }
+    frame_ms.push_back(std::chrono::duration<double, std::milli>(recording.frame_end[frame] -
+                                                                 recording.frame_start[frame])
+                           .count());
+  }
+  const double elapsed_s = std::chrono::duration<double>(recording.frame_end.back() -
+                                                         recording.frame_start[options.warmup])
+                               .count();
+  const double throughput = options.frames / elapsed_s;
+
+  std::array<Summary, kStageCount> stage_summaries;
+  for (size_t stage : stages) { stage_summaries[stage] = summarize(stage_ms[stage]); }
+  const auto frame_summary = summarize(frame_ms);
+  const auto model_timing = infer_context->get_model_timing();
+
+  std::printf("%zu frames, %.1f frames/s\n\n", options.frames, throughput);
+  std::printf("%-16s %10s %10s %10s %10s\n", "stage", "mean ms", "p50 ms", "p99 ms", "max ms");
+  auto print_row = [](const char* name, const Summary& summary) {
+    std::printf("%-16s %10.3f %10.3f %10.3f %10.3f\n",
+                name, summary.mean, summary.p50, summary.p99, summary.max);
+  };
+  for (size_t stage : stages) { print_row(kStageNames[stage], stage_summaries[stage]); }
+  print_row("total", frame_summary);
+  std::printf("\n%-24s %10s %10s\n", "model", "mean ms", "max ms");
+  for (const auto& [model_name, timing] : model_timing) {
+    std::printf("%-24s %10.3f %10.3f\n", model_name.c_str(), timing.average_ms, timing.max_ms);
+  }
+
+  if (!options.json_path.empty()) {
+    std::ofstream json(options.json_path);
+    if (!json) {
+      std::fprintf(stderr, "Cannot write %s\n", options.json_path.c_str());
+      return 1;
+    }
+    json << "{\n  \"config\": " << json_string(options.config_path) << ",\n"
+         << "  \"frames\": " << options.frames << ",\n"
+         << "  \"warmup\": " << options.warmup << ",\n"
+         << "  \"throughput_fps\": " << throughput << ",\n"
+         << "  \"stages\": {\n";
+    for (size_t stage : stages) {
+      json << "    " << json_string(kStageNames[stage]) << ": "
+           << json_summary(stage_summaries[stage]) << ",\n";
+    }
+    json << "    \"total\": " << json_summary(frame_summary) << "\n  },\n  \"models\": {";
+    const char* separator = "\n";
+    for (const auto& [model_name, timing] : model_timing) {
+      json << separator << "    " << json_string(model_name) << ": {\"mean_ms\": "
+           << timing.average_ms << ", \"max_ms\": " << timing.max_ms
+           << ", \"count\": " << timing.count << "}";
+      separator = ",\n";
+    }
+    json << "\n  }\n}\n";
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parse_options(argc, argv, options)) {
+    std::fputs(kUsage, stderr);
+    return 1;
+  }
+  if (!options.verbose) { holoscan::set_log_level(holoscan::LogLevel::WARN); }
+
+  try {
+    return run(options);
+  } catch (const std::exception& e) {
+    std::fprintf(stderr, "holoinfer_bench: %s\n", e.what());
+    return 1;
+  }
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <holoinfer.hpp>
+
+// Throughput of HoloInfer processing operations with and without compiled operation plans
+// ("fused"), on 1080p and 4K tensors, and of multi-stage plans.
+
+namespace holoscan::benchmarks {
+
+namespace {
+
+namespace HoloInfer = holoscan::inference;
+
+struct Resolution {
+  const char* name;
+  int height;
+  int width;
+};
+
+void BM_ProcessOperations(benchmark::State& state, std::string operation, Resolution resolution,
+                          bool fuse_operations) {
+  const std::string in_tensor = "bench_in";
+  const std::string out_tensor = "bench_out";
+  // max_per_channel_scaled expects NHWC data, scale_intensity_cpu single channel CHW data
+  const bool nhwc = operation == "max_per_channel_scaled";
+  const int channels = nhwc ? 4 : 1;
+  const std::vector<int> dims =
+      nhwc ? std::vector<int>{1, resolution.height, resolution.width, channels}
+           : std::vector<int>{1, resolution.height, resolution.width};
+  const size_t size = static_cast<size_t>(resolution.height) * resolution.width * channels;
+
+  auto buffer = std::make_shared<HoloInfer::DataBuffer>();
+  buffer->host_buffer.resize(size);
+  auto data = static_cast<float*>(buffer->host_buffer.data());
+  std::mt19937 generator(7);
+  std::normal_distribution<float> distribution(0.0f, 1.0f);
+  for (size_t i = 0; i < size; i++) { data[i] = distribution(generator); }
+
+  HoloInfer::MultiMappings operations = {{in_tensor, {operation}}};
+  HoloInfer::MultiMappings in_out_map = {{in_tensor, {out_tensor}}};
+  std::map<std::string, std::vector<int>> dims_map = {{in_tensor, dims}};
+  HoloInfer::DataMap data_map = {{in_tensor, buffer}};
+
+  auto context = std::make_unique<HoloInfer::ProcessorContext>();
+  auto status = context->initialize(operations, "", fuse_operations);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+    state.SkipWithError(status.get_message().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    status = context->process(operations, in_out_map, data_map, dims_map);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      state.SkipWithError(status.get_message().c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * sizeof(float)));
+}
+
+/**
+ * @brief Runs a compiled plan of several operations on a NHWC tensor.
+ *
+ * The plan computes max_per_channel_scaled and prints its output twice, the print stages read
+ * the intermediate output of the plan. The printed output is discarded.
+ */
+void BM_ProcessPlanChain(benchmark::State& state, Resolution resolution) {
+  const std::string in_tensor = "bench_in";
+  const std::string out_tensor = "bench_out";
+  const int channels = 4;
+  const std::vector<int> dims = {1, resolution.height, resolution.width, channels};
+  const size_t size = static_cast<size_t>(resolution.height) * resolution.width * channels;
+
+  auto buffer = std::make_shared<HoloInfer::DataBuffer>();
+  buffer->host_buffer.resize(size);
+  auto data = static_cast<float*>(buffer->host_buffer.data());
+  std::mt19937 generator(7);
+  std::normal_distribution<float> distribution(0.0f, 1.0f);
+  for (size_t i = 0; i < size; i++) { data[i] = distribution(generator); }
+
+  HoloInfer::MultiMappings operations = {{in_tensor, {"max_per_channel_scaled", "print", "print"}}};
+  HoloInfer::MultiMappings in_out_map = {{in_tensor, {out_tensor}}};
+  std::map<std::string, std::vector<int>> dims_map = {{in_tensor, dims}};
+  HoloInfer::DataMap data_map = {{in_tensor, buffer}};
+
+  auto context = std::make_unique<HoloInfer::ProcessorContext>();
+  auto status = context->initialize(operations, "", true);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+    state.SkipWithError(status.get_message().c_str());
+    return;
+  }
+
+  std::ostringstream printed;
+  auto* stdout_buffer = std::cout.rdbuf(printed.rdbuf());
+  for (auto _ : state) {
+    status = context->process(operations, in_out_map, data_map, dims_map);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      state.SkipWithError(status.get_message().c_str());
+      break;
+    }
+    printed.str("");
+  }
+  std::cout.rdbuf(stdout_buffer);
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * sizeof(float)));
+}
+
+bool register_process_plan_benchmarks() {
+  const Resolution resolutions[] = {{"1080p", 1080, 1920}, {"4k", 2160, 3840}};
+  for (const char* operation : {"scale_intensity_cpu", "max_per_channel_scaled"}) {
+    for (const auto& resolution : resolutions) {
+      for (bool fuse_operations : {false, true}) {
+        auto name = std::string("BM_ProcessOperations/") + operation + "/" + resolution.name +
+                    (fuse_operations ? "/fused" : "/unfused");
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_ProcessOperations, operation, resolution, fuse_operations)
+            ->Unit(benchmark::kMillisecond);
+      }
+    }
+  }
+  for (const auto& resolution : resolutions) {
+    auto name = std::string("BM_ProcessPlanChain/max_per_channel_scaled+print/") + resolution.name;
+    benchmark::RegisterBenchmark(name.c_str(), BM_ProcessPlanChain, resolution)
+        ->Unit(benchmark::kMillisecond);
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool process_plan_benchmarks_registered =
+    register_process_plan_benchmarks();
+
+}  // namespace
+
+}  // namespace holoscan::benchmarks
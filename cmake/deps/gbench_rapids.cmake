@@ -0,0 +1,22 @@
+# SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# https://docs.rapids.ai/api/rapids-cmake/stable/packages/rapids_cpm_gbench.html
+include(${rapids-cmake-dir}/cpm/gbench.cmake)
+include(${rapids-cmake-dir}/cpm/package_override.cmake)
+
+# Using Google Benchmark 1.8.3
+rapids_cpm_package_override("${CMAKE_SOURCE_DIR}/cmake/deps/rapids-cmake-packages.json")
+rapids_cpm_gbench()
@@ -54,6 +54,11 @@ if(HOLOSCAN_BUILD_TESTS)
     superbuild_depend(gtest_rapids)
 endif()
 
+# Benchmarking dependencies
+if(HOLOSCAN_BUILD_BENCHMARKS)
+    superbuild_depend(gbench_rapids)
+endif()
+
 # Python binding dependencies
 if(HOLOSCAN_BUILD_PYTHON)
     find_package(Python3 REQUIRED COMPONENTS Interpreter Development)
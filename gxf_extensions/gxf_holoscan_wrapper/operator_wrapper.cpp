@@ -303,6 +303,7 @@ gxf_result_t OperatorWrapper::start() {
     HOLOSCAN_LOG_ERROR("OperatorWrapper::start() - Operator is not set");
     return GXF_FAILURE;
   }
+  exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_.get());
   op_->start();
   return GXF_SUCCESS;
 }
@@ -316,10 +317,12 @@ gxf_result_t OperatorWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_.get());
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
-  op_->compute(*op_input, *op_output, exec_context);
+  if (!exec_context_) {
+    exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_.get());
+  }
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+  op_->compute(*op_input, *op_output, *exec_context_);
 
   return GXF_SUCCESS;
 }
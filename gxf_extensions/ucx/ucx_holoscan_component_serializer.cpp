@@ -17,6 +17,7 @@
 
 #include "ucx_holoscan_component_serializer.hpp"
 
+#include <cinttypes>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -28,6 +29,13 @@
 namespace nvidia {
 namespace gxf {
 
+namespace {
+
+/// The `bytes_per_element` of a codec header which carries a codec ID instead of a codec name
+constexpr uint8_t kCodecIdBytesPerElement = 0;
+
+}  // namespace
+
 gxf_result_t UcxHoloscanComponentSerializer::registerInterface(Registrar* registrar) {
   Expected<void> result;
   result &= registrar->parameter(
@@ -66,31 +74,40 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
     const holoscan::Message& message, Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::serializeHoloscanMessage");
 
-  // retrieve the name of the codec corresponding to the data in the Message
+  // retrieve the codec corresponding to the data in the Message
   auto index = std::type_index(message.value().type());
   auto& registry = holoscan::CodecRegistry::get_instance();
-  auto maybe_name = registry.index_to_name(index);
-  if (!maybe_name) {
+  const auto* codec_entry = registry.find_codec(index);
+  if (codec_entry == nullptr) {
     GXF_LOG_ERROR("No codec found for type_index with name: %s", index.name());
     return Unexpected{GXF_FAILURE};
   }
-  std::string codec_name = maybe_name.value();
 
-  // serialize the codec_name of the holoscan::Message codec to retrieve
+  // Serialize the holoscan::Message codec to retrieve. The (unique) codec ID is sent in place of
+  // the codec name: a header with zero bytes per element carries the ID in its size field.
+  // Codecs whose ID collides with another codec are sent by name.
   holoscan::ContiguousDataHeader header;
-  header.size = codec_name.size();
-  header.bytes_per_element = header.size > 0 ? sizeof(codec_name[0]) : 1;
   size_t total_size = 0;
-  auto maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
-  if (!maybe_size) { return ForwardError(maybe_size); }
-  total_size += maybe_size.value();
-  maybe_size = endpoint->write(codec_name.data(), header.size * header.bytes_per_element);
-  if (!maybe_size) { return ForwardError(maybe_size); }
-  total_size += maybe_size.value();
+  if (codec_entry->unique_id) {
+    header.size = codec_entry->id;
+    header.bytes_per_element = kCodecIdBytesPerElement;
+    auto maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
+    if (!maybe_size) { return ForwardError(maybe_size); }
+    total_size += maybe_size.value();
+  } else {
+    const std::string& codec_name = codec_entry->name;
+    header.size = codec_name.size();
+    header.bytes_per_element = sizeof(codec_name[0]);
+    auto maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
+    if (!maybe_size) { return ForwardError(maybe_size); }
+    total_size += maybe_size.value();
+    maybe_size = endpoint->write(codec_name.data(), header.size * header.bytes_per_element);
+    if (!maybe_size) { return ForwardError(maybe_size); }
+    total_size += maybe_size.value();
+  }
 
   // serialize the message contents
-  auto serialize_func = registry.get_serializer(codec_name);
-  maybe_size = serialize_func(message, endpoint);
+  auto maybe_size = codec_entry->codec.first(message, endpoint);
   if (!maybe_size) { return ForwardError(maybe_size); }
   total_size += maybe_size.value();
   return total_size;
@@ -100,17 +117,32 @@ Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeHoloscanM
     Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::deserializeHoloscanMessage");
 
-  // deserialize the type_name of the holoscan::Message codec to retrieve
+  // deserialize the ID or the name of the holoscan::Message codec to retrieve
   holoscan::ContiguousDataHeader header;
   auto header_size = endpoint->readTrivialType<holoscan::ContiguousDataHeader>(&header);
   if (!header_size) { return ForwardError(header_size); }
+
+  auto& registry = holoscan::CodecRegistry::get_instance();
+  if (header.bytes_per_element == kCodecIdBytesPerElement) {
+    const auto codec_id = static_cast<holoscan::CodecRegistry::CodecId>(header.size);
+    const auto* codec_entry = registry.find_codec(codec_id);
+    if (codec_entry == nullptr) {
+      GXF_LOG_ERROR(
+          "No codec found for codec ID 0x%016" PRIx64
+          ". The codec has to be registered with the same name in all fragments.",
+          codec_id);
+      return Unexpected{GXF_FAILURE};
+    }
+    // deserialize the message contents
+    return codec_entry->codec.second(endpoint);
+  }
+
   std::string codec_name;
   codec_name.resize(header.size);
   auto result = endpoint->read(codec_name.data(), header.size * header.bytes_per_element);
   if (!result) { return ForwardError(result); }
 
   // deserialize the message contents
-  auto& registry = holoscan::CodecRegistry::get_instance();
   auto deserialize_func = registry.get_deserializer(codec_name);
   return deserialize_func(endpoint);
 }
@@ -18,10 +18,15 @@
 #ifndef HOLOSCAN_CORE_CODEC_REGISTRY_HPP
 #define HOLOSCAN_CORE_CODEC_REGISTRY_HPP
 
+#include <algorithm>
 #include <complex>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
@@ -67,6 +72,15 @@ class CodecRegistry {
    */
   using Codec = std::pair<SerializeFunc, DeserializeFunc>;
 
+  /**
+   * @brief Compact numeric ID of a codec.
+   *
+   * The ID is derived from the codec name only (see codec_id()), so every process which
+   * registered a codec under the same name computes the same ID without any negotiation. It is
+   * sent over the wire instead of the codec name.
+   */
+  using CodecId = uint64_t;
+
   inline static SerializeFunc none_serialize =
       []([[maybe_unused]] const Message& message,
          [[maybe_unused]] GXFEndpoint* buffer) -> nvidia::gxf::Expected<size_t> {
@@ -129,13 +143,12 @@ class CodecRegistry {
    * @return The reference to the Codec object.
    */
   Codec& get_codec(const std::type_index& index) {
-    auto maybe_name = index_to_name(index);
-    if (!maybe_name) {
+    auto loc = index_to_slot_map_.find(index);
+    if (loc == index_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No codec for type '{}' exists", index.name());
       return CodecRegistry::none_codec;
     }
-    auto& codec = codec_map_[maybe_name.value()];
-    return codec;
+    return codecs_[loc->second].codec;
   }
 
   /**
@@ -145,13 +158,12 @@ class CodecRegistry {
    * @return The reference to the Codec object.
    */
   Codec& get_codec(const std::string& codec_name) {
-    auto loc = codec_map_.find(codec_name);
-    if (loc == codec_map_.end()) {
+    auto loc = name_to_slot_map_.find(codec_name);
+    if (loc == name_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No codec for name '{}' exists", codec_name);
       return CodecRegistry::none_codec;
     }
-    auto& codec = loc->second;
-    return codec;
+    return codecs_[loc->second].codec;
   }
 
   /**
@@ -161,13 +173,12 @@ class CodecRegistry {
    * @return The reference to the Serializer function.
    */
   SerializeFunc& get_serializer(const std::string& codec_name) {
-    auto loc = codec_map_.find(codec_name);
-    if (loc == codec_map_.end()) {
+    auto loc = name_to_slot_map_.find(codec_name);
+    if (loc == name_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No serializer for name '{}' exists", codec_name);
       return CodecRegistry::none_serialize;
     }
-    Codec& codec = loc->second;
-    return codec.first;
+    return codecs_[loc->second].codec.first;
   }
 
   /**
@@ -177,13 +188,12 @@ class CodecRegistry {
    * @return The reference to the Serializer function.
    */
   SerializeFunc& get_serializer(const std::type_index& index) {
-    auto maybe_name = index_to_name(index);
-    if (!maybe_name) {
+    auto loc = index_to_slot_map_.find(index);
+    if (loc == index_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No serializer for type '{}' exists", index.name());
       return CodecRegistry::none_serialize;
     }
-    auto& serializer = codec_map_[maybe_name.value()].first;
-    return serializer;
+    return codecs_[loc->second].codec.first;
   }
 
   /**
@@ -193,13 +203,12 @@ class CodecRegistry {
    * @return The reference to the Deserializer function.
    */
   DeserializeFunc& get_deserializer(const std::string& codec_name) {
-    auto loc = codec_map_.find(codec_name);
-    if (loc == codec_map_.end()) {
+    auto loc = name_to_slot_map_.find(codec_name);
+    if (loc == name_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No deserializer for name '{}' exists", codec_name);
       return CodecRegistry::none_deserialize;
     }
-    Codec& codec = loc->second;
-    return codec.second;
+    return codecs_[loc->second].codec.second;
   }
 
   /**
@@ -209,13 +218,84 @@ class CodecRegistry {
    * @return The reference to the Deserializer function.
    */
   DeserializeFunc& get_deserializer(const std::type_index& index) {
-    auto maybe_name = index_to_name(index);
-    if (!maybe_name) {
+    auto loc = index_to_slot_map_.find(index);
+    if (loc == index_to_slot_map_.end()) {
       HOLOSCAN_LOG_WARN("No deserializer for type '{}' exists", index.name());
       return CodecRegistry::none_deserialize;
     }
-    auto& deserializer = codec_map_[maybe_name.value()].second;
-    return deserializer;
+    return codecs_[loc->second].codec.second;
+  }
+
+  /**
+   * @brief Get the deserializer function of the codec with the given ID.
+   *
+   * The ID is resolved with a binary search in a flat, sorted table, without hashing a string.
+   *
+   * @param id The ID of the codec.
+   * @return The reference to the Deserializer function.
+   */
+  DeserializeFunc& get_deserializer(CodecId id) {
+    auto slot = id_to_slot(id);
+    if (!slot) {
+      HOLOSCAN_LOG_WARN("No deserializer for codec ID '{:#018x}' exists", id);
+      return CodecRegistry::none_deserialize;
+    }
+    return codecs_[slot.value()].codec.second;
+  }
+
+  /**
+   * @brief Compute the ID of a codec from its name (64-bit FNV-1a hash of the name).
+   *
+   * @param codec_name The name of the codec.
+   * @return The ID of the codec.
+   */
+  static constexpr CodecId codec_id(std::string_view codec_name) {
+    CodecId hash = 0xcbf29ce484222325ULL;
+    for (char c : codec_name) {
+      hash ^= static_cast<uint8_t>(c);
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Information about a registered codec.
+   */
+  struct CodecEntry {
+    std::string name;  ///< The name of the codec
+    CodecId id = 0;    ///< The ID of the codec (see codec_id())
+    /// Whether the ID identifies the codec unambiguously. If the ID of another registered codec
+    /// collides with it, the codec is transferred by name instead.
+    bool unique_id = true;
+    Codec codec;  ///< The serialization and deserialization functions
+  };
+
+  /**
+   * @brief Get the information about the codec of a type.
+   *
+   * This resolves the name, ID and functions of the codec with a single lookup, which is what
+   * serializers use on every message.
+   *
+   * @param index The std::type_index corresponding to the parameter.
+   * @return The pointer to the codec information, or nullptr if there is no codec for the type.
+   */
+  const CodecEntry* find_codec(const std::type_index& index) const {
+    auto loc = index_to_slot_map_.find(index);
+    if (loc == index_to_slot_map_.end()) { return nullptr; }
+    return &codecs_[loc->second];
+  }
+
+  /**
+   * @brief Get the information about the codec with the given ID.
+   *
+   * @param id The ID of the codec.
+   * @return The pointer to the codec information, or nullptr if there is no codec with a unique
+   * matching ID.
+   */
+  const CodecEntry* find_codec(CodecId id) const {
+    auto slot = id_to_slot(id);
+    if (!slot) { return nullptr; }
+    return &codecs_[slot.value()];
   }
 
   /**
@@ -280,14 +360,40 @@ class CodecRegistry {
         return;
       }
       if (index != name_search->second) {
-        HOLOSCAN_LOG_ERROR("Existing codec for name '{}' found, but with non-matching type_index.");
+        HOLOSCAN_LOG_ERROR("Existing codec for name '{}' found, but with non-matching type_index.",
+                           codec_name);
       }
       HOLOSCAN_LOG_INFO("Replacing existing codec with name '{}'.", codec_name);
-      codec_map_.erase(codec_name);
+      // Replace the functions in place so that the slot (and the ID table) stays valid
+      codecs_[name_to_slot_map_[codec_name]].codec = std::move(codec);
+      index_to_name_map_.try_emplace(index, codec_name);
+      index_to_slot_map_.try_emplace(index, name_to_slot_map_[codec_name]);
+      return;
     }
     name_to_index_map_.try_emplace(codec_name, index);
     index_to_name_map_.try_emplace(index, codec_name);
-    codec_map_.try_emplace(codec_name, codec);
+
+    const size_t slot = codecs_.size();
+    CodecEntry& entry = codecs_.emplace_back();
+    entry.name = codec_name;
+    entry.id = codec_id(codec_name);
+    entry.codec = std::move(codec);
+    name_to_slot_map_.try_emplace(codec_name, slot);
+    index_to_slot_map_.try_emplace(index, slot);
+
+    // Keep the ID table sorted. Colliding IDs are kept in the table but flagged so that the
+    // codecs are transferred by name and never looked up by ID.
+    auto pos = std::lower_bound(
+        id_table_.begin(), id_table_.end(), std::make_pair(entry.id, size_t{0}));
+    if (pos != id_table_.end() && pos->first == entry.id) {
+      HOLOSCAN_LOG_WARN(
+          "Codec ID of '{}' collides with the codec '{}'. Both codecs are transferred by name.",
+          codec_name,
+          codecs_[pos->second].name);
+      entry.unique_id = false;
+      codecs_[pos->second].unique_id = false;
+    }
+    id_table_.insert(pos, std::make_pair(entry.id, slot));
   }
 
   /**
@@ -301,23 +407,8 @@ class CodecRegistry {
    */
   template <typename typeT>
   void add_codec(const std::string& codec_name, bool overwrite = true) {
-    auto name_search = name_to_index_map_.find(codec_name);
-    auto index = std::type_index(typeid(typeT));
-    if (name_search != name_to_index_map_.end()) {
-      if (!overwrite) {
-        HOLOSCAN_LOG_INFO("Existing codec for name '{}' found.", codec_name);
-        return;
-      }
-      if (index != name_search->second) {
-        HOLOSCAN_LOG_ERROR("Existing codec for name '{}' found, but with non-matching type_index.");
-      }
-      HOLOSCAN_LOG_INFO("Replacing existing codec with name '{}'.", codec_name);
-      codec_map_.erase(codec_name);
-    }
-    name_to_index_map_.try_emplace(codec_name, index);
-    index_to_name_map_.try_emplace(index, codec_name);
-    codec_map_.emplace(
-        codec_name,
+    add_codec(
+        std::type_index(typeid(typeT)),
         std::make_pair(
             [](const Message& data, GXFEndpoint* gxf_endpoint) -> nvidia::gxf::Expected<size_t> {
               try {
@@ -349,7 +440,9 @@ class CodecRegistry {
                                    typeid(typeT).name());
                 return nvidia::gxf::Unexpected(GXF_FAILURE);
               }
-            }));
+            }),
+        codec_name,
+        overwrite);
   }
 
  private:
@@ -473,8 +566,22 @@ class CodecRegistry {
   std::unordered_map<std::string, std::type_index>
       name_to_index_map_;  ///< Mapping from name to type_index
 
-  std::unordered_map<std::string, std::pair<SerializeFunc, DeserializeFunc>>
-      codec_map_;  ///< Map of codec name to codec function pair
+  /// Return the slot of the codec with the given (unique) ID.
+  std::optional<size_t> id_to_slot(CodecId id) const {
+    auto pos = std::lower_bound(id_table_.begin(), id_table_.end(), std::make_pair(id, size_t{0}));
+    if (pos == id_table_.end() || pos->first != id || !codecs_[pos->second].unique_id) {
+      return std::nullopt;
+    }
+    return pos->second;
+  }
+
+  /// Flat storage of the codecs indexed by slot (a deque keeps references to codecs valid when
+  /// new codecs are added)
+  std::deque<CodecEntry> codecs_;
+  std::unordered_map<std::string, size_t> name_to_slot_map_;  ///< Mapping from name to slot
+  std::unordered_map<std::type_index, size_t>
+      index_to_slot_map_;  ///< Mapping from type_index to slot
+  std::vector<std::pair<CodecId, size_t>> id_table_;  ///< (ID, slot) pairs sorted by ID
 };
 
 }  // namespace holoscan
@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_DATAFLOW_TRACE_SINK_HPP
+#define HOLOSCAN_CORE_DATAFLOW_TRACE_SINK_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+constexpr const char* kDefaultTraceFilename = "dataflow_trace.bin";
+constexpr uint64_t kDefaultTraceRingCapacity = 1 << 14;
+constexpr uint64_t kDefaultTraceFlushIntervalMs = 10;
+/// The number of low bits of a trace message ID holding the per-thread message sequence number
+constexpr int kTraceMessageSequenceBits = 40;
+
+/// The magic bytes at the beginning of a binary data flow trace file
+constexpr char kTraceFileMagic[8] = {'H', 'S', 'D', 'F', 'T', 'R', 'C', '\0'};
+/// The version of the binary data flow trace file format
+constexpr uint32_t kTraceFileVersion = 1;
+
+/// The type of a record in a binary data flow trace file
+enum class DataFlowTraceRecordType : uint32_t {
+  kEvent = 1,         ///< A DataFlowTraceEvent follows
+  kOperatorName = 2,  ///< An operator ID (int64), a name length (uint32) and the name follow
+};
+
+/**
+ * @brief A fixed-size binary event of the data flow trace.
+ *
+ * One event is recorded for each operator of each path of a message received by a leaf operator
+ * (or at the end of a cycle).
+ */
+struct DataFlowTraceEvent {
+  uint64_t message_id = 0;      ///< The unique ID of the traced message
+  uint64_t path_hash = 0;       ///< The rolling hash of the operator IDs of the path
+  int64_t operator_id = -1;     ///< The ID of the operator
+  int64_t rec_timestamp = 0;    ///< The receive timestamp of the operator in microseconds
+  int64_t pub_timestamp = 0;    ///< The publish timestamp of the operator in microseconds
+  uint32_t path_index = 0;      ///< The index of the path in the message label
+  uint32_t operator_index = 0;  ///< The index of the operator in the path
+};
+
+static_assert(sizeof(DataFlowTraceEvent) == 48, "DataFlowTraceEvent must be 48 bytes");
+
+/**
+ * @brief Asynchronous sink writing data flow trace events to a compact binary file.
+ *
+ * Every producer thread records events into its own single-producer/single-consumer lock-free
+ * ring buffer, so recording an event never takes a lock or performs I/O. A background writer
+ * thread periodically drains all ring buffers and appends the events to the file. If a ring
+ * buffer is full, the event is dropped and counted instead of stalling the producer. The ring
+ * buffer of a thread is removed once the thread exited and its events were written.
+ *
+ * The binary file can be converted to Chrome trace / Perfetto JSON with the
+ * `convert_dfft_trace_to_chrome_trace.py` script.
+ */
+class DataFlowTraceSink {
+ public:
+  /**
+   * @brief Construct a new DataFlowTraceSink object and start its writer thread.
+   *
+   * @param filename The name of the binary trace file.
+   * @param ring_capacity The capacity (in events) of the ring buffer of each producer thread. It is
+   * rounded up to a power of two.
+   * @param flush_interval_ms The interval in milliseconds at which the writer thread drains the
+   * ring buffers.
+   */
+  explicit DataFlowTraceSink(std::string filename = kDefaultTraceFilename,
+                             uint64_t ring_capacity = kDefaultTraceRingCapacity,
+                             uint64_t flush_interval_ms = kDefaultTraceFlushIntervalMs);
+
+  ~DataFlowTraceSink();
+
+  DataFlowTraceSink(const DataFlowTraceSink&) = delete;
+  DataFlowTraceSink& operator=(const DataFlowTraceSink&) = delete;
+
+  /**
+   * @brief Register the name of an operator so that it can be resolved by the converter.
+   *
+   * @param operator_id The ID of the operator.
+   * @param name The name of the operator.
+   */
+  void register_operator(int64_t operator_id, const std::string& name);
+
+  /**
+   * @brief Record an event into the ring buffer of the calling thread.
+   *
+   * @param event The event to record.
+   * @return true if the event was recorded, false if it was dropped because the ring buffer of the
+   * calling thread was full or the sink is closed.
+   */
+  bool record(const DataFlowTraceEvent& event);
+
+  /**
+   * @brief Return a new, unique message ID.
+   *
+   * The ID is made of the index of the ring buffer of the calling thread (upper bits) and of the
+   * sequence number of the message in this thread (lower kTraceMessageSequenceBits bits), so that
+   * no state is shared with other producer threads.
+   */
+  uint64_t next_message_id();
+
+  /**
+   * @brief Stop the writer thread after draining all recorded events, and close the file.
+   *
+   * Events recorded after close() are dropped.
+   */
+  void close();
+
+  /// Return the number of events written to the file so far.
+  uint64_t written_events() const { return written_events_.load(std::memory_order_relaxed); }
+
+  /// Return the number of events dropped because a ring buffer was full.
+  uint64_t dropped_events() const { return dropped_events_.load(std::memory_order_relaxed); }
+
+  /// Return the number of ring buffers of producer threads which are not removed yet.
+  size_t num_rings();
+
+ private:
+  /// Single-producer/single-consumer ring buffer of events.
+  struct Ring {
+    Ring(uint64_t capacity, uint64_t index)
+        : events(capacity), mask(capacity - 1), index(index) {}
+
+    std::vector<DataFlowTraceEvent> events;
+    const uint64_t mask;
+    const uint64_t index;                    ///< The index of the ring in its sink
+    uint64_t num_messages = 0;               ///< Only accessed by the producer
+    std::atomic<bool> producer_exited{false};  ///< Whether the producer thread exited
+    std::atomic<bool> sink_closed{false};      ///< Whether the sink of the ring is closed
+    alignas(64) std::atomic<uint64_t> head{0};  ///< Next position written by the producer
+    alignas(64) std::atomic<uint64_t> tail{0};  ///< Next position read by the consumer
+  };
+
+  /// The ring buffers of a producer thread, for every sink the thread recorded events into.
+  struct ThreadRings {
+    /// Marks the ring buffers so that the sinks remove them once they are drained.
+    ~ThreadRings();
+
+    std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> rings;  ///< (sink ID, ring) pairs
+  };
+
+  /// Return the ring buffers of the calling thread.
+  static ThreadRings& thread_rings();
+
+  /// Return the ring buffer of the calling thread, creating it if needed.
+  Ring* thread_ring();
+
+  /// The main loop of the writer thread.
+  void writer_loop();
+
+  /// Drain all ring buffers and write their events (and new operator names) to the file.
+  void drain();
+
+  const uint64_t sink_id_;  ///< The unique ID of this sink, used to look up thread-local rings
+  std::string filename_;
+  uint64_t ring_capacity_;
+  uint64_t flush_interval_ms_;
+
+  std::ofstream ofstream_;
+  std::vector<char> write_buffer_;  ///< Only accessed by the writer thread
+
+  std::mutex rings_mutex_;  ///< The mutex for rings_ and next_ring_index_
+  /// The ring buffers of the producer threads. Rings are only removed by drain().
+  std::vector<std::shared_ptr<Ring>> rings_;
+  uint64_t next_ring_index_ = 0;
+
+  std::mutex operator_names_mutex_;  ///< The mutex for operator_names_
+  /// The registered (operator ID, operator name) pairs in registration order
+  std::vector<std::pair<int64_t, std::string>> operator_names_;
+  size_t num_written_operator_names_ = 0;  ///< Only accessed by the writer thread
+
+  std::atomic<uint64_t> written_events_{0};
+  std::atomic<uint64_t> dropped_events_{0};
+
+  std::mutex writer_mutex_;  ///< The mutex for writer_cv_
+  std::condition_variable writer_cv_;
+  std::atomic<bool> closed_{false};
+  std::thread writer_thread_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_DATAFLOW_TRACE_SINK_HPP */
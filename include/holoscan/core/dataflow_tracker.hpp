@@ -20,20 +20,29 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "./dataflow_trace_sink.hpp"
 #include "./forward_def.hpp"
+#include "./latency_histogram.hpp"
 
 namespace holoscan {
 
+namespace gxf {
+class GXFExecutor;
+}  // namespace gxf
+
 constexpr uint64_t kDefaultNumStartMessagesToSkip = 10;
 constexpr uint64_t kDefaultNumLastMessagesToDiscard = 10;
 constexpr int kDefaultLatencyThreshold = 0;
@@ -48,6 +57,10 @@ enum class DataFlowMetric {
   kMinE2ELatency,
   kNumSrcMessages,
   kNumDstMessages,
+  kP50E2ELatency,
+  kP90E2ELatency,
+  kP99E2ELatency,
+  kP999E2ELatency,
 };
 
 static const std::unordered_map<DataFlowMetric, std::string> metricToString = {
@@ -56,7 +69,18 @@ static const std::unordered_map<DataFlowMetric, std::string> metricToString = {
     {DataFlowMetric::kAvgE2ELatency, "Avg end-to-end Latency (ms)"},
     {DataFlowMetric::kMinE2ELatency, "Min end-to-end Latency (ms)"},
     {DataFlowMetric::kMinMessageID, "Min Latency Message No"},
-    {DataFlowMetric::kNumDstMessages, "Number of messages"}};
+    {DataFlowMetric::kNumDstMessages, "Number of messages"},
+    {DataFlowMetric::kP50E2ELatency, "p50 end-to-end Latency (ms)"},
+    {DataFlowMetric::kP90E2ELatency, "p90 end-to-end Latency (ms)"},
+    {DataFlowMetric::kP99E2ELatency, "p99 end-to-end Latency (ms)"},
+    {DataFlowMetric::kP999E2ELatency, "p99.9 end-to-end Latency (ms)"}};
+
+/// The percentile metrics which are computed from the latency histogram of a path.
+static const std::unordered_map<DataFlowMetric, double> metricToPercentile = {
+    {DataFlowMetric::kP50E2ELatency, 50.0},
+    {DataFlowMetric::kP90E2ELatency, 90.0},
+    {DataFlowMetric::kP99E2ELatency, 99.0},
+    {DataFlowMetric::kP999E2ELatency, 99.9}};
 
 class PathMetrics {
  public:
@@ -77,6 +101,8 @@ class PathMetrics {
   std::unordered_map<DataFlowMetric, double> metrics;
   std::queue<double> latency_buffer;
   uint64_t num_skipped_messages;
+  LatencyHistogram latency_histogram;  ///< The histogram of the tracked latencies in microseconds.
+  std::mutex mutex;                    ///< The mutex for the metrics of this path.
 };
 
 /**
@@ -84,8 +110,11 @@ class PathMetrics {
  * between the root operators and leaf operators. This class is used by the developers to get the
  * metrics data for flow during the execution of the application and at the end of it.
  *
- * This class uses mutex locks on metric properties so that multiple threads on multiple operators
- * can update the metrics without conflicts.
+ * The metrics are sharded per path: each path has its own lock, and the map of paths is only
+ * locked exclusively when a new path is seen for the first time. Therefore, multiple threads on
+ * multiple leaf operators can update the metrics of different paths without contention. The
+ * latency distribution of every path is also recorded in a fixed-memory log-linear histogram
+ * from which percentiles are computed at query time.
  *
  */
 class DataFlowTracker {
@@ -140,6 +169,34 @@ class DataFlowTracker {
   void enable_logging(std::string filename = kDefaultLogfileName,
                       uint64_t num_buffered_messages = kDefaultNumBufferedMessages);
 
+  /**
+   * @brief Enable binary tracing of every message at the end of the every execution of a leaf
+   * Operator (and at the end of cycles).
+   *
+   * Unlike enable_logging(), no text is formatted and no I/O is done on the scheduler threads. For
+   * every Operator of every path of a message, a fixed-size binary event (Operator ID, receive and
+   * publish timestamps, message ID) is recorded into a lock-free ring buffer of the calling thread.
+   * A background thread writes the events to the binary trace file. The trace file can be converted
+   * to Chrome trace / Perfetto JSON with the `convert_dfft_trace_to_chrome_trace.py` script.
+   *
+   * Like logging, tracing does not take into account the number of message to skip or discard or
+   * the threshold latency.
+   *
+   * If tracing is already enabled, the previous trace file is closed. This is safe while the
+   * application is running: the sink is replaced once the threads writing to it are done.
+   *
+   * @param filename The name of the binary trace file.
+   * @param ring_capacity The capacity (in events) of the ring buffer of each thread. Events are
+   * dropped (and counted) if a ring buffer is full.
+   */
+  void enable_trace(std::string filename = kDefaultTraceFilename,
+                    uint64_t ring_capacity = kDefaultTraceRingCapacity);
+
+  /**
+   * @brief Write out the remaining trace events and close the binary trace file.
+   */
+  void end_trace();
+
   /**
    * @brief Print the result of the data flow tracking in pretty-printed format to the standard
    * output.
@@ -174,6 +231,18 @@ class DataFlowTracker {
    */
   double get_metric(std::string pathstring, holoscan::DataFlowMetric metric);
 
+  /**
+   * @brief Return the histogram of the tracked end-to-end latencies for a given path.
+   *
+   * Only non-empty buckets are returned. The same messages which are taken into account for the
+   * other end-to-end latency metrics are counted in the histogram.
+   *
+   * @param pathstring The path name string for which the histogram is being queried.
+   * @return A vector of (bucket upper bound latency in ms, number of messages) pairs, in
+   * increasing order of latency. The vector is empty if the path is not found.
+   */
+  std::vector<std::pair<double, uint64_t>> get_latency_histogram(std::string pathstring);
+
   /**
    * @brief Return the value of a metric.
    *
@@ -200,6 +269,9 @@ class DataFlowTracker {
   // because the cyclic paths are updated from there, instead of DFFTCollector
   friend class AnnotatedDoubleBufferReceiver;
 
+  // Making GXFExecutor friend class to access register_operator during graph initialization
+  friend class holoscan::gxf::GXFExecutor;
+
   /**
    * @brief Update the tracker with the current latency for a given path.
    *
@@ -213,6 +285,18 @@ class DataFlowTracker {
    */
   void update_latency(std::string pathstring, double current_latency);
 
+  /**
+   * @brief Update the tracker with the current latency for a path of a MessageLabel.
+   *
+   * The path is looked up by its integer hash (MessageLabel::get_path_hash). The path name string
+   * is only built the first time a path is seen.
+   *
+   * @param label The MessageLabel containing the path.
+   * @param path_index The index of the path in the MessageLabel.
+   * @param current_latency The current latency value.
+   */
+  void update_latency(const MessageLabel& label, int path_index, double current_latency);
+
   /**
    * @brief Update the tracker with the number of published messages for a given source
    * Operator.
@@ -234,14 +318,69 @@ class DataFlowTracker {
    */
   void write_to_logfile(std::string text);
 
+  /**
+   * @brief Record the paths of a MessageLabel in the binary trace only if tracing is enabled.
+   * Otherwise, the function does nothing.
+   *
+   * @param label The MessageLabel to be traced.
+   * @param path_index The index of the path to be traced, or -1 to trace all the paths.
+   */
+  void write_to_trace(const MessageLabel& label, int path_index = -1);
+
+  /**
+   * @brief Register the name of an Operator so that the Operator IDs in the binary trace can be
+   * resolved to names.
+   *
+   * @param operator_id The ID of the Operator.
+   * @param name The name of the Operator.
+   */
+  void register_operator(int64_t operator_id, const std::string& name);
+
  private:
+  /**
+   * @brief Return the metrics of a path, creating them if the path is seen for the first time.
+   *
+   * @param pathstring The path name string.
+   * @return The shared pointer to the metrics of the path.
+   */
+  std::shared_ptr<holoscan::PathMetrics> get_or_create_path_metrics(const std::string& pathstring);
+
+  /**
+   * @brief Return the metrics of a path.
+   *
+   * @param pathstring The path name string.
+   * @return The shared pointer to the metrics of the path, or nullptr if the path is not found.
+   */
+  std::shared_ptr<holoscan::PathMetrics> find_path_metrics(const std::string& pathstring);
+
+  /**
+   * @brief Update the metrics of a path with the current latency.
+   *
+   * @param path_metrics The metrics of the path.
+   * @param current_latency The current latency value.
+   */
+  void update_path_latency(const std::shared_ptr<holoscan::PathMetrics>& path_metrics,
+                           double current_latency);
+
+  /**
+   * @brief Close and destroy a trace sink which is no longer published in trace_sink_.
+   *
+   * Waits until no thread is writing to the sink anymore.
+   *
+   * @param trace_sink The trace sink to retire. Nothing is done if it is nullptr.
+   */
+  void retire_trace_sink(DataFlowTraceSink* trace_sink);
+
   std::map<std::string, uint64_t>
       source_messages_;  ///< The map of source names to the number of published messages.
-  std::mutex source_messages_mutex_;  ///< The mutex for the source_messages_.
+  mutable std::mutex source_messages_mutex_;  ///< The mutex for the source_messages_.
 
   std::map<std::string, std::shared_ptr<holoscan::PathMetrics>>
-      all_path_metrics_;               ///< The map of path names to the path metrics.
-  std::mutex all_path_metrics_mutex_;  ///< The mutex for the all_path_metrics_.
+      all_path_metrics_;  ///< The map of path names to the path metrics.
+  std::unordered_map<uint64_t, std::shared_ptr<holoscan::PathMetrics>>
+      path_metrics_by_hash_;  ///< The map of path hashes to the path metrics.
+  mutable std::shared_mutex all_path_metrics_mutex_;  ///< The mutex for all_path_metrics_ and
+                                                      ///< path_metrics_by_hash_.
 
   /// The number of messages to skip at the beginning of the execution of an application graph.
   /// This is also known as the warm-up period.
@@ -265,6 +404,14 @@ class DataFlowTracker {
 
   uint64_t logfile_messages_ =
       0;  ///< The number of messages logged to the log file, used for writing to the log file.
+
+  /// The sink of the binary trace, or nullptr if tracing is not enabled. The sink is owned by the
+  /// tracker. Threads writing to it publish it in their hazard pointer, so that a replaced sink is
+  /// only destroyed once no thread writes to it anymore.
+  std::atomic<DataFlowTraceSink*> trace_sink_{nullptr};
+  std::mutex trace_sink_mutex_;  ///< The mutex serializing the replacement of trace_sink_.
+  std::mutex operator_names_mutex_;                ///< The mutex for operator_names_.
+  std::map<int64_t, std::string> operator_names_;  ///< The registered Operator names by ID.
 };
 }  // namespace holoscan
 
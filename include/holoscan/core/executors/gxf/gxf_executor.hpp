@@ -27,8 +27,9 @@
 #include <memory>
 #include <set>
 #include <string>
-#include <unordered_map>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -43,7 +44,10 @@ namespace holoscan {
 // Forward declarations
 class Arg;
 class Condition;
+class DeadlineArbiter;
+class FanOutDoubleBufferTransmitter;
 class Resource;
+class ThreadPool;
 
 }  // namespace holoscan
 
@@ -236,6 +240,28 @@ class GXFExecutor : public holoscan::Executor {
   /// The connection items for virtual operators.
   std::vector<std::shared_ptr<holoscan::ConnectionItem>> connection_items_;
 
+  /// The first operator of the fused chain of each fused operator, indexed by the fused operator.
+  std::unordered_map<Operator*, Operator*> fused_chain_heads_;
+
+  /// The operators of each fused chain, indexed by the first operator of the chain.
+  std::unordered_map<Operator*, std::vector<std::shared_ptr<Operator>>> fused_chains_;
+
+  /// The previous operator of each operator whose input port may be fused, indexed by the
+  /// operator. The fusion is decided once the operator configured its ports.
+  std::unordered_map<Operator*, std::shared_ptr<Operator>> fusion_candidates_;
+
+  /// The output ports of the fusion candidates whose fusion is not decided yet.
+  std::unordered_set<IOSpec*> fusion_candidate_outputs_;
+
+  /// The output ports whose creation is deferred until the fusion of their connection is decided.
+  std::unordered_set<IOSpec*> pending_fused_outputs_;
+
+  /// The thread pool of each operator assigned to a thread pool, indexed by the operator.
+  std::unordered_map<Operator*, ThreadPool*> operator_thread_pools_;
+
+  /// The earliest-deadline-first arbiter of the operator entities, if deadline scheduling is on.
+  std::shared_ptr<DeadlineArbiter> deadline_arbiter_;
+
   /// The list of implicit broadcast entities to be added to the network entity group.
   std::list<std::shared_ptr<nvidia::gxf::GraphEntity>> implicit_broadcast_entities_;
 
@@ -256,6 +282,10 @@ class GXFExecutor : public holoscan::Executor {
       holoscan::OperatorGraph::NodeType,
       std::unordered_map<std::string, std::shared_ptr<nvidia::gxf::GraphEntity>>>;
 
+  using FanOutTransmitterMapType =
+      std::unordered_map<holoscan::OperatorGraph::NodeType,
+                         std::unordered_map<std::string, FanOutDoubleBufferTransmitter*>>;
+
   /** @brief Initialize all GXF Resources in the map and assign them to graph_entity.
    *
    *  Utility function grouping common code across `initialize_network_context` and
@@ -320,6 +350,103 @@ class GXFExecutor : public holoscan::Executor {
                                         holoscan::OperatorGraph::NodeType prev_op,
                                         holoscan::OperatorGraph::EdgeDataType port_map_val);
 
+  /** @brief Find the fan-out output ports of `op` and add their transmitters to
+   * fan_out_transmitters.
+   *
+   * This is a helper method that gets called by initialize_fragment.
+   *
+   * An output port publishes directly into its target input ports if it is a fan-out port and all
+   * of its targets are within this fragment. Such ports need neither a direct GXF connection nor a
+   * Broadcast component, so they are removed from `connections`.
+   *
+   * @param op The operator to find the fan-out output ports of.
+   * @param fan_out_transmitters The mapping of fan-out transmitters.
+   * @param connections The downstream connections of `op`, indexed by the source port uid.
+   */
+  void collect_fan_out_transmitters(holoscan::OperatorGraph::NodeType op,
+                                    FanOutTransmitterMapType& fan_out_transmitters,
+                                    TargetConnectionsMapType& connections);
+
+  /** @brief Register the current operator's input port(s) as receivers of the fan-out
+   * transmitters of the previous operator.
+   *
+   * Any connected ports of the operator are removed from port_map_val.
+   *
+   * @param fan_out_transmitters The mapping of fan-out transmitters.
+   * @param op The operator whose input ports receive from the fan-out transmitters.
+   * @param prev_op The operator owning the fan-out transmitters.
+   * @param port_map_val The port mapping between prev_op and op.
+   */
+  void connect_fan_out_to_previous_op(const FanOutTransmitterMapType& fan_out_transmitters,
+                                      holoscan::OperatorGraph::NodeType op,
+                                      holoscan::OperatorGraph::NodeType prev_op,
+                                      holoscan::OperatorGraph::EdgeDataType port_map_val);
+
+  /** @brief Initialize the thread pools of the fragment and resolve their operators.
+   *
+   * This is a helper method that gets called by initialize_fragment, before the operator chains
+   * are fused. Each thread pool gets an entity of its own, and operator_thread_pools_ is filled.
+   * An operator assigned to several thread pools is an error.
+   *
+   * @param graph The operator graph of the fragment.
+   */
+  void initialize_thread_pools(OperatorGraph& graph);
+
+  /// Whether two operators run on the same thread pool (or both on the scheduler's threads) with
+  /// the same pinning, so that they can share an entity.
+  bool have_same_thread_pool(Operator* op, Operator* other_op) const;
+
+  /** @brief Add the entities of the operators of each thread pool to an entity group.
+   *
+   * This is a helper method that gets called by initialize_gxf_graph, once the operator entities
+   * exist. The entity group of a thread pool contains the entity of the pool and the entities of
+   * its operators, and a CPUThread component pins the entity of each pinned operator to a thread
+   * of the pool. Thread pools are ignored by the GreedyScheduler.
+   */
+  void add_thread_pools_to_entity_groups();
+
+  /** @brief Set up the tracking of frames and the deadline scheduling of the operators.
+   *
+   * This is a helper method that gets called by initialize_gxf_graph, once the operator entities
+   * exist. If any operator has a deadline, every operator keeps track of the release time of the
+   * frame it processes. If deadline scheduling is also enabled for the fragment, a
+   * DeadlineSchedulingTerm sharing the deadline_arbiter_ is added to the entity of each native
+   * operator with input ports, except for operators pinned to a thread pool.
+   *
+   * @param graph The operator graph of the fragment.
+   */
+  void initialize_deadline_scheduling(OperatorGraph& graph);
+
+  /** @brief Find the connections of the linear operator chains of the graph that can be fused.
+   *
+   * This is a helper method that gets called by initialize_fragment, before any operator is
+   * initialized.
+   *
+   * If operator fusion is enabled for the fragment, each connection between two operators of a
+   * chain is added to fusion_candidates_, and initialize_operator defers the creation of its
+   * output port until fuse_with_previous_operator decides the fusion. Fused connections of a
+   * previous run are always cleared.
+   *
+   * @param graph The operator graph of the fragment.
+   */
+  void fuse_operator_chains(OperatorGraph& graph);
+
+  /** @brief Fuse the input port of an operator with the output port of its previous operator.
+   *
+   * This is a helper method that gets called by initialize_operator, once the initialize() method
+   * of the operator configured its ports, and before the operator creates its entity.
+   *
+   * The connection is fused if it is a fusion candidate whose ports kept the default connector and
+   * conditions, in which case both ports get a FusedConnection and the operator is added to
+   * fused_chain_heads_. Otherwise, the output port of the previous operator is created, if its
+   * creation was deferred.
+   *
+   * @param op The operator being initialized.
+   * @return The first operator of the fused chain, whose entity the operator shares, or nullptr if
+   * the operator is not fused.
+   */
+  Operator* fuse_with_previous_operator(Operator* op);
+
   /// Indicate whether this executor was created by a Holoscan Application.
   bool is_holoscan() const;
 
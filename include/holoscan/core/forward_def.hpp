@@ -44,6 +44,7 @@ class ExecutionContext;
 class ExtensionManager;
 class Executor;
 class Fragment;
+class FusedConnection;
 template <typename NodeT, typename EdgeDataElementT>
 class Graph;
 class GXFParameterAdaptor;
@@ -131,6 +132,7 @@ class RealtimeClock;
 class SerializationBuffer;
 class StdComponentSerializer;
 class StdEntitySerializer;
+class ThreadPool;
 class Transmitter;
 class UcxComponentSerializer;
 class UcxEntitySerializer;
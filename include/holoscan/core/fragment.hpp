@@ -28,6 +28,7 @@
 #include <unordered_set>
 #include <tuple>
 #include <utility>  // for std::pair
+#include <vector>
 
 #include "common.hpp"
 #include "config.hpp"
@@ -35,6 +36,7 @@
 #include "executor.hpp"
 #include "graph.hpp"
 #include "network_context.hpp"
+#include "operator_metrics.hpp"
 #include "scheduler.hpp"
 
 namespace holoscan {
@@ -465,6 +467,39 @@ class Fragment {
     return network_context;
   }
 
+  /**
+   * @brief Create a new thread pool.
+   *
+   * Thread pools are used by the multi-threaded schedulers (`MultiThreadScheduler` and
+   * `EventBasedScheduler`) to run operators on dedicated threads. Operators are assigned to the
+   * pool with `ThreadPool::add()`. See `ThreadPool` for the CPU affinity and real-time priority
+   * settings of a pool.
+   *
+   * @param name The name of the thread pool.
+   * @param initial_size The number of threads of the pool.
+   * @return The shared pointer to the thread pool.
+   */
+  std::shared_ptr<ThreadPool> make_thread_pool(const std::string& name, int64_t initial_size = 1);
+
+  /**
+   * @brief Create a new thread pool.
+   *
+   * This overload takes the parameters of the thread pool as arguments, e.g. from
+   * `from_config()`, so that thread pools can be configured from a YAML file.
+   *
+   * @param name The name of the thread pool.
+   * @param args The arguments for the thread pool.
+   * @return The shared pointer to the thread pool.
+   */
+  std::shared_ptr<ThreadPool> make_thread_pool(const std::string& name, const ArgList& args);
+
+  /**
+   * @brief Get the thread pools of the fragment.
+   *
+   * @return The thread pools created with make_thread_pool().
+   */
+  const std::vector<std::shared_ptr<ThreadPool>>& thread_pools() const { return thread_pools_; }
+
   /**
    * @brief Add an operator to the graph.
    *
@@ -627,6 +662,92 @@ class Fragment {
    */
   DataFlowTracker* data_flow_tracker() { return data_flow_tracker_.get(); }
 
+  /**
+   * @brief Get the execution statistics of the operators of this fragment.
+   *
+   * The statistics (number of ticks, duration of compute(), interval between ticks and number of
+   * queued input messages at tick) are always recorded and can be queried while the fragment
+   * runs.
+   *
+   * @return An unordered_map with the operator names as keys and the statistics as values.
+   */
+  std::unordered_map<std::string, OperatorStatistics> operator_metrics();
+
+  /**
+   * @brief Set the period of the operator metrics summary log.
+   *
+   * When the period is positive, each operator writes a summary of its statistics to the log
+   * (at INFO level) every `period_ms` milliseconds while it ticks. Must be set before the
+   * fragment runs.
+   *
+   * @param period_ms The period in milliseconds. Zero (the default) disables the log.
+   */
+  void operator_metrics_log_period(int64_t period_ms) {
+    operator_metrics_log_period_ms_ = period_ms;
+  }
+
+  /**
+   * @brief Get the period of the operator metrics summary log.
+   *
+   * @return The period in milliseconds, zero if the log is disabled.
+   */
+  int64_t operator_metrics_log_period() const { return operator_metrics_log_period_ms_; }
+
+  /**
+   * @brief Enable or disable the fusion of linear operator chains.
+   *
+   * When enabled, the executor looks for chains of native operators where each operator has a
+   * single output port connected to the single input port of the next operator, which has no
+   * other upstream operator. The operators of such a chain are run by a single GXF entity: the
+   * scheduler only evaluates the conditions of the first operator (and the output ports of the
+   * last one), and the compute() methods of the operators are called back to back, passing the
+   * messages directly instead of going through a transmitter/receiver pair.
+   *
+   * A connection is only fused if both ports use the default connector and conditions, also after
+   * the initialize() methods of the operators configured their ports, the downstream operator has
+   * no condition of its own, neither operator has a UCX port and the connection is not part of a
+   * cycle. A downstream operator computes once per message emitted by the upstream operator.
+   * Per-operator metrics and data flow tracking are kept for fused operators. Must be set before
+   * the fragment runs.
+   *
+   * @param enabled Whether to fuse operator chains (disabled by default).
+   */
+  void fuse_operators(bool enabled) { fuse_operators_ = enabled; }
+
+  /**
+   * @brief Get whether linear operator chains are fused.
+   *
+   * @return true if operator fusion is enabled.
+   */
+  bool fuse_operators() const { return fuse_operators_; }
+
+  /**
+   * @brief Enable or disable earliest-deadline-first (EDF) dispatching of operators.
+   *
+   * When enabled, the executor adds a scheduling term to the entity of each operator with input
+   * ports. Among the operators with pending input messages, the operators whose frames have the
+   * earliest absolute deadlines (see Operator::deadline()) are dispatched first: an operator is
+   * held back while the number of dispatched operators and of operators with earlier deadlines
+   * reaches the number of worker threads of the scheduler. Operators without a deadline have the
+   * latest possible deadline, and operators without input ports are never held back.
+   *
+   * Dispatching stays work-conserving: an operator is only held back by operators with earlier
+   * deadlines that are themselves ready, and for at most 1 ms per pending frame of these
+   * operators, so that an operator held back by its other conditions cannot block the others.
+   * Deadline misses are recorded in the operator metrics whether or not EDF dispatching is
+   * enabled. Must be set before the fragment runs.
+   *
+   * @param enabled Whether to dispatch operators in deadline order (disabled by default).
+   */
+  void deadline_scheduling(bool enabled) { deadline_scheduling_ = enabled; }
+
+  /**
+   * @brief Get whether operators are dispatched in deadline order.
+   *
+   * @return true if EDF dispatching is enabled.
+   */
+  bool deadline_scheduling() const { return deadline_scheduling_; }
+
   /**
    * @brief Calls compose() if the graph is not composed yet.
    */
@@ -684,6 +805,10 @@ class Fragment {
   std::shared_ptr<NetworkContext> network_context_;  ///< The network_context used by the executor
   std::shared_ptr<DataFlowTracker> data_flow_tracker_;  ///< The DataFlowTracker for the fragment
   bool is_composed_ = false;                            ///< Whether the graph is composed or not.
+  int64_t operator_metrics_log_period_ms_ = 0;  ///< The period of the operator metrics summary log.
+  bool fuse_operators_ = false;  ///< Whether linear operator chains are fused into one entity.
+  bool deadline_scheduling_ = false;  ///< Whether operators are dispatched in deadline order.
+  std::vector<std::shared_ptr<ThreadPool>> thread_pools_;  ///< The thread pools of the fragment.
 };
 
 }  // namespace holoscan
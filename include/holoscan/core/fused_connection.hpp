@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_FUSED_CONNECTION_HPP
+#define HOLOSCAN_CORE_FUSED_CONNECTION_HPP
+
+#include <any>
+#include <cstddef>
+#include <deque>
+#include <string>
+
+#include "./forward_def.hpp"
+#include "./messagelabel.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief In-process connection between the output port of an operator and the input port of the
+ * next operator in a fused operator chain.
+ *
+ * The operators of a fused chain are ticked back to back by the same GXF entity, so the messages
+ * emitted on a fused output port are consumed by the next operator within the same entity
+ * execution, which computes once per message. The connection queues the messages emitted by one
+ * compute() call, and passes them without creating GXF message entities or going through a
+ * transmitter/receiver pair.
+ *
+ * When data flow tracking is enabled, the connection stamps the message label the same way as
+ * AnnotatedDoubleBufferTransmitter and AnnotatedDoubleBufferReceiver do.
+ */
+class FusedConnection {
+ public:
+  /**
+   * @brief Create a connection between two fused operators.
+   *
+   * @param producer The operator emitting on the output port.
+   * @param output_name The name of the output port.
+   * @param consumer The operator receiving on the input port.
+   * @param input_name The name of the input port.
+   */
+  FusedConnection(Operator* producer, const std::string& output_name, Operator* consumer,
+                  const std::string& input_name);
+
+  /// Return the operator emitting on the output port.
+  Operator* producer() const { return producer_; }
+
+  /// Return true if no message is pending.
+  bool empty() const { return messages_.empty(); }
+
+  /// Return the number of pending messages.
+  size_t size() const { return messages_.size(); }
+
+  /**
+   * @brief Queue a message for the consumer.
+   *
+   * @param data The message data, as returned by InputContext::receive_impl() on the consumer side.
+   */
+  void push(std::any data);
+
+  /**
+   * @brief Take the oldest pending message.
+   *
+   * @return The message data, or a std::any holding nullptr if no message is pending.
+   */
+  std::any pop();
+
+  /// Drop the pending messages, if any.
+  void clear();
+
+ private:
+  Operator* producer_ = nullptr;
+  Operator* consumer_ = nullptr;
+  std::string input_name_;
+  std::string publisher_name_;  ///< "<producer>-><output port>" as used by data flow tracking
+
+  struct Message {
+    std::any data;
+    MessageLabel label;
+    bool has_label = false;
+  };
+  std::deque<Message> messages_;  ///< The pending messages, oldest first
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_FUSED_CONNECTION_HPP */
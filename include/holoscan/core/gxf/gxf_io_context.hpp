@@ -28,6 +28,39 @@ namespace holoscan::gxf {
 
 nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spec);
 
+/**
+ * @brief Get the GXF receiver of an input port.
+ *
+ * The receiver is resolved from the connector of the port on first use and cached in the IOSpec
+ * (see IOSpec::connector_handle()), so subsequent calls do not query the GXF runtime.
+ *
+ * @param input_spec The IOSpec of the input port.
+ * @return The pointer to the GXF receiver, or nullptr if the connector is not a GXF resource.
+ */
+nvidia::gxf::Receiver* get_gxf_receiver(IOSpec* input_spec);
+
+/**
+ * @brief Get the GXF transmitter of an output port.
+ *
+ * The transmitter is resolved from the connector of the port on first use and cached in the
+ * IOSpec (see IOSpec::connector_handle()), so subsequent calls do not query the GXF runtime.
+ *
+ * @param output_spec The IOSpec of the output port.
+ * @return The pointer to the GXF transmitter, or nullptr if the connector is not a GXF resource.
+ */
+nvidia::gxf::Transmitter* get_gxf_transmitter(IOSpec* output_spec);
+
+/**
+ * @brief Resolve and cache the GXF receivers/transmitters of all ports of an operator.
+ *
+ * The cached handles are used by GXFInputContext and GXFOutputContext. Any previously cached
+ * handle is discarded, so this must be called whenever the GXF graph of the operator is
+ * (re)initialized.
+ *
+ * @param op The operator whose ports are resolved.
+ */
+void cache_gxf_connector_handles(Operator* op);
+
 /**
  * @brief Class to hold the input context for a GXF Operator.
  *
@@ -61,7 +94,9 @@ class GXFInputContext : public InputContext {
 
  protected:
   bool empty_impl(const char* name = nullptr) override;
+  bool empty_impl(IOSpec* input_spec) override;
   std::any receive_impl(const char* name = nullptr, bool no_error_message = false) override;
+  std::any receive_impl(IOSpec* input_spec) override;
 };
 
 /**
@@ -98,6 +133,7 @@ class GXFOutputContext : public OutputContext {
  protected:
   void emit_impl(std::any data, const char* name = nullptr,
                  OutputType out_type = OutputType::kSharedPointer) override;
+  void emit_impl(std::any data, IOSpec* output_spec, OutputType out_type) override;
 };
 
 }  // namespace holoscan::gxf
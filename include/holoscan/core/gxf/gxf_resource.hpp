@@ -38,6 +38,21 @@ class GXFResource : public holoscan::Resource, public gxf::GXFComponent {
   void initialize() override;
 
   void add_to_graph_entity(Operator* op);
+
+ protected:
+  /**
+   * @brief Whether a parameter of the component spec is passed on to the GXF component.
+   *
+   * Resources with parameters applied by Holoscan rather than by the GXF component override this
+   * method to keep them from being set on the GXF component.
+   *
+   * @param key The name of the parameter.
+   * @return true if the parameter is a parameter of the GXF component (default).
+   */
+  virtual bool is_gxf_parameter(const std::string& key) const {
+    (void)key;
+    return true;
+  }
 };
 
 }  // namespace holoscan::gxf
@@ -18,11 +18,21 @@
 #ifndef HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 #define HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 
+#include <pthread.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "holoscan/core/gxf/gxf_execution_context.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 
 #include "gxf/std/codelet.hpp"
 #include "gxf/core/parameter_parser_std.hpp"
 
+namespace holoscan {
+class DeadlineSchedulingTerm;
+}  // namespace holoscan
+
 namespace holoscan::gxf {
 
 /**
@@ -51,7 +61,40 @@ class GXFWrapper : public nvidia::gxf::Codelet {
  private:
   void store_exception();
 
+  /// Apply the CPU affinity and scheduling policy of the pinned thread pool to the calling
+  /// thread, if it is not configured yet.
+  void configure_thread();
+
+  /**
+   * @brief Resolve the release time of the frame the operator is about to compute.
+   *
+   * Stale input messages are dropped first if the operator drops stale frames.
+   *
+   * @param now_ns The current time, in nanoseconds of std::chrono::steady_clock.
+   * @return false if the frame was dropped and compute() must not be called.
+   */
+  bool begin_frame(int64_t now_ns);
+
+  /**
+   * @brief Compute one frame and record the metrics of the call.
+   *
+   * @param input_queue_depth The number of messages queued on the input ports before the call.
+   * @return GXF_FAILURE if compute() threw an exception.
+   */
+  gxf_result_t compute_frame(uint64_t input_queue_depth);
+
   Operator* op_ = nullptr;
+  /// Execution context created on start() and reused by every tick, so that ticking does not
+  /// allocate the execution, input and output contexts.
+  std::unique_ptr<GXFExecutionContext> exec_context_;
+  /// Thread pool whose CPU affinity and scheduling policy apply to the operator, if it is pinned
+  /// to a thread of a pool that sets them.
+  const ThreadPool* pinned_thread_pool_ = nullptr;
+  pthread_t configured_thread_{};      ///< The thread last configured for the thread pool.
+  bool is_thread_configured_ = false;  ///< Whether configured_thread_ is set.
+  /// The deadline scheduling term of the entity, if the fragment uses deadline scheduling.
+  DeadlineSchedulingTerm* deadline_term_ = nullptr;
+  int64_t last_tick_ns_ = 0;  ///< The time of the last tick of a periodic source.
 };
 
 }  // namespace holoscan::gxf
@@ -291,94 +291,140 @@ class InputContext {
     } else {
       // If it is not a vector then try to get the input directly and convert for respective data
       // type for an input
-      auto value = receive_impl(name);
-      // If the received data is nullptr, then check whether nullptr or empty holoscan::gxf::Entity
-      // can be sent
-      if (value.type() == typeid(nullptr_t)) {
-        HOLOSCAN_LOG_DEBUG("nullptr is received from the input port with name '{}'", name);
-        // If it is a shared pointer, or raw pointer then return nullptr because it might be a valid
-        // nullptr
-        if constexpr (holoscan::is_shared_ptr_v<DataT>) {
-          return nullptr;
-        } else if constexpr (std::is_pointer_v<DataT>) {
-          return nullptr;
-        }
-        // If it's holoscan::gxf::Entity then return an error message
-        if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
-          auto error_message = fmt::format(
-              "Null received in place of nvidia::gxf::Entity or derived type for input {}", name);
-          return make_unexpected<holoscan::RuntimeError>(
-              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
-          auto error_message = fmt::format(
-              "Null received in place of holoscan::TensorMap or derived type for input {}", name);
-          return make_unexpected<holoscan::RuntimeError>(
-              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        }
+      return convert_received_value<DataT>(receive_impl(name), name);
+    }
+  }
+
+  /**
+   * @brief Receive a message from the input port with the given handle.
+   *
+   * This is equivalent to `receive<DataT>(name)` for a single input port, but the port is given
+   * by its precompiled handle (see OperatorSpec::input_handle()), which skips the lookup of the
+   * port by name.
+   *
+   * @tparam DataT The type of the data to receive.
+   * @param handle The handle of the input port to receive the data from.
+   * @return The received data.
+   */
+  template <typename DataT>
+  holoscan::expected<DataT, holoscan::RuntimeError> receive(const PortHandle& handle) {
+    if (!handle) {
+      auto error_message = std::string("Unable to receive from an invalid input port handle");
+      HOLOSCAN_LOG_DEBUG(error_message);
+      return make_unexpected<holoscan::RuntimeError>(
+          holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+    }
+    return convert_received_value<DataT>(receive_impl(handle.io_spec()), handle.name());
+  }
+
+  /**
+   * @brief Return whether the input port with the given handle has no message.
+   *
+   * @param handle The handle of the input port.
+   * @return True if the input port is empty. Otherwise, false.
+   */
+  bool empty(const PortHandle& handle) {
+    if (!handle) { return true; }
+    return empty_impl(handle.io_spec());
+  }
+
+ protected:
+  /**
+   * @brief Convert the data received from an input port to the requested type.
+   *
+   * @tparam DataT The type of the data to receive.
+   * @param value The data returned by `receive_impl`.
+   * @param name The name of the input port (for error messages).
+   * @return The converted data.
+   */
+  template <typename DataT>
+  holoscan::expected<DataT, holoscan::RuntimeError> convert_received_value(std::any value,
+                                                                           const char* name) {
+    // If the received data is nullptr, then check whether nullptr or empty holoscan::gxf::Entity
+    // can be sent
+    if (value.type() == typeid(nullptr_t)) {
+      HOLOSCAN_LOG_DEBUG("nullptr is received from the input port with name '{}'", name);
+      // If it is a shared pointer, or raw pointer then return nullptr because it might be a valid
+      // nullptr
+      if constexpr (holoscan::is_shared_ptr_v<DataT>) {
+        return nullptr;
+      } else if constexpr (std::is_pointer_v<DataT>) {
+        return nullptr;
       }
-      try {
-        // Check if the types of value and DataT are the same or not
-        if constexpr (std::is_same_v<DataT, std::any>) { return value; }
-        DataT return_value = std::any_cast<DataT>(value);
-        return return_value;
-      } catch (const std::bad_any_cast& e) {
-        // If it is of the type of holoscan::gxf::Entity then show a specific error message
-        if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
+      // If it's holoscan::gxf::Entity then return an error message
+      if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
+        auto error_message = fmt::format(
+            "Null received in place of nvidia::gxf::Entity or derived type for input {}", name);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
+        auto error_message = fmt::format(
+            "Null received in place of holoscan::TensorMap or derived type for input {}", name);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      }
+    }
+    try {
+      // Check if the types of value and DataT are the same or not
+      if constexpr (std::is_same_v<DataT, std::any>) { return value; }
+      DataT return_value = std::any_cast<DataT>(value);
+      return return_value;
+    } catch (const std::bad_any_cast& e) {
+      // If it is of the type of holoscan::gxf::Entity then show a specific error message
+      if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
+        auto error_message = fmt::format(
+            "Unable to cast the received data to the specified type (holoscan::gxf::"
+            "Entity) for input {}: {}",
+            name,
+            e.what());
+        HOLOSCAN_LOG_DEBUG(error_message);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
+        TensorMap tensor_map;
+        try {
+          auto gxf_entity = std::any_cast<holoscan::gxf::Entity>(value);
+
+          auto components_expected = gxf_entity.findAll();
+          auto components = components_expected.value();
+          for (size_t i = 0; i < components.size(); i++) {
+            const auto component = components[i];
+            const auto component_name = component->name();
+
+            if (std::string(component_name).compare("message_label") == 0) {
+              // Skip checking for Tensor as it's message label for DFFT
+              continue;
+            }
+            if (std::string(component_name).compare("cuda_stream_id_") == 0) {
+              // Skip checking for Tensor as it's a stream ID from CudaStreamHandler
+              continue;
+            }
+            std::shared_ptr<holoscan::Tensor> holoscan_tensor =
+                gxf_entity.get<holoscan::Tensor>(component_name);
+            if (holoscan_tensor) { tensor_map.insert({component_name, holoscan_tensor}); }
+          }
+        } catch (const std::bad_any_cast& e) {
           auto error_message = fmt::format(
-              "Unable to cast the received data to the specified type (holoscan::gxf::"
-              "Entity) for input {}: {}",
+              "Unable to cast the received data to the specified type (holoscan::TensorMap) for "
+              "input {}: {}",
               name,
               e.what());
           HOLOSCAN_LOG_DEBUG(error_message);
           return make_unexpected<holoscan::RuntimeError>(
               holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
-          TensorMap tensor_map;
-          try {
-            auto gxf_entity = std::any_cast<holoscan::gxf::Entity>(value);
-
-            auto components_expected = gxf_entity.findAll();
-            auto components = components_expected.value();
-            for (size_t i = 0; i < components.size(); i++) {
-              const auto component = components[i];
-              const auto component_name = component->name();
-
-              if (std::string(component_name).compare("message_label") == 0) {
-                // Skip checking for Tensor as it's message label for DFFT
-                continue;
-              }
-              if (std::string(component_name).compare("cuda_stream_id_") == 0) {
-                // Skip checking for Tensor as it's a stream ID from CudaStreamHandler
-                continue;
-              }
-              std::shared_ptr<holoscan::Tensor> holoscan_tensor =
-                  gxf_entity.get<holoscan::Tensor>(component_name);
-              if (holoscan_tensor) { tensor_map.insert({component_name, holoscan_tensor}); }
-            }
-          } catch (const std::bad_any_cast& e) {
-            auto error_message = fmt::format(
-                "Unable to cast the received data to the specified type (holoscan::TensorMap) for "
-                "input {}: {}",
-                name,
-                e.what());
-            HOLOSCAN_LOG_DEBUG(error_message);
-            return make_unexpected<holoscan::RuntimeError>(
-                holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-          }
-          return tensor_map;
         }
-        auto error_message = fmt::format(
-            "Unable to cast the received data to the specified type (DataT) for input {}: {}",
-            name,
-            e.what());
-        HOLOSCAN_LOG_DEBUG(error_message);
-        return make_unexpected<holoscan::RuntimeError>(
-            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+        return tensor_map;
       }
+      auto error_message = fmt::format(
+          "Unable to cast the received data to the specified type (DataT) for input {}: {}",
+          name,
+          e.what());
+      HOLOSCAN_LOG_DEBUG(error_message);
+      return make_unexpected<holoscan::RuntimeError>(
+          holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
     }
   }
 
- protected:
   /**
    * @brief The implementation of the `empty` method.
    *
@@ -406,6 +452,28 @@ class InputContext {
     return nullptr;
   }
 
+  /**
+   * @brief The implementation of the `empty` method for a port given by its IOSpec.
+   *
+   * The default implementation falls back to the lookup of the port by name.
+   *
+   * @param input_spec The IOSpec of the input port.
+   * @return True if the input port is empty or by default. Otherwise, false.
+   */
+  virtual bool empty_impl(IOSpec* input_spec) { return empty_impl(input_spec->name().c_str()); }
+
+  /**
+   * @brief The implementation of the `receive` method for a port given by its IOSpec.
+   *
+   * The default implementation falls back to the lookup of the port by name.
+   *
+   * @param input_spec The IOSpec of the input port.
+   * @return The data received from the input port.
+   */
+  virtual std::any receive_impl(IOSpec* input_spec) {
+    return receive_impl(input_spec->name().c_str());
+  }
+
   ExecutionContext* execution_context_ =
       nullptr;              ///< The execution context that is associated with.
   Operator* op_ = nullptr;  ///< The operator that this context is associated with.
@@ -630,7 +698,76 @@ class OutputContext {
     emit(out_message, name);
   }
 
+  /**
+   * @brief Send a shared pointer of the message data to the output port with the given handle.
+   *
+   * This is equivalent to `emit(data, name)`, but the port is given by its precompiled handle
+   * (see OperatorSpec::output_handle()), which skips the lookup of the port by name.
+   *
+   * @tparam DataT The type of the data to send.
+   * @param data The shared pointer to the data.
+   * @param handle The handle of the output port.
+   */
+  template <typename DataT, typename = std::enable_if_t<!holoscan::is_one_of_derived_v<
+                                DataT, nvidia::gxf::Entity, std::any>>>
+  void emit(std::shared_ptr<DataT>& data, const PortHandle& handle) {
+    emit_to_port(data, handle, OutputType::kSharedPointer);
+  }
+
+  /**
+   * @brief Send message data (GXF Entity) to the output port with the given handle.
+   *
+   * @tparam DataT The type of the data to send. It should be `holoscan::gxf::Entity`.
+   * @param data The entity object to send (`holoscan::gxf::Entity`).
+   * @param handle The handle of the output port.
+   */
+  template <typename DataT,
+            typename = std::enable_if_t<holoscan::is_one_of_derived_v<DataT, nvidia::gxf::Entity>>>
+  void emit(DataT& data, const PortHandle& handle) {
+    if constexpr (holoscan::is_one_of_v<DataT, nvidia::gxf::Entity>) {
+      emit_to_port(data, handle, OutputType::kGXFEntity);
+    } else {
+      emit_to_port(nvidia::gxf::Entity(data), handle, OutputType::kGXFEntity);
+    }
+  }
+
+  /**
+   * @brief Send the message data (std::any) to the output port with the given handle.
+   *
+   * @tparam DataT The type of the data to send. It can be any type except the shared pointer
+   * (std::shared_ptr<T>) or the GXF Entity (holoscan::gxf::Entity) type.
+   * @param data The entity object to send (as `std::any`).
+   * @param handle The handle of the output port.
+   */
+  template <typename DataT,
+            typename = std::enable_if_t<!holoscan::is_one_of_derived_v<DataT, nvidia::gxf::Entity>>>
+  void emit(DataT data, const PortHandle& handle) {
+    emit_to_port(data, handle, OutputType::kAny);
+  }
+
+  void emit(holoscan::TensorMap& data, const PortHandle& handle) {
+    auto out_message = holoscan::gxf::Entity::New(execution_context_);
+    for (auto& [key, tensor] : data) { out_message.add(tensor, key.c_str()); }
+    emit(out_message, handle);
+  }
+
  protected:
+  /**
+   * @brief Send the data to the output port with the given handle.
+   *
+   * @param data The data to send.
+   * @param handle The handle of the output port.
+   * @param out_type The type of the message data.
+   */
+  void emit_to_port(std::any data, const PortHandle& handle, OutputType out_type) {
+    if (!handle) {
+      HOLOSCAN_LOG_ERROR("The operator({}) is unable to emit to an invalid output port handle",
+                         op_->name());
+      return;
+    }
+    emit_impl(std::move(data), handle.io_spec(), out_type);
+  }
+
   /**
    * @brief The implementation of the `emit` method.
    *
@@ -648,6 +785,19 @@ class OutputContext {
     (void)out_type;
   }
 
+  /**
+   * @brief The implementation of the `emit` method for a port given by its IOSpec.
+   *
+   * The default implementation falls back to the lookup of the port by name.
+   *
+   * @param data The data to send.
+   * @param output_spec The IOSpec of the output port.
+   * @param out_type The type of the message data.
+   */
+  virtual void emit_impl(std::any data, IOSpec* output_spec, OutputType out_type) {
+    emit_impl(std::move(data), output_spec->name().c_str(), out_type);
+  }
+
   ExecutionContext* execution_context_ =
       nullptr;              ///< The execution context that is associated with.
   Operator* op_ = nullptr;  ///< The operator that this context is associated with.
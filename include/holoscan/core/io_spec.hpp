@@ -199,7 +199,30 @@ class IOSpec {
    *
    * @param connector The connector (transmitter or receiver) of this input/output.
    */
-  void connector(std::shared_ptr<Resource> connector) { connector_ = connector; }
+  void connector(std::shared_ptr<Resource> connector) {
+    connector_ = connector;
+    connector_handle_ = nullptr;
+  }
+
+  /**
+   * @brief Get the cached native handle of the connector of this input/output.
+   *
+   * The native handle is the backend object (e.g. `nvidia::gxf::Receiver*` or
+   * `nvidia::gxf::Transmitter*` for GXF) that is resolved from the connector by the executor, so
+   * that it does not have to be resolved again for every message.
+   *
+   * @return The native handle of the connector, or nullptr if it is not resolved yet.
+   */
+  void* connector_handle() const { return connector_handle_; }
+
+  /**
+   * @brief Set the cached native handle of the connector of this input/output.
+   *
+   * The handle is reset whenever the connector is replaced.
+   *
+   * @param handle The native handle of the connector (nullptr to invalidate the cache).
+   */
+  void connector_handle(void* handle) { connector_handle_ = handle; }
 
   /**
    * @brief Add a connector (receiver/transmitter) to this input/output.
@@ -218,6 +241,7 @@ class IOSpec {
   template <typename... ArgsT>
   IOSpec& connector(ConnectorType type, ArgsT&&... args) {
     connector_type_ = type;
+    connector_handle_ = nullptr;
     switch (type) {
       case ConnectorType::kDefault:
         // default receiver or transmitter will be created in GXFExecutor::run instead
@@ -243,6 +267,55 @@ class IOSpec {
     return *this;
   }
 
+  /**
+   * @brief Get whether this output publishes directly into all of its downstream receivers.
+   *
+   * @return true if the output port uses a fan-out transmitter.
+   */
+  bool fan_out() const { return fan_out_; }
+
+  /**
+   * @brief Let this output publish every message directly into all of its downstream receivers.
+   *
+   * By default, an output port connected to more than one input port is served by an implicit
+   * Broadcast entity, which costs an extra scheduling hop and queue per message. A fan-out output
+   * port instead pushes the emitted entity into every connected receiver in a single publish.
+   * Each receiver keeps its own capacity and policy, and the operator is only scheduled when all
+   * downstream receivers can accept a new message.
+   *
+   * This only applies to output ports with a `ConnectorType::kDefault` or
+   * `ConnectorType::kDoubleBuffer` connector that are connected within the same fragment; other
+   * output ports keep using a Broadcast entity.
+   *
+   * @param enable Whether to enable fan-out for this output port.
+   * @return The reference to this IOSpec.
+   */
+  IOSpec& fan_out(bool enable) {
+    fan_out_ = enable;
+    return *this;
+  }
+
+  /**
+   * @brief Get the in-process connection of this input/output, if the operator is fused with the
+   * operator at the other end of the port.
+   *
+   * Fused ports have no connector: messages are passed directly through the FusedConnection.
+   * Fused connections are created by the executor when operator fusion is enabled (see
+   * Fragment::fuse_operators()).
+   *
+   * @return The fused connection of this input/output, or nullptr if the port is not fused.
+   */
+  FusedConnection* fused_connection() const { return fused_connection_.get(); }
+
+  /**
+   * @brief Set the in-process connection of this input/output.
+   *
+   * @param connection The fused connection (nullptr to unfuse the port).
+   */
+  void fused_connection(std::shared_ptr<FusedConnection> connection) {
+    fused_connection_ = std::move(connection);
+  }
+
   /**
    * @brief Get a YAML representation of the IOSpec.
    *
@@ -264,8 +337,64 @@ class IOSpec {
   IOType io_type_;
   const std::type_info* typeinfo_ = nullptr;
   std::shared_ptr<Resource> connector_;
+  void* connector_handle_ = nullptr;  ///< The cached native handle of connector_
   std::vector<std::pair<ConditionType, std::shared_ptr<Condition>>> conditions_;
   ConnectorType connector_type_ = ConnectorType::kDefault;
+  bool fan_out_ = false;  ///< Whether this output publishes directly into all downstream receivers
+  std::shared_ptr<FusedConnection> fused_connection_;  ///< The connection to a fused operator
+};
+
+/**
+ * @brief Precompiled handle of an input/output port of an Operator.
+ *
+ * A port handle refers directly to the IOSpec of the port, so receiving from or emitting to a
+ * port through its handle skips the lookup of the port by name. Port handles are obtained with
+ * OperatorSpec::input_handle() and OperatorSpec::output_handle() once the ports are defined
+ * (e.g. in `Operator::initialize()`), and stay valid for the lifetime of the operator.
+ *
+ * ```cpp
+ * void initialize() override {
+ *   Operator::initialize();
+ *   in_handle_ = spec()->input_handle("in");
+ *   out_handle_ = spec()->output_handle("out");
+ * }
+ *
+ * void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+ *   auto value = op_input.receive<std::shared_ptr<ValueData>>(in_handle_).value();
+ *   op_output.emit(value, out_handle_);
+ * }
+ * ```
+ */
+class PortHandle {
+ public:
+  PortHandle() = default;
+
+  /**
+   * @brief Construct a new PortHandle object.
+   *
+   * @param io_spec The pointer to the IOSpec of the port.
+   */
+  explicit PortHandle(IOSpec* io_spec) : io_spec_(io_spec) {}
+
+  /**
+   * @brief Get the IOSpec of the port.
+   *
+   * @return The pointer to the IOSpec of the port, or nullptr if the handle is invalid.
+   */
+  IOSpec* io_spec() const { return io_spec_; }
+
+  /**
+   * @brief Get the name of the port.
+   *
+   * @return The name of the port, or an empty string if the handle is invalid.
+   */
+  const char* name() const { return io_spec_ ? io_spec_->name().c_str() : ""; }
+
+  /// Return true if the handle refers to a port.
+  explicit operator bool() const { return io_spec_ != nullptr; }
+
+ private:
+  IOSpec* io_spec_ = nullptr;
 };
 
 }  // namespace holoscan
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_LATENCY_HISTOGRAM_HPP
+#define HOLOSCAN_CORE_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+/**
+ * @brief Fixed-memory log-linear (HDR-style) histogram of latency values in microseconds.
+ *
+ * Values below `2 * kSubBucketCount` are counted exactly. Larger values are grouped into
+ * `kSubBucketCount` linear sub-buckets per power of two, which bounds the relative error of any
+ * reported percentile to `1 / kSubBucketCount` (~3%). Values larger than `kMaxTrackableValue` are
+ * clamped into the last bucket.
+ *
+ * Recording is lock-free (a relaxed atomic increment), so multiple threads can record into the
+ * same histogram concurrently. A histogram with a single writer can use `record_single_writer()`
+ * instead, which replaces the read-modify-write operations by plain loads and stores. Queries read
+ * a snapshot of the counters without blocking writers.
+ */
+class LatencyHistogram {
+ public:
+  /// Number of bits used for the linear sub-buckets of each power-of-two range.
+  static constexpr int kSubBucketBits = 5;
+  /// Number of linear sub-buckets in each power-of-two range.
+  static constexpr uint64_t kSubBucketCount = uint64_t{1} << kSubBucketBits;
+  /// Largest power of two covered by the histogram (2^40 us is ~12.7 days).
+  static constexpr int kMaxValueBits = 40;
+  /// Largest value that is counted in its own bucket.
+  static constexpr uint64_t kMaxTrackableValue = (uint64_t{1} << kMaxValueBits) - 1;
+  /// Total number of buckets.
+  static constexpr size_t kNumBuckets = (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+
+  LatencyHistogram() { reset(); }
+
+  // Atomic counters are neither copyable nor movable.
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  /**
+   * @brief Record a latency value.
+   *
+   * @param value_us The latency in microseconds. Negative values are counted as zero.
+   */
+  void record(int64_t value_us) {
+    counts_[bucket_index(value_us < 0 ? 0 : static_cast<uint64_t>(value_us))].fetch_add(
+        1, std::memory_order_relaxed);
+    total_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Record a latency value, when no other thread records into the histogram.
+   *
+   * Readers still see consistent counters, but concurrent calls of `record()` or
+   * `record_single_writer()` from other threads would lose increments.
+   *
+   * @param value_us The latency in microseconds. Negative values are counted as zero.
+   */
+  void record_single_writer(int64_t value_us) {
+    auto& count = counts_[bucket_index(value_us < 0 ? 0 : static_cast<uint64_t>(value_us))];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total_count_.store(total_count_.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+  }
+
+  /// Reset all counters to zero.
+  void reset();
+
+  /// Return the total number of recorded values.
+  uint64_t total_count() const { return total_count_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Return the value at the given percentile.
+   *
+   * The returned value is the midpoint of the bucket which contains the percentile.
+   *
+   * @param percentile The percentile in the range [0, 100].
+   * @return The value in microseconds, or -1 if the histogram is empty.
+   */
+  double value_at_percentile(double percentile) const;
+
+  /**
+   * @brief Return the non-empty buckets of the histogram.
+   *
+   * @return A vector of (bucket upper bound in microseconds, count) pairs in increasing order of
+   * the bucket bound.
+   */
+  std::vector<std::pair<uint64_t, uint64_t>> buckets() const;
+
+  /// Return the index of the bucket that counts the given value.
+  static size_t bucket_index(uint64_t value);
+
+  /// Return the smallest value counted by the bucket at the given index.
+  static uint64_t bucket_lower_bound(size_t index);
+
+  /// Return the largest value counted by the bucket at the given index.
+  static uint64_t bucket_upper_bound(size_t index);
+
+ private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> counts_;
+  std::atomic<uint64_t> total_count_{0};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_LATENCY_HISTOGRAM_HPP */
@@ -19,9 +19,9 @@
 #define HOLOSCAN_CORE_MESSAGELABEL_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <iterator>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 #include "./forward_def.hpp"
@@ -33,6 +33,22 @@ namespace holoscan {
 // The initially reserved number of paths in message_paths
 #define DEFAULT_NUM_PATHS 5
 
+/// The initial value of the rolling hash of a path (FNV-1a 64-bit offset basis)
+constexpr uint64_t kPathHashSeed = 0xcbf29ce484222325ULL;
+/// The multiplier of the rolling hash of a path (FNV-1a 64-bit prime)
+constexpr uint64_t kPathHashPrime = 0x100000001b3ULL;
+
+/**
+ * @brief Extend the rolling hash of a path with the ID of the next Operator in the path.
+ *
+ * @param path_hash The hash of the path until now.
+ * @param op_id The ID of the Operator being appended to the path.
+ * @return The hash of the extended path.
+ */
+static inline uint64_t extend_path_hash(uint64_t path_hash, int64_t op_id) {
+  return (path_hash ^ static_cast<uint64_t>(op_id)) * kPathHashPrime;
+}
+
 /**
  * @brief Return the current time in microseconds since the epoch.
 This function uses the C++11 standard library's chrono library.
@@ -96,27 +112,24 @@ struct OperatorTimestampLabel {
  *
  * A MessageLabel has a vector of paths, where each path is a vector of Operator references and
  * their publish and receive timestamps.
+ *
+ * Every path is also identified by a rolling 64-bit hash of the IDs of its Operators, so that
+ * paths can be keyed by an integer on the hot path. The human-readable path names are only built
+ * when they are printed or first registered with the DataFlowTracker.
  */
 class MessageLabel {
  public:
   using TimestampedPath = std::vector<OperatorTimestampLabel>;
-  using PathOperators = std::unordered_set<std::string>;
 
   MessageLabel() {
     // By default, allocate DEFAULT_NUM_PATHS paths in the message_paths
     message_paths.reserve(DEFAULT_NUM_PATHS);
   }
 
-  MessageLabel(const MessageLabel& m)
-      : message_paths(m.message_paths), message_path_operators(m.message_path_operators) {}
-
-  MessageLabel& operator=(const MessageLabel& m) {
-    if (this != &m) {
-      this->message_paths = m.message_paths;
-      this->message_path_operators = m.message_path_operators;
-    }
-    return *this;
-  }
+  MessageLabel(const MessageLabel& m) = default;
+  MessageLabel(MessageLabel&& m) = default;
+  MessageLabel& operator=(const MessageLabel& m) = default;
+  MessageLabel& operator=(MessageLabel&& m) = default;
 
   /**
    * @brief Get the number of paths in a MessageLabel.
@@ -133,7 +146,18 @@ class MessageLabel {
    */
   std::vector<std::string> get_all_path_names();
 
-  std::vector<TimestampedPath> paths() { return message_paths; }
+  const std::vector<TimestampedPath>& paths() const { return message_paths; }
+
+  /**
+   * @brief Get the rolling hash of the Operator IDs of a path.
+   *
+   * Two paths with the same sequence of Operators have the same hash, independent of their
+   * timestamps.
+   *
+   * @param index The index of the path.
+   * @return The hash of the path.
+   */
+  uint64_t get_path_hash(int index) const { return message_path_hashes[index]; }
 
   /**
    * @brief Get the current end-to-end latency of a path in microseconds.
@@ -181,7 +205,7 @@ class MessageLabel {
    * @param index The index of the path to get
    * @return The path name string
    */
-  std::string get_path_name(int index);
+  std::string get_path_name(int index) const;
 
   /**
    * @brief Get the OperatorTimestampLabel at the given path and operator index
@@ -219,6 +243,17 @@ class MessageLabel {
    */
   std::vector<int> has_operator(std::string op_name);
 
+  /**
+   * @brief Check if an operator is present in the MessageLabel. Returns an empty vector if the
+   * operator is not present in any path.
+   *
+   * Unlike the overload taking an operator name, no string comparison is done.
+   *
+   * @param op The operator to check
+   * @return List of path indexes where the operator is present
+   */
+  std::vector<int> has_operator(const Operator* op) const;
+
   /**
    * @brief Add a new Operator timestamp to all the paths in a message label.
    *
@@ -239,6 +274,14 @@ class MessageLabel {
    */
   void add_new_path(TimestampedPath path);
 
+  /**
+   * @brief Add a new path to the MessageLabel with an already computed path hash.
+   *
+   * @param path The path to be added.
+   * @param path_hash The rolling hash of the Operator IDs of the path.
+   */
+  void add_new_path(TimestampedPath path, uint64_t path_hash);
+
   /**
    * @brief Convert the MessageLabel to a string.
    *
@@ -258,9 +301,8 @@ class MessageLabel {
  private:
   std::vector<TimestampedPath> message_paths;
 
-  /// List of paths where each path is a set of name of the operators
-  /// This variable is used to quickly check whether an operator is in a path
-  std::vector<PathOperators> message_path_operators;
+  /// The rolling hash of the Operator IDs of every path in message_paths
+  std::vector<uint64_t> message_path_hashes;
 };
 }  // namespace holoscan
 
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -37,6 +38,7 @@
 #include "./condition.hpp"
 #include "./forward_def.hpp"
 #include "./messagelabel.hpp"
+#include "./operator_metrics.hpp"
 #include "./operator_spec.hpp"
 #include "./resource.hpp"
 
@@ -123,6 +125,7 @@ namespace holoscan {
 
 namespace gxf {
 class GXFExecutor;
+class GXFWrapper;
 }  // namespace gxf
 
 /**
@@ -565,6 +568,100 @@ class Operator : public ComponentBase {
    */
   std::shared_ptr<nvidia::gxf::GraphEntity> graph_entity() { return graph_entity_; }
 
+  /**
+   * @brief Get the execution metrics of the operator.
+   *
+   * The metrics are recorded by the executor around the calls to start(), compute() and stop().
+   *
+   * @return The reference to the OperatorMetrics object.
+   */
+  OperatorMetrics& metrics() { return *metrics_; }
+
+  /**
+   * @brief Get the thread pool the operator runs on.
+   *
+   * The thread pool is set by the executor when the fragment runs with a multi-threaded
+   * scheduler.
+   *
+   * @return The thread pool, or nullptr if the operator runs on the worker threads of the
+   * scheduler.
+   */
+  ThreadPool* thread_pool() const { return thread_pool_; }
+
+  /**
+   * @brief Set the relative deadline of the operator.
+   *
+   * The deadline is measured from the release of the frame being processed, which is the time the
+   * source operator of the frame ticked (or the time the frame was due, see period()). A frame for
+   * which compute() returns after the deadline is counted as a deadline miss in the metrics of the
+   * operator. With Fragment::deadline_scheduling() enabled, the operators with pending frames are
+   * also dispatched in the order of the absolute deadlines of their frames.
+   *
+   * Only native operators keep track of frames. Must be set before the fragment runs.
+   *
+   * @param relative_deadline The deadline relative to the release of the frame. Zero (the default)
+   * disables the deadline.
+   */
+  void deadline(std::chrono::nanoseconds relative_deadline) { deadline_ = relative_deadline; }
+
+  /**
+   * @brief Get the relative deadline of the operator.
+   *
+   * @return The deadline, or the period of the operator if no deadline is set (zero if neither
+   * is set).
+   */
+  std::chrono::nanoseconds deadline() const { return deadline_.count() > 0 ? deadline_ : period_; }
+
+  /**
+   * @brief Set the period of the operator.
+   *
+   * A source operator (an operator without input ports) releases a frame once per period: the
+   * frame of a tick is due one period after the previous tick, so that the time a late source
+   * waited to be scheduled counts towards the deadline of its frames. The period is also the
+   * deadline of the operator if no deadline is set. Must be set before the fragment runs.
+   *
+   * @param period The period of the operator. Zero (the default) disables it.
+   */
+  void period(std::chrono::nanoseconds period) { period_ = period; }
+
+  /**
+   * @brief Get the period of the operator.
+   *
+   * @return The period, zero if not set.
+   */
+  std::chrono::nanoseconds period() const { return period_; }
+
+  /**
+   * @brief Enable or disable the dropping of stale frames.
+   *
+   * When enabled, the input messages whose deadline already passed when the operator is about to
+   * compute are dropped instead of being computed. A periodic source operator that ticks after the
+   * deadline of its due frame drops the frames of the periods it missed since its previous tick,
+   * and computes the frame of the current period (or skips compute() if that frame is stale as
+   * well). Dropped frames are counted in the metrics of the operator. Has no effect if the operator
+   * has no deadline.
+   *
+   * @param enabled Whether to drop stale frames (disabled by default).
+   */
+  void drop_stale_frames(bool enabled) { drop_stale_frames_ = enabled; }
+
+  /**
+   * @brief Get whether stale frames are dropped.
+   *
+   * @return true if stale frames are dropped.
+   */
+  bool drop_stale_frames() const { return drop_stale_frames_; }
+
+  /**
+   * @brief Get the release time of the frame being processed by the operator.
+   *
+   * Frames are only tracked while the fragment has an operator with a deadline.
+   *
+   * @return The release time (in nanoseconds of std::chrono::steady_clock), or zero if frames are
+   * not tracked.
+   */
+  int64_t frame_release_ns() const { return frame_release_ns_; }
+
  protected:
   // Making the following classes as friend classes to allow them to access
   // get_consolidated_input_label, num_published_messages_map, update_input_message_label,
@@ -573,9 +670,12 @@ class Operator : public ComponentBase {
   friend class AnnotatedDoubleBufferReceiver;
   friend class AnnotatedDoubleBufferTransmitter;
   friend class DFFTCollector;
+  friend class FusedConnection;
 
   // Make GXFExecutor a friend class so it can call protected initialization methods
   friend class holoscan::gxf::GXFExecutor;
+  // GXFWrapper keeps track of the frame being processed
+  friend class holoscan::gxf::GXFWrapper;
   // Fragment should be able to call reset_graph_entities
   friend class Fragment;
 
@@ -626,7 +726,7 @@ class Operator : public ComponentBase {
    * @param m The new MessageLabel that will be set for the input port
    */
   void update_input_message_label(std::string input_name, MessageLabel m) {
-    input_message_labels[input_name] = m;
+    input_message_labels[input_name] = std::move(m);
   }
 
   /**
@@ -733,6 +833,14 @@ class Operator : public ComponentBase {
       resources_;                                           ///< The resources used by the operator.
   std::shared_ptr<nvidia::gxf::GraphEntity> graph_entity_;  ///< GXF graph entity corresponding to
                                                             ///< the Operator
+  /// The execution metrics of the operator.
+  std::shared_ptr<OperatorMetrics> metrics_ = std::make_shared<OperatorMetrics>();
+  ThreadPool* thread_pool_ = nullptr;  ///< The thread pool the operator is assigned to, if any.
+  std::chrono::nanoseconds deadline_{0};  ///< The relative deadline of the operator.
+  std::chrono::nanoseconds period_{0};    ///< The period of the operator.
+  bool drop_stale_frames_ = false;        ///< Whether stale frames are dropped.
+  bool track_frame_release_ = false;      ///< Whether frames are tracked (set by the executor).
+  int64_t frame_release_ns_ = 0;          ///< The release time of the frame being processed.
 
  private:
   ///  Set the operator codelet or any other backend codebase.
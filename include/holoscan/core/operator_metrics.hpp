@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_OPERATOR_METRICS_HPP
+#define HOLOSCAN_CORE_OPERATOR_METRICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./latency_histogram.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Statistics of the execution of an operator.
+ *
+ * Durations are in milliseconds. Interval and queue depth statistics are zero until the operator
+ * ticked at least twice, respectively once.
+ */
+struct OperatorStatistics {
+  uint64_t tick_count = 0;              ///< Number of calls to compute().
+  double compute_time_mean_ms = 0.0;    ///< Average duration of compute().
+  double compute_time_max_ms = 0.0;     ///< Longest duration of compute().
+  double compute_time_p50_ms = 0.0;     ///< Median duration of compute().
+  double compute_time_p99_ms = 0.0;     ///< 99th percentile of the duration of compute().
+  double interval_mean_ms = 0.0;        ///< Average time between the start of consecutive ticks.
+  double interval_max_ms = 0.0;         ///< Longest time between the start of consecutive ticks.
+  double input_queue_depth_mean = 0.0;  ///< Average number of queued input messages at tick.
+  uint64_t input_queue_depth_max = 0;   ///< Largest number of queued input messages at tick.
+  double start_time_ms = 0.0;           ///< Duration of start().
+  double stop_time_ms = 0.0;            ///< Duration of stop().
+  uint64_t deadline_miss_count = 0;     ///< Number of frames completed after their deadline.
+  double max_lateness_ms = 0.0;         ///< Longest delay past the deadline of a frame.
+  uint64_t dropped_frame_count = 0;     ///< Number of stale frames dropped before compute().
+  /// Non-empty buckets of the compute() duration histogram, as (bucket upper bound in
+  /// microseconds, count) pairs in increasing order of the bound.
+  std::vector<std::pair<uint64_t, uint64_t>> compute_time_histogram;
+};
+
+/**
+ * @brief Execution metrics of an operator, recorded by the executor around start(), compute()
+ * and stop().
+ *
+ * The ticks of an operator never overlap, so a single thread records at a time. Recording only
+ * uses relaxed atomic loads and stores, also into the histogram, so that metrics can stay
+ * enabled in production. The statistics can be read from any thread while the operator runs;
+ * counters updated by a concurrent tick may then be off by one tick.
+ */
+class OperatorMetrics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  OperatorMetrics() = default;
+
+  // Atomic counters are neither copyable nor movable.
+  OperatorMetrics(const OperatorMetrics&) = delete;
+  OperatorMetrics& operator=(const OperatorMetrics&) = delete;
+
+  /**
+   * @brief Record a call to start().
+   *
+   * @param begin The time start() was called.
+   * @param end The time start() returned.
+   */
+  void record_start(Clock::time_point begin, Clock::time_point end);
+
+  /**
+   * @brief Record a call to stop().
+   *
+   * @param begin The time stop() was called.
+   * @param end The time stop() returned.
+   */
+  void record_stop(Clock::time_point begin, Clock::time_point end);
+
+  /**
+   * @brief Record a call to compute().
+   *
+   * @param begin The time compute() was called.
+   * @param end The time compute() returned.
+   * @param input_queue_depth The number of messages queued on the input ports before the call.
+   * @return true if the summary log period elapsed since the last summary.
+   */
+  bool record_tick(Clock::time_point begin, Clock::time_point end, uint64_t input_queue_depth) {
+    const int64_t begin_ns = to_ns(begin);
+    const int64_t end_ns = to_ns(end);
+    const int64_t compute_ns = end_ns - begin_ns;
+    const uint64_t count = tick_count_.load(std::memory_order_relaxed);
+
+    if (count > 0) {
+      const int64_t interval_ns = begin_ns - last_tick_ns_.load(std::memory_order_relaxed);
+      store_add(interval_sum_ns_, interval_ns);
+      store_max(interval_max_ns_, interval_ns);
+    }
+    last_tick_ns_.store(begin_ns, std::memory_order_relaxed);
+    store_add(compute_sum_ns_, compute_ns);
+    store_max(compute_max_ns_, compute_ns);
+    compute_histogram_.record_single_writer(compute_ns / 1000);
+    queue_depth_sum_.store(queue_depth_sum_.load(std::memory_order_relaxed) + input_queue_depth,
+                           std::memory_order_relaxed);
+    if (input_queue_depth > queue_depth_max_.load(std::memory_order_relaxed)) {
+      queue_depth_max_.store(input_queue_depth, std::memory_order_relaxed);
+    }
+    tick_count_.store(count + 1, std::memory_order_relaxed);
+
+    if (log_period_ns_ <= 0 || end_ns < next_log_ns_) { return false; }
+    next_log_ns_ = end_ns + log_period_ns_;
+    return true;
+  }
+
+  /**
+   * @brief Record a frame completed after its deadline.
+   *
+   * @param lateness_ns The delay past the deadline, in nanoseconds.
+   */
+  void record_deadline_miss(int64_t lateness_ns) {
+    deadline_miss_count_.store(deadline_miss_count_.load(std::memory_order_relaxed) + 1,
+                               std::memory_order_relaxed);
+    store_max(max_lateness_ns_, lateness_ns);
+  }
+
+  /**
+   * @brief Record stale frames dropped instead of being computed.
+   *
+   * @param count The number of dropped frames.
+   */
+  void record_dropped_frames(uint64_t count) {
+    dropped_frame_count_.store(dropped_frame_count_.load(std::memory_order_relaxed) + count,
+                               std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Set the period of the summary log.
+   *
+   * @param period_ms The period in milliseconds. Zero or a negative value disables the log.
+   */
+  void log_period(int64_t period_ms);
+
+  /// Reset all metrics to zero.
+  void reset();
+
+  /// Return the statistics recorded so far.
+  OperatorStatistics statistics() const;
+
+  /// Return a one-line summary of the statistics, as written to the summary log.
+  std::string summary() const;
+
+ private:
+  static int64_t to_ns(Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+  }
+
+  // Single writer: plain load/store pairs are enough and avoid locked read-modify-write
+  // instructions.
+  static void store_add(std::atomic<int64_t>& counter, int64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  }
+  static void store_max(std::atomic<int64_t>& counter, int64_t value) {
+    if (value > counter.load(std::memory_order_relaxed)) {
+      counter.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<uint64_t> tick_count_{0};
+  std::atomic<int64_t> last_tick_ns_{0};
+  std::atomic<int64_t> compute_sum_ns_{0};
+  std::atomic<int64_t> compute_max_ns_{0};
+  std::atomic<int64_t> interval_sum_ns_{0};
+  std::atomic<int64_t> interval_max_ns_{0};
+  std::atomic<uint64_t> queue_depth_sum_{0};
+  std::atomic<uint64_t> queue_depth_max_{0};
+  std::atomic<int64_t> start_ns_{0};
+  std::atomic<int64_t> stop_ns_{0};
+  std::atomic<uint64_t> deadline_miss_count_{0};
+  std::atomic<int64_t> max_lateness_ns_{0};
+  std::atomic<uint64_t> dropped_frame_count_{0};
+  LatencyHistogram compute_histogram_;  ///< Durations of compute() in microseconds.
+
+  // Set on start(), then only accessed by the thread ticking the operator.
+  int64_t log_period_ns_ = 0;
+  int64_t next_log_ns_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_OPERATOR_METRICS_HPP */
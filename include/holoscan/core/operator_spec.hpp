@@ -76,6 +76,24 @@ class OperatorSpec : public ComponentSpec {
     return *(iter->second.get());
   }
 
+  /**
+   * @brief Get the precompiled handle of an input port of this operator.
+   *
+   * The handle can be passed to InputContext::receive() instead of the port name to skip the
+   * lookup of the port by name.
+   *
+   * @param name The name of the input port.
+   * @return The handle of the input port (invalid if there is no input port with the name).
+   */
+  PortHandle input_handle(const std::string& name) {
+    auto it = inputs_.find(name);
+    if (it == inputs_.end()) {
+      HOLOSCAN_LOG_ERROR("Input port '{}' does not exist", name);
+      return PortHandle();
+    }
+    return PortHandle(it->second.get());
+  }
+
   /**
    * @brief Get output specifications of this operator.
    *
@@ -109,6 +127,24 @@ class OperatorSpec : public ComponentSpec {
     return *(iter->second.get());
   }
 
+  /**
+   * @brief Get the precompiled handle of an output port of this operator.
+   *
+   * The handle can be passed to OutputContext::emit() instead of the port name to skip the
+   * lookup of the port by name.
+   *
+   * @param name The name of the output port.
+   * @return The handle of the output port (invalid if there is no output port with the name).
+   */
+  PortHandle output_handle(const std::string& name) {
+    auto it = outputs_.find(name);
+    if (it == outputs_.end()) {
+      HOLOSCAN_LOG_ERROR("Output port '{}' does not exist", name);
+      return PortHandle();
+    }
+    return PortHandle(it->second.get());
+  }
+
   using ComponentSpec::param;
 
   /**
@@ -59,6 +59,17 @@ class AnnotatedDoubleBufferTransmitter : public nvidia::gxf::DoubleBufferTransmi
    */
   void op(holoscan::Operator* op) { this->op_ = op; }
 
+  /**
+   * @brief Add the consolidated input MessageLabel of the given operator to a message entity.
+   *
+   * @param context The GXF context of the message entity.
+   * @param uid The uid of the message entity.
+   * @param op The operator publishing the message.
+   * @return GXF_SUCCESS if the MessageLabel is added.
+   */
+  static gxf_result_t add_message_label(gxf_context_t context, gxf_uid_t uid,
+                                        holoscan::Operator* op);
+
  private:
   holoscan::Operator* op_ = nullptr;  ///< The operator that this transmitter is attached to.
 
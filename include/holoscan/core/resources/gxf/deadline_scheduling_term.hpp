@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_DEADLINE_SCHEDULING_TERM_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_DEADLINE_SCHEDULING_TERM_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gxf/core/gxf.h>
+#include <gxf/std/receiver.hpp>
+#include <gxf/std/scheduling_term.hpp>
+
+namespace holoscan {
+
+/**
+ * @brief Release time of the frame a message belongs to.
+ *
+ * Added to the messages emitted by native operators while their fragment has an operator with a
+ * deadline. The release time is set by the source operator of the frame and passed on by the
+ * downstream operators, so that the deadline of an operator is measured from the release of the
+ * frame it processes.
+ */
+struct FrameRelease {
+  int64_t time_ns = 0;  ///< The release time, in nanoseconds of std::chrono::steady_clock.
+};
+
+/**
+ * @brief Earliest-deadline-first arbitration between the operator entities of a fragment.
+ *
+ * Shared by the DeadlineSchedulingTerm components of a fragment. An entity with a pending frame
+ * is dispatched only while the number of dispatched or running entities, plus the number of
+ * pending entities whose frames have earlier deadlines, is below the number of worker threads of
+ * the scheduler. Otherwise it is held back until an entity finishes executing.
+ *
+ * A pending entity stops holding back the other entities once its deadline passed and it has
+ * been pending for kMaxHoldNs, and a dispatched entity that did not start running within
+ * kMaxHoldNs (e.g. because another scheduling term of its entity is not ready) is no longer
+ * counted, so that an entity blocked by its other conditions cannot block the other entities.
+ */
+class DeadlineArbiter {
+ public:
+  /// The time an entity can hold back the other entities without running.
+  static constexpr int64_t kMaxHoldNs = 1000000;
+  /// The deadline of the frames of entities without a deadline.
+  static constexpr int64_t kNoDeadline = INT64_MAX;
+
+  /**
+   * @brief Create an arbiter.
+   *
+   * @param worker_count The number of worker threads of the scheduler.
+   */
+  explicit DeadlineArbiter(int64_t worker_count);
+
+  /**
+   * @brief Register an entity. Must be called before the fragment runs.
+   *
+   * @param eid The entity ID.
+   * @return The slot of the entity.
+   */
+  size_t add_entity(gxf_uid_t eid);
+
+  /**
+   * @brief Decide whether an entity with a pending frame can be dispatched.
+   *
+   * @param slot The slot of the entity.
+   * @param now_ns The current time, in nanoseconds of std::chrono::steady_clock.
+   * @param deadline_ns The absolute deadline of the pending frame, or kNoDeadline.
+   * @param wait_until_ns Set to the time the entity should be checked again if it is held back.
+   * @return true if the entity is dispatched.
+   */
+  bool try_dispatch(size_t slot, int64_t now_ns, int64_t deadline_ns, int64_t* wait_until_ns);
+
+  /**
+   * @brief Mark an entity as having no pending frame.
+   *
+   * @param slot The slot of the entity.
+   */
+  void set_idle(size_t slot);
+
+  /**
+   * @brief Mark an entity as running. Called by the operators when they start computing.
+   *
+   * @param slot The slot of the entity.
+   */
+  void on_started(size_t slot);
+
+  /**
+   * @brief Mark an entity as executed.
+   *
+   * @param slot The slot of the entity.
+   * @return The IDs of the entities held back, which must be notified to be checked again.
+   */
+  std::vector<gxf_uid_t> on_executed(size_t slot);
+
+ private:
+  enum class State { kIdle, kPending, kDispatched, kRunning };
+
+  struct Entry {
+    gxf_uid_t eid = 0;
+    State state = State::kIdle;
+    int64_t deadline_ns = kNoDeadline;  ///< The deadline of the pending frame.
+    int64_t since_ns = 0;               ///< The time the entity became pending or dispatched.
+  };
+
+  std::mutex mutex_;
+  int64_t worker_count_ = 1;
+  std::vector<Entry> entries_;
+};
+
+/**
+ * @brief Scheduling term dispatching operator entities in earliest-deadline-first order.
+ *
+ * Added by the executor to the entity of each operator with input ports when
+ * Fragment::deadline_scheduling() is enabled. The entity has a pending frame when every receiver
+ * with a message-available condition holds a message. The deadline of the frame is the earliest
+ * release time (see FrameRelease) of the messages at the front of the receivers plus the relative
+ * deadline of the operators of the entity. Whether the entity is dispatched is decided by the
+ * DeadlineArbiter of the fragment.
+ */
+class DeadlineSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+  /**
+   * @brief Register the entity of this term with an arbiter.
+   *
+   * @param arbiter The arbiter of the fragment.
+   * @param receivers The receivers that must hold a message for the entity to have a pending
+   * frame.
+   * @param relative_deadline_ns The relative deadline of the entity, zero if it has none.
+   */
+  void configure(std::shared_ptr<DeadlineArbiter> arbiter,
+                 std::vector<nvidia::gxf::Receiver*> receivers, int64_t relative_deadline_ns);
+
+  /// Mark the entity as running. Called by the operators of the entity when they tick.
+  void on_started();
+
+ private:
+  std::shared_ptr<DeadlineArbiter> arbiter_;
+  size_t slot_ = 0;
+  std::vector<nvidia::gxf::Receiver*> receivers_;
+  int64_t relative_deadline_ns_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_DEADLINE_SCHEDULING_TERM_HPP */
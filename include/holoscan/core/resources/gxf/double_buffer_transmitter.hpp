@@ -53,6 +53,15 @@ class DoubleBufferTransmitter : public Transmitter {
    */
   void track();
 
+  /**
+   * @brief Publish every message directly into all downstream receivers and use
+   * holoscan::FanOutDoubleBufferTransmitter as the GXF Component.
+   *
+   * Data flow tracking is handled by the fan-out transmitter itself when the transmitter is
+   * tracked as well.
+   */
+  void fan_out();
+
   nvidia::gxf::DoubleBufferTransmitter* get() const;
 
   Parameter<uint64_t> capacity_;
@@ -60,6 +69,7 @@ class DoubleBufferTransmitter : public Transmitter {
 
  private:
   bool tracking_ = false;  ///< Used to decide whether to use data flow tracking or not.
+  bool fan_out_ = false;   ///< Used to decide whether to publish to all receivers directly.
 };
 
 }  // namespace holoscan
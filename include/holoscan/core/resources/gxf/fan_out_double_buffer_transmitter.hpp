@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RESOURCES_GXF_FAN_OUT_DOUBLE_BUFFER_TRANSMITTER_HPP
+#define CORE_RESOURCES_GXF_FAN_OUT_DOUBLE_BUFFER_TRANSMITTER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gxf/core/component.hpp>
+#include <gxf/core/entity.hpp>
+#include <gxf/core/handle.hpp>
+#include <gxf/core/parameter.hpp>
+#include <gxf/std/receiver.hpp>
+#include <gxf/std/scheduling_term.hpp>
+
+#include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class Operator;
+
+/**
+ * @brief FanOutDoubleBufferTransmitter class publishes every message directly into all of its
+ * downstream receivers.
+ *
+ * It replaces the implicit Broadcast entity that is otherwise inserted for an output port that is
+ * connected to more than one input port. The receivers are registered by the executor with
+ * add_receiver() instead of being connected through GXF Connection components.
+ *
+ * When no receiver is registered (e.g. the output port is served by a Broadcast entity because
+ * one of its targets is in another fragment), it behaves like a DoubleBufferTransmitter.
+ */
+class FanOutDoubleBufferTransmitter : public nvidia::gxf::DoubleBufferTransmitter {
+ public:
+  FanOutDoubleBufferTransmitter() = default;
+
+  /**
+   * @brief Override the DoubleBufferTransmitter::publish_abi() function. It pushes the published
+   * GXF Entity into every registered receiver and notifies the receivers' entities.
+   *
+   * Each receiver applies its own capacity and policy when it is full. If an operator is set,
+   * a MessageLabel is added to the message first, like AnnotatedDoubleBufferTransmitter does.
+   */
+  gxf_result_t publish_abi(gxf_uid_t uid) override;
+
+  /**
+   * @brief Register a downstream receiver of this transmitter.
+   *
+   * @param receiver The receiver to publish messages into.
+   */
+  void add_receiver(nvidia::gxf::Receiver* receiver);
+
+  /// Get the registered downstream receivers.
+  const std::vector<nvidia::gxf::Receiver*>& receivers() const { return receivers_; }
+
+  /**
+   * @brief Check whether every downstream receiver can accept the given number of messages.
+   *
+   * If no receiver is registered, the own queue of this transmitter is checked instead.
+   *
+   * @param min_size The number of messages to be accepted.
+   * @return true if all receivers have at least `min_size` free slots.
+   */
+  bool is_receptive(uint64_t min_size);
+
+  holoscan::Operator* op() { return op_; }
+
+  /**
+   * @brief Set the associated operator for this transmitter to track the data flow. It is set at
+   * the @see create_output_port() function when data flow tracking is enabled.
+   *
+   * @param op The operator that this transmitter is attached to.
+   */
+  void op(holoscan::Operator* op) { this->op_ = op; }
+
+ private:
+  std::vector<nvidia::gxf::Receiver*> receivers_;  ///< The downstream receivers.
+  holoscan::Operator* op_ = nullptr;  ///< The operator that this transmitter is attached to.
+
+  /// The concatenated name of the operator and this transmitter.
+  std::string op_transmitter_name_pair_;
+};
+
+/**
+ * @brief Scheduling term which permits execution only when all downstream receivers of a
+ * FanOutDoubleBufferTransmitter can accept new messages.
+ *
+ * This is the counterpart of nvidia::gxf::DownstreamReceptiveSchedulingTerm for fan-out output
+ * ports, whose receivers are not known to the GXF connection router.
+ */
+class FanOutReceptiveSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+  /**
+   * @brief Set the fan-out transmitter whose receivers are checked.
+   *
+   * @param transmitter The fan-out transmitter of the output port.
+   */
+  void transmitter(FanOutDoubleBufferTransmitter* transmitter) { transmitter_ = transmitter; }
+
+ private:
+  nvidia::gxf::Parameter<uint64_t> min_size_;
+  FanOutDoubleBufferTransmitter* transmitter_ = nullptr;
+};
+
+}  // namespace holoscan
+
+#endif /* CORE_RESOURCES_GXF_FAN_OUT_DOUBLE_BUFFER_TRANSMITTER_HPP */
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_MESSAGE_OR_EVENT_SCHEDULING_TERM_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_MESSAGE_OR_EVENT_SCHEDULING_TERM_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <gxf/core/gxf.h>
+#include <gxf/std/receiver.hpp>
+#include <gxf/std/scheduling_term.hpp>
+
+namespace holoscan {
+
+/**
+ * @brief Scheduling term executing an entity on new messages or on an event of another thread.
+ *
+ * Replaces the message-available conditions of the receivers of an operator whose results are
+ * also produced by a thread of its own. The entity is ready when every receiver holds a message,
+ * or once notify() was called. The scheduling terms of an entity are AND-combined, so an
+ * AsynchronousCondition added next to the message-available conditions of the receivers could
+ * not execute the entity without a new message.
+ *
+ * While an event is expected, the entity waits for the time it is expected at instead of
+ * waiting for a message, so that the scheduler does not stop the application as deadlocked once
+ * the upstream operators are done.
+ */
+class MessageOrEventSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  /// The period the entity is checked at once the expected time of the event passed.
+  static constexpr int64_t kRecheckPeriodNs = 1000000;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+  /**
+   * @brief Set the receivers that must hold a message for the entity to be ready.
+   *
+   * @param receivers The receivers whose message-available conditions are replaced.
+   */
+  void receivers(std::vector<nvidia::gxf::Receiver*> receivers);
+
+  /// Check whether every receiver holds a message.
+  bool has_messages() const;
+
+  /**
+   * @brief Set the time an event is expected at.
+   *
+   * @param event_time_ns The time, in nanoseconds of std::chrono::steady_clock, or zero if no
+   * event is expected.
+   */
+  void expect_event(int64_t event_time_ns);
+
+  /// Signal the event and make the entity ready. Can be called from any thread.
+  void notify();
+
+  /**
+   * @brief Reset the event, before handling it.
+   *
+   * @return true if the event was signaled.
+   */
+  bool consume_event();
+
+ private:
+  std::vector<nvidia::gxf::Receiver*> receivers_;
+  std::atomic<bool> event_signaled_{false};
+  std::atomic<int64_t> event_time_ns_{0};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_MESSAGE_OR_EVENT_SCHEDULING_TERM_HPP */
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_THREAD_POOL_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_THREAD_POOL_HPP
+
+#include <sched.h>  // for cpu_set_t
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gxf/std/resources.hpp>
+
+#include "../../gxf/gxf_resource.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Thread pool resource.
+ *
+ * A pool of worker threads of the multi-threaded schedulers (`MultiThreadScheduler` and
+ * `EventBasedScheduler`). Operators added to the pool with `pin_operator=true` always run on a
+ * dedicated thread of the pool instead of on the shared worker threads of the scheduler. Thread
+ * pools are created with `Fragment::make_thread_pool()`.
+ *
+ * The threads running the pinned operators of the pool can be restricted to a set of CPU cores
+ * (`cpu_cores`) or to the CPUs of a NUMA node (`numa_node`), as reported by
+ * `CPUResourceMonitor`, and can run with the real-time `SCHED_FIFO` policy (`sched_priority`).
+ * The affinity and the policy are applied when the operator starts on the thread. With a
+ * `sched_priority`, the `strict_job_thread_pinning` parameter of the `MultiThreadScheduler` is
+ * enabled unless it was set explicitly, so that operators that are not pinned do not run on the
+ * real-time threads.
+ * Setting the `SCHED_FIFO` policy requires the `CAP_SYS_NICE` capability (or a suitable
+ * `RLIMIT_RTPRIO`); if it is denied an error is logged and the operator runs with the default
+ * policy.
+ *
+ * Operators can also be assigned by name with the `operators` parameter, so that pools can be
+ * configured from a YAML file:
+ *
+ * ```yaml
+ * realtime_pool:
+ *   initial_size: 2
+ *   numa_node: 0
+ *   sched_priority: 50
+ *   operators: [source, inference]
+ * ```
+ *
+ * ```cpp
+ * auto pool = make_thread_pool("realtime_pool", from_config("realtime_pool"));
+ * ```
+ *
+ * An operator can be assigned to a single thread pool. As a GXF entity can only belong to one
+ * entity group, operators with UCX (inter-fragment) ports cannot be assigned to a thread pool.
+ *
+ * ==Parameters==
+ *
+ * - **initial_size** (int64_t, optional): The number of threads of the pool (default: 1). The
+ * pool needs at least one thread per pinned operator.
+ * - **cpu_cores** (std::vector<int32_t>, optional): The CPU cores (as numbered by the OS) that the
+ * threads of pinned operators may run on.
+ * - **numa_node** (int32_t, optional): The NUMA node whose CPUs the threads of pinned operators
+ * may run on. Ignored if `cpu_cores` is set.
+ * - **sched_priority** (int32_t, optional): If positive, the threads of pinned operators run with
+ * the `SCHED_FIFO` policy and this priority (1-99). Default: 0 (the policy is not changed).
+ * - **operators** (std::vector<std::string>, optional): The names of operators to add to the pool.
+ * - **pin_operators** (bool, optional): Whether the operators of the `operators` parameter are
+ * pinned to a thread of the pool (default: true).
+ */
+class ThreadPool : public gxf::GXFResource {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(ThreadPool, gxf::GXFResource)
+  ThreadPool() = default;
+
+  const char* gxf_typename() const override { return "nvidia::gxf::ThreadPool"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  void initialize() override;
+
+  /**
+   * @brief Add an operator to the thread pool.
+   *
+   * @param op The operator.
+   * @param pin_operator Whether the operator always runs on a dedicated thread of the pool.
+   */
+  void add(const std::shared_ptr<Operator>& op, bool pin_operator = true);
+
+  /**
+   * @brief Add operators to the thread pool.
+   *
+   * @param ops The operators.
+   * @param pin_operator Whether the operators always run on a dedicated thread of the pool.
+   */
+  void add(const std::vector<std::shared_ptr<Operator>>& ops, bool pin_operator = true);
+
+  /// Get the operators of the thread pool.
+  const std::vector<std::shared_ptr<Operator>>& operators() const { return operators_; }
+
+  /// Whether the operator is pinned to a dedicated thread of the pool.
+  bool is_pinned(const Operator* op) const { return pinned_operators_.count(op) != 0; }
+
+  /// Get the number of threads of the pool.
+  int64_t initial_size();
+
+  /// Whether the threads of pinned operators are restricted to a set of CPUs.
+  bool has_cpu_affinity() const { return CPU_COUNT(&cpu_set_) > 0; }
+
+  /// Get the set of CPUs the threads of pinned operators may run on (empty if not restricted).
+  const cpu_set_t& cpu_set() const { return cpu_set_; }
+
+  /// Get the SCHED_FIFO priority of the threads of pinned operators (0 if not real-time).
+  int32_t sched_priority() const { return sched_priority_value_; }
+
+  /**
+   * @brief Apply the CPU affinity and the scheduling policy of the pool to the calling thread.
+   *
+   * Called by pinned operators from the thread of the pool they run on.
+   *
+   * @return true if the thread was configured successfully (or there is nothing to configure).
+   */
+  bool configure_current_thread() const;
+
+  nvidia::gxf::ThreadPool* get() const;
+
+ protected:
+  bool is_gxf_parameter(const std::string& key) const override;
+
+ private:
+  /// Resolve the parameters that are applied by Holoscan rather than by nvidia::gxf::ThreadPool.
+  void resolve_holoscan_parameters();
+
+  Parameter<int64_t> initial_size_;
+
+  // Parameters applied by Holoscan, which are not passed on to the GXF component
+  Parameter<std::vector<int32_t>> cpu_cores_;
+  Parameter<int32_t> numa_node_;
+  Parameter<int32_t> sched_priority_;
+  Parameter<std::vector<std::string>> operator_names_;
+  Parameter<bool> pin_operators_;
+
+  std::vector<std::shared_ptr<Operator>> operators_;
+  std::unordered_set<const Operator*> pinned_operators_;
+  cpu_set_t cpu_set_{};
+  int32_t sched_priority_value_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_THREAD_POOL_HPP */
@@ -45,9 +45,21 @@ class EventBasedScheduler : public gxf::GXFScheduler {
   int64_t worker_thread_number() { return worker_thread_number_; }
   bool stop_on_deadlock() { return stop_on_deadlock_; }
   int64_t stop_on_deadlock_timeout() { return stop_on_deadlock_timeout_; }
+  bool thread_pool_allocation_auto() { return thread_pool_allocation_auto_; }
+  bool strict_job_thread_pinning() { return strict_job_thread_pinning_; }
   // could return std::optional<int64_t>, but just using int64_t simplifies the Python bindings
   int64_t max_duration_ms() { return max_duration_ms_.has_value() ? max_duration_ms_.get() : -1; }
 
+  /**
+   * @brief Enable `strict_job_thread_pinning`, unless it was set explicitly.
+   *
+   * Called by the executor when a thread pool runs its pinned operators with a real-time
+   * priority, as other operators running on the thread of a pinned operator would inherit it.
+   *
+   * @return true if strict job-thread pinning is enabled.
+   */
+  bool enable_strict_job_thread_pinning();
+
   nvidia::gxf::EventBasedScheduler* get() const;
 
  private:
@@ -56,8 +68,8 @@ class EventBasedScheduler : public gxf::GXFScheduler {
   Parameter<bool> stop_on_deadlock_;
   Parameter<int64_t> max_duration_ms_;
   Parameter<int64_t> stop_on_deadlock_timeout_;  // in ms
-  // The following parameter needs to wait on ThreadPool support
-  // Parameter<bool> thread_pool_allocation_auto_;
+  Parameter<bool> thread_pool_allocation_auto_;
+  Parameter<bool> strict_job_thread_pinning_;
 };
 
 }  // namespace holoscan
@@ -46,9 +46,21 @@ class MultiThreadScheduler : public gxf::GXFScheduler {
   bool stop_on_deadlock() { return stop_on_deadlock_; }
   int64_t check_recession_period_ms() { return check_recession_period_ms_; }
   int64_t stop_on_deadlock_timeout() { return stop_on_deadlock_timeout_; }
+  bool thread_pool_allocation_auto() { return thread_pool_allocation_auto_; }
+  bool strict_job_thread_pinning() { return strict_job_thread_pinning_; }
   // could return std::optional<int64_t>, but just using int64_t simplifies the Python bindings
   int64_t max_duration_ms() { return max_duration_ms_.has_value() ? max_duration_ms_.get() : -1; }
 
+  /**
+   * @brief Enable `strict_job_thread_pinning`, unless it was set explicitly.
+   *
+   * Called by the executor when a thread pool runs its pinned operators with a real-time
+   * priority, as other operators running on the thread of a pinned operator would inherit it.
+   *
+   * @return true if strict job-thread pinning is enabled.
+   */
+  bool enable_strict_job_thread_pinning();
+
   nvidia::gxf::MultiThreadScheduler* get() const;
 
  private:
@@ -58,9 +70,8 @@ class MultiThreadScheduler : public gxf::GXFScheduler {
   Parameter<double> check_recession_period_ms_;
   Parameter<int64_t> max_duration_ms_;
   Parameter<int64_t> stop_on_deadlock_timeout_;  // in ms
-  // The following two parameters need to wait on ThreadPool support
-  // Parameter<bool> thread_pool_allocation_auto_;
-  // Parameter<bool> strict_job_thread_pinning_;
+  Parameter<bool> thread_pool_allocation_auto_;
+  Parameter<bool> strict_job_thread_pinning_;
 };
 
 }  // namespace holoscan
@@ -184,6 +184,36 @@ class CPUResourceMonitor {
    */
   cpu_set_t cpu_set() const;
 
+  /**
+   * @brief Get the number of NUMA nodes.
+   *
+   * @return The number of NUMA nodes of the system (1 on systems without NUMA support).
+   */
+  int32_t num_numa_nodes() const;
+
+  /**
+   * @brief Get the CPU set of a NUMA node.
+   *
+   * The returned set contains the logical processors (as numbered by the OS, e.g., for
+   * `sched_setaffinity`) that belong to the given NUMA node.
+   *
+   * Example:
+   *
+   * ```cpp
+   * holoscan::Topology topology;
+   * topology.load();
+   * holoscan::CPUResourceMonitor cpu_resource_monitor(topology.context());
+   * for (int32_t node = 0; node < cpu_resource_monitor.num_numa_nodes(); node++) {
+   *   cpu_set_t cpu_set = cpu_resource_monitor.numa_node_cpu_set(node);
+   *   HOLOSCAN_LOG_INFO("NUMA node {} has {} CPUs", node, CPU_COUNT(&cpu_set));
+   * }
+   * ```
+   *
+   * @param numa_node The index of the NUMA node.
+   * @return The CPU set of the NUMA node. The set is empty if the index is out of range.
+   */
+  cpu_set_t numa_node_cpu_set(int32_t numa_node) const;
+
  protected:
   void* context_ = nullptr;                     ///< The context of the CPU resource monitor
   uint64_t metric_flags_ = kDefaultCpuMetrics;  ///< The metric flags
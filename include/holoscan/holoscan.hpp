@@ -62,6 +62,7 @@
 #include "./core/resources/gxf/std_component_serializer.hpp"
 #include "./core/resources/gxf/std_entity_serializer.hpp"
 #include "./core/resources/gxf/unbounded_allocator.hpp"
+#include "./core/resources/gxf/thread_pool.hpp"
 #include "./core/resources/gxf/ucx_component_serializer.hpp"
 #include "./core/resources/gxf/ucx_entity_serializer.hpp"
 #include "./core/resources/gxf/ucx_holoscan_component_serializer.hpp"
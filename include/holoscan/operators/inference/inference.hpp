@@ -18,11 +18,15 @@
 #ifndef HOLOSCAN_OPERATORS_INFERENCE_HPP
 #define HOLOSCAN_OPERATORS_INFERENCE_HPP
 
+#include <cstdint>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "gxf/std/timestamp.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/core/io_spec.hpp"
 #include "holoscan/core/operator.hpp"
@@ -35,6 +39,10 @@
 
 namespace HoloInfer = holoscan::inference;
 
+namespace holoscan {
+class MessageOrEventSchedulingTerm;
+}  // namespace holoscan
+
 namespace holoscan::ops {
 /**
  * @brief Inference Operator class to perform single/multi model inference.
@@ -83,6 +91,43 @@ namespace holoscan::ops {
  *   (default: `false`).
  * - **cuda_stream_pool**: `holoscan::CudaStreamPool` instance to allocate CUDA streams. Optional
  *   (default: `nullptr`).
+ * - **intra_op_num_threads**: Number of threads parallelizing the execution within nodes, `0`
+ *   uses the number of physical cores. Only used by the `"onnxrt"` backend. Optional
+ *   (default: `1`).
+ * - **inter_op_num_threads**: Number of threads parallelizing the execution across nodes, `0`
+ *   uses the number of physical cores. Only used by the `"onnxrt"` backend. Optional
+ *   (default: `1`).
+ * - **graph_optimization_level**: Graph optimization level, one of `"disable"`, `"basic"`,
+ *   `"extended"` or `"all"`. Only used by the `"onnxrt"` backend. Optional
+ *   (default: `"extended"`).
+ * - **execution_mode**: Execution mode of the graph, `"sequential"` or `"parallel"`. Only used by
+ *   the `"onnxrt"` backend. Optional (default: `"sequential"`).
+ * - **use_global_thread_pool**: Share one pool of threads across the sessions of all models
+ *   instead of creating threads per session. Only used by the `"onnxrt"` backend. Optional
+ *   (default: `false`).
+ * - **optimized_model_cache_dir**: Directory caching the optimized models, reused across runs
+ *   while the model and the onnxruntime settings are unchanged. Only used by the `"onnxrt"`
+ *   backend. Optional (default: `""`, no cache).
+ * - **batch_size_map**: Mapping of model (`DataMap`) to the maximum number of frames inferred
+ *   in one batch. The model must have a dynamic batch dimension and use the `"onnxrt"` backend.
+ *   The results of the inferred frames are transmitted one message per tick, in the order frames
+ *   were received, and the operator is executed again without a new input until all of them are
+ *   transmitted. The `receivers` ports without conditions of their own are then not given
+ *   message-available conditions: the operator is executed when every port holds a message or
+ *   results are available. Optional.
+ * - **batch_delay_map**: Mapping of model (`DataMap`) to the longest time in milliseconds a frame
+ *   waits for its batch to fill up. An incomplete batch is inferred once the delay expires, and
+ *   its results are transmitted without waiting for a new input. Batches still incomplete when
+ *   the operator is stopped are inferred but their results are not transmitted. Optional
+ *   (default: `0`, a batch is inferred on every tick).
+ * - **skip_threshold_map**: Mapping of model (`DataMap`) to the mean absolute difference between
+ *   sampled input elements of a frame and of the last inferred frame below which the outputs of
+ *   the last inference are reused. Cannot be combined with batching. Optional.
+ * - **skip_max_frames_map**: Mapping of model (`DataMap`) to the largest number of consecutive
+ *   frames reusing the outputs of the last inference. Optional (default: `10`).
+ *
+ * The number of skipped frames per model is available with `skipped_inferences()`, also after
+ * the operator stopped.
  */
 class InferenceOp : public holoscan::Operator {
  public:
@@ -174,6 +219,36 @@ class InferenceOp : public holoscan::Operator {
   ///  @brief Backend to do inference on. Supported values: "trt", "torch", "onnxrt".
   Parameter<std::string> backend_;
 
+  ///  @brief Number of threads used within nodes by onnxruntime. Default is 1.
+  Parameter<int32_t> intra_op_num_threads_;
+
+  ///  @brief Number of threads used across nodes by onnxruntime. Default is 1.
+  Parameter<int32_t> inter_op_num_threads_;
+
+  ///  @brief Graph optimization level of onnxruntime. Default is "extended".
+  Parameter<std::string> graph_optimization_level_;
+
+  ///  @brief Execution mode of onnxruntime: "sequential" or "parallel". Default is "sequential".
+  Parameter<std::string> execution_mode_;
+
+  ///  @brief Flag to share a thread pool across onnxruntime sessions. Default is False.
+  Parameter<bool> use_global_thread_pool_;
+
+  ///  @brief Directory caching the models optimized by onnxruntime. Default is "", no cache.
+  Parameter<std::string> optimized_model_cache_dir_;
+
+  ///  @brief Map with key as model name and value as the maximum batch size of the model.
+  Parameter<DataMap> batch_size_map_;
+
+  ///  @brief Map with key as model name and value as the batch delay in milliseconds.
+  Parameter<DataMap> batch_delay_map_;
+
+  ///  @brief Map with key as model name and value as the input difference threshold of skipping.
+  Parameter<DataMap> skip_threshold_map_;
+
+  ///  @brief Map with key as model name and value as the largest number of consecutive skips.
+  Parameter<DataMap> skip_max_frames_map_;
+
   ///  @brief Backend map. Multiple backends can be combined in the same application.
   ///  Supported values: "trt" or "torch"
   Parameter<DataMap> backend_map_;
@@ -186,9 +261,22 @@ class InferenceOp : public holoscan::Operator {
 
   // Internal state
 
+  /// Value of a DataMap argument, before the parameters are set
+  DataMap data_map_arg(const std::string& name);
+
+  /// Executes the operator on new messages of the given input ports or on results of the batch
+  /// timer, in place of the message-available conditions of the ports
+  void add_results_term(const std::vector<std::string>& port_names);
+
   /// Pointer to inference context.
   std::unique_ptr<HoloInfer::InferContext> holoscan_infer_context_;
 
+  /// Number of skipped frames per model, kept once the inference context is released
+  std::map<std::string, uint64_t> skipped_inferences_;
+
+  /// Guards the inference context and the skipped frames against skipped_inferences()
+  mutable std::mutex skipped_inferences_mutex_;
+
   /// Pointer to inference specifications
   std::shared_ptr<HoloInfer::InferenceSpecs> inference_specs_;
 
@@ -196,6 +284,24 @@ class InferenceOp : public holoscan::Operator {
   /// dimensions.
   std::map<std::string, std::vector<int>> dims_per_tensor_;
 
+  /// Flag set if frames are queued for batched inference
+  bool batching_ = false;
+
+  /// Number of frames received, used as identifier of the queued frames
+  uint64_t frame_count_ = 0;
+
+  /// Timestamps of the queued frames, transmitted with their results
+  std::map<uint64_t, nvidia::gxf::Timestamp> frame_timestamps_;
+
+  /// Scheduling term notified by the batch timer and while results remain, set when batching
+  MessageOrEventSchedulingTerm* results_term_ = nullptr;
+
+  /// Longest batch delay of the batched models, in nanoseconds
+  int64_t batch_delay_ns_ = 0;
+
+  /// Times the queued frames were received, in nanoseconds of std::chrono::steady_clock
+  std::deque<int64_t> frame_enqueue_ns_;
+
   /// Operator Identifier, used in reporting.
   const std::string module_{"Inference Operator"};
 
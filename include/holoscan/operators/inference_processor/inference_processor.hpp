@@ -69,6 +69,10 @@ namespace holoscan::ops {
  * - **cuda_stream_pool**: `holoscan::CudaStreamPool` instance to allocate CUDA streams.
  *   Optional (default: `nullptr`).
  * - **config_path**: File path to the config file. Optional (default: `""`).
+ * - **fuse_operations**: Compile the operations of each tensor once into a plan and keep the
+ *   intermediate results of chained operations internal. The initialization fails if an
+ *   operation does not accept the data type or rank of the output of the previous one.
+ *   Optional (default: `false`).
  * - **disable_transmitter**: If `true`, disable the transmitter output port of the operator.
  *   Optional (default: `false`).
  */
@@ -123,6 +127,9 @@ class InferenceProcessorOp : public holoscan::Operator {
   ///  @brief Path to configuration file
   Parameter<std::string> config_path_;
 
+  ///  @brief Flag to run the operations of each tensor as a compiled plan
+  Parameter<bool> fuse_operations_;
+
   ///  @brief Vector of input tensor names
   Parameter<std::vector<std::string>> in_tensor_names_;
 
@@ -18,17 +18,29 @@
 #ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_RECORDER_HPP
 #define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_RECORDER_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
 #include "gxf/serialization/file_stream.hpp"
 
 namespace holoscan::ops {
 
+// Forward declarations
+class ChunkedFileWriter;
+
 /**
  * @brief Operator class to record a video stream to a file.
  *
@@ -44,8 +56,22 @@ namespace holoscan::ops {
  *
  * - **directory**: Directory path for storing files.
  * - **basename**: User specified file name without extension.
- * - **flush_on_tick**: Flushes output buffer on every tick when `true`.
- *   Optional (default: `false`).
+ * - **flush_on_tick**: Flushes output buffer on every tick when `true`. With `async_queue_size`
+ *   set, the writer thread flushes whenever its queue is drained. Optional (default: `false`).
+ * - **async_queue_size**: Number of entities which can be queued for the writer thread. If
+ *   nonzero, `compute()` only enqueues the received entity and a dedicated thread serializes it
+ *   and writes it to disk in large chunks. If zero, entities are written in `compute()`.
+ *   Optional (default: `0`).
+ * - **backpressure_policy**: What `compute()` does when the writer queue is full, either
+ *   `"block"` (wait for the writer thread) or `"drop"` (discard the entity and count it as
+ *   dropped). Optional (default: `"block"`).
+ * - **write_chunk_size**: Size in bytes of the chunks written by the writer thread. Rounded up
+ *   to a multiple of 4096. Optional (default: `4194304`).
+ * - **direct_io**: Open the entity file with `O_DIRECT` to bypass the page cache when writing
+ *   asynchronously. Optional (default: `false`).
+ *
+ * The writer statistics are available through `queue_depth()`, `bytes_written()`,
+ * `bytes_per_second()` and `dropped_frames()`.
  */
 class VideoStreamRecorderOp : public holoscan::Operator {
  public:
@@ -61,21 +87,71 @@ class VideoStreamRecorderOp : public holoscan::Operator {
   // void deinitialize() override;
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override;
+  void start() override;
   void stop() override;
 
+  /// Number of entities waiting for the writer thread.
+  size_t queue_depth();
+  /// Number of bytes written to the entity file so far.
+  uint64_t bytes_written() const { return bytes_written_.load(); }
+  /// Average write throughput of the entity file since the start of the recording.
+  double bytes_per_second() const;
+  /// Number of entities discarded because the writer queue was full.
+  uint64_t dropped_frames() const { return dropped_frames_.load(); }
+
  private:
+  /// An entity waiting to be written by the writer thread.
+  struct PendingEntity {
+    gxf::Entity entity;
+    int64_t log_time = 0;  ///< Time at which the entity was received.
+  };
+
+  /// Get the underlying GXF EntitySerializer (resolved once).
+  nvidia::gxf::EntitySerializer* entity_serializer(gxf_context_t context);
+  /// Body of the writer thread.
+  void writer_loop(gxf_context_t context);
+  /// Serialize an entity and its index with the writer thread's chunked writers.
+  void write_entity(gxf_context_t context, const PendingEntity& pending);
+  /// Flush the writer thread's chunked writers.
+  void flush_writers(bool final);
+
   Parameter<holoscan::IOSpec*> receiver_;
   Parameter<std::shared_ptr<holoscan::Resource>> entity_serializer_;
   Parameter<std::string> directory_;
   Parameter<std::string> basename_;
   Parameter<bool> flush_on_tick_;
+  Parameter<size_t> async_queue_size_;
+  Parameter<std::string> backpressure_policy_;
+  Parameter<size_t> write_chunk_size_;
+  Parameter<bool> direct_io_;
 
   // File stream for data index
   nvidia::gxf::FileStream index_file_stream_;
   // File stream for binary data
   nvidia::gxf::FileStream binary_file_stream_;
   // Offset into binary file
-  size_t binary_file_offset_;
+  size_t binary_file_offset_ = 0;
+
+  nvidia::gxf::EntitySerializer* entity_serializer_ptr_ = nullptr;
+  bool file_streams_open_ = false;
+  bool drop_when_full_ = false;
+
+  // Writer thread state
+  std::unique_ptr<ChunkedFileWriter> index_writer_;
+  std::unique_ptr<ChunkedFileWriter> binary_writer_;
+  std::thread writer_thread_;
+  std::mutex writer_mutex_;
+  std::condition_variable writer_cv_;        ///< Signals new entities to the writer thread.
+  std::condition_variable writer_space_cv_;  ///< Signals free queue slots to compute().
+  std::deque<PendingEntity> writer_queue_;   ///< Entities waiting to be written.
+  bool stop_writer_ = false;                 ///< Whether the writer thread should exit.
+  std::string writer_error_;                 ///< Error message of the writer thread, if any.
+
+  // Writer statistics
+  std::atomic<uint64_t> bytes_written_{0};
+  std::atomic<uint64_t> dropped_frames_{0};
+  std::atomic<int64_t> write_start_ns_{0};  ///< Steady clock time of the first write.
+  std::atomic<int64_t> write_last_ns_{0};   ///< Steady clock time of the last write.
 };
 
 }  // namespace holoscan::ops
@@ -18,16 +18,27 @@
 #ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 #define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "holoscan/core/conditions/gxf/asynchronous.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
+#include "gxf/core/entity.hpp"
+#include "gxf/serialization/entity_serializer.hpp"
 #include "gxf/serialization/file_stream.hpp"
 
 namespace holoscan::ops {
 
+// Forward declarations
+class MappedFileStream;
+
 /**
  * @brief Operator class to replay a video stream from a file.
  *
@@ -53,6 +64,13 @@ namespace holoscan::ops {
  * - **count**: Number of frame counts to playback. If zero value is specified, it is ignored.
  *   If the count is less than the number of frames in the video, it would finish early.
  *   Optional (default: `0`).
+ * - **read_ahead**: Number of entities to deserialize ahead of playback. If nonzero, the files
+ *   are memory-mapped and entities are deserialized by a background thread into a queue of this
+ *   size. Playback is then paced by an AsynchronousCondition instead of sleeping in `compute()`,
+ *   so no scheduler worker thread is blocked. If zero, entities are read in `compute()`.
+ *   Optional (default: `0`).
+ * - **async_condition**: AsynchronousCondition pacing the playback in read-ahead mode. Created
+ *   automatically in read-ahead mode if not provided. Optional.
  */
 class VideoStreamReplayerOp : public holoscan::Operator {
  public:
@@ -65,10 +83,30 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   void setup(OperatorSpec& spec) override;
 
   void initialize() override;
+  void start() override;
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override;
+  void stop() override;
 
  private:
+  /// An entity deserialized by the read-ahead thread.
+  struct ReadAheadFrame {
+    nvidia::gxf::Entity entity;
+    int64_t playback_offset_ns = 0;  ///< Time of the frame relative to the start of playback.
+    uint64_t playback_count = 0;     ///< Playback count of the frame.
+  };
+
+  /// Get the value of the `read_ahead` argument before the parameters are set (0 if not set).
+  uint64_t read_ahead_arg();
+  /// Get the underlying GXF EntitySerializer (resolved once).
+  nvidia::gxf::EntitySerializer* entity_serializer(gxf_context_t context);
+  /// Compute the time of the next frame relative to the start of playback and update the state.
+  int64_t update_playback_offset(uint64_t log_time);
+  /// Body of the read-ahead thread.
+  void read_ahead_loop(gxf_context_t context);
+  /// Read the next frame from the mapped files. Returns false at the end of the stream.
+  bool read_next_frame(gxf_context_t context, ReadAheadFrame& frame);
+
   Parameter<holoscan::IOSpec*> transmitter_;
   Parameter<std::shared_ptr<holoscan::Resource>> entity_serializer_;
   Parameter<std::shared_ptr<BooleanCondition>> boolean_scheduling_term_;
@@ -80,6 +118,8 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   Parameter<bool> realtime_;
   Parameter<bool> repeat_;
   Parameter<uint64_t> count_;
+  Parameter<size_t> read_ahead_;
+  Parameter<std::shared_ptr<AsynchronousCondition>> async_condition_;
 
   // Internal state
   // File stream for entities
@@ -94,6 +134,22 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   uint64_t index_timestamp_duration_ = 0;
   uint64_t index_frame_count_ = 1;
   uint64_t playback_start_timestamp_ = 0;
+
+  nvidia::gxf::EntitySerializer* entity_serializer_ptr_ = nullptr;
+  bool file_streams_open_ = false;
+
+  // Read-ahead state
+  std::unique_ptr<MappedFileStream> mapped_index_;
+  std::unique_ptr<MappedFileStream> mapped_entities_;
+  std::thread read_ahead_thread_;
+  std::mutex read_ahead_mutex_;
+  std::condition_variable read_ahead_cv_;
+  std::deque<ReadAheadFrame> read_ahead_queue_;  ///< Frames ready for playback.
+  std::chrono::steady_clock::time_point read_ahead_start_{};  ///< Start time of playback.
+  bool waiting_for_frame_ = false;  ///< Whether compute() waits for the front frame to be due.
+  bool end_of_stream_ = false;      ///< Whether the read-ahead thread read the last frame.
+  bool stop_read_ahead_ = false;    ///< Whether the read-ahead thread should exit.
+  std::string read_ahead_error_;    ///< Error message of the read-ahead thread, if any.
 };
 
 }  // namespace holoscan::ops
@@ -19,9 +19,11 @@
 #define HOLOSCAN_UTILS_HOLOINFER_HPP
 
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "gxf/std/timestamp.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/utils/cuda_stream_handler.hpp"
 
@@ -43,13 +45,16 @@ namespace holoscan::utils {
  * @param module Module that called for data extraction
  * @param context GXF execution context
  * @param cuda_stream_handler Cuda steam handler
+ * @param timestamp If not null, set to the first timestamp found in the input messages or reset
+ * if there is none
  * @returns GXF result code
  */
 gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::string>& in_tensors,
                                 HoloInfer::DataMap& data_per_input_tensor,
                                 std::map<std::string, std::vector<int>>& dims_per_tensor,
                                 bool cuda_buffer_out, const std::string& module,
-                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler);
+                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler,
+                                std::optional<nvidia::gxf::Timestamp>* timestamp = nullptr);
 
 /**
  * Transmits multiple buffers via GXF Transmitters.
@@ -67,6 +72,7 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
  * @param allocator GXF Memory allocator
  * @param module Module that called for data transmission
  * @param cuda_stream_handler Cuda steam handler
+ * @param timestamp If not null, added to the output message
  * @returns GXF result code
  */
 gxf_result_t transmit_data_per_model(gxf_context_t& cont,
@@ -77,7 +83,8 @@ gxf_result_t transmit_data_per_model(gxf_context_t& cont,
                                      bool cuda_buffer_out,
                                      const nvidia::gxf::Handle<nvidia::gxf::Allocator>& allocator_,
                                      const std::string& module,
-                                     CudaStreamHandler& cuda_stream_handler);
+                                     CudaStreamHandler& cuda_stream_handler,
+                                     const nvidia::gxf::Timestamp* timestamp = nullptr);
 
 }  // namespace holoscan::utils
 
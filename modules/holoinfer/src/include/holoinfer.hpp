@@ -17,6 +17,7 @@
 #ifndef _HOLOSCAN_INFER_API_H
 #define _HOLOSCAN_INFER_API_H
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -62,6 +63,79 @@ class _HOLOSCAN_EXTERNAL_API_ InferContext {
    */
   DimType get_output_dimensions() const;
 
+  /**
+   * Gets input dimension per model
+   *
+   * @returns Map of model as key mapped to the dimension of each input tensor
+   */
+  DimType get_input_dimensions() const;
+
+  /**
+   * Gets input data type per model
+   *
+   * @returns Map of model as key mapped to the data type of each input tensor
+   */
+  DataTypeMap get_input_datatypes() const;
+
+  /**
+   * Gets inference timing per model
+   *
+   * @returns Map of model as key mapped to its inference timing
+   */
+  TimingMap get_model_timing() const;
+
+  /**
+   * Gets the statistics of the host memory pool of the output buffers
+   *
+   * @returns Hits, misses and peak bytes of the pool
+   */
+  HostMemoryStats get_host_memory_stats() const;
+
+  /**
+   * Queues a frame for inference, models are inferred once their batch is complete or their
+   * batch delay expired. Models without a batch size are inferred immediately.
+   *
+   * @param data_map Input DataMap with tensor name as key and DataBuffer as value
+   * @param output_data_map Output DataMap used by the models inferred immediately
+   * @param tag Identifier of the frame
+   *
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus enqueue_inference(DataMap& data_map, DataMap& output_data_map, uint64_t tag);
+
+  /**
+   * Gets the results of the oldest queued frame once all its models are inferred
+   *
+   * @param output_data_map Output DataMap with tensor name as key and DataBuffer as value
+   * @param tag Identifier of the frame given to enqueue_inference
+   *
+   * @returns True if the results of a frame were returned
+   */
+  bool dequeue_inference(DataMap& output_data_map, uint64_t& tag);
+
+  /**
+   * Infers the incomplete batches without waiting for the batch delay, e.g. once the last frame
+   * was queued
+   *
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus flush_inference();
+
+  /**
+   * Sets the function called once the results of the oldest queued frame were inferred by the
+   * batch timer, i.e. once its batch delay expired while no other frame was queued
+   *
+   * @param callback Function called from the batch timer thread
+   */
+  void set_results_callback(std::function<void()> callback);
+
+  /**
+   * Gets batching statistics per model
+   *
+   * @returns Map of model as key mapped to its achieved batch size and queueing delay
+   */
+  BatchStatsMap get_batch_stats() const;
+
  private:
   std::string unique_id_;
 };
@@ -82,6 +156,22 @@ class _HOLOSCAN_EXTERNAL_API_ ProcessorContext {
    */
   InferStatus initialize(const MultiMappings& process_operations, const std::string config_path);
 
+  /**
+   * Initialize the preprocessor context
+   *
+   * @param process_operations   Map of tensor name as key, mapped to list of operations to be
+   *                             applied in sequence on the tensor
+   * @param config_path          Path to the processing configuration settings
+   * @param fuse_operations      Compile the operations of each tensor once into a plan. The
+   *                             operations of a plan are chained, and only the output of the last
+   *                             operation is materialized. Plans chaining operations with
+   *                             mismatched data types or ranks are rejected.
+   *
+   * @returns InferStatus with appropriate holoinfer_code and message.
+   */
+  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path,
+                         bool fuse_operations);
+
   /**
    * Process the tensors with operations as initialized.
    * Toolkit supports one tensor input and output per model
@@ -21,6 +21,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -125,21 +126,117 @@ class DeviceBuffer {
   DeviceFree free_;
 };
 
+/**
+ * @brief Statistics of a host memory pool
+ */
+struct HostMemoryStats {
+  uint64_t hits = 0;        ///< Allocations served with a cached block
+  uint64_t misses = 0;      ///< Allocations served with a new block
+  size_t bytes_in_use = 0;  ///< Bytes of the blocks held by buffers
+  size_t bytes_cached = 0;  ///< Bytes of the cached blocks
+  size_t peak_bytes = 0;    ///< Highest number of bytes allocated from the system
+};
+
+/**
+ * @brief Pool of 64 byte aligned host memory blocks. Blocks are rounded up to a size class and
+ * cached when released, to be reused by the next allocation of the same class. Thread safe.
+ */
+class HostMemoryPool {
+ public:
+  /// @brief Alignment of the blocks in bytes
+  static constexpr size_t kAlignment = 64;
+
+  HostMemoryPool() = default;
+  HostMemoryPool(const HostMemoryPool&) = delete;
+  HostMemoryPool& operator=(const HostMemoryPool&) = delete;
+
+  /**
+   * @brief Destructor, frees the cached blocks
+   */
+  ~HostMemoryPool();
+
+  /**
+   * @brief Get the pool used by buffers created without a pool
+   *
+   * @returns Shared pointer to the default pool
+   */
+  static std::shared_ptr<HostMemoryPool> get_default();
+
+  /**
+   * @brief Get the size class of an allocation. Classes are powers of two up to 4 KiB, and four
+   * classes per power of two above.
+   *
+   * @param bytes Requested bytes
+   * @returns Bytes of the block serving the allocation
+   */
+  static size_t get_size_class(size_t bytes);
+
+  /**
+   * @brief Allocate an uninitialized block
+   *
+   * @param bytes Requested bytes
+   * @param block_size Size of the returned block, must be passed back to release
+   * @returns Pointer to the block
+   */
+  void* allocate(size_t bytes, size_t& block_size);
+
+  /**
+   * @brief Return a block to the pool
+   *
+   * @param ptr Pointer to the block
+   * @param block_size Size of the block returned by allocate
+   */
+  void release(void* ptr, size_t block_size);
+
+  /**
+   * @brief Free the cached blocks
+   */
+  void trim();
+
+  /**
+   * @brief Get the pool statistics
+   *
+   * @returns HostMemoryStats
+   */
+  HostMemoryStats get_stats() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<size_t, std::vector<void*>> free_blocks_;
+  HostMemoryStats stats_;
+};
+
 class HostBuffer {
  public:
   /// @brief Constructor
   /// @param data_type  data type of the buffer
-  explicit HostBuffer(holoinfer_datatype data_type = holoinfer_datatype::h_Float32)
-      : type_(data_type) {}
+  /// @param pool Memory pool of the buffer, the default pool is used if null
+  explicit HostBuffer(holoinfer_datatype data_type = holoinfer_datatype::h_Float32,
+                      std::shared_ptr<HostMemoryPool> pool = nullptr);
+
+  HostBuffer(const HostBuffer& other);
+  HostBuffer& operator=(const HostBuffer& other);
+
+  /// @brief Destructor, returns the memory to the pool
+  ~HostBuffer();
 
   /// @brief Get the buffer data on the host
-  /// @return void pointer to the buffer
-  void* data() { return static_cast<void*>(buffer_.data()); }
+  /// @return void pointer to the buffer, aligned on HostMemoryPool::kAlignment bytes unless the
+  /// buffer references external memory
+  void* data() { return external_ != nullptr ? external_ : buffer_; }
 
   /// @brief Get the number of elements in the buffer
   /// @return size
   size_t size() const { return number_of_elements_; }
 
+  /// @brief Get the bytes used by the elements
+  /// @return size in bytes
+  size_t get_bytes() const { return number_of_elements_ * get_element_size(type_); }
+
+  /// @brief Get the bytes allocated
+  /// @return capacity in bytes
+  size_t capacity() const { return capacity_; }
+
   /// @brief Set the data type and resize the buffer
   /// @param in_type input data type
   void set_type(holoinfer_datatype in_type) {
@@ -147,21 +244,68 @@ class HostBuffer {
     resize(size());
   }
 
-  /// @brief Resize the underlying buffer on host
+  /// @brief Resize the underlying buffer on host. Memory is only reallocated when the buffer
+  /// grows past its capacity, and the content is not initialized. A reference to external memory
+  /// is dropped.
   /// @param number_of_elements Number of elements to be resized with
-  void resize(size_t number_of_elements) {
-    buffer_.clear();
-    number_of_elements_ = number_of_elements;
-    buffer_.resize(number_of_elements * get_element_size(type_));
-  }
+  void resize(size_t number_of_elements);
+
+  /// @brief Empty the buffer and drop the reference to external memory. The storage is kept.
+  void clear();
+
+  /// @brief Reference external host memory instead of the storage of the buffer, without copy.
+  /// The owner is kept alive until the buffer is resized, cleared, references other memory or is
+  /// destroyed.
+  /// @param data Pointer to the external memory
+  /// @param number_of_elements Number of elements in the external memory
+  /// @param owner Object owning the external memory
+  void borrow(void* data, size_t number_of_elements, std::shared_ptr<void> owner);
+
+  /// @brief Check if the buffer references external memory
+  /// @return true if the data is borrowed
+  bool is_borrowed() const { return external_ != nullptr; }
+
+  /// @brief Hand the data over to the caller without copy. The buffer continues with new
+  /// uninitialized storage of the same size.
+  /// @return Shared pointer to the data, the storage returns to the pool once it is released
+  std::shared_ptr<void> detach();
+
+  /// @brief Share the data with the caller without copy. The buffer keeps its storage, which
+  /// must not be written before reclaim() is called. Lending the data again before reclaim()
+  /// returns the same loan.
+  /// @return Shared pointer to the data
+  std::shared_ptr<void> lend();
+
+  /// @brief End the loan of the data before writing to the buffer. If the borrower released the
+  /// data, the buffer keeps its storage and address. Otherwise the borrower keeps the storage
+  /// until it releases it, and the buffer continues with new uninitialized storage.
+  void reclaim();
 
  private:
-  /// @brief Data buffer on host, stored as a vector of bytes
-  std::vector<byte> buffer_;
+  struct Loan;
+
+  /// @brief End the loan of the data buffer
+  /// @return true if the borrower still holds the data buffer, which it then owns
+  bool end_loan();
+
+  /// @brief Memory pool owning the data buffer
+  std::shared_ptr<HostMemoryPool> pool_;
+  /// @brief Data buffer on host
+  void* buffer_ = nullptr;
+  /// @brief Bytes allocated for the data buffer
+  size_t capacity_{0};
+  /// @brief External memory referenced instead of the data buffer
+  void* external_ = nullptr;
+  /// @brief Owner of the external memory
+  std::shared_ptr<void> external_owner_;
   /// @brief Number of elements in the buffer
   size_t number_of_elements_{0};
   /// @brief Datatype of the elements in the buffer
   holoinfer_datatype type_;
+  /// @brief Loan of the data buffer, set by lend() until reclaim()
+  std::shared_ptr<Loan> loan_;
+  /// @brief Data handed over by lend(), alive while the borrower holds it
+  std::weak_ptr<void> lent_data_;
 };
 
 /**
@@ -172,9 +316,13 @@ class DataBuffer {
  public:
   /**
    * @brief Constructor
+   *
+   * @param data_type Data type of the buffer
+   * @param device_id GPU ID of the device buffer
+   * @param pool Memory pool of the host buffer, the default pool is used if null
    */
   explicit DataBuffer(holoinfer_datatype data_type = holoinfer_datatype::h_Float32,
-                      int device_id = 0);
+                      int device_id = 0, std::shared_ptr<HostMemoryPool> pool = nullptr);
   std::shared_ptr<DeviceBuffer> device_buffer;
   HostBuffer host_buffer;
 
@@ -189,8 +337,62 @@ class DataBuffer {
 using DataMap = std::map<std::string, std::shared_ptr<DataBuffer>>;
 using Mappings = std::map<std::string, std::string>;
 using DimType = std::map<std::string, std::vector<std::vector<int64_t>>>;
+using DataTypeMap = std::map<std::string, std::vector<holoinfer_datatype>>;
 using MultiMappings = std::map<std::string, std::vector<std::string>>;
 
+/**
+ * @brief Inference timing of a model
+ */
+struct ModelTiming {
+  double last_ms = 0.0;     ///< Duration of the last inference in milliseconds
+  double average_ms = 0.0;  ///< Average duration of all inferences in milliseconds
+  double max_ms = 0.0;      ///< Longest duration of an inference in milliseconds
+  uint64_t count = 0;       ///< Number of inferences
+  uint64_t skipped = 0;     ///< Number of frames that reused the outputs of the previous inference
+};
+using TimingMap = std::map<std::string, ModelTiming>;
+
+/**
+ * @brief Batching statistics of a model
+ */
+struct BatchStats {
+  uint64_t batches = 0;                 ///< Number of batched inferences
+  uint64_t frames = 0;                  ///< Number of frames inferred in batches
+  size_t last_batch_size = 0;           ///< Number of frames in the last batch
+  double average_batch_size = 0.0;      ///< Average number of frames per batch
+  double average_queue_delay_ms = 0.0;  ///< Average time frames waited for their batch
+  double max_queue_delay_ms = 0.0;      ///< Longest time a frame waited for its batch
+};
+using BatchStatsMap = std::map<std::string, BatchStats>;
+
+/**
+ * @brief Session settings of the onnxruntime backend
+ */
+struct OnnxRuntimeOptions {
+  /// @brief Number of threads used to parallelize the execution within nodes. 0 lets
+  /// onnxruntime pick the number of physical cores.
+  int intra_op_num_threads = 1;
+
+  /// @brief Number of threads used to parallelize the execution of the graph across nodes. 0
+  /// lets onnxruntime pick the number of physical cores.
+  int inter_op_num_threads = 1;
+
+  /// @brief Graph optimization level: "disable", "basic", "extended" or "all"
+  std::string graph_optimization_level{"extended"};
+
+  /// @brief Execution mode of the graph: "sequential" or "parallel"
+  std::string execution_mode{"sequential"};
+
+  /// @brief Share one pool of threads across the sessions of all models instead of creating
+  /// threads per session. The thread counts of the first session creating the pool are used.
+  bool use_global_thread_pool = false;
+
+  /// @brief Directory caching the optimized models. A model is optimized once and the optimized
+  /// model is reused while the model file, the graph optimization level, the execution provider
+  /// and the onnxruntime version are unchanged. Empty disables the cache.
+  std::string optimized_model_cache_dir;
+};
+
 /**
  * @brief Struct that holds specifications related to inference, along with input and
  * output data buffer.
@@ -290,6 +492,26 @@ struct InferenceSpecs {
 
   /// @brief Output Data Map with key as tensor name and value as DataBuffer
   DataMap output_per_model_;
+
+  /// @brief Session settings of models using the onnxruntime backend
+  OnnxRuntimeOptions onnx_options_;
+
+  /// @brief Map with key as model name and value as the maximum number of frames inferred in one
+  /// batch. Models that are not in the map are inferred per frame.
+  Mappings batch_size_map_;
+
+  /// @brief Map with key as model name and value as the longest time in milliseconds a frame
+  /// waits for its batch to fill up
+  Mappings batch_delay_map_;
+
+  /// @brief Map with key as model name and value as the largest mean absolute difference between
+  /// the sampled inputs of a frame and of the last inferred frame for which the outputs of the
+  /// last inference are reused. Models that are not in the map are inferred on every frame.
+  Mappings skip_threshold_map_;
+
+  /// @brief Map with key as model name and value as the largest number of consecutive frames
+  /// reusing the outputs of the last inference. Defaults to 10.
+  Mappings skip_max_frames_map_;
 };
 
 /**
@@ -302,11 +524,13 @@ struct InferenceSpecs {
  * @param keyname Storage name in the map against the created DataBuffer
  * @param allocate_cuda flag to allocate cuda buffer
  * @param device_id GPU ID to allocate buffers on
+ * @param pool Memory pool of the host buffer, the default pool is used if null
  * @returns InferStatus with appropriate code and message
  */
 InferStatus allocate_buffers(DataMap& buffers, std::vector<int64_t>& dims,
                              holoinfer_datatype datatype, const std::string& keyname,
-                             bool allocate_cuda, int device_id);
+                             bool allocate_cuda, int device_id,
+                             std::shared_ptr<HostMemoryPool> pool = nullptr);
 }  // namespace inference
 }  // namespace holoscan
 
@@ -72,6 +72,16 @@ class InferBase {
    * */
   virtual std::vector<holoinfer_datatype> get_output_datatype() const { return {}; }
 
+  /**
+   * @brief Set the size of the batch dimension of the next inferences. Input and output
+   * dimensions are updated accordingly.
+   * @param batch_size Number of frames in the batch
+   * @return InferStatus, error if the backend or model does not support a variable batch size
+   * */
+  virtual InferStatus set_batch_size(int64_t batch_size) {
+    return InferStatus(holoinfer_code::H_ERROR, "Batching not supported by the backend");
+  }
+
   virtual void cleanup() {}
 };
 
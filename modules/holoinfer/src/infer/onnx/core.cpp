@@ -17,10 +17,17 @@
 #include "core.hpp"
 
 #include <onnxruntime_cxx_api.h>
+#include <unistd.h>
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -31,17 +38,25 @@ namespace inference {
 class OnnxInferImpl {
  public:
   // Internal only
-  OnnxInferImpl(const std::string& model_file_path, bool cuda_flag);
+  OnnxInferImpl(const std::string& model_file_path, bool cuda_flag,
+                const OnnxRuntimeOptions& options);
 
   std::string model_path_{""};
   bool use_cuda_ = true;
+  OnnxRuntimeOptions options_;
 
   Ort::SessionOptions session_options_;
   OrtCUDAProviderOptions cuda_options_{};
 
-  std::unique_ptr<Ort::Env> env_ = nullptr;
+  std::shared_ptr<Ort::Env> env_ = nullptr;
+  bool use_global_thread_pool_ = false;
   std::unique_ptr<Ort::Session> session_ = nullptr;
 
+  // Binding of the input and output tensors, rebuilt only when the buffers move
+  std::unique_ptr<Ort::IoBinding> io_binding_;
+  std::vector<const void*> bound_input_data_;
+  std::vector<const void*> bound_output_data_;
+
   Ort::AllocatorWithDefaultOptions allocator_;
 
   size_t input_nodes_{0}, output_nodes_{0};
@@ -51,6 +66,10 @@ class OnnxInferImpl {
 
   std::vector<holoinfer_datatype> input_type_, output_type_;
 
+  // Whether the first dimension of all inputs and outputs is dynamic
+  bool dynamic_batch_ = true;
+  int64_t batch_size_ = 1;
+
   std::vector<const char*> input_names_;
   std::vector<const char*> output_names_;
 
@@ -74,8 +93,10 @@ class OnnxInferImpl {
 
   Ort::Value create_tensor(const std::shared_ptr<DataBuffer>& input_buffer,
                            const std::vector<int64_t>& dims);
-  void transfer_to_output(std::vector<std::shared_ptr<DataBuffer>>& output_buffer,
-                          const size_t& index);
+  bool is_bound(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
+                const std::vector<std::shared_ptr<DataBuffer>>& output_buffer);
+  InferStatus bind_buffers(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
+                           std::vector<std::shared_ptr<DataBuffer>>& output_buffer);
 
   // Wrapped Public APIs
   InferStatus do_inference(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
@@ -83,10 +104,13 @@ class OnnxInferImpl {
   void populate_model_details();
   void print_model_details();
   int set_holoscan_inf_onnx_session_options();
+  std::filesystem::path get_cache_path() const;
+  void create_session();
   std::vector<std::vector<int64_t>> get_input_dims() const;
   std::vector<std::vector<int64_t>> get_output_dims() const;
   std::vector<holoinfer_datatype> get_input_datatype() const;
   std::vector<holoinfer_datatype> get_output_datatype() const;
+  InferStatus set_batch_size(int64_t batch_size);
   void cleanup();
 };
 
@@ -102,14 +126,66 @@ Ort::Value create_tensor_core(const std::shared_ptr<DataBuffer>& input_buffer,
                                      dims.size());
 }
 
-template <typename T>
-void transfer_to_host(std::shared_ptr<DataBuffer>& output_buffer, Ort::Value& output_tensor,
-                      const size_t& output_tensor_size) {
-  memcpy(output_buffer->host_buffer.data(),
-         output_tensor.GetTensorMutableData<T>(),
-         output_tensor_size * sizeof(T));
+namespace {
+
+GraphOptimizationLevel get_graph_optimization_level(const std::string& level) {
+  if (level == "disable") { return GraphOptimizationLevel::ORT_DISABLE_ALL; }
+  if (level == "basic") { return GraphOptimizationLevel::ORT_ENABLE_BASIC; }
+  if (level == "extended") { return GraphOptimizationLevel::ORT_ENABLE_EXTENDED; }
+  if (level == "all") { return GraphOptimizationLevel::ORT_ENABLE_ALL; }
+  throw std::runtime_error("Onnxruntime: unsupported graph optimization level " + level +
+                           ", must be one of disable, basic, extended or all");
+}
+
+ExecutionMode get_execution_mode(const std::string& mode) {
+  if (mode == "sequential") { return ExecutionMode::ORT_SEQUENTIAL; }
+  if (mode == "parallel") { return ExecutionMode::ORT_PARALLEL; }
+  throw std::runtime_error("Onnxruntime: unsupported execution mode " + mode +
+                           ", must be sequential or parallel");
+}
+
+// Onnxruntime supports a single environment per process, it is shared by all sessions. The
+// global thread pool can only be created with the environment.
+std::mutex env_mutex;
+std::weak_ptr<Ort::Env> shared_env;
+bool shared_env_has_thread_pool = false;
+
+std::shared_ptr<Ort::Env> get_env(const OnnxRuntimeOptions& options, bool& use_global_pool) {
+  std::lock_guard<std::mutex> lock(env_mutex);
+  auto env = shared_env.lock();
+  if (!env) {
+    if (options.use_global_thread_pool) {
+      Ort::ThreadingOptions threading_options;
+      threading_options.SetGlobalIntraOpNumThreads(options.intra_op_num_threads);
+      threading_options.SetGlobalInterOpNumThreads(options.inter_op_num_threads);
+      env = std::make_shared<Ort::Env>(static_cast<const OrtThreadingOptions*>(threading_options),
+                                       ORT_LOGGING_LEVEL_WARNING,
+                                       "holoinfer");
+    } else {
+      env = std::make_shared<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "holoinfer");
+    }
+    shared_env = env;
+    shared_env_has_thread_pool = options.use_global_thread_pool;
+  } else if (options.use_global_thread_pool && !shared_env_has_thread_pool) {
+    HOLOSCAN_LOG_WARN(
+        "Onnxruntime environment already created without global thread pool, session uses its "
+        "own threads.");
+  }
+  use_global_pool = options.use_global_thread_pool && shared_env_has_thread_pool;
+  return env;
 }
 
+/// Updates a 64-bit FNV-1a hash with the bytes
+uint64_t hash_bytes(const char* data, size_t size, uint64_t hash) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
 void OnnxInfer::print_model_details() {
   impl_->print_model_details();
 }
@@ -162,7 +238,11 @@ void OnnxInferImpl::populate_model_details() {
     ONNXTensorElementDataType tensor_element_type = input_tensor_info.GetElementType();
     input_type_.push_back(get_holoinfer_datatype(tensor_element_type));
     auto indim = input_tensor_info.GetShape();
-    if (indim[0] <= 0) { indim[0] = 1; }
+    if (indim[0] <= 0) {
+      indim[0] = 1;
+    } else {
+      dynamic_batch_ = false;
+    }
     input_dims_.push_back(indim);
   }
 
@@ -178,7 +258,11 @@ void OnnxInferImpl::populate_model_details() {
 
     output_type_.push_back(get_holoinfer_datatype(tensor_element_type));
     auto outdim = output_tensor_info.GetShape();
-    if (outdim[0] <= 0) { outdim[0] = 1; }
+    if (outdim[0] <= 0) {
+      outdim[0] = 1;
+    } else {
+      dynamic_batch_ = false;
+    }
     output_dims_.push_back(outdim);
   }
 
@@ -190,19 +274,94 @@ int OnnxInfer::set_holoscan_inf_onnx_session_options() {
 }
 
 int OnnxInferImpl::set_holoscan_inf_onnx_session_options() {
-  session_options_.SetIntraOpNumThreads(1);
-  session_options_.SetInterOpNumThreads(1);
+  if (use_global_thread_pool_) {
+    session_options_.DisablePerSessionThreads();
+  } else {
+    session_options_.SetIntraOpNumThreads(options_.intra_op_num_threads);
+    session_options_.SetInterOpNumThreads(options_.inter_op_num_threads);
+  }
+  session_options_.SetExecutionMode(get_execution_mode(options_.execution_mode));
   if (use_cuda_) { session_options_.AppendExecutionProvider_CUDA(cuda_options_); }
-  session_options_.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
+  session_options_.SetGraphOptimizationLevel(
+      get_graph_optimization_level(options_.graph_optimization_level));
   return 0;
 }
 
-extern "C" OnnxInfer* NewOnnxInfer(const std::string& model_file_path, bool cuda_flag) {
-  return new OnnxInfer(model_file_path, cuda_flag);
+std::filesystem::path OnnxInferImpl::get_cache_path() const {
+  uint64_t hash = 14695981039346656037ULL;
+  std::ifstream model_file(model_path_, std::ios::binary);
+  if (!model_file) { throw std::runtime_error("Onnxruntime: cannot read model " + model_path_); }
+  std::vector<char> chunk(1 << 20);
+  while (model_file) {
+    model_file.read(chunk.data(), chunk.size());
+    hash = hash_bytes(chunk.data(), model_file.gcount(), hash);
+  }
+
+  // the optimized graph depends on the optimization level, the execution provider and the version
+  const std::string settings = fmt::format("{}|{}|{}",
+                                           options_.graph_optimization_level,
+                                           use_cuda_ ? "cuda" : "cpu",
+                                           OrtGetApiBase()->GetVersionString());
+  hash = hash_bytes(settings.data(), settings.size(), hash);
+
+  const auto stem = std::filesystem::path(model_path_).stem().string();
+  return std::filesystem::path(options_.optimized_model_cache_dir) /
+         fmt::format("{}.{:016x}.onnx", stem, hash);
+}
+
+void OnnxInferImpl::create_session() {
+  if (options_.optimized_model_cache_dir.empty()) {
+    session_ = std::make_unique<Ort::Session>(*env_, model_path_.c_str(), session_options_);
+    return;
+  }
+
+  const auto cache_path = get_cache_path();
+  if (std::filesystem::exists(cache_path)) {
+    try {
+      // the cached model is already optimized
+      auto cached_options = session_options_.Clone();
+      cached_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+      session_ = std::make_unique<Ort::Session>(*env_, cache_path.c_str(), cached_options);
+      HOLOSCAN_LOG_INFO("Onnxruntime: optimized model loaded from cache {}", cache_path.string());
+      return;
+    } catch (const Ort::Exception& exception) {
+      HOLOSCAN_LOG_WARN(
+          "Onnxruntime: ignoring cached model {}: {}", cache_path.string(), exception.what());
+      std::error_code error;
+      std::filesystem::remove(cache_path, error);
+    }
+  }
+
+  // The optimized model is written to a temporary file and renamed, so that concurrent loads
+  // never read a partial model
+  std::error_code error;
+  std::filesystem::create_directories(cache_path.parent_path(), error);
+  auto temporary_path = cache_path;
+  temporary_path += fmt::format(
+      ".{}.{}.tmp", getpid(), std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  auto caching_options = session_options_.Clone();
+  caching_options.SetOptimizedModelFilePath(temporary_path.c_str());
+  session_ = std::make_unique<Ort::Session>(*env_, model_path_.c_str(), caching_options);
+
+  std::filesystem::rename(temporary_path, cache_path, error);
+  if (error) {
+    HOLOSCAN_LOG_WARN("Onnxruntime: optimized model not cached in {}: {}",
+                      cache_path.string(),
+                      error.message());
+    std::filesystem::remove(temporary_path, error);
+  } else {
+    HOLOSCAN_LOG_INFO("Onnxruntime: optimized model cached in {}", cache_path.string());
+  }
 }
 
-OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag)
-    : impl_(new OnnxInferImpl(model_file_path, cuda_flag)) {}
+extern "C" OnnxInfer* NewOnnxInfer(const std::string& model_file_path, bool cuda_flag,
+                                   const OnnxRuntimeOptions& options) {
+  return new OnnxInfer(model_file_path, cuda_flag, options);
+}
+
+OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+                     const OnnxRuntimeOptions& options)
+    : impl_(new OnnxInferImpl(model_file_path, cuda_flag, options)) {}
 
 OnnxInfer::~OnnxInfer() {
   if (impl_) {
@@ -211,21 +370,19 @@ OnnxInfer::~OnnxInfer() {
   }
 }
 
-OnnxInferImpl::OnnxInferImpl(const std::string& model_file_path, bool cuda_flag)
-    : model_path_(model_file_path), use_cuda_(cuda_flag) {
+OnnxInferImpl::OnnxInferImpl(const std::string& model_file_path, bool cuda_flag,
+                             const OnnxRuntimeOptions& options)
+    : model_path_(model_file_path), use_cuda_(cuda_flag), options_(options) {
   try {
+    env_ = get_env(options_, use_global_thread_pool_);
     set_holoscan_inf_onnx_session_options();
 
-    auto env_local = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "test");
-    env_ = std::move(env_local);
-
-    auto _session =
-        std::make_unique<Ort::Session>(*env_, model_file_path.c_str(), session_options_);
-    if (!_session) {
+    create_session();
+    if (!session_) {
       HOLOSCAN_LOG_ERROR("Session creation failed in Onnx inference constructor");
       throw std::runtime_error("Onnxruntime session creation failed");
     }
-    session_ = std::move(_session);
+    io_binding_ = std::make_unique<Ort::IoBinding>(*session_);
     populate_model_details();
   } catch (const Ort::Exception& exception) {
     HOLOSCAN_LOG_ERROR(exception.what());
@@ -251,26 +408,74 @@ Ort::Value OnnxInferImpl::create_tensor(const std::shared_ptr<DataBuffer>& input
   }
 }
 
-void OnnxInferImpl::transfer_to_output(std::vector<std::shared_ptr<DataBuffer>>& output_buffer,
-                                       const size_t& index) {
-  size_t output_tensor_size = accumulate(
-      output_dims_[index].begin(), output_dims_[index].end(), 1, std::multiplies<size_t>());
+bool OnnxInferImpl::is_bound(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
+                             const std::vector<std::shared_ptr<DataBuffer>>& output_buffer) {
+  if (bound_input_data_.size() != input_buffer.size() ||
+      bound_output_data_.size() != output_buffer.size()) {
+    return false;
+  }
+  for (size_t a = 0; a < input_buffer.size(); a++) {
+    if (bound_input_data_[a] != input_buffer[a]->host_buffer.data()) { return false; }
+  }
+  for (size_t a = 0; a < output_buffer.size(); a++) {
+    if (bound_output_data_[a] != output_buffer[a]->host_buffer.data()) { return false; }
+  }
+  return true;
+}
+
+InferStatus OnnxInferImpl::bind_buffers(
+    const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
+    std::vector<std::shared_ptr<DataBuffer>>& output_buffer) {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+
+  io_binding_->ClearBoundInputs();
+  io_binding_->ClearBoundOutputs();
+  input_tensors_.clear();
+  output_tensors_.clear();
+  bound_input_data_.clear();
+  bound_output_data_.clear();
 
-  auto data_type = output_buffer[index]->get_datatype();
+  for (size_t a = 0; a < input_buffer.size(); a++) {
+    if (input_buffer[a]->host_buffer.size() == 0) {
+      status.set_message("ONNX inference core: Input Host buffer empty.");
+      return status;
+    }
 
-  switch (data_type) {
-    case holoinfer_datatype::h_Float32:
-      transfer_to_host<float>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    case holoinfer_datatype::h_Int8:
-      transfer_to_host<int8_t>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    case holoinfer_datatype::h_Int32:
-      transfer_to_host<int32_t>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    default:
-      throw std::runtime_error("Unsupported datatype");
+    Ort::Value i_tensor = create_tensor(input_buffer[a], input_dims_[a]);
+
+    if (!i_tensor) {
+      status.set_message("Onnxruntime: Error creating Ort tensor.");
+      return status;
+    }
+    input_tensors_.push_back(std::move(i_tensor));
+    io_binding_->BindInput(input_names_[a], input_tensors_.back());
+  }
+
+  // The output tensors use the memory of the output buffers, results are written in place
+  for (unsigned int a = 0; a < output_buffer.size(); a++) {
+    if (output_buffer[a]->host_buffer.size() == 0) {
+      status.set_message("ONNX inference core: Output Host buffer empty.");
+      return status;
+    }
+
+    Ort::Value o_tensor = create_tensor(output_buffer[a], output_dims_[a]);
+
+    if (!o_tensor) {
+      status.set_message("Onnxruntime: Error creating output Ort tensor.");
+      return status;
+    }
+    output_tensors_.push_back(std::move(o_tensor));
+    io_binding_->BindOutput(output_names_[a], output_tensors_.back());
   }
+
+  // Buffers are recorded once all of them are bound, a failure rebinds on the next call
+  for (const auto& buffer : input_buffer) {
+    bound_input_data_.push_back(buffer->host_buffer.data());
+  }
+  for (const auto& buffer : output_buffer) {
+    bound_output_data_.push_back(buffer->host_buffer.data());
+  }
+  return InferStatus();
 }
 
 InferStatus OnnxInfer::do_inference(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
@@ -284,9 +489,6 @@ InferStatus OnnxInferImpl::do_inference(
   InferStatus status = InferStatus(holoinfer_code::H_ERROR);
 
   try {
-    input_tensors_.clear();
-    output_tensors_.clear();
-
     if (input_nodes_ != input_buffer.size()) {
       status.set_message("ONNX inference core: Input buffer size not equal to input nodes.");
       return status;
@@ -296,47 +498,13 @@ InferStatus OnnxInferImpl::do_inference(
       return status;
     }
 
-    for (size_t a = 0; a < input_buffer.size(); a++) {
-      if (input_buffer[a]->host_buffer.size() == 0) {
-        status.set_message("ONNX inference core: Input Host buffer empty.");
-        return status;
-      }
-
-      Ort::Value i_tensor = create_tensor(input_buffer[a], input_dims_[a]);
-
-      if (!i_tensor) {
-        status.set_message("Onnxruntime: Error creating Ort tensor.");
-        return status;
-      }
-      input_tensors_.push_back(std::move(i_tensor));
+    if (!is_bound(input_buffer, output_buffer)) {
+      status = bind_buffers(input_buffer, output_buffer);
+      if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
     }
 
-    for (unsigned int a = 0; a < output_buffer.size(); a++) {
-      if (output_buffer[a]->host_buffer.size() == 0) {
-        status.set_message("ONNX inference core: Output Host buffer empty.");
-        return status;
-      }
-
-      Ort::Value o_tensor = create_tensor(output_buffer[a], output_dims_[a]);
-
-      if (!o_tensor) {
-        status.set_message("Onnxruntime: Error creating output Ort tensor.");
-        return status;
-      }
-      output_tensors_.push_back(std::move(o_tensor));
-    }
-
-    session_->Run(Ort::RunOptions{nullptr},
-                  input_names_.data(),
-                  input_tensors_.data(),
-                  input_tensors_.size(),
-                  output_names_.data(),
-                  output_tensors_.data(),
-                  output_tensors_.size());
-
-    for (unsigned int a = 0; a < output_buffer.size(); a++) {
-      transfer_to_output(output_buffer, a);
-    }
+    session_->Run(Ort::RunOptions{nullptr}, *io_binding_);
+    if (use_cuda_) { io_binding_->SynchronizeOutputs(); }
   } catch (const Ort::Exception& exception) {
     HOLOSCAN_LOG_ERROR(exception.what());
     throw;
@@ -376,11 +544,35 @@ std::vector<holoinfer_datatype> OnnxInferImpl::get_output_datatype() const {
   return output_type_;
 }
 
+InferStatus OnnxInfer::set_batch_size(int64_t batch_size) {
+  return impl_->set_batch_size(batch_size);
+}
+
+InferStatus OnnxInferImpl::set_batch_size(int64_t batch_size) {
+  if (batch_size == batch_size_) { return InferStatus(); }
+  if (!dynamic_batch_ || batch_size < 1) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "ONNX inference core: Model " + model_path_ +
+                           " does not have a dynamic batch dimension.");
+  }
+  for (auto& dims : input_dims_) { dims[0] = batch_size; }
+  for (auto& dims : output_dims_) { dims[0] = batch_size; }
+  batch_size_ = batch_size;
+  // tensors are bound with the previous dimensions
+  bound_input_data_.clear();
+  return InferStatus();
+}
+
 void OnnxInfer::cleanup() {
   impl_->cleanup();
 }
 
 void OnnxInferImpl::cleanup() {
+  io_binding_.reset();
+  input_tensors_.clear();
+  output_tensors_.clear();
+  bound_input_data_.clear();
+  bound_output_data_.clear();
   session_.reset();
   env_.reset();
 }
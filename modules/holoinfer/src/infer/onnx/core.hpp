@@ -44,8 +44,10 @@ class OnnxInfer : public InferBase {
    * @brief Constructor
    * @param model_file_path Path to onnx model file
    * @param cuda_flag Flag to show if inference will happen using CUDA
+   * @param options Session settings of onnxruntime
    * */
-  OnnxInfer(const std::string& model_file_path, bool cuda_flag);
+  OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+            const OnnxRuntimeOptions& options = {});
 
   /**
    * @brief Destructor
@@ -54,7 +56,8 @@ class OnnxInfer : public InferBase {
 
   /**
    * @brief Does the Core inference using Onnxruntime. Input and output buffer are supported on
-   * Host. Inference is supported on host and device.
+   * Host. Inference is supported on host and device. The buffers are bound to the session on the
+   * first call and stay bound as long as their memory does not change.
    * @param input_data Input DataBuffer
    * @param output_buffer Output DataBuffer, is populated with inferred results
    * @return InferStatus
@@ -103,6 +106,14 @@ class OnnxInfer : public InferBase {
    * */
   std::vector<holoinfer_datatype> get_output_datatype() const;
 
+  /**
+   * @brief Set the size of the batch dimension of the next inferences. The first dimension of
+   * all inputs and outputs of the model must be dynamic.
+   * @param batch_size Number of frames in the batch
+   * @return InferStatus
+   * */
+  InferStatus set_batch_size(int64_t batch_size);
+
   void cleanup();
 
  private:
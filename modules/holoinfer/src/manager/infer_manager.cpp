@@ -18,8 +18,14 @@
 
 #include <dlfcn.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -28,6 +34,20 @@
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Copies the data of one frame into a new host buffer from the pool
+std::shared_ptr<DataBuffer> copy_frame(const void* data, size_t bytes,
+                                       holoinfer_datatype datatype, int device_id,
+                                       const std::shared_ptr<HostMemoryPool>& pool) {
+  auto buffer = std::make_shared<DataBuffer>(datatype, device_id, pool);
+  buffer->host_buffer.resize(bytes / get_element_size(datatype));
+  std::memcpy(buffer->host_buffer.data(), data, bytes);
+  return buffer;
+}
+
+}  // namespace
+
 ManagerInfer::ManagerInfer() {}
 
 InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>& inference_specs) {
@@ -39,6 +59,9 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
   auto backend_map = inference_specs->get_backend_map();
   cuda_buffer_in_ = inference_specs->cuda_buffer_in_;
   cuda_buffer_out_ = inference_specs->cuda_buffer_out_;
+  // inference on CPU with host buffers runs without a GPU
+  use_cuda_device_ = inference_specs->oncuda_ || cuda_buffer_in_ || cuda_buffer_out_ ||
+                     !inference_specs->get_device_map().empty();
 
   if (multi_model_map.size() <= 0) {
     status.set_message("Inference manager, Empty model map for setup");
@@ -148,8 +171,23 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
     }
   }
 
+  /// Settings of a model, resolved before the models are loaded in parallel
+  struct ModelLoad {
+    std::string model_name;
+    std::string model_path;
+    holoinfer_backend backend = holoinfer_backend::h_trt;
+    int device_id = 0;
+    std::vector<std::string> in_tensor_names;
+    std::vector<std::string> out_tensor_names;
+    std::unique_ptr<InferBase> context;
+    InferStatus status;
+    double load_ms = 0.0;
+  };
+  std::vector<ModelLoad> model_loads;
+  const auto setup_start = std::chrono::steady_clock::now();
+
   try {
-    // create inference contexts and memory allocations for each model
+    // create parameters for each model
     for (auto& [model_name, model_path] : multi_model_map) {
       if (infer_param_.find(model_name) != infer_param_.end()) {
         status.set_message("Duplicate entry in settings for " + model_name);
@@ -184,8 +222,6 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
       infer_param_.at(model_name)->set_tensor_names(in_tensor_names, true);
       infer_param_.at(model_name)->set_tensor_names(out_tensor_names, false);
 
-      check_cuda(cudaSetDevice(device_id));
-
       auto current_backend = holoinfer_backend::h_trt;
       if (backend_type.length() != 0) { current_backend = supported_backend_.at(backend_type); }
 
@@ -198,120 +234,52 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
         current_backend = supported_backend_.at(backend_);
       }
 
-      switch (current_backend) {
-        case holoinfer_backend::h_trt: {
-          if (inference_specs->use_fp16_ && inference_specs->is_engine_path_) {
-            status.set_message(
-                "WARNING: Engine files are the input, fp16 check/conversion is ignored");
-            status.display_message();
-          }
-          if (!inference_specs->oncuda_) {
-            status.set_message("ERROR: TRT backend supports inference on GPU only");
-            return status;
-          }
-
-          holo_infer_context_.insert({model_name,
-                                      std::make_unique<TrtInfer>(model_path,
-                                                                 model_name,
-                                                                 device_id,
-                                                                 inference_specs->use_fp16_,
-                                                                 inference_specs->is_engine_path_,
-                                                                 cuda_buffer_in_,
-                                                                 cuda_buffer_out_)});
-          break;
-        }
-
-        case holoinfer_backend::h_onnx: {
-          if (cuda_buffer_in_ || cuda_buffer_out_) {
-            status.set_message(
-                "Inference manager, Cuda based in and out buffer not supported in onnxrt");
-            return status;
-          }
-          if (inference_specs->is_engine_path_) {
-            status.set_message(
-                "Inference manager, Engine path cannot be true with onnx runtime backend");
-            return status;
-          }
-
-          if (std::filesystem::path(model_path).extension() != ".onnx") {
-            HOLOSCAN_LOG_ERROR("Onnx model must be in .onnx format.");
-            status.set_message("Inference manager, model path must have .onnx extension.");
-            return status;
-          }
+      ModelLoad model_load;
+      model_load.model_name = model_name;
+      model_load.model_path = model_path;
+      model_load.backend = current_backend;
+      model_load.device_id = device_id;
+      model_load.in_tensor_names = std::move(in_tensor_names);
+      model_load.out_tensor_names = std::move(out_tensor_names);
+      model_loads.push_back(std::move(model_load));
+    }
 
-          bool is_aarch64 = is_platform_aarch64();
-          if (is_aarch64 && inference_specs->oncuda_) {
-            status.set_message("Onnxruntime with CUDA not supported on aarch64.");
-            return status;
-          }
+    // Models are independent, their contexts are created in parallel. Exceptions are rethrown
+    // once all the models are loaded.
+    {
+      std::vector<std::future<void>> loads;
+      for (auto& model_load : model_loads) {
+        loads.push_back(std::async(std::launch::async, [this, &model_load, &inference_specs]() {
+          const auto start = std::chrono::steady_clock::now();
+          model_load.status = create_context(model_load.model_name,
+                                             model_load.model_path,
+                                             model_load.backend,
+                                             model_load.device_id,
+                                             *inference_specs,
+                                             model_load.context);
+          model_load.load_ms =
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                  .count();
+        }));
+      }
+      for (auto& load : loads) { load.wait(); }
+      for (auto& load : loads) { load.get(); }
+    }
+    set_device(device_gpu_dt);
 
-#if use_onnxruntime
-          HOLOSCAN_LOG_INFO("Searching for ONNX Runtime libraries");
-          void* handle = dlopen("libholoscan_infer_onnx_runtime.so", RTLD_NOW);
-          if (handle == nullptr) {
-            HOLOSCAN_LOG_ERROR(dlerror());
-            status.set_message("ONNX Runtime context setup failure.");
-            return status;
-          }
-          HOLOSCAN_LOG_INFO("Found ONNX Runtime libraries");
-          using NewOnnxInfer = OnnxInfer* (*)(const std::string&, bool);
-          auto new_ort_infer = reinterpret_cast<NewOnnxInfer>(dlsym(handle, "NewOnnxInfer"));
-          if (!new_ort_infer) {
-            HOLOSCAN_LOG_ERROR(dlerror());
-            status.set_message("ONNX Runtime context setup failure.");
-            return status;
-          }
-          dlclose(handle);
-          auto context = new_ort_infer(model_path, inference_specs->oncuda_);
-          holo_infer_context_[model_name] = std::unique_ptr<OnnxInfer>(context);
-#else
-          HOLOSCAN_LOG_ERROR("Onnxruntime backend not supported or incorrectly installed.");
-          status.set_message("Onnxruntime context setup failure.");
-          return status;
-#endif
-          break;
-        }
+    for (auto& model_load : model_loads) {
+      if (model_load.status.get_code() != holoinfer_code::H_SUCCESS) { return model_load.status; }
+      holo_infer_context_[model_load.model_name] = std::move(model_load.context);
+    }
 
-        case holoinfer_backend::h_torch: {
-          if (std::filesystem::path(model_path).extension() != ".pt" &&
-              std::filesystem::path(model_path).extension() != ".pth") {
-            HOLOSCAN_LOG_ERROR("Torch model must be in torchsript format (.pt or .pth).");
-            status.set_message("Inference manager, model path must have .pt or .pth extension.");
-            return status;
-          }
-#if use_torch
-          HOLOSCAN_LOG_INFO("Searching for libtorch libraries");
-          void* handle = dlopen("libholoscan_infer_torch.so", RTLD_NOW);
-          if (handle == nullptr) {
-            HOLOSCAN_LOG_ERROR(dlerror());
-            status.set_message("Torch context setup failure.");
-            return status;
-          }
-          HOLOSCAN_LOG_INFO("Found libtorch libraries");
-          using NewTorchInfer = TorchInfer* (*)(const std::string&, bool, bool, bool);
-          auto new_torch_infer = reinterpret_cast<NewTorchInfer>(dlsym(handle, "NewTorchInfer"));
-          if (!new_torch_infer) {
-            HOLOSCAN_LOG_ERROR(dlerror());
-            status.set_message("Torch context setup failure.");
-            return status;
-          }
-          dlclose(handle);
-          auto context = new_torch_infer(
-              model_path, inference_specs->oncuda_, cuda_buffer_in_, cuda_buffer_out_);
-          holo_infer_context_[model_name] = std::unique_ptr<TorchInfer>(context);
-#else
-          HOLOSCAN_LOG_ERROR("Torch backend not supported.");
-          status.set_message("Torch context setup failure.");
-          return status;
-#endif
-          break;
-        }
-        default: {
-          status.set_message("ERROR: Backend not supported");
-          return status;
-        }
-      }
-      check_cuda(cudaSetDevice(device_gpu_dt));
+    // create memory allocations for each model
+    for (const auto& model_load : model_loads) {
+      const auto& model_name = model_load.model_name;
+      const auto& in_tensor_names = model_load.in_tensor_names;
+      const auto& out_tensor_names = model_load.out_tensor_names;
+      const auto device_id = model_load.device_id;
+      const auto current_backend = model_load.backend;
+      const auto allocation_start = std::chrono::steady_clock::now();
 
       auto output_node_size = holo_infer_context_.at(model_name)->get_output_dims().size();
       auto input_node_size = holo_infer_context_.at(model_name)->get_input_dims().size();
@@ -350,7 +318,8 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
                                         datatype,
                                         out_tensor_names[d],
                                         allocate_cuda,
-                                        device_id);
+                                        device_id,
+                                        host_memory_pool_);
         if (astatus.get_code() != holoinfer_code::H_SUCCESS) {
           astatus.display_message();
           status.set_message("Allocation failed for output tensor: " + out_tensor_names[d]);
@@ -361,8 +330,13 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
         if (device_id != device_gpu_dt) {
           check_cuda(cudaSetDevice(device_id));
 
-          auto astatus =
-              allocate_buffers(dm, dims, datatype, out_tensor_names[d], allocate_cuda, device_id);
+          auto astatus = allocate_buffers(dm,
+                                          dims,
+                                          datatype,
+                                          out_tensor_names[d],
+                                          allocate_cuda,
+                                          device_id,
+                                          host_memory_pool_);
           if (astatus.get_code() != holoinfer_code::H_SUCCESS) {
             astatus.display_message();
             status.set_message("Allocation failed for output tensor: " + out_tensor_names[d]);
@@ -430,8 +404,13 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
             return status;
           }
 
-          auto astatus =
-              allocate_buffers(dm_in, dims, datatype, in_tensor_names[d], allocate_cuda, device_id);
+          auto astatus = allocate_buffers(dm_in,
+                                          dims,
+                                          datatype,
+                                          in_tensor_names[d],
+                                          allocate_cuda,
+                                          device_id,
+                                          host_memory_pool_);
           if (astatus.get_code() != holoinfer_code::H_SUCCESS) {
             astatus.display_message();
             status.set_message("Allocation failed for output tensor: " + out_tensor_names[d]);
@@ -443,7 +422,85 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
       }
 
       models_input_dims_.insert({model_name, holo_infer_context_.at(model_name)->get_input_dims()});
+      models_input_types_.insert(
+          {model_name, holo_infer_context_.at(model_name)->get_input_datatype()});
+
+      if (inference_specs->batch_size_map_.find(model_name) !=
+          inference_specs->batch_size_map_.end()) {
+        size_t max_batch_size = 0;
+        double max_delay_ms = 0.0;
+        try {
+          max_batch_size = std::stoul(inference_specs->batch_size_map_.at(model_name));
+          if (inference_specs->batch_delay_map_.find(model_name) !=
+              inference_specs->batch_delay_map_.end()) {
+            max_delay_ms = std::stod(inference_specs->batch_delay_map_.at(model_name));
+          }
+        } catch (const std::logic_error&) {
+          status.set_message("Inference manager, invalid batch size or delay for " + model_name);
+          return status;
+        }
+
+        if (max_batch_size > 1) {
+          if (current_backend != holoinfer_backend::h_onnx || device_id != device_gpu_dt) {
+            status.set_message(
+                "Inference manager, batching is supported with the onnxrt backend on the data "
+                "transfer GPU only, model: " +
+                model_name);
+            return status;
+          }
+          auto bstatus = setup_batch(model_name, max_batch_size, max_delay_ms);
+          if (bstatus.get_code() != holoinfer_code::H_SUCCESS) { return bstatus; }
+          HOLOSCAN_LOG_INFO("Batching up to {} frames for model {}, delay {} ms",
+                            max_batch_size,
+                            model_name,
+                            max_delay_ms);
+        }
+      }
+
+      if (inference_specs->skip_threshold_map_.find(model_name) !=
+          inference_specs->skip_threshold_map_.end()) {
+        SkipState skip;
+        skip.max_frames = 10;
+        try {
+          skip.threshold = std::stod(inference_specs->skip_threshold_map_.at(model_name));
+          if (inference_specs->skip_max_frames_map_.find(model_name) !=
+              inference_specs->skip_max_frames_map_.end()) {
+            skip.max_frames = std::stoul(inference_specs->skip_max_frames_map_.at(model_name));
+          }
+        } catch (const std::logic_error&) {
+          status.set_message("Inference manager, invalid skip threshold or frame count for " +
+                             model_name);
+          return status;
+        }
+
+        if (skip.threshold > 0.0 && skip.max_frames > 0) {
+          if (model_batches_.find(model_name) != model_batches_.end()) {
+            status.set_message(
+                "Inference manager, temporal skipping cannot be combined with batching, model: " +
+                model_name);
+            return status;
+          }
+          HOLOSCAN_LOG_INFO("Skipping up to {} frames for model {}, threshold {}",
+                            skip.max_frames,
+                            model_name,
+                            skip.threshold);
+          skip_states_[model_name] = std::move(skip);
+        }
+      }
+
+      HOLOSCAN_LOG_INFO(
+          "Model {} loaded in {:.1f} ms, buffers allocated in {:.1f} ms",
+          model_name,
+          model_load.load_ms,
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                    allocation_start)
+              .count());
     }
+    HOLOSCAN_LOG_INFO("{} models set up in {:.1f} ms",
+                      model_loads.size(),
+                      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                setup_start)
+                          .count());
   } catch (const std::runtime_error& rt) {
     raise_error("Inference Manager", "Setting Inference parameters: " + std::string(rt.what()));
   } catch (...) {
@@ -451,10 +508,179 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
   }
 
   parallel_processing_ = inference_specs->parallel_processing_;
+
+  // Launch a long-lived worker per model instead of a thread per model and frame
+  stop_workers();
+  {
+    std::lock_guard<std::mutex> lock(timing_mutex_);
+    for (const auto& [model_name, _] : infer_param_) { model_timing_[model_name] = ModelTiming(); }
+  }
+  if (parallel_processing_) {
+    for (const auto& [model_name, _] : infer_param_) {
+      infer_workers_.insert({model_name, std::make_unique<InferWorker>(this, model_name)});
+    }
+  }
+
+  // Batches are inferred once their delay expires, even if no other frame is queued
+  stop_batch_timer();
+  for (const auto& [_, batch] : model_batches_) {
+    if (batch.max_delay_ms > 0.0) {
+      stop_batch_timer_ = false;
+      batch_timer_ = std::thread(&ManagerInfer::run_batch_timer, this);
+      break;
+    }
+  }
+  return InferStatus();
+}
+
+InferStatus ManagerInfer::create_context(const std::string& model_name,
+                                         const std::string& model_path, holoinfer_backend backend,
+                                         int device_id, const InferenceSpecs& inference_specs,
+                                         std::unique_ptr<InferBase>& context) const {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  // the current device is per thread
+  set_device(device_id);
+
+  switch (backend) {
+    case holoinfer_backend::h_trt: {
+      if (inference_specs.use_fp16_ && inference_specs.is_engine_path_) {
+        status.set_message(
+            "WARNING: Engine files are the input, fp16 check/conversion is ignored");
+        status.display_message();
+      }
+      if (!inference_specs.oncuda_) {
+        status.set_message("ERROR: TRT backend supports inference on GPU only");
+        return status;
+      }
+
+      context = std::make_unique<TrtInfer>(model_path,
+                                           model_name,
+                                           device_id,
+                                           inference_specs.use_fp16_,
+                                           inference_specs.is_engine_path_,
+                                           cuda_buffer_in_,
+                                           cuda_buffer_out_);
+      break;
+    }
+
+    case holoinfer_backend::h_onnx: {
+      if (cuda_buffer_in_ || cuda_buffer_out_) {
+        status.set_message(
+            "Inference manager, Cuda based in and out buffer not supported in onnxrt");
+        return status;
+      }
+      if (inference_specs.is_engine_path_) {
+        status.set_message(
+            "Inference manager, Engine path cannot be true with onnx runtime backend");
+        return status;
+      }
+
+      if (std::filesystem::path(model_path).extension() != ".onnx") {
+        HOLOSCAN_LOG_ERROR("Onnx model must be in .onnx format.");
+        status.set_message("Inference manager, model path must have .onnx extension.");
+        return status;
+      }
+
+      bool is_aarch64 = is_platform_aarch64();
+      if (is_aarch64 && inference_specs.oncuda_) {
+        status.set_message("Onnxruntime with CUDA not supported on aarch64.");
+        return status;
+      }
+
+#if use_onnxruntime
+      HOLOSCAN_LOG_INFO("Searching for ONNX Runtime libraries");
+      void* handle = dlopen("libholoscan_infer_onnx_runtime.so", RTLD_NOW);
+      if (handle == nullptr) {
+        HOLOSCAN_LOG_ERROR(dlerror());
+        status.set_message("ONNX Runtime context setup failure.");
+        return status;
+      }
+      HOLOSCAN_LOG_INFO("Found ONNX Runtime libraries");
+      using NewOnnxInfer =
+          OnnxInfer* (*)(const std::string&, bool, const OnnxRuntimeOptions&);
+      auto new_ort_infer = reinterpret_cast<NewOnnxInfer>(dlsym(handle, "NewOnnxInfer"));
+      if (!new_ort_infer) {
+        HOLOSCAN_LOG_ERROR(dlerror());
+        status.set_message("ONNX Runtime context setup failure.");
+        return status;
+      }
+      dlclose(handle);
+      context.reset(
+          new_ort_infer(model_path, inference_specs.oncuda_, inference_specs.onnx_options_));
+#else
+      HOLOSCAN_LOG_ERROR("Onnxruntime backend not supported or incorrectly installed.");
+      status.set_message("Onnxruntime context setup failure.");
+      return status;
+#endif
+      break;
+    }
+
+    case holoinfer_backend::h_torch: {
+      if (std::filesystem::path(model_path).extension() != ".pt" &&
+          std::filesystem::path(model_path).extension() != ".pth") {
+        HOLOSCAN_LOG_ERROR("Torch model must be in torchsript format (.pt or .pth).");
+        status.set_message("Inference manager, model path must have .pt or .pth extension.");
+        return status;
+      }
+#if use_torch
+      HOLOSCAN_LOG_INFO("Searching for libtorch libraries");
+      void* handle = dlopen("libholoscan_infer_torch.so", RTLD_NOW);
+      if (handle == nullptr) {
+        HOLOSCAN_LOG_ERROR(dlerror());
+        status.set_message("Torch context setup failure.");
+        return status;
+      }
+      HOLOSCAN_LOG_INFO("Found libtorch libraries");
+      using NewTorchInfer = TorchInfer* (*)(const std::string&, bool, bool, bool);
+      auto new_torch_infer = reinterpret_cast<NewTorchInfer>(dlsym(handle, "NewTorchInfer"));
+      if (!new_torch_infer) {
+        HOLOSCAN_LOG_ERROR(dlerror());
+        status.set_message("Torch context setup failure.");
+        return status;
+      }
+      dlclose(handle);
+      context.reset(new_torch_infer(
+          model_path, inference_specs.oncuda_, cuda_buffer_in_, cuda_buffer_out_));
+#else
+      HOLOSCAN_LOG_ERROR("Torch backend not supported.");
+      status.set_message("Torch context setup failure.");
+      return status;
+#endif
+      break;
+    }
+    default: {
+      status.set_message("ERROR: Backend not supported");
+      return status;
+    }
+  }
   return InferStatus();
 }
 
+void ManagerInfer::set_device(int device_id) const {
+  if (use_cuda_device_) { check_cuda(cudaSetDevice(device_id)); }
+}
+
+void ManagerInfer::stop_workers() {
+  // Destroying a worker joins its thread
+  infer_workers_.clear();
+}
+
+void ManagerInfer::stop_batch_timer() {
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    stop_batch_timer_ = true;
+  }
+  batch_cv_.notify_all();
+  if (batch_timer_.joinable()) { batch_timer_.join(); }
+}
+
 void ManagerInfer::cleanup() {
+  stop_batch_timer();
+  stop_workers();
+  pending_frames_.clear();
+  model_batches_.clear();
+  skip_states_.clear();
+
   for (auto& [_, context] : holo_infer_context_) {
     context->cleanup();
     context.reset();
@@ -493,7 +719,7 @@ InferStatus ManagerInfer::run_core_inference(const std::string& model_name,
   }
 
   auto device_id = infer_param_.at(model_name)->get_device_id();
-  check_cuda(cudaSetDevice(device_id));
+  set_device(device_id);
 
   // input and output buffer for current inference
   std::vector<std::shared_ptr<DataBuffer>> indata, outdata;
@@ -586,7 +812,7 @@ InferStatus ManagerInfer::run_core_inference(const std::string& model_name,
     }
   }
 
-  check_cuda(cudaSetDevice(device_id));
+  set_device(device_id);
   auto i_status = holo_infer_context_.at(model_name)->do_inference(indata, outdata);
 
   if (i_status.get_code() == holoinfer_code::H_ERROR) {
@@ -650,7 +876,7 @@ InferStatus ManagerInfer::run_core_inference(const std::string& model_name,
     }
   }
 
-  check_cuda(cudaSetDevice(device_gpu_dt));
+  set_device(device_gpu_dt);
   return InferStatus();
 }
 
@@ -669,12 +895,11 @@ InferStatus ManagerInfer::execute_inference(DataMap& permodel_preprocess_data,
   std::chrono::steady_clock::time_point s_time;
   std::chrono::steady_clock::time_point e_time;
 
-  std::map<std::string, std::future<InferStatus>> inference_futures;
   s_time = std::chrono::steady_clock::now();
-  for (const auto& [model_instance, _] : infer_param_) {
-    if (!parallel_processing_) {
+  if (!parallel_processing_) {
+    for (const auto& [model_instance, _] : infer_param_) {
       InferStatus infer_status =
-          run_core_inference(model_instance, permodel_preprocess_data, permodel_output_data);
+          infer_model(model_instance, permodel_preprocess_data, permodel_output_data);
       if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
         status.set_code(holoinfer_code::H_ERROR);
         infer_status.display_message();
@@ -682,24 +907,22 @@ InferStatus ManagerInfer::execute_inference(DataMap& permodel_preprocess_data,
                            model_instance);
         return status;
       }
-    } else {
-      inference_futures.insert({model_instance,
-                                std::async(std::launch::async,
-                                           std::bind(&ManagerInfer::run_core_inference,
-                                                     this,
-                                                     model_instance,
-                                                     permodel_preprocess_data,
-                                                     permodel_output_data))});
     }
-  }
+  } else {
+    // Data maps are passed by reference, they outlive the barrier
+    infer_barrier_.reset(infer_workers_.size());
+    for (auto& [_, worker] : infer_workers_) {
+      worker->submit(permodel_preprocess_data, permodel_output_data, infer_barrier_);
+    }
+    infer_barrier_.wait();
 
-  if (parallel_processing_) {
-    for (auto& inf_fut : inference_futures) {
-      InferStatus infer_status = inf_fut.second.get();
+    for (const auto& [model_instance, worker] : infer_workers_) {
+      const InferStatus& infer_status = worker->status();
       if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
         status.set_code(holoinfer_code::H_ERROR);
         infer_status.display_message();
-        status.set_message("Inference manager, Inference failed in execution for " + inf_fut.first);
+        status.set_message("Inference manager, Inference failed in execution for " +
+                           model_instance);
         return status;
       }
     }
@@ -718,14 +941,557 @@ InferStatus ManagerInfer::execute_inference(DataMap& permodel_preprocess_data,
   return status;
 }
 
+InferStatus ManagerInfer::setup_batch(const std::string& model_name, size_t max_batch_size,
+                                      double max_delay_ms) {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  auto& context = holo_infer_context_.at(model_name);
+
+  auto bstatus = context->set_batch_size(static_cast<int64_t>(max_batch_size));
+  if (bstatus.get_code() != holoinfer_code::H_SUCCESS) {
+    bstatus.display_message();
+    status.set_message("Inference manager, batching not supported for " + model_name);
+    return status;
+  }
+
+  ModelBatch batch;
+  batch.max_batch_size = max_batch_size;
+  batch.max_delay_ms = max_delay_ms;
+  batch.frames.reserve(max_batch_size);
+
+  // Staging buffers are allocated once for a full batch
+  auto in_tensor_names = infer_param_.at(model_name)->get_input_tensor_names();
+  auto in_dims = context->get_input_dims();
+  auto in_types = context->get_input_datatype();
+  for (size_t d = 0; d < in_tensor_names.size(); d++) {
+    auto astatus = allocate_buffers(batch.inputs,
+                                    in_dims[d],
+                                    in_types[d],
+                                    in_tensor_names[d],
+                                    false,
+                                    device_gpu_dt,
+                                    host_memory_pool_);
+    if (astatus.get_code() != holoinfer_code::H_SUCCESS) {
+      astatus.display_message();
+      status.set_message("Allocation failed for batched input tensor: " + in_tensor_names[d]);
+      return status;
+    }
+    batch.frame_bytes[in_tensor_names[d]] =
+        batch.inputs.at(in_tensor_names[d])->host_buffer.get_bytes() / max_batch_size;
+  }
+
+  auto out_tensor_names = infer_param_.at(model_name)->get_output_tensor_names();
+  auto out_dims = context->get_output_dims();
+  auto out_types = context->get_output_datatype();
+  for (size_t d = 0; d < out_tensor_names.size(); d++) {
+    auto astatus = allocate_buffers(batch.outputs,
+                                    out_dims[d],
+                                    out_types[d],
+                                    out_tensor_names[d],
+                                    false,
+                                    device_gpu_dt,
+                                    host_memory_pool_);
+    if (astatus.get_code() != holoinfer_code::H_SUCCESS) {
+      astatus.display_message();
+      status.set_message("Allocation failed for batched output tensor: " + out_tensor_names[d]);
+      return status;
+    }
+    batch.frame_bytes[out_tensor_names[d]] =
+        batch.outputs.at(out_tensor_names[d])->host_buffer.get_bytes() / max_batch_size;
+  }
+
+  // Results are returned per frame
+  for (auto& dims : out_dims) { dims[0] = 1; }
+  models_output_dims_[model_name] = std::move(out_dims);
+
+  model_batches_[model_name] = std::move(batch);
+  return InferStatus();
+}
+
+InferStatus ManagerInfer::enqueue_inference(DataMap& preprocess_data_map,
+                                            DataMap& output_data_map, uint64_t tag) {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+
+  if (infer_param_.size() == 0) {
+    status.set_message(
+        "Infer Manager core, inference parameters not set. Maybe setup is incomplete for inference "
+        "contexts.");
+    return status;
+  }
+
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  if (batch_timer_status_.get_code() != holoinfer_code::H_SUCCESS) {
+    return std::exchange(batch_timer_status_, InferStatus());
+  }
+
+  auto frame = std::make_shared<PendingFrame>();
+  frame->tag = tag;
+  frame->enqueue_time = std::chrono::steady_clock::now();
+  frame->models_pending = infer_param_.size();
+  pending_frames_.push_back(frame);
+
+  for (const auto& [model_name, params] : infer_param_) {
+    auto batch_it = model_batches_.find(model_name);
+    if (batch_it == model_batches_.end()) {
+      InferStatus infer_status = infer_model(model_name, preprocess_data_map, output_data_map);
+      if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
+        infer_status.display_message();
+        status.set_message("Inference manager, Inference failed in execution for " + model_name);
+        return status;
+      }
+
+      // Output buffers are reused by the next frame, the frame keeps a copy
+      for (const auto& out_tensor : params->get_output_tensor_names()) {
+        auto& buffer = output_data_map.at(out_tensor);
+        frame->outputs[out_tensor] = copy_frame(buffer->host_buffer.data(),
+                                                buffer->host_buffer.get_bytes(),
+                                                buffer->get_datatype(),
+                                                device_gpu_dt,
+                                                host_memory_pool_);
+      }
+      models_output_dims_[model_name] = holo_infer_context_.at(model_name)->get_output_dims();
+      frame->models_pending--;
+      continue;
+    }
+
+    // Copy the inputs of the frame in the next slot of the batch
+    auto& batch = batch_it->second;
+    const size_t slot = batch.frames.size();
+    for (const auto& in_tensor : params->get_input_tensor_names()) {
+      auto in_it = preprocess_data_map.find(in_tensor);
+      if (in_it == preprocess_data_map.end()) {
+        status.set_message("Inference manager, Preprocessed data for tensor " + in_tensor +
+                           " does not exist.");
+        return status;
+      }
+      const size_t frame_bytes = batch.frame_bytes.at(in_tensor);
+      const auto& input = in_it->second;
+      const size_t input_bytes =
+          cuda_buffer_in_ ? input->device_buffer->get_bytes() : input->host_buffer.get_bytes();
+      if (input_bytes != frame_bytes) {
+        status.set_message("Inference manager, size of tensor " + in_tensor +
+                           " does not match the frame size of the batch of " + model_name);
+        return status;
+      }
+      auto staging = static_cast<uint8_t*>(batch.inputs.at(in_tensor)->host_buffer.data());
+      if (cuda_buffer_in_) {
+        set_device(device_gpu_dt);
+        check_cuda(cudaMemcpy(staging + slot * frame_bytes,
+                              input->device_buffer->data(),
+                              frame_bytes,
+                              cudaMemcpyDeviceToHost));
+      } else {
+        std::memcpy(staging + slot * frame_bytes, input->host_buffer.data(), frame_bytes);
+      }
+    }
+    batch.frames.push_back(frame);
+  }
+
+  status = run_ready_batches(false);
+  lock.unlock();
+  // The timer waits for the delay of the frames just added to a batch
+  batch_cv_.notify_all();
+  return status;
+}
+
+InferStatus ManagerInfer::flush_inference() {
+  std::lock_guard<std::mutex> lock(batch_mutex_);
+  if (batch_timer_status_.get_code() != holoinfer_code::H_SUCCESS) {
+    return std::exchange(batch_timer_status_, InferStatus());
+  }
+  return run_ready_batches(true);
+}
+
+InferStatus ManagerInfer::run_ready_batches(bool flush) {
+  auto now = std::chrono::steady_clock::now();
+  for (auto& [model_name, batch] : model_batches_) {
+    if (batch.frames.empty()) { continue; }
+    double waited_ms =
+        std::chrono::duration<double, std::milli>(now - batch.frames.front()->enqueue_time)
+            .count();
+    if (flush || batch.frames.size() >= batch.max_batch_size ||
+        waited_ms >= batch.max_delay_ms) {
+      auto bstatus = run_batch(model_name, batch);
+      if (bstatus.get_code() != holoinfer_code::H_SUCCESS) { return bstatus; }
+    }
+  }
+  return InferStatus();
+}
+
+void ManagerInfer::run_batch_timer() {
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  while (!stop_batch_timer_) {
+    // Wake up when the oldest frame of a batch reaches the batch delay
+    std::optional<std::chrono::steady_clock::time_point> wake_time;
+    for (const auto& [_, batch] : model_batches_) {
+      if (batch.frames.empty()) { continue; }
+      auto deadline = batch.frames.front()->enqueue_time +
+                      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                          std::chrono::duration<double, std::milli>(batch.max_delay_ms));
+      if (!wake_time || deadline < wake_time.value()) { wake_time = deadline; }
+    }
+    if (!wake_time) {
+      batch_cv_.wait(lock);
+      continue;
+    }
+    if (batch_cv_.wait_until(lock, wake_time.value()) == std::cv_status::no_timeout) { continue; }
+
+    try {
+      set_device(device_gpu_dt);
+      auto bstatus = run_ready_batches(false);
+      if (bstatus.get_code() != holoinfer_code::H_SUCCESS) { batch_timer_status_ = bstatus; }
+    } catch (const std::exception& e) {
+      batch_timer_status_ = InferStatus(
+          holoinfer_code::H_ERROR,
+          "Inference manager, exception in batch timer: " + std::string(e.what()));
+    }
+
+    // The results are dequeued without waiting for the next frame
+    if (results_callback_ && !pending_frames_.empty() &&
+        pending_frames_.front()->models_pending == 0) {
+      auto callback = results_callback_;
+      lock.unlock();
+      callback();
+      lock.lock();
+    }
+  }
+}
+
+InferStatus ManagerInfer::run_batch(const std::string& model_name, ModelBatch& batch) {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  const size_t count = batch.frames.size();
+
+  auto bstatus = holo_infer_context_.at(model_name)->set_batch_size(static_cast<int64_t>(count));
+  if (bstatus.get_code() != holoinfer_code::H_SUCCESS) {
+    bstatus.display_message();
+    status.set_message("Inference manager, setting batch size failed for " + model_name);
+    return status;
+  }
+
+  auto s_time = std::chrono::steady_clock::now();
+  InferStatus infer_status = run_core_inference(model_name, batch.inputs, batch.outputs);
+  record_timing(
+      model_name,
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_time)
+          .count());
+  if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
+    infer_status.display_message();
+    status.set_message("Inference manager, Batched inference failed for " + model_name);
+    return status;
+  }
+
+  // Split the results per frame
+  for (const auto& out_tensor : infer_param_.at(model_name)->get_output_tensor_names()) {
+    const auto& staging = batch.outputs.at(out_tensor);
+    const size_t frame_bytes = batch.frame_bytes.at(out_tensor);
+    auto data = static_cast<const uint8_t*>(staging->host_buffer.data());
+    for (size_t f = 0; f < count; f++) {
+      batch.frames[f]->outputs[out_tensor] = copy_frame(data + f * frame_bytes,
+                                                        frame_bytes,
+                                                        staging->get_datatype(),
+                                                        device_gpu_dt,
+                                                        host_memory_pool_);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(timing_mutex_);
+    auto& stats = batch.stats;
+    stats.batches++;
+    stats.last_batch_size = count;
+    for (const auto& frame : batch.frames) {
+      double delay_ms =
+          std::chrono::duration<double, std::milli>(s_time - frame->enqueue_time).count();
+      stats.frames++;
+      stats.average_queue_delay_ms +=
+          (delay_ms - stats.average_queue_delay_ms) / static_cast<double>(stats.frames);
+      stats.max_queue_delay_ms = std::max(stats.max_queue_delay_ms, delay_ms);
+    }
+    stats.average_batch_size =
+        static_cast<double>(stats.frames) / static_cast<double>(stats.batches);
+  }
+
+  for (auto& frame : batch.frames) { frame->models_pending--; }
+  batch.frames.clear();
+  return InferStatus();
+}
+
+bool ManagerInfer::dequeue_inference(DataMap& output_data_map, uint64_t& tag) {
+  std::lock_guard<std::mutex> lock(batch_mutex_);
+  // Frames are returned in order of arrival
+  if (pending_frames_.empty() || pending_frames_.front()->models_pending > 0) { return false; }
+
+  auto frame = std::move(pending_frames_.front());
+  pending_frames_.pop_front();
+  for (auto& [tensor_name, buffer] : frame->outputs) {
+    output_data_map[tensor_name] = std::move(buffer);
+  }
+  tag = frame->tag;
+  return true;
+}
+
+void ManagerInfer::set_results_callback(std::function<void()> callback) {
+  std::lock_guard<std::mutex> lock(batch_mutex_);
+  results_callback_ = std::move(callback);
+}
+
+BatchStatsMap ManagerInfer::get_batch_stats() const {
+  std::lock_guard<std::mutex> lock(timing_mutex_);
+  BatchStatsMap stats;
+  for (const auto& [model_name, batch] : model_batches_) { stats[model_name] = batch.stats; }
+  return stats;
+}
+
 DimType ManagerInfer::get_input_dimensions() const {
   return models_input_dims_;
 }
 
+DataTypeMap ManagerInfer::get_input_datatypes() const {
+  return models_input_types_;
+}
+
 DimType ManagerInfer::get_output_dimensions() const {
   return models_output_dims_;
 }
 
+HostMemoryStats ManagerInfer::get_host_memory_stats() const {
+  return host_memory_pool_->get_stats();
+}
+
+TimingMap ManagerInfer::get_model_timing() const {
+  std::lock_guard<std::mutex> lock(timing_mutex_);
+  return model_timing_;
+}
+
+void ManagerInfer::record_timing(const std::string& model_name, double duration_ms) {
+  std::lock_guard<std::mutex> lock(timing_mutex_);
+  auto& timing = model_timing_[model_name];
+  timing.last_ms = duration_ms;
+  timing.max_ms = std::max(timing.max_ms, duration_ms);
+  timing.count++;
+  timing.average_ms += (duration_ms - timing.average_ms) / static_cast<double>(timing.count);
+}
+
+void ManagerInfer::record_skip(const std::string& model_name) {
+  std::lock_guard<std::mutex> lock(timing_mutex_);
+  model_timing_[model_name].skipped++;
+}
+
+InferStatus ManagerInfer::infer_model(const std::string& model_name, DataMap& input_data,
+                                      DataMap& output_data) {
+  // Each model has its own state, workers of different models do not share it
+  auto skip_it = skip_states_.find(model_name);
+  SkipState* skip = (skip_it != skip_states_.end()) ? &skip_it->second : nullptr;
+
+  // Outputs transmitted without copy are written again
+  for (const auto& out_tensor : infer_param_.at(model_name)->get_output_tensor_names()) {
+    auto output = output_data.find(out_tensor);
+    if (output != output_data.end()) { output->second->host_buffer.reclaim(); }
+  }
+
+  if (skip != nullptr) {
+    auto sstatus = sample_inputs(model_name, input_data, *skip);
+    if (sstatus.get_code() != holoinfer_code::H_SUCCESS) { return sstatus; }
+
+    if (skip->has_reference && skip->skipped_frames < skip->max_frames &&
+        skip->samples.size() == skip->reference.size()) {
+      double difference = 0.0;
+      for (size_t i = 0; i < skip->samples.size(); i++) {
+        difference += std::abs(skip->samples[i] - skip->reference[i]);
+      }
+      if (!skip->samples.empty()) { difference /= static_cast<double>(skip->samples.size()); }
+
+      if (difference < skip->threshold) {
+        auto cstatus = copy_outputs(model_name, skip->outputs, output_data);
+        if (cstatus.get_code() != holoinfer_code::H_SUCCESS) { return cstatus; }
+        skip->skipped_frames++;
+        record_skip(model_name);
+        return InferStatus();
+      }
+    }
+  }
+
+  auto s_time = std::chrono::steady_clock::now();
+  InferStatus status = run_core_inference(model_name, input_data, output_data);
+  record_timing(
+      model_name,
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_time).count());
+
+  if (skip != nullptr && status.get_code() == holoinfer_code::H_SUCCESS) {
+    // The output buffers are handed over downstream, the state keeps its own copy
+    status = copy_outputs(model_name, output_data, skip->outputs);
+    std::swap(skip->reference, skip->samples);
+    skip->has_reference = true;
+    skip->skipped_frames = 0;
+  }
+  return status;
+}
+
+InferStatus ManagerInfer::sample_inputs(const std::string& model_name, DataMap& input_data,
+                                        SkipState& state) {
+  // Number of elements sampled per input tensor, enough to notice motion in a frame while the
+  // signature costs far less than an inference
+  constexpr size_t kSamplesPerTensor = 4096;
+
+  state.samples.clear();
+  for (const auto& in_tensor : infer_param_.at(model_name)->get_input_tensor_names()) {
+    auto in_it = input_data.find(in_tensor);
+    if (in_it == input_data.end()) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Inference manager, Preprocessed data for tensor " + in_tensor +
+                             " does not exist.");
+    }
+    auto& buffer = in_it->second;
+    const auto datatype = buffer->get_datatype();
+    const size_t element_size = get_element_size(datatype);
+    const size_t elements =
+        cuda_buffer_in_ ? buffer->device_buffer->size() : buffer->host_buffer.size();
+    if (elements == 0 || element_size == 0) { continue; }
+
+    const size_t count = std::min(elements, kSamplesPerTensor);
+    const size_t stride = elements / count;
+    state.raw.resize(count * element_size);
+    if (cuda_buffer_in_) {
+      // Gather the strided elements with a single copy
+      set_device(device_gpu_dt);
+      check_cuda(cudaMemcpy2D(state.raw.data(),
+                              element_size,
+                              buffer->device_buffer->data(),
+                              stride * element_size,
+                              element_size,
+                              count,
+                              cudaMemcpyDeviceToHost));
+    } else {
+      const auto* data = static_cast<const uint8_t*>(buffer->host_buffer.data());
+      for (size_t i = 0; i < count; i++) {
+        std::memcpy(state.raw.data() + i * element_size,
+                    data + i * stride * element_size,
+                    element_size);
+      }
+    }
+
+    const size_t offset = state.samples.size();
+    state.samples.resize(offset + count);
+    float* samples = state.samples.data() + offset;
+    switch (datatype) {
+      case holoinfer_datatype::h_Float32:
+        std::memcpy(samples, state.raw.data(), count * sizeof(float));
+        break;
+      case holoinfer_datatype::h_Int8:
+        std::copy_n(reinterpret_cast<const int8_t*>(state.raw.data()), count, samples);
+        break;
+      case holoinfer_datatype::h_UInt8:
+        std::copy_n(state.raw.data(), count, samples);
+        break;
+      case holoinfer_datatype::h_Int32:
+        std::copy_n(reinterpret_cast<const int32_t*>(state.raw.data()), count, samples);
+        break;
+      case holoinfer_datatype::h_Int64:
+        std::copy_n(reinterpret_cast<const int64_t*>(state.raw.data()), count, samples);
+        break;
+      default:
+        return InferStatus(holoinfer_code::H_ERROR,
+                           "Inference manager, temporal skipping does not support the data type "
+                           "of tensor " +
+                               in_tensor);
+    }
+  }
+  return InferStatus();
+}
+
+InferStatus ManagerInfer::copy_outputs(const std::string& model_name, DataMap& from,
+                                       DataMap& to) {
+  for (const auto& out_tensor : infer_param_.at(model_name)->get_output_tensor_names()) {
+    auto from_it = from.find(out_tensor);
+    if (from_it == from.end()) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Inference manager, no output data mapping for " + out_tensor);
+    }
+    auto& source = from_it->second;
+    auto& destination = to[out_tensor];
+    if (!destination) {
+      destination =
+          std::make_shared<DataBuffer>(source->get_datatype(), device_gpu_dt, host_memory_pool_);
+    }
+
+    if (cuda_buffer_out_) {
+      set_device(device_gpu_dt);
+      destination->device_buffer->resize(source->device_buffer->size());
+      check_cuda(cudaMemcpy(destination->device_buffer->data(),
+                            source->device_buffer->data(),
+                            source->device_buffer->get_bytes(),
+                            cudaMemcpyDeviceToDevice));
+    } else {
+      destination->host_buffer.resize(source->host_buffer.size());
+      std::memcpy(destination->host_buffer.data(),
+                  source->host_buffer.data(),
+                  source->host_buffer.get_bytes());
+    }
+  }
+  return InferStatus();
+}
+
+void InferBarrier::reset(size_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_ = count;
+}
+
+void InferBarrier::arrive() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pending_ > 0 && --pending_ == 0) { cv_.notify_all(); }
+}
+
+void InferBarrier::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return pending_ == 0; });
+}
+
+InferWorker::InferWorker(ManagerInfer* manager, const std::string& model_name)
+    : manager_(manager), model_name_(model_name) {
+  thread_ = std::thread(&InferWorker::run, this);
+}
+
+InferWorker::~InferWorker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  if (thread_.joinable()) { thread_.join(); }
+}
+
+void InferWorker::submit(DataMap& preprocess_data, DataMap& output_data, InferBarrier& barrier) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    preprocess_data_ = &preprocess_data;
+    output_data_ = &output_data;
+    barrier_ = &barrier;
+  }
+  cv_.notify_one();
+}
+
+void InferWorker::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return stop_ || barrier_ != nullptr; });
+    if (stop_) { return; }
+    DataMap* preprocess_data = preprocess_data_;
+    DataMap* output_data = output_data_;
+    InferBarrier* barrier = barrier_;
+    barrier_ = nullptr;
+    lock.unlock();
+
+    try {
+      status_ = manager_->infer_model(model_name_, *preprocess_data, *output_data);
+    } catch (const std::exception& e) {
+      status_ = InferStatus(holoinfer_code::H_ERROR,
+                            "Inference manager, exception in inference worker: " +
+                                std::string(e.what()));
+    }
+    barrier->arrive();
+    lock.lock();
+  }
+}
+
 InferContext::InferContext() {
   try {
     if (g_managers.find("current_manager") != g_managers.end()) {
@@ -840,5 +1606,78 @@ DimType InferContext::get_output_dimensions() const {
   return g_manager->get_output_dimensions();
 }
 
+DimType InferContext::get_input_dimensions() const {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->get_input_dimensions();
+}
+
+DataTypeMap InferContext::get_input_datatypes() const {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->get_input_datatypes();
+}
+
+TimingMap InferContext::get_model_timing() const {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->get_model_timing();
+}
+
+HostMemoryStats InferContext::get_host_memory_stats() const {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->get_host_memory_stats();
+}
+
+InferStatus InferContext::enqueue_inference(DataMap& data_map, DataMap& output_data_map,
+                                            uint64_t tag) {
+  InferStatus status = InferStatus();
+
+  if (g_managers.find(unique_id_) == g_managers.end()) {
+    status.set_code(holoinfer_code::H_ERROR);
+    status.set_message("Inference manager, Error: Inference manager not created or is not set up.");
+    return status;
+  }
+
+  try {
+    g_manager = g_managers.at(unique_id_);
+
+    if (data_map.size() == 0) {
+      status.set_code(holoinfer_code::H_ERROR);
+      status.set_message("Inference manager, Error: Data map empty for inferencing");
+      return status;
+    }
+    status = g_manager->enqueue_inference(data_map, output_data_map, tag);
+  } catch (const std::exception& e) {
+    status.set_code(holoinfer_code::H_ERROR);
+    status.set_message(std::string("Inference manager, Error in batched inference: ") + e.what());
+    return status;
+  }
+
+  return status;
+}
+
+bool InferContext::dequeue_inference(DataMap& output_data_map, uint64_t& tag) {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->dequeue_inference(output_data_map, tag);
+}
+
+InferStatus InferContext::flush_inference() {
+  try {
+    g_manager = g_managers.at(unique_id_);
+    return g_manager->flush_inference();
+  } catch (const std::exception& e) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       std::string("Inference manager, Error in batched inference: ") + e.what());
+  }
+}
+
+void InferContext::set_results_callback(std::function<void()> callback) {
+  g_manager = g_managers.at(unique_id_);
+  g_manager->set_results_callback(std::move(callback));
+}
+
+BatchStatsMap InferContext::get_batch_stats() const {
+  g_manager = g_managers.at(unique_id_);
+  return g_manager->get_batch_stats();
+}
+
 }  // namespace inference
 }  // namespace holoscan
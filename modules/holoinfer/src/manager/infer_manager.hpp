@@ -17,13 +17,19 @@
 #ifndef _HOLOSCAN_INFER_MANAGER_H
 #define _HOLOSCAN_INFER_MANAGER_H
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
-#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <holoinfer.hpp>
 #include <holoinfer_buffer.hpp>
@@ -44,6 +50,77 @@
 
 namespace holoscan {
 namespace inference {
+
+class ManagerInfer;
+
+/**
+ * @brief Completion barrier for the models inferred in parallel
+ */
+class InferBarrier {
+ public:
+  /// @brief Set the number of models to wait for
+  void reset(size_t count);
+  /// @brief Mark one model as completed
+  void arrive();
+  /// @brief Wait until all models completed
+  void wait();
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t pending_ = 0;
+};
+
+/**
+ * @brief Long-lived thread inferring one model when parallel processing is enabled
+ */
+class InferWorker {
+ public:
+  /**
+   * @brief Constructor, launches the worker thread
+   *
+   * @param manager Inference manager running the core inference
+   * @param model_name Model inferred by this worker
+   */
+  InferWorker(ManagerInfer* manager, const std::string& model_name);
+
+  /**
+   * @brief Destructor, stops the worker thread
+   */
+  ~InferWorker();
+
+  InferWorker(const InferWorker&) = delete;
+  InferWorker& operator=(const InferWorker&) = delete;
+
+  /**
+   * @brief Submits an inference. The data maps must stay valid until the barrier is reached.
+   *
+   * @param preprocess_data Input DataMap with model name as key and DataBuffer as value
+   * @param output_data Output DataMap with tensor name as key and DataBuffer as value
+   * @param barrier Barrier notified once the inference is complete
+   */
+  void submit(DataMap& preprocess_data, DataMap& output_data, InferBarrier& barrier);
+
+  /**
+   * @brief Status of the last inference. Valid once the barrier is reached.
+   */
+  const InferStatus& status() const { return status_; }
+
+ private:
+  void run();
+
+  ManagerInfer* manager_;
+  std::string model_name_;
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  DataMap* preprocess_data_ = nullptr;
+  DataMap* output_data_ = nullptr;
+  InferBarrier* barrier_ = nullptr;
+  InferStatus status_;
+  bool stop_ = false;
+};
+
 /**
  * @brief Manager class for inference
  */
@@ -89,6 +166,54 @@ class ManagerInfer {
    */
   InferStatus run_core_inference(const std::string& model_name, DataMap& permodel_preprocess_data,
                                  DataMap& permodel_output_data);
+
+  /**
+   * @brief Queues a frame for inference. Models without batching are inferred immediately, the
+   * others once their batch is full or the oldest frame of the batch waited for the batch delay.
+   * Batches whose delay expires while no frame is queued are inferred by a timer thread.
+   *
+   * @param preprocess_data_map Input DataMap with tensor name as key and DataBuffer as value. The
+   * data is copied, buffers can be reused once the call returns.
+   * @param output_data_map Output DataMap used for the inference of models without batching
+   * @param tag Identifier of the frame, returned with its results by dequeue_inference
+   *
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus enqueue_inference(DataMap& preprocess_data_map, DataMap& output_data_map,
+                                uint64_t tag);
+
+  /**
+   * @brief Gets the results of the oldest queued frame if all its models were inferred
+   *
+   * @param output_data_map Output DataMap populated with the buffers of the frame
+   * @param tag Identifier of the frame given to enqueue_inference
+   *
+   * @returns True if the results of a frame were returned
+   */
+  bool dequeue_inference(DataMap& output_data_map, uint64_t& tag);
+
+  /**
+   * @brief Infers the incomplete batches without waiting for the batch delay
+   *
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus flush_inference();
+
+  /**
+   * @brief Sets the function called by the batch timer once the results of the oldest queued
+   * frame are available. Called without holding the lock of the batches.
+   *
+   * @param callback Function called from the batch timer thread
+   */
+  void set_results_callback(std::function<void()> callback);
+
+  /**
+   * @brief Checks if a model is inferred in batches
+   *
+   * @returns True if at least one model has a batch size greater than one
+   */
+  bool is_batching() const { return !model_batches_.empty(); }
+
   /**
    * @brief Cleans up internal context per model
    *
@@ -102,6 +227,13 @@ class ManagerInfer {
    */
   DimType get_input_dimensions() const;
 
+  /**
+   * @brief Get input data type per model
+   *
+   * @returns Map with model name as key and the data type of each input tensor as value
+   */
+  DataTypeMap get_input_datatypes() const;
+
   /**
    * @brief Get output dimension per tensor
    *
@@ -109,10 +241,130 @@ class ManagerInfer {
    */
   DimType get_output_dimensions() const;
 
+  /**
+   * @brief Get inference timing per model
+   *
+   * @returns Map with model name as key and timing as value
+   */
+  TimingMap get_model_timing() const;
+
+  /**
+   * @brief Get the statistics of the host memory pool shared by the buffers of the context
+   *
+   * @returns HostMemoryStats
+   */
+  HostMemoryStats get_host_memory_stats() const;
+
+  /**
+   * @brief Get batching statistics per model
+   *
+   * @returns Map with model name as key and batching statistics as value
+   */
+  BatchStatsMap get_batch_stats() const;
+
  private:
+  friend class InferWorker;
+
+  /// @brief Records the duration of an inference of a model
+  void record_timing(const std::string& model_name, double duration_ms);
+
+  /// @brief Records a frame that reused the outputs of the last inference of a model
+  void record_skip(const std::string& model_name);
+
+  /// @brief Stops the parallel inference workers
+  void stop_workers();
+
+  /// @brief Sets the current CUDA device of the calling thread, if the models use a GPU
+  void set_device(int device_id) const;
+
+  /// @brief Frame queued for inference with the results of the models inferred so far
+  struct PendingFrame {
+    uint64_t tag = 0;
+    std::chrono::steady_clock::time_point enqueue_time;
+    DataMap outputs;
+    size_t models_pending = 0;
+  };
+
+  /// @brief State of a model reusing its outputs on frames close to the last inferred frame
+  struct SkipState {
+    double threshold = 0.0;        ///< Largest mean absolute difference of a skipped frame
+    size_t max_frames = 0;         ///< Largest number of consecutive skipped frames
+    size_t skipped_frames = 0;     ///< Consecutive frames skipped since the last inference
+    bool has_reference = false;    ///< Set once the model was inferred
+    std::vector<uint8_t> raw;      ///< Staging of the sampled input elements
+    std::vector<float> reference;  ///< Input samples of the last inferred frame
+    std::vector<float> samples;    ///< Input samples of the current frame
+    DataMap outputs;               ///< Outputs of the last inference
+  };
+
+  /// @brief Batch of frames collected for a model
+  struct ModelBatch {
+    size_t max_batch_size = 1;
+    double max_delay_ms = 0.0;
+    DataMap inputs;   ///< Staging buffers holding max_batch_size frames per input tensor
+    DataMap outputs;  ///< Staging buffers holding max_batch_size frames per output tensor
+    std::map<std::string, size_t> frame_bytes;  ///< Size of one frame per tensor
+    std::vector<std::shared_ptr<PendingFrame>> frames;
+    BatchStats stats;
+  };
+
+  /**
+   * @brief Creates the inference context of a model. Called concurrently for all models, it only
+   * reads the specifications and does not touch the members of the manager.
+   *
+   * @param model_name Name of the model
+   * @param model_path Path to the model
+   * @param backend Backend of the model
+   * @param device_id GPU the model is loaded on
+   * @param inference_specs Inference specifications
+   * @param context Created inference context
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus create_context(const std::string& model_name, const std::string& model_path,
+                             holoinfer_backend backend, int device_id,
+                             const InferenceSpecs& inference_specs,
+                             std::unique_ptr<InferBase>& context) const;
+
+  /// @brief Sets up the batch of a model, called once the inference context is created
+  InferStatus setup_batch(const std::string& model_name, size_t max_batch_size,
+                          double max_delay_ms);
+
+  /// @brief Infers the frames collected in the batch of a model and splits the results per frame
+  InferStatus run_batch(const std::string& model_name, ModelBatch& batch);
+
+  /// @brief Infers the batches that are full or whose delay expired, or all of them with flush
+  InferStatus run_ready_batches(bool flush);
+
+  /// @brief Infers the batches whose delay expired while no frame is queued, until stopped
+  void run_batch_timer();
+
+  /// @brief Stops the batch timer thread
+  void stop_batch_timer();
+
+  /**
+   * @brief Infers a model and records the timing. With temporal skipping, the outputs of the last
+   * inference are reused instead if the frame is close enough to the last inferred frame.
+   *
+   * @param model_name Input model to do the inference on
+   * @param input_data Input DataMap with tensor name as key and DataBuffer as value
+   * @param output_data Output DataMap with tensor name as key and DataBuffer as value
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus infer_model(const std::string& model_name, DataMap& input_data,
+                          DataMap& output_data);
+
+  /// @brief Samples evenly strided elements of the input tensors of a model into state.samples
+  InferStatus sample_inputs(const std::string& model_name, DataMap& input_data, SkipState& state);
+
+  /// @brief Copies the output tensors of a model, allocating the missing destination buffers
+  InferStatus copy_outputs(const std::string& model_name, DataMap& from, DataMap& to);
+
   /// Flag to infer models in parallel. Defaults to False
   bool parallel_processing_ = false;
 
+  /// Flag set if inference or data buffers use a GPU, otherwise no CUDA device is required
+  bool use_cuda_device_ = true;
+
   /// Flag to demonstrate if input data buffer is on cuda
   bool cuda_buffer_in_ = false;
 
@@ -147,6 +399,9 @@ class ManagerInfer {
   /// Map storing input dimension per model
   DimType models_input_dims_;
 
+  /// Map storing input data type per model
+  DataTypeMap models_input_types_;
+
   /// Output buffer for multi-GPU inference
   std::map<std::string, DataMap> mgpu_output_buffer_;
 
@@ -159,6 +414,48 @@ class ManagerInfer {
   /// Map storing inferred output dimension per tensor
   DimType models_output_dims_;
 
+  /// Map storing inference worker per model, used with parallel processing
+  std::map<std::string, std::unique_ptr<InferWorker>> infer_workers_;
+
+  /// Barrier waiting for the parallel inference workers
+  InferBarrier infer_barrier_;
+
+  /// Host memory pool of the output and multi-GPU buffers
+  std::shared_ptr<HostMemoryPool> host_memory_pool_ = std::make_shared<HostMemoryPool>();
+
+  /// Map storing the batch per model inferred in batches
+  std::map<std::string, ModelBatch> model_batches_;
+
+  /// Map storing the temporal skipping state per model reusing its outputs on near-static frames
+  std::map<std::string, SkipState> skip_states_;
+
+  /// Frames queued for inference, in order of arrival
+  std::deque<std::shared_ptr<PendingFrame>> pending_frames_;
+
+  /// Mutex protecting the batches and the queued frames, shared with the batch timer
+  std::mutex batch_mutex_;
+
+  /// Condition variable waking up the batch timer when a frame is queued or on stop
+  std::condition_variable batch_cv_;
+
+  /// Thread inferring the batches whose delay expired, used if a model has a batch delay
+  std::thread batch_timer_;
+
+  /// Flag stopping the batch timer
+  bool stop_batch_timer_ = false;
+
+  /// Status of the last failed batch of the batch timer, returned by the next enqueue
+  InferStatus batch_timer_status_;
+
+  /// Function called by the batch timer once the results of the oldest queued frame are available
+  std::function<void()> results_callback_;
+
+  /// Map storing inference timing per model
+  TimingMap model_timing_;
+
+  /// Mutex protecting model_timing_ and the batching statistics
+  mutable std::mutex timing_mutex_;
+
   /// Map storing Backends supported with holoinfer mapping
   inline static std::map<std::string, holoinfer_backend> supported_backend_{
       {"onnxrt", holoinfer_backend::h_onnx},
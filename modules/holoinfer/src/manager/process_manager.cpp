@@ -16,8 +16,12 @@
  */
 #include "process_manager.hpp"
 
+#include <functional>
+#include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,15 +29,232 @@
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Name of a data type, as used in the model configuration
+std::string datatype_name(holoinfer_datatype type) {
+  for (const auto& [name, value] : kHoloInferDataTypeMap) {
+    if (value == type) { return name; }
+  }
+  return "unsupported";
+}
+
+std::string dims_string(const std::vector<int>& dims) {
+  std::string result = "[";
+  for (size_t i = 0; i < dims.size(); i++) {
+    result += (i == 0 ? "" : ", ") + std::to_string(dims[i]);
+  }
+  return result + "]";
+}
+
+}  // namespace
+
 InferStatus ManagerProcessor::initialize(const MultiMappings& process_operations,
-                                         const std::string config_path = {}) {
+                                         const std::string config_path, bool fuse_operations) {
   try {
     infer_data_ = std::make_unique<DataProcessor>();
   } catch (const std::bad_alloc&) {
     return InferStatus(holoinfer_code::H_ERROR,
                        "Process Manager, Holoscan out data core: Memory allocation error");
   }
-  return infer_data_->initialize(process_operations, config_path);
+  auto status = infer_data_->initialize(process_operations, config_path);
+  if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+
+  fuse_operations_ = fuse_operations;
+  plans_.clear();
+  if (fuse_operations_) {
+    for (const auto& [tensor_name, operations] : process_operations) {
+      // multi-tensor transforms are not compiled
+      if (tensor_name.find(":") != std::string::npos) { continue; }
+      status = compile_plan(tensor_name, operations);
+      if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+    }
+  }
+  return status;
+}
+
+InferStatus ManagerProcessor::compile_plan(const std::string& tensor_name,
+                                           const std::vector<std::string>& operations) {
+  ProcessPlan plan;
+  // Last operation with an output, its output is the input of the next operations
+  int producer = -1;
+  for (const auto& operation_entry : operations) {
+    PlanStage stage;
+    stage.operation = operation_entry;
+
+    if (operation_entry.find("print") != std::string::npos) {
+      stage.print = true;
+      if (operation_entry.find("custom") != std::string::npos) {
+        std::istringstream cstrings(operation_entry);
+        std::string custom_string;
+        while (std::getline(cstrings, custom_string, ',')) {
+          stage.custom_strings.push_back(custom_string);
+        }
+        if (stage.custom_strings.size() != 3) {
+          return InferStatus(
+              holoinfer_code::H_ERROR,
+              "Process manager, Custom binary print operation must generate 3 strings");
+        }
+        stage.operation = stage.custom_strings[0];
+        stage.custom_strings.erase(stage.custom_strings.begin());
+      }
+    } else {
+      plan.last_compute_stage = static_cast<int>(plan.stages.size());
+    }
+
+    stage.function = infer_data_->resolve_operation(stage.operation);
+    stage.signature = DataProcessor::operation_signature(stage.operation);
+    if (!stage.function || !stage.signature) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Process manager, Operation " + stage.operation +
+                             " cannot be compiled for " + tensor_name);
+    }
+
+    // The input of the first operation is only known when running the plan
+    if (producer >= 0) {
+      const auto* input = stage.signature;
+      const auto* output = plan.stages[producer].signature;
+      if (input->input_type != output->output_type ||
+          (input->input_rank != 0 && input->input_rank != output->output_rank)) {
+        return InferStatus(
+            holoinfer_code::H_ERROR,
+            "Process manager, Operation " + stage.operation + " cannot process the output of " +
+                plan.stages[producer].operation + " for " + tensor_name + ": expected " +
+                datatype_name(input->input_type) + " input of rank " +
+                std::to_string(input->input_rank) + ", got " +
+                datatype_name(output->output_type) + " output of rank " +
+                std::to_string(output->output_rank));
+      }
+    }
+    if (stage.signature->has_output) { producer = static_cast<int>(plan.stages.size()); }
+    plan.stages.push_back(std::move(stage));
+  }
+  plans_.insert({tensor_name, std::move(plan)});
+  return InferStatus();
+}
+
+InferStatus ManagerProcessor::validate_plan(const std::string& tensor_name, ProcessPlan& plan,
+                                            holoinfer_datatype input_type,
+                                            const std::vector<int>& input_dims) {
+  plan.input_type = holoinfer_datatype::h_Unsupported;
+  holoinfer_datatype type = input_type;
+  std::vector<int> dims = input_dims;
+  for (auto& stage : plan.stages) {
+    const auto* signature = stage.signature;
+    if (type != signature->input_type ||
+        (signature->input_rank != 0 && dims.size() != signature->input_rank) ||
+        !signature->output_dims(dims, stage.output_dims)) {
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Process manager, Operation " + stage.operation + " cannot process " +
+                             datatype_name(type) + " data of dimension " + dims_string(dims) +
+                             " for " + tensor_name);
+    }
+    stage.input_dims = dims;
+    if (signature->has_output) {
+      type = signature->output_type;
+      dims = stage.output_dims;
+    }
+  }
+  plan.input_type = input_type;
+  plan.input_dims = input_dims;
+  return InferStatus();
+}
+
+InferStatus ManagerProcessor::run_plan(
+    const std::string& tensor_name, ProcessPlan& plan, const MultiMappings& in_out_tensor_map,
+    DataMap& inferred_result_map, const std::map<std::string, std::vector<int>>& dimension_map) {
+  if (dimension_map.find(tensor_name) == dimension_map.end()) {
+    return InferStatus(holoinfer_code::H_ERROR,
+                       "Process manager, Dimension map does not contain results from " +
+                           tensor_name);
+  }
+
+  const std::vector<std::string> no_tensors;
+  const std::vector<std::string>* out_tensor_names = &no_tensors;
+  if (plan.last_compute_stage >= 0) {
+    auto out_tensors = in_out_tensor_map.find(tensor_name);
+    if (out_tensors == in_out_tensor_map.end()) {
+      return InferStatus(
+          holoinfer_code::H_ERROR,
+          "Process manager, In tensor " + tensor_name + " has no out tensor mapping");
+    }
+    out_tensor_names = &out_tensors->second;
+  }
+
+  const auto& input = inferred_result_map.at(tensor_name);
+  const auto& input_dims = dimension_map.at(tensor_name);
+  // The stages are only validated again when the input changes
+  if (input->get_datatype() != plan.input_type || input_dims != plan.input_dims) {
+    const bool validated = plan.input_type != holoinfer_datatype::h_Unsupported;
+    auto status = validate_plan(tensor_name, plan, input->get_datatype(), input_dims);
+    if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+    // The output allocated for the previous input is reallocated by the last operation
+    if (validated && plan.last_compute_stage >= 0) {
+      processed_data_map_.erase(out_tensor_names->at(0));
+      processed_dims_map_.erase(tensor_name);
+    }
+  }
+  const void* input_data = input->host_buffer.data();
+
+  size_t scratch_index = 0;
+  for (size_t i = 0; i < plan.stages.size(); i++) {
+    auto& stage = plan.stages[i];
+    if (stage.print) {
+      if (stage.custom_strings.empty()) {
+        std::cout << "Printing results from " << tensor_name << " -> ";
+      }
+      std::vector<int64_t> processed_dims;
+      auto status = stage.function(stage.input_dims,
+                                   input_data,
+                                   processed_dims,
+                                   plan.scratch[scratch_index],
+                                   no_tensors,
+                                   stage.custom_strings);
+      if (status.get_code() != holoinfer_code::H_SUCCESS) {
+        status.display_message();
+        return InferStatus(holoinfer_code::H_ERROR,
+                           "Process manager, Error running operation " + stage.operation);
+      }
+      continue;
+    }
+
+    // Only the last operation writes to the processed data map, the intermediate outputs are
+    // written to the scratch buffers
+    const bool last = static_cast<int>(i) == plan.last_compute_stage;
+    DataMap& outputs = last ? processed_data_map_ : plan.scratch[scratch_index];
+    if (!last) {
+      // Operations only allocate their output when it is absent, the scratch buffer is sized
+      // for the output of this stage before running it
+      auto& scratch = outputs[out_tensor_names->at(0)];
+      if (!scratch || scratch->get_datatype() != stage.signature->output_type) {
+        scratch = std::make_shared<DataBuffer>(stage.signature->output_type);
+      }
+      const auto& dims = stage.output_dims;
+      scratch->host_buffer.resize(
+          std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>()));
+    }
+    std::vector<int64_t> processed_dims;
+    auto status = stage.function(stage.input_dims,
+                                 input_data,
+                                 processed_dims,
+                                 outputs,
+                                 *out_tensor_names,
+                                 stage.custom_strings);
+    if (status.get_code() != holoinfer_code::H_SUCCESS) {
+      status.display_message();
+      return InferStatus(holoinfer_code::H_ERROR,
+                         "Process manager, Error running operation " + stage.operation);
+    }
+
+    // Dimensions are only reported when the output is allocated
+    if (last && processed_dims.size() != 0) {
+      processed_dims_map_.insert({tensor_name, {std::move(processed_dims)}});
+    }
+    // The next operations use the output of this one
+    input_data = outputs.at(out_tensor_names->at(0))->host_buffer.data();
+    scratch_index = 1 - scratch_index;
+  }
+  return InferStatus();
 }
 
 InferStatus ManagerProcessor::process_multi_tensor_operation(
@@ -82,10 +303,23 @@ InferStatus ManagerProcessor::process_multi_tensor_operation(
 InferStatus ManagerProcessor::process(
     const MultiMappings& tensor_oper_map, const MultiMappings& in_out_tensor_map,
     DataMap& inferred_result_map, const std::map<std::string, std::vector<int>>& dimension_map) {
+  // Outputs transmitted without copy are written again
+  for (auto& [_, buffer] : processed_data_map_) { buffer->host_buffer.reclaim(); }
+
   for (const auto& current_tensor_operation : tensor_oper_map) {
     auto& tensor_name = current_tensor_operation.first;
     auto operations = current_tensor_operation.second;
 
+    // Compiled plans run all the operations of a tensor, without looking them up by name
+    auto plan = plans_.find(tensor_name);
+    if (plan != plans_.end() &&
+        inferred_result_map.find(tensor_name) != inferred_result_map.end()) {
+      auto status = run_plan(
+          tensor_name, plan->second, in_out_tensor_map, inferred_result_map, dimension_map);
+      if (status.get_code() != holoinfer_code::H_SUCCESS) { return status; }
+      continue;
+    }
+
     // currently one operation is supported
     if (operations.size() != 1) {
       return InferStatus(
@@ -230,5 +464,10 @@ InferStatus ProcessorContext::initialize(const MultiMappings& process_operations
   return process_manager->initialize(process_operations, config_path);
 }
 
+InferStatus ProcessorContext::initialize(const MultiMappings& process_operations,
+                                         const std::string config_path, bool fuse_operations) {
+  return process_manager->initialize(process_operations, config_path, fuse_operations);
+}
+
 }  // namespace inference
 }  // namespace holoscan
@@ -50,10 +50,15 @@ class ManagerProcessor {
    * @param process_operations Map where tensor name is the key, and operations to perform on
    * the tensor as vector of strings. Each value in the vector of strings is the supported
    * operation.
+   * @param config_path Path to the processing configuration settings
+   * @param fuse_operations Compile the operations of each tensor once into a plan. Operations of
+   * a plan can be chained if the data type and rank of the output of an operation match the
+   * input of the next one, and only the output of the last operation is materialized.
    *
    * @returns InferStatus with appropriate code and message
    */
-  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path);
+  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path,
+                         bool fuse_operations = false);
 
   /*
    * @brief Executes post processing operations and generates the result
@@ -100,6 +105,73 @@ class ManagerProcessor {
   DimType get_processed_data_dims() const;
 
  private:
+  /// Operation of a plan, resolved at initialization
+  struct PlanStage {
+    std::string operation;                    ///< Name of the operation
+    processor_FP function;                    ///< Function callback of the operation
+    const OperationSignature* signature;      ///< Input and output types of the operation
+    std::vector<std::string> custom_strings;  ///< Strings of custom print operations
+    bool print = false;                       ///< Whether the operation only prints its input
+    std::vector<int> input_dims;              ///< Dimension of the input, set by validate_plan
+    std::vector<int> output_dims;             ///< Dimension of the output, set by validate_plan
+  };
+
+  /// Operations of a tensor compiled at initialization
+  struct ProcessPlan {
+    std::vector<PlanStage> stages;
+    int last_compute_stage = -1;  ///< Stage materializing the output, -1 for print only plans
+    /// Type and dimension of the input tensor the stages were validated for
+    holoinfer_datatype input_type = holoinfer_datatype::h_Unsupported;
+    std::vector<int> input_dims;
+    /// Scratch buffers of the intermediate outputs, used alternately by consecutive compute
+    /// stages and reused across frames
+    DataMap scratch[2];
+  };
+
+  /*
+   * @brief Compiles the operations of a tensor into a plan
+   *
+   * @param tensor_name Input tensor name
+   * @param operations Operations to perform on the tensor, in sequence
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus compile_plan(const std::string& tensor_name,
+                           const std::vector<std::string>& operations);
+
+  /*
+   * @brief Checks the type and dimension of the input tensor against the stages of a plan, and
+   * computes the dimension of each stage. Called when the input type or dimension changes.
+   *
+   * @param tensor_name Input tensor name
+   * @param plan Plan of the tensor
+   * @param input_type Data type of the input tensor
+   * @param input_dims Dimension of the input tensor
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus validate_plan(const std::string& tensor_name, ProcessPlan& plan,
+                            holoinfer_datatype input_type, const std::vector<int>& input_dims);
+
+  /*
+   * @brief Executes the plan of a tensor
+   *
+   * @param tensor_name Input tensor name
+   * @param plan Plan of the tensor
+   * @param in_out_tensor_map Map with input tensor name as the key, and generated output tensor
+   * names is the value (as vector of strings)
+   * @param inferred_result_map Map with tensor name as key, and related DataBuffer as value
+   * @param dimension_map Map with tensor name as key and related dimension as value.
+   * @returns InferStatus with appropriate code and message
+   */
+  InferStatus run_plan(const std::string& tensor_name, ProcessPlan& plan,
+                       const MultiMappings& in_out_tensor_map, DataMap& inferred_result_map,
+                       const std::map<std::string, std::vector<int>>& dimension_map);
+
+  /// Flag to run the compiled plans. Defaults to False
+  bool fuse_operations_ = false;
+
+  /// Map with tensor name as key and its compiled plan as value
+  std::map<std::string, ProcessPlan> plans_;
+
   /// Pointer to the data processor class
   std::unique_ptr<DataProcessor> infer_data_;
 
@@ -0,0 +1,618 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cpu_kernels.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define HOLOINFER_HAS_AVX2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HOLOINFER_HAS_NEON 1
+#endif
+
+namespace holoscan {
+namespace inference {
+namespace cpu {
+
+namespace {
+
+/// Minimum number of elements per tile, smaller inputs are processed on the calling thread
+constexpr size_t kMinTileSize = 1 << 16;
+
+/// Maximum number of elements per tile of max_per_channel, element offsets are 32 bit
+constexpr size_t kMaxTileElements = size_t{1} << 30;
+
+// Scalar kernels, they define the results of all the kernels.
+
+void min_max_scalar(const float* data, size_t size, float& min, float& max) {
+  for (size_t index = 0; index < size; index++) {
+    float v = data[index];
+    if (max < v) { max = v; }
+    if (min > v) { min = v; }
+  }
+}
+
+/// Merges partial minimum and maximum values
+void merge_min_max(const float* mins, const float* maxs, size_t count, float& min, float& max) {
+  for (size_t i = 0; i < count; i++) {
+    if (max < maxs[i]) { max = maxs[i]; }
+    if (min > mins[i]) { min = mins[i]; }
+  }
+}
+
+void histogram_bins_scalar(const float* data, size_t size, float min, float max, uint8_t* bins,
+                           uint32_t* histogram) {
+  for (size_t index = 0; index < size; index++) {
+    auto value = uint8_t(255 * ((data[index] - min) / (max - min)));
+    bins[index] = value;
+    histogram[value]++;
+  }
+}
+
+void max_per_channel_scalar(const float* data, size_t first_pixel, size_t pixels,
+                            size_t channels, float* max_values, int64_t* max_pixels) {
+  for (size_t pixel = first_pixel; pixel < first_pixel + pixels; pixel++) {
+    const float* values = data + pixel * channels;
+    for (size_t c = 0; c < channels; c++) {
+      if (max_values[c] < values[c]) {
+        max_values[c] = values[c];
+        max_pixels[c] = static_cast<int64_t>(pixel);
+      }
+    }
+  }
+}
+
+size_t select_above_scalar(const float* data, size_t size, float threshold, uint32_t* indices,
+                           size_t first_index) {
+  size_t count = 0;
+  for (size_t index = 0; index < size; index++) {
+    // the index is always written and kept only if selected, which avoids a branch
+    indices[count] = static_cast<uint32_t>(first_index + index);
+    count += data[index] > threshold ? 1 : 0;
+  }
+  return count;
+}
+
+void fill_mask_scalar(const float* mask, size_t pixels, float threshold, const float* color,
+                      float* out) {
+  for (size_t pixel = 0; pixel < pixels; pixel++) {
+    if (mask[pixel] > threshold) { std::memcpy(out + 4 * pixel, color, 4 * sizeof(float)); }
+  }
+}
+
+/// Reduces the per-lane candidates of max_per_channel. Lane p of a block holds channel p %
+/// channels, ties are resolved to the smallest element offset to keep the first occurrence.
+void reduce_lanes(const float* lane_values, const int32_t* lane_offsets, size_t lanes,
+                  size_t channels, size_t first_element, float* max_values,
+                  int64_t* max_pixels) {
+  for (size_t c = 0; c < channels; c++) {
+    float best = max_values[c];
+    int64_t best_offset = -1;
+    for (size_t p = c; p < lanes; p += channels) {
+      if (lane_offsets[p] < 0) { continue; }
+      if (best < lane_values[p] ||
+          (best == lane_values[p] && best_offset >= 0 && lane_offsets[p] < best_offset)) {
+        best = lane_values[p];
+        best_offset = lane_offsets[p];
+      }
+    }
+    if (best_offset >= 0) {
+      max_values[c] = best;
+      max_pixels[c] = static_cast<int64_t>((first_element + best_offset) / channels);
+    }
+  }
+}
+
+#if HOLOINFER_HAS_AVX2
+
+__attribute__((target("avx2"))) void min_max_avx2(const float* data, size_t size, float& min,
+                                                  float& max) {
+  __m256 vmin = _mm256_set1_ps(min);
+  __m256 vmax = _mm256_set1_ps(max);
+  size_t index = 0;
+  for (; index + 8 <= size; index += 8) {
+    __m256 v = _mm256_loadu_ps(data + index);
+    // the second operand is returned for NaN values, so they are ignored like in the scalar loop
+    vmin = _mm256_min_ps(v, vmin);
+    vmax = _mm256_max_ps(v, vmax);
+  }
+  alignas(32) float lanes_min[8];
+  alignas(32) float lanes_max[8];
+  _mm256_store_ps(lanes_min, vmin);
+  _mm256_store_ps(lanes_max, vmax);
+  merge_min_max(lanes_min, lanes_max, 8, min, max);
+  min_max_scalar(data + index, size - index, min, max);
+}
+
+__attribute__((target("avx2"))) void histogram_bins_avx2(const float* data, size_t size,
+                                                         float min, float max, uint8_t* bins,
+                                                         uint32_t* histogram) {
+  // Interleaved sub-histograms avoid store-to-load stalls on repeated bins
+  uint32_t sub_histograms[4][256] = {};
+  const __m256 vmin = _mm256_set1_ps(min);
+  const __m256 vrange = _mm256_set1_ps(max - min);
+  const __m256 vscale = _mm256_set1_ps(255.0f);
+  alignas(32) int32_t values[8];
+  size_t index = 0;
+  for (; index + 8 <= size; index += 8) {
+    __m256 v = _mm256_loadu_ps(data + index);
+    v = _mm256_mul_ps(vscale, _mm256_div_ps(_mm256_sub_ps(v, vmin), vrange));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(values), _mm256_cvttps_epi32(v));
+    for (int lane = 0; lane < 8; lane++) {
+      auto value = static_cast<uint8_t>(values[lane]);
+      bins[index + lane] = value;
+      sub_histograms[lane & 3][value]++;
+    }
+  }
+  for (int i = 0; i < 256; i++) {
+    histogram[i] +=
+        sub_histograms[0][i] + sub_histograms[1][i] + sub_histograms[2][i] + sub_histograms[3][i];
+  }
+  histogram_bins_scalar(data + index, size - index, min, max, bins + index, histogram);
+}
+
+__attribute__((target("avx2"))) void max_per_channel_avx2(const float* data, size_t first_pixel,
+                                                          size_t pixels, size_t channels,
+                                                          float* max_values,
+                                                          int64_t* max_pixels) {
+  // A block of 8 pixels spans `channels` vectors, so each lane always holds the same channel
+  const size_t lanes = 8 * channels;
+  const size_t blocks = pixels / 8;
+  const float* base = data + first_pixel * channels;
+  std::vector<float> lane_values(lanes);
+  std::vector<int32_t> lane_offsets(lanes, -1);
+  for (size_t p = 0; p < lanes; p++) { lane_values[p] = max_values[p % channels]; }
+
+  const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  float* acc_values = lane_values.data();
+  auto* acc_offsets = reinterpret_cast<__m256i*>(lane_offsets.data());
+  for (size_t block = 0; block < blocks; block++) {
+    for (size_t j = 0; j < channels; j++) {
+      const size_t offset = block * lanes + 8 * j;
+      __m256 v = _mm256_loadu_ps(base + offset);
+      __m256 acc = _mm256_loadu_ps(acc_values + 8 * j);
+      __m256 mask = _mm256_cmp_ps(acc, v, _CMP_LT_OQ);
+      _mm256_storeu_ps(acc_values + 8 * j, _mm256_blendv_ps(acc, v, mask));
+      __m256i current = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(offset)), iota);
+      __m256i offsets = _mm256_loadu_si256(acc_offsets + j);
+      offsets = _mm256_castps_si256(_mm256_blendv_ps(
+          _mm256_castsi256_ps(offsets), _mm256_castsi256_ps(current), mask));
+      _mm256_storeu_si256(acc_offsets + j, offsets);
+    }
+  }
+  reduce_lanes(lane_values.data(),
+               lane_offsets.data(),
+               lanes,
+               channels,
+               first_pixel * channels,
+               max_values,
+               max_pixels);
+  max_per_channel_scalar(
+      data, first_pixel + blocks * 8, pixels - blocks * 8, channels, max_values, max_pixels);
+}
+
+__attribute__((target("avx2"))) size_t select_above_avx2(const float* data, size_t size,
+                                                         float threshold, uint32_t* indices) {
+  const __m256 vthreshold = _mm256_set1_ps(threshold);
+  size_t count = 0;
+  size_t index = 0;
+  for (; index + 8 <= size; index += 8) {
+    // ordered comparison, NaN values are not selected
+    int selected =
+        _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + index), vthreshold, _CMP_GT_OQ));
+    while (selected != 0) {
+      indices[count++] = static_cast<uint32_t>(index + __builtin_ctz(selected));
+      selected &= selected - 1;
+    }
+  }
+  return count +
+         select_above_scalar(data + index, size - index, threshold, indices + count, index);
+}
+
+__attribute__((target("avx2"))) void fill_mask_avx2(const float* mask, size_t pixels,
+                                                    float threshold, const float* color,
+                                                    float* out) {
+  const __m256 vthreshold = _mm256_set1_ps(threshold);
+  const __m128 vcolor = _mm_loadu_ps(color);
+  size_t pixel = 0;
+  for (; pixel + 8 <= pixels; pixel += 8) {
+    int selected =
+        _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(mask + pixel), vthreshold, _CMP_GT_OQ));
+    while (selected != 0) {
+      _mm_storeu_ps(out + 4 * (pixel + __builtin_ctz(selected)), vcolor);
+      selected &= selected - 1;
+    }
+  }
+  fill_mask_scalar(mask + pixel, pixels - pixel, threshold, color, out + 4 * pixel);
+}
+
+#endif
+
+#if HOLOINFER_HAS_NEON
+
+void min_max_neon(const float* data, size_t size, float& min, float& max) {
+  float32x4_t vmin = vdupq_n_f32(min);
+  float32x4_t vmax = vdupq_n_f32(max);
+  size_t index = 0;
+  for (; index + 4 <= size; index += 4) {
+    float32x4_t v = vld1q_f32(data + index);
+    // compare and select, vminq_f32/vmaxq_f32 would propagate NaN values
+    vmin = vbslq_f32(vcltq_f32(v, vmin), v, vmin);
+    vmax = vbslq_f32(vcgtq_f32(v, vmax), v, vmax);
+  }
+  float lanes_min[4];
+  float lanes_max[4];
+  vst1q_f32(lanes_min, vmin);
+  vst1q_f32(lanes_max, vmax);
+  merge_min_max(lanes_min, lanes_max, 4, min, max);
+  min_max_scalar(data + index, size - index, min, max);
+}
+
+void histogram_bins_neon(const float* data, size_t size, float min, float max, uint8_t* bins,
+                         uint32_t* histogram) {
+  uint32_t sub_histograms[4][256] = {};
+  const float32x4_t vmin = vdupq_n_f32(min);
+  const float32x4_t vrange = vdupq_n_f32(max - min);
+  const float32x4_t vscale = vdupq_n_f32(255.0f);
+  int32_t values[4];
+  size_t index = 0;
+  for (; index + 4 <= size; index += 4) {
+    float32x4_t v = vld1q_f32(data + index);
+    v = vmulq_f32(vscale, vdivq_f32(vsubq_f32(v, vmin), vrange));
+    vst1q_s32(values, vcvtq_s32_f32(v));
+    for (int lane = 0; lane < 4; lane++) {
+      auto value = static_cast<uint8_t>(values[lane]);
+      bins[index + lane] = value;
+      sub_histograms[lane][value]++;
+    }
+  }
+  for (int i = 0; i < 256; i++) {
+    histogram[i] +=
+        sub_histograms[0][i] + sub_histograms[1][i] + sub_histograms[2][i] + sub_histograms[3][i];
+  }
+  histogram_bins_scalar(data + index, size - index, min, max, bins + index, histogram);
+}
+
+void max_per_channel_neon(const float* data, size_t first_pixel, size_t pixels, size_t channels,
+                          float* max_values, int64_t* max_pixels) {
+  // A block of 4 pixels spans `channels` vectors, so each lane always holds the same channel
+  const size_t lanes = 4 * channels;
+  const size_t blocks = pixels / 4;
+  const float* base = data + first_pixel * channels;
+  std::vector<float> lane_values(lanes);
+  std::vector<int32_t> lane_offsets(lanes, -1);
+  for (size_t p = 0; p < lanes; p++) { lane_values[p] = max_values[p % channels]; }
+
+  const int32_t iota_values[4] = {0, 1, 2, 3};
+  const int32x4_t iota = vld1q_s32(iota_values);
+  for (size_t block = 0; block < blocks; block++) {
+    for (size_t j = 0; j < channels; j++) {
+      const size_t offset = block * lanes + 4 * j;
+      float32x4_t v = vld1q_f32(base + offset);
+      float32x4_t acc = vld1q_f32(lane_values.data() + 4 * j);
+      uint32x4_t mask = vcltq_f32(acc, v);
+      vst1q_f32(lane_values.data() + 4 * j, vbslq_f32(mask, v, acc));
+      int32x4_t current = vaddq_s32(vdupq_n_s32(static_cast<int32_t>(offset)), iota);
+      int32x4_t offsets = vld1q_s32(lane_offsets.data() + 4 * j);
+      vst1q_s32(lane_offsets.data() + 4 * j, vbslq_s32(mask, current, offsets));
+    }
+  }
+  reduce_lanes(lane_values.data(),
+               lane_offsets.data(),
+               lanes,
+               channels,
+               first_pixel * channels,
+               max_values,
+               max_pixels);
+  max_per_channel_scalar(
+      data, first_pixel + blocks * 4, pixels - blocks * 4, channels, max_values, max_pixels);
+}
+
+size_t select_above_neon(const float* data, size_t size, float threshold, uint32_t* indices) {
+  const float32x4_t vthreshold = vdupq_n_f32(threshold);
+  size_t count = 0;
+  size_t index = 0;
+  for (; index + 4 <= size; index += 4) {
+    // most values are below the threshold, blocks without a selected value are skipped
+    if (vmaxvq_u32(vcgtq_f32(vld1q_f32(data + index), vthreshold)) == 0) { continue; }
+    count += select_above_scalar(data + index, 4, threshold, indices + count, index);
+  }
+  return count +
+         select_above_scalar(data + index, size - index, threshold, indices + count, index);
+}
+
+void fill_mask_neon(const float* mask, size_t pixels, float threshold, const float* color,
+                    float* out) {
+  const float32x4_t vthreshold = vdupq_n_f32(threshold);
+  const float32x4_t vcolor = vld1q_f32(color);
+  size_t pixel = 0;
+  for (; pixel + 4 <= pixels; pixel += 4) {
+    uint32_t selected[4];
+    vst1q_u32(selected, vcgtq_f32(vld1q_f32(mask + pixel), vthreshold));
+    for (int lane = 0; lane < 4; lane++) {
+      if (selected[lane] != 0) { vst1q_f32(out + 4 * (pixel + lane), vcolor); }
+    }
+  }
+  fill_mask_scalar(mask + pixel, pixels - pixel, threshold, color, out + 4 * pixel);
+}
+
+#endif
+
+void min_max_range(const float* data, size_t size, float& min, float& max) {
+  switch (simd_level()) {
+#if HOLOINFER_HAS_AVX2
+    case SimdLevel::kAVX2:
+      return min_max_avx2(data, size, min, max);
+#endif
+#if HOLOINFER_HAS_NEON
+    case SimdLevel::kNEON:
+      return min_max_neon(data, size, min, max);
+#endif
+    default:
+      return min_max_scalar(data, size, min, max);
+  }
+}
+
+void histogram_bins_range(const float* data, size_t size, float min, float max, uint8_t* bins,
+                          uint32_t* histogram) {
+  switch (simd_level()) {
+#if HOLOINFER_HAS_AVX2
+    case SimdLevel::kAVX2:
+      return histogram_bins_avx2(data, size, min, max, bins, histogram);
+#endif
+#if HOLOINFER_HAS_NEON
+    case SimdLevel::kNEON:
+      return histogram_bins_neon(data, size, min, max, bins, histogram);
+#endif
+    default:
+      return histogram_bins_scalar(data, size, min, max, bins, histogram);
+  }
+}
+
+void max_per_channel_range(const float* data, size_t first_pixel, size_t pixels,
+                           size_t channels, float* max_values, int64_t* max_pixels) {
+  switch (simd_level()) {
+#if HOLOINFER_HAS_AVX2
+    case SimdLevel::kAVX2:
+      return max_per_channel_avx2(data, first_pixel, pixels, channels, max_values, max_pixels);
+#endif
+#if HOLOINFER_HAS_NEON
+    case SimdLevel::kNEON:
+      return max_per_channel_neon(data, first_pixel, pixels, channels, max_values, max_pixels);
+#endif
+    default:
+      return max_per_channel_scalar(data, first_pixel, pixels, channels, max_values, max_pixels);
+  }
+}
+
+void fill_mask_range(const float* mask, size_t pixels, float threshold, const float* color,
+                     float* out) {
+  switch (simd_level()) {
+#if HOLOINFER_HAS_AVX2
+    case SimdLevel::kAVX2:
+      return fill_mask_avx2(mask, pixels, threshold, color, out);
+#endif
+#if HOLOINFER_HAS_NEON
+    case SimdLevel::kNEON:
+      return fill_mask_neon(mask, pixels, threshold, color, out);
+#endif
+    default:
+      return fill_mask_scalar(mask, pixels, threshold, color, out);
+  }
+}
+
+}  // namespace
+
+SimdLevel simd_level() {
+  static const SimdLevel level = [] {
+#if HOLOINFER_HAS_AVX2
+    if (__builtin_cpu_supports("avx2")) { return SimdLevel::kAVX2; }
+#endif
+#if HOLOINFER_HAS_NEON
+    return SimdLevel::kNEON;
+#endif
+    return SimdLevel::kScalar;
+  }();
+  return level;
+}
+
+TilePool& TilePool::instance() {
+  static TilePool pool;
+  return pool;
+}
+
+TilePool::TilePool() {
+  const size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), 8);
+  for (size_t i = 1; i < threads; i++) { workers_.emplace_back(&TilePool::worker_loop, this); }
+}
+
+TilePool::~TilePool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto& worker : workers_) { worker.join(); }
+}
+
+void TilePool::worker_loop() {
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this, generation] { return stop_ || generation_ != generation; });
+    if (stop_) { return; }
+    generation = generation_;
+    const auto* job = job_;
+    const size_t tiles = tiles_;
+    if (job == nullptr) { continue; }
+    ++active_;
+    lock.unlock();
+    for (size_t tile = next_tile_++; tile < tiles; tile = next_tile_++) { (*job)(tile); }
+    lock.lock();
+    if (--active_ == 0) { done_cv_.notify_all(); }
+  }
+}
+
+void TilePool::run(size_t tiles, const std::function<void(size_t)>& fn) {
+  if (tiles <= 1 || workers_.empty() || !run_mutex_.try_lock()) {
+    for (size_t tile = 0; tile < tiles; tile++) { fn(tile); }
+    return;
+  }
+  std::lock_guard<std::mutex> run_lock(run_mutex_, std::adopt_lock);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &fn;
+    tiles_ = tiles;
+    next_tile_ = 0;
+    ++generation_;
+  }
+  cv_.notify_all();
+  for (size_t tile = next_tile_++; tile < tiles; tile = next_tile_++) { fn(tile); }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this] { return active_ == 0; });
+  job_ = nullptr;
+}
+
+size_t tile_count(size_t size, size_t min_tile_size) {
+  const size_t max_tiles = 4 * TilePool::instance().concurrency();
+  return std::max<size_t>(1, std::min(size / std::max<size_t>(1, min_tile_size), max_tiles));
+}
+
+void min_max(const float* data, size_t size, float& min, float& max) {
+  const size_t tiles = tile_count(size, kMinTileSize);
+  if (tiles == 1) { return min_max_range(data, size, min, max); }
+
+  std::vector<float> tile_min(tiles, min);
+  std::vector<float> tile_max(tiles, max);
+  const size_t tile_size = (size + tiles - 1) / tiles;
+  TilePool::instance().run(tiles, [&](size_t tile) {
+    const size_t begin = std::min(size, tile * tile_size);
+    const size_t end = std::min(size, begin + tile_size);
+    min_max_range(data + begin, end - begin, tile_min[tile], tile_max[tile]);
+  });
+  merge_min_max(tile_min.data(), tile_max.data(), tiles, min, max);
+}
+
+void histogram_bins(const float* data, size_t size, float min, float max, uint8_t* bins,
+                    uint32_t* histogram) {
+  const size_t tiles = tile_count(size, kMinTileSize);
+  if (tiles == 1) { return histogram_bins_range(data, size, min, max, bins, histogram); }
+
+  std::vector<uint32_t> tile_histograms(tiles * 256, 0);
+  const size_t tile_size = (size + tiles - 1) / tiles;
+  TilePool::instance().run(tiles, [&](size_t tile) {
+    const size_t begin = std::min(size, tile * tile_size);
+    const size_t end = std::min(size, begin + tile_size);
+    histogram_bins_range(
+        data + begin, end - begin, min, max, bins + begin, tile_histograms.data() + tile * 256);
+  });
+  for (size_t tile = 0; tile < tiles; tile++) {
+    for (int i = 0; i < 256; i++) { histogram[i] += tile_histograms[tile * 256 + i]; }
+  }
+}
+
+void lookup_rgb(const uint8_t* bins, size_t size, const uint8_t* lut, uint8_t* out) {
+  auto lookup = [bins, lut, out](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; index++) {
+      const uint8_t value = lut[bins[index]];
+      out[3 * index] = value;
+      out[3 * index + 1] = value;
+      out[3 * index + 2] = value;
+    }
+  };
+  const size_t tiles = tile_count(size, kMinTileSize);
+  if (tiles == 1) { return lookup(0, size); }
+
+  const size_t tile_size = (size + tiles - 1) / tiles;
+  TilePool::instance().run(tiles, [&](size_t tile) {
+    const size_t begin = std::min(size, tile * tile_size);
+    lookup(begin, std::min(size, begin + tile_size));
+  });
+}
+
+void max_per_channel(const float* data, size_t pixels, size_t channels, float* max_values,
+                     int64_t* max_pixels) {
+  if (channels == 0 || pixels == 0) { return; }
+  size_t tiles = tile_count(pixels * channels, kMinTileSize);
+  tiles = std::max(tiles, (pixels * channels + kMaxTileElements - 1) / kMaxTileElements);
+  if (tiles == 1) {
+    return max_per_channel_range(data, 0, pixels, channels, max_values, max_pixels);
+  }
+
+  std::vector<float> tile_values(tiles * channels);
+  std::vector<int64_t> tile_pixels(tiles * channels, -1);
+  for (size_t tile = 0; tile < tiles; tile++) {
+    std::copy(max_values, max_values + channels, tile_values.begin() + tile * channels);
+  }
+  const size_t tile_size = (pixels + tiles - 1) / tiles;
+  TilePool::instance().run(tiles, [&](size_t tile) {
+    const size_t begin = std::min(pixels, tile * tile_size);
+    const size_t end = std::min(pixels, begin + tile_size);
+    max_per_channel_range(data,
+                          begin,
+                          end - begin,
+                          channels,
+                          tile_values.data() + tile * channels,
+                          tile_pixels.data() + tile * channels);
+  });
+  // Merge in tile order with a strict comparison to keep the first occurrence
+  for (size_t tile = 0; tile < tiles; tile++) {
+    for (size_t c = 0; c < channels; c++) {
+      const size_t i = tile * channels + c;
+      if (tile_pixels[i] >= 0 && max_values[c] < tile_values[i]) {
+        max_values[c] = tile_values[i];
+        max_pixels[c] = tile_pixels[i];
+      }
+    }
+  }
+}
+
+size_t select_above(const float* data, size_t size, float threshold, uint32_t* indices) {
+  // not tiled, the indices are written in order
+  switch (simd_level()) {
+#if HOLOINFER_HAS_AVX2
+    case SimdLevel::kAVX2:
+      return select_above_avx2(data, size, threshold, indices);
+#endif
+#if HOLOINFER_HAS_NEON
+    case SimdLevel::kNEON:
+      return select_above_neon(data, size, threshold, indices);
+#endif
+    default:
+      return select_above_scalar(data, size, threshold, indices, 0);
+  }
+}
+
+void fill_mask(const float* mask, size_t pixels, float threshold, const float* color, float* out) {
+  const size_t tiles = tile_count(pixels, kMinTileSize);
+  if (tiles == 1) { return fill_mask_range(mask, pixels, threshold, color, out); }
+
+  const size_t tile_size = (pixels + tiles - 1) / tiles;
+  TilePool::instance().run(tiles, [&](size_t tile) {
+    const size_t begin = std::min(pixels, tile * tile_size);
+    const size_t end = std::min(pixels, begin + tile_size);
+    fill_mask_range(mask + begin, end - begin, threshold, color, out + 4 * begin);
+  });
+}
+
+}  // namespace cpu
+}  // namespace inference
+}  // namespace holoscan
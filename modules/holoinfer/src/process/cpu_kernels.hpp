@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_CPU_KERNELS_H
+#define _HOLOSCAN_CPU_KERNELS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace holoscan {
+namespace inference {
+namespace cpu {
+
+/// Instruction set used by the CPU kernels
+enum class SimdLevel { kScalar, kAVX2, kNEON };
+
+/**
+ * @brief Instruction set detected at runtime and used by the CPU kernels
+ *
+ * @returns Best supported SimdLevel
+ */
+SimdLevel simd_level();
+
+/**
+ * @brief Thread pool shared by the CPU kernels to process tiles in parallel
+ */
+class TilePool {
+ public:
+  /**
+   * @brief Get the pool shared by all data processors
+   */
+  static TilePool& instance();
+
+  /**
+   * @brief Number of threads processing tiles, including the calling thread
+   */
+  size_t concurrency() const { return workers_.size() + 1; }
+
+  /**
+   * @brief Runs the function on each tile and waits for completion. The calling thread
+   * participates. If the pool is busy with another caller, all tiles run on the calling thread.
+   *
+   * @param tiles Number of tiles
+   * @param fn Function called with the tile index
+   */
+  void run(size_t tiles, const std::function<void(size_t)>& fn);
+
+  ~TilePool();
+
+ private:
+  TilePool();
+  void worker_loop();
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;  ///< Held by the caller owning the pool
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(size_t)>* job_ = nullptr;
+  size_t tiles_ = 0;
+  std::atomic<size_t> next_tile_{0};
+  size_t active_ = 0;
+  uint64_t generation_ = 0;
+  bool stop_ = false;
+};
+
+/**
+ * @brief Number of tiles to split the work in
+ *
+ * @param size Number of elements
+ * @param min_tile_size Minimum number of elements per tile
+ */
+size_t tile_count(size_t size, size_t min_tile_size);
+
+/**
+ * @brief Updates min and max with the values in data. NaN values are ignored.
+ *
+ * @param data Input data
+ * @param size Number of elements
+ * @param min Minimum value, must be initialized
+ * @param max Maximum value, must be initialized
+ */
+void min_max(const float* data, size_t size, float& min, float& max);
+
+/**
+ * @brief Maps values to 8 bit bins with uint8_t(255 * ((v - min) / (max - min))) and counts them
+ *
+ * @param data Input data
+ * @param size Number of elements
+ * @param min Minimum value of data
+ * @param max Maximum value of data
+ * @param bins Output bin per element
+ * @param histogram Histogram of 256 bins, updated with the counts
+ */
+void histogram_bins(const float* data, size_t size, float min, float max, uint8_t* bins,
+                    uint32_t* histogram);
+
+/**
+ * @brief Looks up the bins and replicates the value to 3 channels
+ *
+ * @param bins Bin per element
+ * @param size Number of elements
+ * @param lut Table of 256 output values
+ * @param out Output data, 3 values per element
+ */
+void lookup_rgb(const uint8_t* bins, size_t size, const uint8_t* lut, uint8_t* out);
+
+/**
+ * @brief Finds the first pixel holding the strict maximum of each channel, in row-major order.
+ *
+ * @param data Input data in HWC format
+ * @param pixels Number of pixels
+ * @param channels Number of channels
+ * @param max_values Maximum value per channel, must be initialized
+ * @param max_pixels Pixel of the maximum value per channel, -1 if no value is greater than the
+ * initial maximum
+ */
+void max_per_channel(const float* data, size_t pixels, size_t channels, float* max_values,
+                     int64_t* max_pixels);
+
+/**
+ * @brief Finds the elements strictly greater than the threshold, in increasing order. NaN values
+ * are never selected.
+ *
+ * @param data Input data
+ * @param size Number of elements
+ * @param threshold Threshold value
+ * @param indices Output indices of the selected elements, must hold size elements
+ * @returns Number of selected elements
+ */
+size_t select_above(const float* data, size_t size, float threshold, uint32_t* indices);
+
+/**
+ * @brief Writes the color to the pixels whose mask value is strictly greater than the threshold.
+ * Other pixels are not modified.
+ *
+ * @param mask Mask data, one value per pixel
+ * @param pixels Number of pixels
+ * @param threshold Threshold value
+ * @param color RGBA color
+ * @param out Output data, 4 values per pixel
+ */
+void fill_mask(const float* mask, size_t pixels, float threshold, const float* color, float* out);
+
+}  // namespace cpu
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
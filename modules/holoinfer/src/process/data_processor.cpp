@@ -201,20 +201,14 @@ InferStatus DataProcessor::scale_intensity_cpu(const std::vector<int>& dimension
   auto input_data = static_cast<const float*>(indata);
   float max = 0, min = 100000;
 
-  for (auto index = 0; index < dsize; index++) {
-    float v = input_data[index];
-    if (max < v) { max = v; }
-    if (min > v) { min = v; }
-  }
-
-  std::vector<uint32_t> histogram(256, 0);
+  cpu::min_max(input_data, dsize, min, max);
 
-  for (auto index = 0; index < dsize; index++) {
-    auto value = uint8_t(255 * ((input_data[index] - min) / (max - min)));
-    histogram[value]++;
-  }
+  // Bins are computed once and reused when equalizing
+  bins_.resize(dsize);
+  uint32_t histogram[256] = {};
+  cpu::histogram_bins(input_data, dsize, min, max, bins_.data(), histogram);
 
-  std::vector<uint32_t> cdf_histogram(256);
+  uint32_t cdf_histogram[256];
 
   cdf_histogram[0] = histogram[0];
   for (int i = 1; i < 256; i++) { cdf_histogram[i] = histogram[i] + cdf_histogram[i - 1]; }
@@ -226,18 +220,13 @@ InferStatus DataProcessor::scale_intensity_cpu(const std::vector<int>& dimension
     if (count > cdf_histogram_max) { cdf_histogram_max = count; }
   }
 
-  std::vector<uint32_t> updated_histogram(256);
+  uint8_t updated_histogram[256];
   for (int i = 0; i < 256; i++) {
-    updated_histogram[i] =
-        (uint32_t)(255.0 * (cdf_histogram[i] - cdf_histogram_min) / (dsize - cdf_histogram_min));
+    updated_histogram[i] = static_cast<uint8_t>(
+        (uint32_t)(255.0 * (cdf_histogram[i] - cdf_histogram_min) / (dsize - cdf_histogram_min)));
   }
 
-  for (auto index = 0; index < dsize; index++) {
-    auto dm_index = channels * index;
-    auto fvalue = uint32_t(255 * ((input_data[index] - min) / (max - min)));
-    auto value = updated_histogram[fvalue];
-    for (int c = 0; c < channels; c++) { processed_data[dm_index + c] = value; }
-  }
+  cpu::lookup_rgb(bins_.data(), dsize, updated_histogram, processed_data);
 
   return InferStatus();
 }
@@ -278,36 +267,70 @@ InferStatus DataProcessor::compute_max_per_channel_cpu(
 
   auto input_data = static_cast<const float*>(indata);
   auto processed_data = static_cast<float*>(outdata);
-  std::vector<unsigned int> max_x_per_channel, max_y_per_channel;
-
-  max_x_per_channel.resize(out_channels, 0);
-  max_y_per_channel.resize(out_channels, 0);
-  std::vector<float> maxV(out_channels, -1999);
-
-  for (unsigned int i = 0; i < rows; i++) {
-    for (unsigned int j = 0; j < cols; j++) {
-      for (unsigned int c = 1; c < out_channels; c++) {
-        unsigned int index = i * cols * out_channels + j * out_channels + c;
-        float v1 = input_data[index];
-        if (maxV[c] < v1) {
-          maxV[c] = v1;
-          max_x_per_channel[c] = i;
-          max_y_per_channel[c] = j;
-        }
-      }
-    }
-  }
+
+  std::vector<float> max_values(out_channels, -1999);
+  std::vector<int64_t> max_pixels(out_channels, -1);
+  cpu::max_per_channel(input_data, rows * cols, out_channels, max_values.data(), max_pixels.data());
 
   for (unsigned int i = 0; i < out_channels; i++) {
-    processed_data[2 * i] = static_cast<float>(max_x_per_channel[i]) / static_cast<float>(rows);
-    processed_data[2 * i + 1] = static_cast<float>(max_y_per_channel[i]) / static_cast<float>(cols);
+    // The first channel is the background, its location is not searched.
+    const int64_t pixel = (i == 0) ? -1 : max_pixels[i];
+    const size_t max_x = pixel < 0 ? 0 : static_cast<size_t>(pixel) / cols;
+    const size_t max_y = pixel < 0 ? 0 : static_cast<size_t>(pixel) % cols;
+    processed_data[2 * i] = static_cast<float>(max_x) / static_cast<float>(rows);
+    processed_data[2 * i + 1] = static_cast<float>(max_y) / static_cast<float>(cols);
   }
 
-  max_x_per_channel.clear();
-  max_y_per_channel.clear();
   return InferStatus();
 }
 
+namespace {
+
+/// Any input with at least one element, for the operations that only print their input
+bool print_output_dims(const std::vector<int>& in_dims, std::vector<int>& out_dims) {
+  out_dims.clear();
+  return accumulate(in_dims.begin(), in_dims.end(), 1, std::multiplies<size_t>()) >= 1;
+}
+
+/// Single channel CHW input, HWC output with 3 channels
+bool scale_intensity_output_dims(const std::vector<int>& in_dims, std::vector<int>& out_dims) {
+  if (in_dims.size() != 3 || in_dims[0] != 1 || in_dims[1] < 1 || in_dims[2] < 1) { return false; }
+  out_dims = {in_dims[1], in_dims[2], 3};
+  return true;
+}
+
+/// NHWC input, (x, y) location per channel
+bool max_per_channel_output_dims(const std::vector<int>& in_dims, std::vector<int>& out_dims) {
+  if (in_dims.size() != 4 || in_dims[3] < 1) { return false; }
+  out_dims = {1, 2 * in_dims[3]};
+  return true;
+}
+
+}  // namespace
+
+const OperationSignature* DataProcessor::operation_signature(const std::string& operation) {
+  static const std::map<std::string, OperationSignature> signatures{
+      {"max_per_channel_scaled",
+       {holoinfer_datatype::h_Float32, 4, true, holoinfer_datatype::h_Float32, 2,
+        max_per_channel_output_dims}},
+      {"scale_intensity_cpu",
+       {holoinfer_datatype::h_Float32, 3, true, holoinfer_datatype::h_UInt8, 3,
+        scale_intensity_output_dims}},
+      {"print", {holoinfer_datatype::h_Float32, 0, false, {}, 0, print_output_dims}},
+      {"print_int32", {holoinfer_datatype::h_Int32, 0, false, {}, 0, print_output_dims}},
+      {"print_custom_binary_classification",
+       {holoinfer_datatype::h_Float32, 0, false, {}, 0, print_output_dims}}};
+  auto signature = signatures.find(operation);
+  if (signature == signatures.end()) { return nullptr; }
+  return &signature->second;
+}
+
+processor_FP DataProcessor::resolve_operation(const std::string& operation) const {
+  auto fp = oper_to_fp_.find(operation);
+  if (fp == oper_to_fp_.end()) { return processor_FP(); }
+  return fp->second;
+}
+
 InferStatus DataProcessor::process_operation(const std::string& operation,
                                              const std::vector<int>& indims, const void* indata,
                                              std::vector<int64_t>& processed_dims,
@@ -31,6 +31,7 @@
 #include <holoinfer_constants.hpp>
 #include <holoinfer_utils.hpp>
 
+#include <process/cpu_kernels.hpp>
 #include <process/transforms/generate_boxes.hpp>
 
 namespace holoscan {
@@ -43,6 +44,19 @@ using processor_FP =
                               const std::vector<std::string>& output_tensors,
                               const std::vector<std::string>& custom_strings)>;
 
+/// Input and output types of an operation with a processor_FP callback, used to check the
+/// operations chained in a processing plan before running them
+struct OperationSignature {
+  holoinfer_datatype input_type = holoinfer_datatype::h_Float32;  ///< Data type of the input
+  size_t input_rank = 0;   ///< Number of dimensions of the input, 0 if any rank is accepted
+  bool has_output = false;  ///< False for operations that only read their input (print)
+  holoinfer_datatype output_type = holoinfer_datatype::h_Float32;  ///< Data type of the output
+  size_t output_rank = 0;  ///< Number of dimensions of the output
+  /// Computes the dimension of the output from the dimension of the input. Returns false if the
+  /// input dimension is not supported by the operation.
+  std::function<bool(const std::vector<int>&, std::vector<int>&)> output_dims;
+};
+
 // Declaration of function callback for transforms that need configuration (via a yaml file).
 // Transforms additionally support multiple inputs and outputs from the processing.
 using transforms_FP =
@@ -89,6 +103,22 @@ class DataProcessor {
                                 const std::vector<std::string>& output_tensors,
                                 const std::vector<std::string>& custom_strings);
 
+  /**
+   * @brief Resolves the function callback of an operation, to call it without a lookup by name.
+   *
+   * @param operation Operation to resolve. Refer to user docs for a list of supported operations
+   * @returns Function callback of the operation, empty if the operation is not supported
+   */
+  processor_FP resolve_operation(const std::string& operation) const;
+
+  /**
+   * @brief Gets the input and output types of an operation.
+   *
+   * @param operation Operation name. Refer to user docs for a list of supported operations
+   * @returns Pointer to the signature of the operation, nullptr if the operation is not supported
+   */
+  static const OperationSignature* operation_signature(const std::string& operation);
+
   /**
    * @brief Executes a transform via function callback. (Currently CPU based)
    *
@@ -182,6 +212,9 @@ class DataProcessor {
   // Map with operation name as key, with pointer to its object
   std::map<std::string, std::unique_ptr<TransformBase>> transforms_;
 
+  /// Histogram bin per element, reused by scale_intensity_cpu
+  std::vector<uint8_t> bins_;
+
   inline static const std::map<std::string, holoinfer_data_processor> supported_print_operations_{
       {"print", holoinfer_data_processor::h_HOST},
       {"print_int32", holoinfer_data_processor::h_HOST},
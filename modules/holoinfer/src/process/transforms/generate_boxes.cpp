@@ -16,15 +16,52 @@
  */
 #include "generate_boxes.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Intersection over union of two boxes given by their corners
+float intersection_over_union(float ax1, float ay1, float ax2, float ay2, float bx1, float by1,
+                              float bx2, float by2) {
+  const float width = std::min(ax2, bx2) - std::max(ax1, bx1);
+  const float height = std::min(ay2, by2) - std::max(ay1, by1);
+  if (width <= 0 || height <= 0) { return 0; }
+  const float intersection = width * height;
+  const float area_union = (ax2 - ax1) * (ay2 - ay1) + (bx2 - bx1) * (by2 - by1) - intersection;
+  return area_union > 0 ? intersection / area_union : 0;
+}
+
+}  // namespace
+
+void GenerateBoxes::Candidates::clear() {
+  classes.clear();
+  scores.clear();
+  x1.clear();
+  y1.clear();
+  x2.clear();
+  y2.clear();
+  order.clear();
+  kept.clear();
+  std::fill(class_counts.begin(), class_counts.end(), 0);
+  std::fill(kept_counts.begin(), kept_counts.end(), 0);
+}
+
+int GenerateBoxes::get_class(int64_t label) const {
+  if (label >= 0 && static_cast<size_t>(label) < label_classes.size()) {
+    return label_classes[label];
+  }
+  return default_class;
+}
+
 InferStatus GenerateBoxes::create_tensor_map(const std::vector<std::string>& input_tensors) {
   for (auto& tensor_key : input_tensors) {
     if (tensor_key.find("scores") != std::string::npos) {
@@ -154,6 +191,16 @@ InferStatus GenerateBoxes::initialize(const std::vector<std::string>& input_tens
     HOLOSCAN_LOG_INFO("Updated threshold value: {}", threshold);
   }
 
+  if (configuration["params"].find("top_k") != configuration["params"].end()) {
+    top_k = std::stoi(configuration["params"]["top_k"]);
+    HOLOSCAN_LOG_INFO("Updated top_k value: {}", top_k);
+  }
+
+  if (configuration["params"].find("nms_threshold") != configuration["params"].end()) {
+    nms_threshold = std::stof(configuration["params"]["nms_threshold"]);
+    HOLOSCAN_LOG_INFO("Updated nms_threshold value: {}", nms_threshold);
+  }
+
   if (configuration.find("objects") != configuration.end()) {
     for (const auto& [current_object, count] : configuration["objects"]) {
       label_count.insert({current_object, std::stoi(count)});
@@ -188,9 +235,63 @@ InferStatus GenerateBoxes::initialize(const std::vector<std::string>& input_tens
     }
   }
 
+  // Classes and output tensor names are resolved once, frames only use indices
+  std::map<std::string, int> class_index;
+  for (const auto& [object_name, max_objects] : label_count) {
+    class_index[object_name] = static_cast<int>(class_names.size());
+    class_names.push_back(object_name);
+    class_limits.push_back(std::max(max_objects, 0));
+    box_keys.emplace_back();
+    text_keys.emplace_back();
+    for (int i = 0; i < max_objects; i++) {
+      box_keys.back().push_back(fmt::format("{}{}", object_name, i));
+      text_keys.back().push_back(fmt::format("{}text{}", object_name, i));
+    }
+  }
+  // if the label is not found in config, object is used as label
+  if (class_index.find("object") != class_index.end()) { default_class = class_index.at("object"); }
+  for (const auto& label_string : label_strings) {
+    auto it = class_index.find(label_string);
+    label_classes.push_back(it != class_index.end() ? it->second : default_class);
+  }
+  candidates.class_counts.assign(class_names.size(), 0);
+  candidates.kept_counts.assign(class_names.size(), 0);
+
   return create_tensor_map(input_tensors);
 }
 
+void GenerateBoxes::sort_candidates() {
+  auto& c = candidates;
+  // ties keep the order of the model output
+  auto by_score = [&c](uint32_t a, uint32_t b) {
+    return c.scores[a] > c.scores[b] || (c.scores[a] == c.scores[b] && a < b);
+  };
+  if (top_k > 0 && static_cast<size_t>(top_k) < c.order.size()) {
+    std::partial_sort(c.order.begin(), c.order.begin() + top_k, c.order.end(), by_score);
+    c.order.resize(top_k);
+  } else {
+    std::sort(c.order.begin(), c.order.end(), by_score);
+  }
+}
+
+bool GenerateBoxes::is_suppressed(uint32_t candidate) const {
+  const auto& c = candidates;
+  for (uint32_t kept : c.kept) {
+    if (c.classes[kept] == c.classes[candidate] &&
+        intersection_over_union(c.x1[candidate],
+                                c.y1[candidate],
+                                c.x2[candidate],
+                                c.y2[candidate],
+                                c.x1[kept],
+                                c.y1[kept],
+                                c.x2[kept],
+                                c.y2[kept]) > nms_threshold) {
+      return true;
+    }
+  }
+  return false;
+}
+
 InferStatus GenerateBoxes::execute_mask(const std::map<std::string, void*>& indata,
                                         const std::map<std::string, std::vector<int>>& indim,
                                         DataMap& processed_data, DimType& processed_dims) {
@@ -210,39 +311,24 @@ InferStatus GenerateBoxes::execute_mask(const std::map<std::string, void*>& inda
   size_t size_scores =
       accumulate(dims_scores.begin(), dims_scores.end(), 1, std::multiplies<size_t>());
   auto buffer = reinterpret_cast<float*>(processed_data.at(key)->host_buffer.data());
-
-  for (int i = 0; i < size_scores; i++) {
-    if (scores[i] > threshold) {
-      std::string key_mask = "object";
-      // if the label is not found in config, object is used as label
-      if (labels[i] < label_strings.size()) {  // it has to be a valid label
-        if (label_count.find(label_strings[labels[i]]) != label_count.end()) {
-          key_mask = label_strings[labels[i]];
-        }
-      }
-
-      float red = 1, blue = 1, green = 1, alpha = 1;
-      if (color_map.find(key_mask) != color_map.end()) {
-        red = color_map.at(key_mask)[0];
-        green = color_map.at(key_mask)[1];
-        blue = color_map.at(key_mask)[2];
-        alpha = color_map.at(key_mask)[3];
-      }
-
-      for (int a = 0; a < height; a++) {
-        for (int b = 0; b < width; b++) {
-          auto index = i * width * height + a * width + b;
-          auto hindex = (a * width + b) * 4;
-
-          if (masks[index] > threshold) {
-            buffer[hindex] = red;
-            buffer[hindex + 1] = green;
-            buffer[hindex + 2] = blue;
-            buffer[hindex + 3] = alpha;
-          }
-        }
-      }
+  // host buffers are not initialized, masks are drawn over a transparent image
+  std::fill(buffer, buffer + height * width * 4, 0.0f);
+
+  auto& selected = candidates.selected;
+  selected.resize(size_scores);
+  const size_t selected_count = cpu::select_above(scores, size_scores, threshold, selected.data());
+  const size_t mask_size = static_cast<size_t>(height) * width;
+
+  for (size_t s = 0; s < selected_count; s++) {
+    const uint32_t i = selected[s];
+    const int object_class = get_class(labels[i]);
+    const std::string& key_mask = object_class >= 0 ? class_names[object_class] : "object";
+
+    float color[4] = {1, 1, 1, 1};
+    if (color_map.find(key_mask) != color_map.end()) {
+      std::copy_n(color_map.at(key_mask).begin(), 4, color);
     }
+    cpu::fill_mask(masks + i * mask_size, mask_size, threshold, color, buffer);
   }
 
   return InferStatus();
@@ -276,10 +362,10 @@ InferStatus GenerateBoxes::execute(const std::map<std::string, void*>& indata,
         "Generate boxes, Input data must have a 'boxes' tensor when the dimension map does.");
   }
   // reset all tensors to be displayed in holoviz
-  for (const auto& [object_name, max_objects] : label_count) {
-    for (int i = 0; i < max_objects; i++) {
-      auto key = fmt::format("{}{}", object_name, i);
-      auto key_text = fmt::format("{}text{}", object_name, i);
+  for (size_t object_class = 0; object_class < class_names.size(); object_class++) {
+    for (int i = 0; i < class_limits[object_class]; i++) {
+      const auto& key = box_keys[object_class][i];
+      const auto& key_text = text_keys[object_class][i];
 
       if (processed_data.find(key) == processed_data.end()) {
         processed_data.insert({key, std::make_shared<DataBuffer>()});
@@ -314,52 +400,66 @@ InferStatus GenerateBoxes::execute(const std::map<std::string, void*>& indata,
 
     size_t size_scores =
         accumulate(dims_scores.begin(), dims_scores.end(), 1, std::multiplies<size_t>());
-    std::map<std::string, std::vector<std::vector<float>>> valid_boxes;
-
-    // later update with a priority queue
-    // Currently the first configured count of the object above threshold is selected
-    // Later it will be configured count of the object above threshold with highest score.
-    for (int i = 0; i < size_scores; i++) {
-      if (scores[i] > threshold) {
-        std::string key = "object";  // if the label is not found in config, object is used as label
-        if (labels[i] < label_strings.size()) {  // it has to be a valid label
-          if (label_count.find(label_strings[labels[i]]) != label_count.end()) {
-            key = label_strings[labels[i]];
-          }
-        }
 
-        valid_boxes[key].push_back({boxes[4 * i] / width,
-                                    boxes[4 * i + 1] / height,
-                                    boxes[4 * i + 2] / width,
-                                    boxes[4 * i + 3] / height});
-      }
+    // Candidates above threshold, boxes of objects that are not displayed are dropped
+    auto& c = candidates;
+    c.clear();
+    c.selected.resize(size_scores);
+    const size_t selected_count =
+        cpu::select_above(scores, size_scores, threshold, c.selected.data());
+    for (size_t s = 0; s < selected_count; s++) {
+      const uint32_t i = c.selected[s];
+      const int object_class = get_class(labels[i]);
+      if (object_class < 0) { continue; }
+      c.order.push_back(static_cast<uint32_t>(c.classes.size()));
+      c.classes.push_back(object_class);
+      c.scores.push_back(scores[i]);
+      c.x1.push_back(boxes[4 * i]);
+      c.y1.push_back(boxes[4 * i + 1]);
+      c.x2.push_back(boxes[4 * i + 2]);
+      c.y2.push_back(boxes[4 * i + 3]);
+      c.class_counts[object_class]++;
     }
 
-    for (const auto& [obj_name, obj_boxes] : valid_boxes) {
-      int size_of_item = obj_boxes.size();
-      HOLOSCAN_LOG_INFO("Valid box count for object {} = {}", obj_name, size_of_item);
-
-      if (label_count.find(obj_name) != label_count.end()) {
-        if (size_of_item > label_count.at(obj_name)) {
-          HOLOSCAN_LOG_INFO("Valid box count more than maximum display limit of {}",
-                            label_count.at(obj_name));
-          size_of_item = label_count.at(obj_name);
-        }
-      } else {
-        size_of_item = 0;
+    for (size_t object_class = 0; object_class < class_names.size(); object_class++) {
+      if (c.class_counts[object_class] == 0) { continue; }
+      HOLOSCAN_LOG_INFO("Valid box count for object {} = {}",
+                        class_names[object_class],
+                        c.class_counts[object_class]);
+      if (c.class_counts[object_class] > class_limits[object_class]) {
+        HOLOSCAN_LOG_INFO("Valid box count more than maximum display limit of {}",
+                          class_limits[object_class]);
       }
+    }
 
-      for (int i = 0; i < size_of_item; i++) {
-        auto key = fmt::format("{}{}", obj_name, i);
-        std::memcpy(processed_data.at(key)->host_buffer.data(),
-                    obj_boxes[i].data(),
-                    obj_boxes[i].size() * sizeof(float));
+    // Without top_k and suppression, the first boxes of each object are displayed
+    if (top_k > 0 || nms_threshold > 0) { sort_candidates(); }
 
-        key = fmt::format("{}text{}", obj_name, i);
-        auto current_data_text = static_cast<float*>(processed_data.at(key)->host_buffer.data());
-        current_data_text[0] = obj_boxes[i][2];
-        current_data_text[1] = obj_boxes[i][1];
-      }
+    size_t full_classes = 0;
+    for (size_t object_class = 0; object_class < class_names.size(); object_class++) {
+      if (class_limits[object_class] == 0) { full_classes++; }
+    }
+    for (uint32_t candidate : c.order) {
+      if (full_classes == class_names.size()) { break; }
+      const int object_class = c.classes[candidate];
+      const int slot = c.kept_counts[object_class];
+      if (slot >= class_limits[object_class]) { continue; }
+      if (nms_threshold > 0 && is_suppressed(candidate)) { continue; }
+
+      c.kept.push_back(candidate);
+      if (++c.kept_counts[object_class] == class_limits[object_class]) { full_classes++; }
+
+      auto current_data =
+          static_cast<float*>(processed_data.at(box_keys[object_class][slot])->host_buffer.data());
+      current_data[0] = c.x1[candidate] / width;
+      current_data[1] = c.y1[candidate] / height;
+      current_data[2] = c.x2[candidate] / width;
+      current_data[3] = c.y2[candidate] / height;
+
+      auto current_data_text =
+          static_cast<float*>(processed_data.at(text_keys[object_class][slot])->host_buffer.data());
+      current_data_text[0] = current_data[2];
+      current_data_text[1] = current_data[1];
     }
   }
   return InferStatus();
@@ -30,6 +30,7 @@
 #include <holoinfer_constants.hpp>
 #include <holoinfer_utils.hpp>
 
+#include <process/cpu_kernels.hpp>
 #include <process/transform.hpp>
 namespace holoscan {
 namespace inference {
@@ -64,6 +65,8 @@ class GenerateBoxes : public TransformBase {
   /**
    * @brief Core execution. Ingests input data with tensor names as "scores", "labels" and "boxes".
    * Finds the valid boxes and text and populates the tensors and coordinates to be used in holoviz.
+   * Boxes are selected in the order of the model output, or by decreasing score if top_k or
+   * nms_threshold are configured.
    * @param indata Map with key as tensor name as value as raw data buffer
    * @param indim Map with key as tensor name as value as dimension of the input tensor
    * @param processed_data Output data map, that will be populated
@@ -88,6 +91,29 @@ class GenerateBoxes : public TransformBase {
                            DataMap& processed_data, DimType& processed_dims);
 
  private:
+  /// @brief Candidate boxes of a frame, stored as structure of arrays and reused across frames
+  struct Candidates {
+    std::vector<uint32_t> selected;     ///< Indices of the scores above threshold
+    std::vector<int> classes;           ///< Class of the candidate
+    std::vector<float> scores;          ///< Score of the candidate
+    std::vector<float> x1, y1, x2, y2;  ///< Box corners in model coordinates
+    std::vector<uint32_t> order;        ///< Candidates in the order they are displayed
+    std::vector<uint32_t> kept;         ///< Displayed candidates
+    std::vector<int> class_counts;      ///< Number of candidates per class
+    std::vector<int> kept_counts;       ///< Number of displayed candidates per class
+
+    void clear();
+  };
+
+  /// @brief Class of the boxes of a label, -1 if they are not displayed
+  int get_class(int64_t label) const;
+
+  /// @brief Orders the candidates by decreasing score and keeps the top_k first ones
+  void sort_candidates();
+
+  /// @brief Checks if a candidate overlaps a displayed box of the same class
+  bool is_suppressed(uint32_t candidate) const;
+
   /// @brief  Path to the configuration file
   std::string config_path_;
 
@@ -100,6 +126,15 @@ class GenerateBoxes : public TransformBase {
   /// is configurable via configuration file
   float threshold = 0.75;
 
+  /// Maximum number of candidate boxes with the highest scores kept per frame. 0 keeps all boxes
+  /// above threshold. This is configurable via configuration file
+  int top_k = 0;
+
+  /// IoU threshold above which the box of an object is suppressed by an overlapping box of the same
+  /// object with a higher score. 0 disables the suppression. This is configurable via
+  /// configuration file
+  float nms_threshold = 0.0f;
+
   /// Default display width. Used to generate coordinates of boxes and text for holoviz display.
   int width = 1920;
 
@@ -118,6 +153,24 @@ class GenerateBoxes : public TransformBase {
 
   /// Color to be displayed for masks per object
   std::map<std::string, std::vector<float>> color_map;
+
+  /// Displayed object names, in the order of label_count
+  std::vector<std::string> class_names;
+
+  /// Maximum number of displayed boxes per class
+  std::vector<int> class_limits;
+
+  /// Class per label of label_strings, -1 if the boxes of the label are not displayed
+  std::vector<int> label_classes;
+
+  /// Class of labels missing from label_strings, -1 if their boxes are not displayed
+  int default_class = -1;
+
+  /// Output tensor names of the boxes and texts per class and display slot
+  std::vector<std::vector<std::string>> box_keys, text_keys;
+
+  /// Candidate boxes of the current frame
+  Candidates candidates;
 };
 }  // namespace inference
 }  // namespace holoscan
@@ -15,8 +15,13 @@
  * limitations under the License.
  */
 
+#include <stdlib.h>
+
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <string>
 #include <utility>
 #include <vector>
@@ -49,10 +54,11 @@ uint32_t get_element_size(holoinfer_datatype element_type) noexcept {
 
 InferStatus allocate_buffers(DataMap& buffers, std::vector<int64_t>& dims,
                              holoinfer_datatype datatype, const std::string& keyname,
-                             bool allocate_cuda, int device_id) {
+                             bool allocate_cuda, int device_id,
+                             std::shared_ptr<HostMemoryPool> pool) {
   size_t buffer_size = accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
 
-  auto data_buffer = std::make_shared<DataBuffer>(datatype, device_id);
+  auto data_buffer = std::make_shared<DataBuffer>(datatype, device_id, std::move(pool));
   if (!data_buffer) {
     InferStatus status = InferStatus(holoinfer_code::H_ERROR);
     status.set_message("Data buffer creation failed for " + keyname);
@@ -72,13 +78,197 @@ void DeviceFree::operator()(void* ptr) const {
   cudaFree(ptr);
 }
 
-DataBuffer::DataBuffer(holoinfer_datatype data_type, int device_id)
-    : type_(data_type), device_id_(device_id) {
+DataBuffer::DataBuffer(holoinfer_datatype data_type, int device_id,
+                       std::shared_ptr<HostMemoryPool> pool)
+    : host_buffer(data_type, std::move(pool)), type_(data_type), device_id_(device_id) {
   device_buffer = std::make_shared<DeviceBuffer>(type_);
   if (!device_buffer) {
     throw std::runtime_error("Device buffer creation failed in DataBuffer constructor");
   }
-  host_buffer.set_type(type_);
+}
+
+HostMemoryPool::~HostMemoryPool() {
+  trim();
+}
+
+std::shared_ptr<HostMemoryPool> HostMemoryPool::get_default() {
+  static auto default_pool = std::make_shared<HostMemoryPool>();
+  return default_pool;
+}
+
+size_t HostMemoryPool::get_size_class(size_t bytes) {
+  size_t power = kAlignment;
+  while (power < bytes) { power <<= 1; }
+  if (power <= 4096) { return power; }
+  // four classes between power / 2 and power, wasting at most a quarter of the block
+  const size_t step = power / 8;
+  return (bytes + step - 1) / step * step;
+}
+
+void* HostMemoryPool::allocate(size_t bytes, size_t& block_size) {
+  block_size = get_size_class(bytes);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto blocks = free_blocks_.find(block_size);
+    if (blocks != free_blocks_.end() && !blocks->second.empty()) {
+      void* ptr = blocks->second.back();
+      blocks->second.pop_back();
+      stats_.hits++;
+      stats_.bytes_cached -= block_size;
+      stats_.bytes_in_use += block_size;
+      return ptr;
+    }
+  }
+
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, kAlignment, block_size) != 0) { throw std::bad_alloc(); }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.misses++;
+  stats_.bytes_in_use += block_size;
+  stats_.peak_bytes = std::max(stats_.peak_bytes, stats_.bytes_in_use + stats_.bytes_cached);
+  return ptr;
+}
+
+void HostMemoryPool::release(void* ptr, size_t block_size) {
+  if (ptr == nullptr) { return; }
+  std::lock_guard<std::mutex> lock(mutex_);
+  free_blocks_[block_size].push_back(ptr);
+  stats_.bytes_in_use -= block_size;
+  stats_.bytes_cached += block_size;
+}
+
+void HostMemoryPool::trim() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [block_size, blocks] : free_blocks_) {
+    for (void* ptr : blocks) { free(ptr); }
+  }
+  free_blocks_.clear();
+  stats_.bytes_cached = 0;
+}
+
+HostMemoryStats HostMemoryPool::get_stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+HostBuffer::HostBuffer(holoinfer_datatype data_type, std::shared_ptr<HostMemoryPool> pool)
+    : pool_(pool ? std::move(pool) : HostMemoryPool::get_default()), type_(data_type) {}
+
+HostBuffer::HostBuffer(const HostBuffer& other) : pool_(other.pool_), type_(other.type_) {
+  resize(other.number_of_elements_);
+  const void* source = other.external_ != nullptr ? other.external_ : other.buffer_;
+  if (get_bytes() != 0) { std::memcpy(buffer_, source, get_bytes()); }
+}
+
+HostBuffer& HostBuffer::operator=(const HostBuffer& other) {
+  if (this != &other) {
+    reclaim();
+    type_ = other.type_;
+    resize(other.number_of_elements_);
+    const void* source = other.external_ != nullptr ? other.external_ : other.buffer_;
+    if (get_bytes() != 0) { std::memcpy(buffer_, source, get_bytes()); }
+  }
+  return *this;
+}
+
+/// Shared state of a lent data buffer. The block is released to the pool by the buffer, or by
+/// the borrower if the buffer continued with new storage before the borrower released it.
+struct HostBuffer::Loan {
+  std::mutex mutex;
+  bool returned = false;   ///< The borrower released the data
+  bool abandoned = false;  ///< The buffer continued with new storage
+  std::shared_ptr<HostMemoryPool> pool;
+  void* ptr = nullptr;
+  size_t block_size = 0;
+};
+
+HostBuffer::~HostBuffer() {
+  if (!end_loan()) { pool_->release(buffer_, capacity_); }
+}
+
+void HostBuffer::resize(size_t number_of_elements) {
+  external_ = nullptr;
+  external_owner_.reset();
+
+  const size_t bytes = number_of_elements * get_element_size(type_);
+  if (bytes > capacity_) {
+    size_t block_size = 0;
+    void* buffer = pool_->allocate(bytes, block_size);
+    if (!end_loan()) { pool_->release(buffer_, capacity_); }
+    buffer_ = buffer;
+    capacity_ = block_size;
+  }
+  number_of_elements_ = number_of_elements;
+}
+
+void HostBuffer::clear() {
+  external_ = nullptr;
+  external_owner_.reset();
+  number_of_elements_ = 0;
+}
+
+void HostBuffer::borrow(void* data, size_t number_of_elements, std::shared_ptr<void> owner) {
+  external_ = data;
+  external_owner_ = std::move(owner);
+  number_of_elements_ = number_of_elements;
+}
+
+std::shared_ptr<void> HostBuffer::detach() {
+  if (external_ != nullptr) { return std::shared_ptr<void>(external_owner_, external_); }
+  if (buffer_ == nullptr) { return nullptr; }
+
+  // Lent data is handed over with the loan, which then owns the block
+  std::shared_ptr<void> data = lent_data_.lock();
+  end_loan();
+  if (!data) {
+    data = std::shared_ptr<void>(buffer_, [pool = pool_, block_size = capacity_](void* ptr) {
+      pool->release(ptr, block_size);
+    });
+  }
+  buffer_ = nullptr;
+  capacity_ = 0;
+  resize(number_of_elements_);
+  return data;
+}
+
+std::shared_ptr<void> HostBuffer::lend() {
+  if (external_ != nullptr) { return std::shared_ptr<void>(external_owner_, external_); }
+  if (buffer_ == nullptr) { return nullptr; }
+  if (auto data = lent_data_.lock()) { return data; }
+
+  loan_ = std::make_shared<Loan>();
+  loan_->pool = pool_;
+  loan_->ptr = buffer_;
+  loan_->block_size = capacity_;
+  std::shared_ptr<void> data(buffer_, [loan = loan_](void*) {
+    std::lock_guard<std::mutex> lock(loan->mutex);
+    loan->returned = true;
+    if (loan->abandoned) { loan->pool->release(loan->ptr, loan->block_size); }
+  });
+  lent_data_ = data;
+  return data;
+}
+
+void HostBuffer::reclaim() {
+  if (!end_loan()) { return; }
+  // The borrower owns the storage now
+  buffer_ = nullptr;
+  capacity_ = 0;
+  resize(number_of_elements_);
+}
+
+bool HostBuffer::end_loan() {
+  if (!loan_) { return false; }
+  bool abandoned = false;
+  {
+    std::lock_guard<std::mutex> lock(loan_->mutex);
+    abandoned = !loan_->returned;
+    loan_->abandoned = abandoned;
+  }
+  loan_.reset();
+  lent_data_.reset();
+  return abandoned;
 }
 
 DeviceBuffer::DeviceBuffer(holoinfer_datatype type)
@@ -45,6 +45,7 @@ create a custom application.
     holoscan.core.NetworkContext
     holoscan.core.Operator
     holoscan.core.OperatorSpec
+    holoscan.core.OperatorStatistics
     holoscan.core.OutputContext
     holoscan.core.ParameterFlag
     holoscan.core.Resource
@@ -86,7 +87,7 @@ from ._core import (
 from ._core import Fragment as _Fragment
 from ._core import InputContext, IOSpec, Message, NetworkContext
 from ._core import Operator as _Operator
-from ._core import OutputContext, ParameterFlag
+from ._core import OperatorStatistics, OutputContext, ParameterFlag
 from ._core import PyOperatorSpec as OperatorSpec
 from ._core import PyTensor as Tensor
 from ._core import (
@@ -129,6 +130,7 @@ __all__ = [
     "Operator",
     "OperatorSpec",
     "OperatorGraph",
+    "OperatorStatistics",
     "OutputContext",
     "ParameterFlag",
     "Resource",
@@ -312,6 +314,7 @@ class Tracker:
         num_start_messages_to_skip=10,
         num_last_messages_to_discard=10,
         latency_threshold=0,
+        trace_filename=None,
     ):
         """
         Parameters
@@ -333,6 +336,9 @@ class Tracker:
         latency_threshold : int, optional
             The minimum end-to-end latency in milliseconds to account for in the end-to-end
             latency metric calculations.
+        trace_filename : str or None, optional
+            If none, binary tracing will be disabled. Otherwise, every message path will be traced
+            asynchronously to the specified binary file (see `DataFlowTracker.enable_trace`).
         """
         self.app = app
         self.enable_logging = filename is not None
@@ -341,6 +347,7 @@ class Tracker:
                 filename=filename,
                 num_buffered_messages=num_buffered_messages,
             )
+        self.trace_filename = trace_filename
         self.tracker_kwargs = dict(
             num_start_messages_to_skip=num_start_messages_to_skip,
             num_last_messages_to_discard=num_last_messages_to_discard,
@@ -351,8 +358,12 @@ class Tracker:
         self.tracker = self.app.track(**self.tracker_kwargs)
         if self.enable_logging:
             self.tracker.enable_logging(**self.logging_kwargs)
+        if self.trace_filename is not None:
+            self.tracker.enable_trace(filename=self.trace_filename)
         return self.tracker
 
     def __exit__(self, exc_type, exc_value, exc_tb):
         if self.enable_logging:
             self.tracker.end_logging()
+        if self.trace_filename is not None:
+            self.tracker.end_trace()
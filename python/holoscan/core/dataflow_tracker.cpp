@@ -38,7 +38,11 @@ void init_data_flow_tracker(py::module_& m) {
       .value("AVG_E2E_LATENCY", DataFlowMetric::kAvgE2ELatency)
       .value("MIN_E2E_LATENCY", DataFlowMetric::kMinE2ELatency)
       .value("NUM_SRC_MESSAGES", DataFlowMetric::kNumSrcMessages)
-      .value("NUM_DST_MESSAGES", DataFlowMetric::kNumDstMessages);
+      .value("NUM_DST_MESSAGES", DataFlowMetric::kNumDstMessages)
+      .value("P50_E2E_LATENCY", DataFlowMetric::kP50E2ELatency)
+      .value("P90_E2E_LATENCY", DataFlowMetric::kP90E2ELatency)
+      .value("P99_E2E_LATENCY", DataFlowMetric::kP99E2ELatency)
+      .value("P999_E2E_LATENCY", DataFlowMetric::kP999E2ELatency);
 
   py::class_<DataFlowTracker>(m, "DataFlowTracker", doc::DataFlowTracker::doc_DataFlowTracker)
       .def(py::init<>(), doc::DataFlowTracker::doc_DataFlowTracker)
@@ -48,6 +52,12 @@ void init_data_flow_tracker(py::module_& m) {
            "num_buffered_messages"_a = kDefaultNumBufferedMessages,
            doc::DataFlowTracker::doc_enable_logging)
       .def("end_logging", &DataFlowTracker::end_logging, doc::DataFlowTracker::doc_end_logging)
+      .def("enable_trace",
+           &DataFlowTracker::enable_trace,
+           "filename"_a = kDefaultTraceFilename,
+           "ring_capacity"_a = kDefaultTraceRingCapacity,
+           doc::DataFlowTracker::doc_enable_trace)
+      .def("end_trace", &DataFlowTracker::end_trace, doc::DataFlowTracker::doc_end_trace)
       // TODO: sphinx API doc build complains if more than one overloaded get_metric method has a
       //       docstring specified. For now using the docstring defined for 2-argument
       //       version and describe the single argument variant in the Notes section.
@@ -59,6 +69,10 @@ void init_data_flow_tracker(py::module_& m) {
       .def("get_metric",
            py::overload_cast<DataFlowMetric>(&DataFlowTracker::get_metric),
            "metric"_a = DataFlowMetric::kNumSrcMessages)
+      .def("get_latency_histogram",
+           &DataFlowTracker::get_latency_histogram,
+           "pathstring"_a,
+           doc::DataFlowTracker::doc_get_latency_histogram)
       .def(
           "get_num_paths", &DataFlowTracker::get_num_paths, doc::DataFlowTracker::doc_get_num_paths)
       .def("get_path_strings",
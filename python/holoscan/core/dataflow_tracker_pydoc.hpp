@@ -67,6 +67,24 @@ Notes
 There is also an overloaded version of this function that takes only the `metric` argument.
 )doc")
 
+PYDOC(get_latency_histogram, R"doc(
+Return the histogram of the tracked end-to-end latencies for a given path.
+
+Only non-empty buckets are returned. The same messages which are taken into account for the
+other end-to-end latency metrics are counted in the histogram.
+
+Parameters
+----------
+pathstring : str
+    The path name string for which the histogram is being queried
+
+Returns
+-------
+histogram : list[tuple[float, int]]
+    A list of (bucket upper bound latency in ms, number of messages) pairs, in increasing order of
+    latency. The list is empty if the path is not found.
+)doc")
+
 PYDOC(get_num_paths, R"doc(
 The number of tracked paths
 
@@ -110,6 +128,29 @@ PYDOC(end_logging, R"doc(
 Write out any remaining messages from the log buffer and close the file
 )doc")
 
+PYDOC(enable_trace, R"doc(
+Enable binary tracing of every message at the end of the every execution of a leaf
+Operator (and at the end of cycles).
+
+For every Operator of every path of a message, a fixed-size binary event (Operator ID, receive and
+publish timestamps, message ID) is recorded into a lock-free ring buffer of the calling thread.
+A background thread writes the events to the binary trace file, so no text formatting or file I/O
+is done on the scheduler threads. The trace file can be converted to Chrome trace / Perfetto JSON
+with the `convert_dfft_trace_to_chrome_trace.py` script.
+
+Parameters
+----------
+filename : str
+    The name of the binary trace file.
+ring_capacity : int
+    The capacity (in events) of the ring buffer of each thread. Events are dropped (and counted)
+    if a ring buffer is full.
+)doc")
+
+PYDOC(end_trace, R"doc(
+Write out any remaining trace events and close the binary trace file
+)doc")
+
 PYDOC(print, R"doc(
 Print the result of the data flow tracking in pretty-printed format to the standard output
 )doc")
@@ -21,9 +21,11 @@
 #include <pybind11/stl.h>
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "application_pydoc.hpp"
 #include "fragment_pydoc.hpp"
@@ -34,6 +36,8 @@
 #include "holoscan/core/graph.hpp"
 #include "holoscan/core/network_context.hpp"
 #include "holoscan/core/operator.hpp"
+#include "holoscan/core/operator_metrics.hpp"
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
 #include "holoscan/core/scheduler.hpp"
 #include "kwarg_handling.hpp"
 
@@ -44,6 +48,25 @@ namespace py = pybind11;
 namespace holoscan {
 
 void init_fragment(py::module_& m) {
+  py::class_<OperatorStatistics>(
+      m, "OperatorStatistics", doc::OperatorStatistics::doc_OperatorStatistics)
+      .def(py::init<>())
+      .def_readonly("tick_count", &OperatorStatistics::tick_count)
+      .def_readonly("compute_time_mean_ms", &OperatorStatistics::compute_time_mean_ms)
+      .def_readonly("compute_time_max_ms", &OperatorStatistics::compute_time_max_ms)
+      .def_readonly("compute_time_p50_ms", &OperatorStatistics::compute_time_p50_ms)
+      .def_readonly("compute_time_p99_ms", &OperatorStatistics::compute_time_p99_ms)
+      .def_readonly("interval_mean_ms", &OperatorStatistics::interval_mean_ms)
+      .def_readonly("interval_max_ms", &OperatorStatistics::interval_max_ms)
+      .def_readonly("input_queue_depth_mean", &OperatorStatistics::input_queue_depth_mean)
+      .def_readonly("input_queue_depth_max", &OperatorStatistics::input_queue_depth_max)
+      .def_readonly("start_time_ms", &OperatorStatistics::start_time_ms)
+      .def_readonly("stop_time_ms", &OperatorStatistics::stop_time_ms)
+      .def_readonly("deadline_miss_count", &OperatorStatistics::deadline_miss_count)
+      .def_readonly("max_lateness_ms", &OperatorStatistics::max_lateness_ms)
+      .def_readonly("dropped_frame_count", &OperatorStatistics::dropped_frame_count)
+      .def_readonly("compute_time_histogram", &OperatorStatistics::compute_time_histogram);
+
   py::class_<Config, std::shared_ptr<Config>>(m, "Config", doc::Config::doc_Config)
       .def(py::init<const std::string&, const std::string&>(),
            "config_file"_a,
@@ -139,6 +162,48 @@ void init_fragment(py::module_& m) {
            "latency_threshold"_a = kDefaultLatencyThreshold,
            doc::Application::doc_track,
            py::return_value_policy::reference_internal)
+      .def("operator_metrics", &Fragment::operator_metrics, doc::Fragment::doc_operator_metrics)
+      .def_property("operator_metrics_log_period",
+                    py::overload_cast<>(&Fragment::operator_metrics_log_period, py::const_),
+                    py::overload_cast<int64_t>(&Fragment::operator_metrics_log_period),
+                    doc::Fragment::doc_operator_metrics_log_period)
+      .def_property("fuse_operators",
+                    py::overload_cast<>(&Fragment::fuse_operators, py::const_),
+                    py::overload_cast<bool>(&Fragment::fuse_operators),
+                    doc::Fragment::doc_fuse_operators)
+      .def_property("deadline_scheduling",
+                    py::overload_cast<>(&Fragment::deadline_scheduling, py::const_),
+                    py::overload_cast<bool>(&Fragment::deadline_scheduling),
+                    doc::Fragment::doc_deadline_scheduling)
+      .def(
+          "make_thread_pool",
+          [](Fragment& fragment,
+             const std::string& name,
+             int64_t initial_size,
+             const std::optional<std::vector<int32_t>>& cpu_cores,
+             int32_t numa_node,
+             int32_t sched_priority,
+             const std::optional<std::vector<std::string>>& operators,
+             bool pin_operators) {
+            ArgList args{Arg("initial_size", initial_size)};
+            if (cpu_cores.has_value()) { args.add(Arg("cpu_cores", cpu_cores.value())); }
+            if (numa_node >= 0) { args.add(Arg("numa_node", numa_node)); }
+            if (sched_priority > 0) { args.add(Arg("sched_priority", sched_priority)); }
+            if (operators.has_value()) {
+              args.add(Arg("operators", operators.value()));
+              args.add(Arg("pin_operators", pin_operators));
+            }
+            return fragment.make_thread_pool(name, args);
+          },
+          "name"_a,
+          "initial_size"_a = 1,
+          py::kw_only(),
+          "cpu_cores"_a = py::none(),
+          "numa_node"_a = -1,
+          "sched_priority"_a = 0,
+          "operators"_a = py::none(),
+          "pin_operators"_a = true,
+          doc::Fragment::doc_make_thread_pool)
       .def("run",
            &Fragment::run,
            doc::Fragment::doc_run,
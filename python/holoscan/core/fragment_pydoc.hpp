@@ -56,6 +56,50 @@ TODO
 
 }  // namespace Config
 
+namespace OperatorStatistics {
+
+PYDOC(OperatorStatistics, R"doc(
+Execution statistics of an operator, as returned by `Fragment.operator_metrics`.
+
+Durations are in milliseconds.
+
+Attributes
+----------
+tick_count : int
+    Number of calls to ``compute``.
+compute_time_mean_ms : float
+    Average duration of ``compute``.
+compute_time_max_ms : float
+    Longest duration of ``compute``.
+compute_time_p50_ms : float
+    Median duration of ``compute``.
+compute_time_p99_ms : float
+    99th percentile of the duration of ``compute``.
+interval_mean_ms : float
+    Average time between the start of consecutive ticks.
+interval_max_ms : float
+    Longest time between the start of consecutive ticks.
+input_queue_depth_mean : float
+    Average number of messages queued on the input ports at tick.
+input_queue_depth_max : int
+    Largest number of messages queued on the input ports at tick.
+start_time_ms : float
+    Duration of ``start``.
+stop_time_ms : float
+    Duration of ``stop``.
+deadline_miss_count : int
+    Number of frames completed after the deadline of the operator.
+max_lateness_ms : float
+    Longest delay past the deadline of a frame.
+dropped_frame_count : int
+    Number of stale frames dropped before ``compute``.
+compute_time_histogram : list of tuple of int
+    Non-empty buckets of the ``compute`` duration histogram, as (bucket upper bound in
+    microseconds, count) pairs in increasing order of the bound.
+)doc")
+
+}  // namespace OperatorStatistics
+
 namespace Fragment {
 
 //  Constructor
@@ -227,6 +271,82 @@ latency_threshold : int
     end-to-end latency metric calculations
 )doc")
 
+PYDOC(operator_metrics, R"doc(
+Get the execution statistics of the operators of the fragment.
+
+The statistics are always recorded and can be queried while the fragment runs.
+
+Returns
+-------
+dict of str to holoscan.core.OperatorStatistics
+    The statistics, keyed by operator name.
+)doc")
+
+PYDOC(operator_metrics_log_period, R"doc(
+The period in milliseconds of the operator metrics summary log.
+
+When positive, each operator logs a summary of its statistics (at INFO level) at this period
+while it ticks. Zero (the default) disables the log. Must be set before the fragment runs.
+)doc")
+
+PYDOC(fuse_operators, R"doc(
+Whether linear operator chains are fused (disabled by default).
+
+When enabled, chains of native operators where each operator has a single output port connected to
+the single input port of the next operator (which has no other upstream operator) are run by a
+single entity: the operators' ``compute`` methods are called back to back and messages are passed
+directly instead of through a transmitter/receiver pair. Only connections whose ports use the
+default connector and conditions, where the downstream operator has no condition of its own and
+that are not part of a cycle are fused. Per-operator metrics and data flow tracking are kept for
+fused operators. Must be set before the fragment runs.
+)doc")
+
+PYDOC(deadline_scheduling, R"doc(
+Whether operators are dispatched in earliest-deadline-first (EDF) order (disabled by default).
+
+When enabled, among the operators with pending input messages, the operators whose frames have the
+earliest absolute deadlines (see `Operator.deadline`) are dispatched first: an operator is held back
+while the number of dispatched operators and of operators with earlier deadlines reaches the number
+of worker threads of the scheduler. Operators without a deadline have the latest possible deadline,
+and operators without input ports are never held back. An operator is only held back by operators
+with earlier deadlines that are themselves ready, and for at most 1 ms per pending frame of these
+operators. Deadline misses are recorded in the operator metrics whether or not EDF dispatching is
+enabled. Must be set before the fragment runs.
+)doc")
+
+PYDOC(make_thread_pool, R"doc(
+Create a new thread pool.
+
+Thread pools are used by the multi-threaded schedulers (`MultiThreadScheduler` and
+`EventBasedScheduler`) to run operators on dedicated threads. Operators are assigned to the pool
+with `holoscan.resources.ThreadPool.add` or with the `operators` argument, so that a pool can be
+configured from the YAML file with ``make_thread_pool("pool", **self.kwargs("pool"))``.
+
+Parameters
+----------
+name : str
+    The name of the thread pool.
+initial_size : int, optional
+    The number of threads of the pool. The pool needs at least one thread per pinned operator.
+cpu_cores : list of int, optional
+    The CPU cores (as numbered by the OS) that the threads of pinned operators may run on.
+numa_node : int, optional
+    The NUMA node whose CPUs the threads of pinned operators may run on. Ignored if `cpu_cores` is
+    set. A negative value (the default) does not restrict the threads to a NUMA node.
+sched_priority : int, optional
+    If positive, the threads of pinned operators run with the ``SCHED_FIFO`` real-time policy and
+    this priority (1-99). This requires the ``CAP_SYS_NICE`` capability.
+operators : list of str, optional
+    The names of operators to add to the pool.
+pin_operators : bool, optional
+    Whether the operators of `operators` are pinned to a thread of the pool.
+
+Returns
+-------
+holoscan.resources.ThreadPool
+    The thread pool.
+)doc")
+
 PYDOC(run, R"doc(
 The run method of the Fragment.
 
@@ -66,6 +66,12 @@ void init_io_spec(py::module_& m) {
             return io_spec.condition(kind, kwargs_to_arglist(kwargs));
           },
           doc::IOSpec::doc_condition)
+      .def(
+          "fan_out",
+          [](IOSpec& io_spec, bool enable) -> IOSpec& { return io_spec.fan_out(enable); },
+          "enable"_a = true,
+          doc::IOSpec::doc_fan_out,
+          py::return_value_policy::reference_internal)
       // TODO: sphinx API doc build complains if more than one connector
       //       method has a docstring specified. For now just set the docstring for the
       //       first overload only and add information about the rest in the Notes section.
@@ -113,6 +113,26 @@ obj : holoscan.core.IOSpec
     The self object.
 )doc")
 
+PYDOC(fan_out, R"doc(
+Let this output publish every message directly into all of its downstream receivers.
+
+By default, an output port connected to more than one input port is served by an implicit
+Broadcast entity. A fan-out output port instead pushes the emitted message into every connected
+receiver in a single publish, while each receiver keeps its own capacity and policy. Only output
+ports with a `DEFAULT` or `DOUBLE_BUFFER` connector connected within the same fragment are
+supported; other ports keep using a Broadcast entity.
+
+Parameters
+----------
+enable : bool, optional
+    Whether to enable fan-out for this output port.
+
+Returns
+-------
+obj : holoscan.core.IOSpec
+    The self object.
+)doc")
+
 PYDOC(connector, R"doc(
 Add a connector (transmitter or receiver) to this input/output.
 
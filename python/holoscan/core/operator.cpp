@@ -17,9 +17,11 @@
 
 #include "operator.hpp"
 
+#include <pybind11/chrono.h>  // for std::chrono::nanoseconds <-> datetime.timedelta
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>  // for unordered_map -> dict, etc.
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <string>
@@ -161,6 +163,18 @@ void init_operator(py::module_& m) {
            doc::Operator::doc_compute,
            py::call_guard<py::gil_scoped_release>())  // note: should release GIL
       .def_property_readonly("description", &Operator::description, doc::Operator::doc_description)
+      .def_property("deadline",
+                    py::overload_cast<>(&Operator::deadline, py::const_),
+                    py::overload_cast<std::chrono::nanoseconds>(&Operator::deadline),
+                    doc::Operator::doc_deadline)
+      .def_property("period",
+                    py::overload_cast<>(&Operator::period, py::const_),
+                    py::overload_cast<std::chrono::nanoseconds>(&Operator::period),
+                    doc::Operator::doc_period)
+      .def_property("drop_stale_frames",
+                    py::overload_cast<>(&Operator::drop_stale_frames, py::const_),
+                    py::overload_cast<bool>(&Operator::drop_stale_frames),
+                    doc::Operator::doc_drop_stale_frames)
       .def(
           "__repr__",
           [](const py::object& obj) {
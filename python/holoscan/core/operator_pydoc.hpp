@@ -240,6 +240,36 @@ PYDOC(description, R"doc(
 YAML formatted string describing the operator.
 )doc")
 
+PYDOC(deadline, R"doc(
+The relative deadline of the operator (``datetime.timedelta``, zero if not set).
+
+The deadline is measured from the release of the frame being processed, which is the time the
+source operator of the frame ticked (or the time the frame was due, see `period`). A frame for which
+``compute`` returns after the deadline is counted as a deadline miss in the operator metrics. With
+`Fragment.deadline_scheduling` enabled, the operators with pending frames are also dispatched in
+the order of the absolute deadlines of their frames. If no deadline is set, the period of the
+operator is its deadline. Must be set before the fragment runs.
+)doc")
+
+PYDOC(period, R"doc(
+The period of the operator (``datetime.timedelta``, zero if not set).
+
+A source operator (an operator without input ports) releases a frame once per period: the frame
+of a tick is due one period after the previous tick, so that the time a late source waited to be
+scheduled counts towards the deadline of its frames. The period is also the deadline of the
+operator if no deadline is set.
+)doc")
+
+PYDOC(drop_stale_frames, R"doc(
+Whether stale frames are dropped (disabled by default).
+
+When enabled, the input messages whose deadline already passed when the operator is about to
+compute are dropped instead of being computed. A periodic source operator that ticks after the
+deadline of its due frame drops the frames of the periods it missed since its previous tick, and
+computes the frame of the current period (or skips ``compute`` if that frame is stale as well).
+Dropped frames are counted in the operator metrics. Has no effect if the operator has no deadline.
+)doc")
+
 }  // namespace Operator
 
 namespace OperatorType {
@@ -86,6 +86,15 @@ class PyInferenceOp : public InferenceOp {
                 bool output_on_cuda = true, bool transmit_on_cuda = true, bool enable_fp16 = false,
                 bool is_engine_path = false,
                 std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool = nullptr,
+                int32_t intra_op_num_threads = 1, int32_t inter_op_num_threads = 1,
+                const std::string& graph_optimization_level = "extended",
+                const std::string& execution_mode = "sequential",
+                bool use_global_thread_pool = false,
+                const std::string& optimized_model_cache_dir = "",
+                py::dict batch_size_map = py::dict(),   // InferenceOp::DataMap
+                py::dict batch_delay_map = py::dict(),  // InferenceOp::DataMap
+                py::dict skip_threshold_map = py::dict(),   // InferenceOp::DataMap
+                py::dict skip_max_frames_map = py::dict(),  // InferenceOp::DataMap
                 // TODO(grelee): handle receivers similarly to HolovizOp?  (default: {})
                 // TODO(grelee): handle transmitter similarly to HolovizOp?
                 const std::string& name = "inference")
@@ -99,7 +108,13 @@ class PyInferenceOp : public InferenceOp {
                             Arg{"output_on_cuda", output_on_cuda},
                             Arg{"transmit_on_cuda", transmit_on_cuda},
                             Arg{"enable_fp16", enable_fp16},
-                            Arg{"is_engine_path", is_engine_path}}) {
+                            Arg{"is_engine_path", is_engine_path},
+                            Arg{"intra_op_num_threads", intra_op_num_threads},
+                            Arg{"inter_op_num_threads", inter_op_num_threads},
+                            Arg{"graph_optimization_level", graph_optimization_level},
+                            Arg{"execution_mode", execution_mode},
+                            Arg{"use_global_thread_pool", use_global_thread_pool},
+                            Arg{"optimized_model_cache_dir", optimized_model_cache_dir}}) {
     if (cuda_stream_pool) { this->add_arg(Arg{"cuda_stream_pool", cuda_stream_pool}); }
     name_ = name;
     fragment_ = fragment;
@@ -139,6 +154,19 @@ class PyInferenceOp : public InferenceOp {
     auto backend_datamap = _dict_to_inference_datamap(backend_map.cast<py::dict>());
     this->add_arg(Arg("backend_map", backend_datamap));
 
+    auto batch_size_datamap = _dict_to_inference_datamap(batch_size_map.cast<py::dict>());
+    this->add_arg(Arg("batch_size_map", batch_size_datamap));
+
+    auto batch_delay_datamap = _dict_to_inference_datamap(batch_delay_map.cast<py::dict>());
+    this->add_arg(Arg("batch_delay_map", batch_delay_datamap));
+
+    auto skip_threshold_datamap = _dict_to_inference_datamap(skip_threshold_map.cast<py::dict>());
+    this->add_arg(Arg("skip_threshold_map", skip_threshold_datamap));
+
+    auto skip_max_frames_datamap =
+        _dict_to_inference_datamap(skip_max_frames_map.cast<py::dict>());
+    this->add_arg(Arg("skip_max_frames_map", skip_max_frames_datamap));
+
     // convert from Python dict to InferenceOp::DataVecMap
     auto pre_processor_datamap = _dict_to_inference_datavecmap(pre_processor_map.cast<py::dict>());
     this->add_arg(Arg("pre_processor_map", pre_processor_datamap));
@@ -189,6 +217,13 @@ PYBIND11_MODULE(_inference, m) {
                     bool,
                     bool,
                     std::shared_ptr<holoscan::CudaStreamPool>,
+                    int32_t,
+                    int32_t,
+                    const std::string&,
+                    const std::string&,
+                    bool,
+                    py::dict,
+                    py::dict,
                     const std::string&>(),
            "fragment"_a,
            "backend"_a,
@@ -208,10 +243,23 @@ PYBIND11_MODULE(_inference, m) {
            "enable_fp16"_a = false,
            "is_engine_path"_a = false,
            "cuda_stream_pool"_a = py::none(),
+           "intra_op_num_threads"_a = 1,
+           "inter_op_num_threads"_a = 1,
+           "graph_optimization_level"_a = "extended"s,
+           "execution_mode"_a = "sequential"s,
+           "use_global_thread_pool"_a = false,
+           "optimized_model_cache_dir"_a = ""s,
+           "batch_size_map"_a = py::dict(),
+           "batch_delay_map"_a = py::dict(),
+           "skip_threshold_map"_a = py::dict(),
+           "skip_max_frames_map"_a = py::dict(),
            "name"_a = "inference"s,
            doc::InferenceOp::doc_InferenceOp)
       .def("initialize", &InferenceOp::initialize, doc::InferenceOp::doc_initialize)
-      .def("setup", &InferenceOp::setup, "spec"_a, doc::InferenceOp::doc_setup);
+      .def("setup", &InferenceOp::setup, "spec"_a, doc::InferenceOp::doc_setup)
+      .def_property_readonly("skipped_inferences",
+                             &InferenceOp::skipped_inferences,
+                             doc::InferenceOp::doc_skipped_inferences);
 
   py::class_<InferenceOp::DataMap>(inference_op, "DataMap")
       .def(py::init<>())
@@ -87,6 +87,42 @@ is_engine_path : bool, optional
 cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     ``holoscan.resources.CudaStreamPool`` instance to allocate CUDA streams. Default value is
     ``None``.
+intra_op_num_threads : int, optional
+    Number of threads parallelizing the execution within nodes, ``0`` uses the number of physical
+    cores. Only used by the ``"onnxrt"`` backend. Default value is ``1``.
+inter_op_num_threads : int, optional
+    Number of threads parallelizing the execution across nodes, ``0`` uses the number of physical
+    cores. Only used by the ``"onnxrt"`` backend. Default value is ``1``.
+graph_optimization_level : str, optional
+    Graph optimization level, one of ``"disable"``, ``"basic"``, ``"extended"`` or ``"all"``.
+    Only used by the ``"onnxrt"`` backend. Default value is ``"extended"``.
+execution_mode : str, optional
+    Execution mode of the graph, ``"sequential"`` or ``"parallel"``. Only used by the
+    ``"onnxrt"`` backend. Default value is ``"sequential"``.
+use_global_thread_pool : bool, optional
+    Share one pool of threads across the sessions of all models instead of creating threads per
+    session. Only used by the ``"onnxrt"`` backend. Default value is ``False``.
+optimized_model_cache_dir : str, optional
+    Directory caching the optimized models, reused across runs while the model and the
+    onnxruntime settings are unchanged. Only used by the ``"onnxrt"`` backend. Default value is
+    ``""``, the models are optimized on every start.
+batch_size_map : holoscan.operators.InferenceOp.DataMap, optional
+    Mapping of model to the maximum number of frames inferred in one batch. The model must have a
+    dynamic batch dimension and use the ``"onnxrt"`` backend. The results of the inferred frames
+    are emitted one message per tick in the order frames were received, and the operator is
+    executed again without a new input until all of them are emitted.
+batch_delay_map : holoscan.operators.InferenceOp.DataMap, optional
+    Mapping of model to the longest time in milliseconds a frame waits for its batch to fill up.
+    An incomplete batch is inferred once the delay expires, and its results are transmitted without
+    waiting for a new input. Batches still incomplete when the operator is stopped are inferred but
+    their results are not transmitted. Default value is ``0``, a batch is inferred on every tick.
+skip_threshold_map : holoscan.operators.InferenceOp.DataMap, optional
+    Mapping of model to the mean absolute difference between sampled input elements of a frame and
+    of the last inferred frame below which the outputs of the last inference are reused. Cannot be
+    combined with batching.
+skip_max_frames_map : holoscan.operators.InferenceOp.DataMap, optional
+    Mapping of model to the largest number of consecutive frames reusing the outputs of the last
+    inference. Default value is ``10``.
 name : str, optional (constructor only)
     The name of the operator. Default value is ``"inference"``.
 )doc")
@@ -107,6 +143,11 @@ spec : holoscan.core.OperatorSpec
     The operator specification.
 )doc")
 
+PYDOC(skipped_inferences, R"doc(
+Number of frames per model that reused the outputs of the last inference, as a dict keyed by
+model name. Also available after the operator stopped.
+)doc")
+
 }  // namespace holoscan::doc::InferenceOp
 
 #endif /* HOLOSCAN_OPERATORS_INFERENCE_PYDOC_HPP */
@@ -82,6 +82,7 @@ class PyInferenceProcessorOp : public InferenceProcessorOp {
                          bool transmit_on_cuda = false, bool disable_transmitter = false,
                          std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool = nullptr,
                          const std::string& config_path = std::string(""),
+                         bool fuse_operations = false,
                          const std::string& name = "postprocessor")
       : InferenceProcessorOp(ArgList{Arg{"allocator", allocator},
                                      Arg{"in_tensor_names", in_tensor_names},
@@ -90,6 +91,7 @@ class PyInferenceProcessorOp : public InferenceProcessorOp {
                                      Arg{"output_on_cuda", output_on_cuda},
                                      Arg{"transmit_on_cuda", transmit_on_cuda},
                                      Arg{"config_path", config_path},
+                                     Arg{"fuse_operations", fuse_operations},
                                      Arg{"disable_transmitter", disable_transmitter}}) {
     if (cuda_stream_pool) { this->add_arg(Arg{"cuda_stream_pool", cuda_stream_pool}); }
     name_ = name;
@@ -171,6 +173,7 @@ PYBIND11_MODULE(_inference_processor, m) {
                     bool,
                     std::shared_ptr<holoscan::CudaStreamPool>,
                     const std::string&,
+                    bool,
                     const std::string&>(),
            "fragment"_a,
            "allocator"_a,
@@ -184,6 +187,7 @@ PYBIND11_MODULE(_inference_processor, m) {
            "disable_transmitter"_a = false,
            "cuda_stream_pool"_a = py::none(),
            "config_path"_a = ""s,
+           "fuse_operations"_a = false,
            "name"_a = "postprocessor"s,
            doc::InferenceProcessorOp::doc_InferenceProcessorOp)
       .def("initialize",
@@ -68,6 +68,10 @@ cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     Default value is ``None``.
 config_path : str, optional
     File path to the config file. Default value is ``""``.
+fuse_operations : bool, optional
+    Compile the operations of each tensor once into a plan and keep the intermediate results of
+    chained operations internal. The initialization fails if an operation does not accept the
+    data type or rank of the output of the previous one. Default value is ``False``.
 disable_transmitter : bool, optional
     If ``True``, disable the transmitter output port of the operator.
     Default value is ``False``.
@@ -45,9 +45,22 @@ directory : str
 basename : str
     User specified file name without extension.
 flush_on_tick : bool, optional
-    Flushes output buffer on every tick when ``True``. Default value is ``False``.
+    Flushes output buffer on every tick when ``True``. With `async_queue_size` set, the writer
+    thread flushes whenever its queue is drained. Default value is ``False``.
 name : str, optional (constructor only)
     The name of the operator. Default value is ``"video_stream_recorder"``.
+async_queue_size : int, optional
+    Number of entities which can be queued for the writer thread. If nonzero, ``compute`` only
+    enqueues the received entity and a dedicated thread serializes it and writes it to disk in
+    large chunks. Default value is ``0`` (entities are written in ``compute``).
+backpressure_policy : str, optional
+    What to do when the writer queue is full: ``"block"`` or ``"drop"``. Default value is
+    ``"block"``.
+write_chunk_size : int, optional
+    Size in bytes of the chunks written by the writer thread. Default value is ``4194304``.
+direct_io : bool, optional
+    Open the entity file with ``O_DIRECT`` when writing asynchronously. Default value is
+    ``False``.
 )doc")
 
 PYDOC(initialize, R"doc(
@@ -66,6 +79,22 @@ spec : holoscan.core.OperatorSpec
     The operator specification.
 )doc")
 
+PYDOC(queue_depth, R"doc(
+Number of entities waiting for the writer thread.
+)doc")
+
+PYDOC(bytes_written, R"doc(
+Number of bytes written to the entity file so far.
+)doc")
+
+PYDOC(bytes_per_second, R"doc(
+Average write throughput of the entity file since the start of the recording.
+)doc")
+
+PYDOC(dropped_frames, R"doc(
+Number of entities discarded because the writer queue was full.
+)doc")
+
 }  // namespace holoscan::doc::VideoStreamRecorderOp
 
 #endif /* HOLOSCAN_OPERATORS_VIDEO_STREAM_RECORDER_PYDOC_HPP */
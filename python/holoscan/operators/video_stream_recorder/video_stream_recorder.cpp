@@ -55,10 +55,17 @@ class PyVideoStreamRecorderOp : public VideoStreamRecorderOp {
   // Define a constructor that fully initializes the object.
   PyVideoStreamRecorderOp(Fragment* fragment, const std::string& directory,
                           const std::string& basename, bool flush_on_tick_ = false,
-                          const std::string& name = "video_stream_recorder")
+                          const std::string& name = "video_stream_recorder",
+                          size_t async_queue_size = 0UL,
+                          const std::string& backpressure_policy = "block"s,
+                          size_t write_chunk_size = 4UL * 1024 * 1024, bool direct_io = false)
       : VideoStreamRecorderOp(ArgList{Arg{"directory", directory},
                                       Arg{"basename", basename},
-                                      Arg{"flush_on_tick", flush_on_tick_}}) {
+                                      Arg{"flush_on_tick", flush_on_tick_},
+                                      Arg{"async_queue_size", async_queue_size},
+                                      Arg{"backpressure_policy", backpressure_policy},
+                                      Arg{"write_chunk_size", write_chunk_size},
+                                      Arg{"direct_io", direct_io}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -90,16 +97,40 @@ PYBIND11_MODULE(_video_stream_recorder, m) {
              Operator,
              std::shared_ptr<VideoStreamRecorderOp>>(
       m, "VideoStreamRecorderOp", doc::VideoStreamRecorderOp::doc_VideoStreamRecorderOp)
-      .def(py::init<Fragment*, const std::string&, const std::string&, bool, const std::string&>(),
+      .def(py::init<Fragment*,
+                    const std::string&,
+                    const std::string&,
+                    bool,
+                    const std::string&,
+                    size_t,
+                    const std::string&,
+                    size_t,
+                    bool>(),
            "fragment"_a,
            "directory"_a,
            "basename"_a,
            "flush_on_tick"_a = false,
            "name"_a = "recorder"s,
+           "async_queue_size"_a = 0UL,
+           "backpressure_policy"_a = "block"s,
+           "write_chunk_size"_a = 4UL * 1024 * 1024,
+           "direct_io"_a = false,
            doc::VideoStreamRecorderOp::doc_VideoStreamRecorderOp)
       .def("initialize",
            &VideoStreamRecorderOp::initialize,
            doc::VideoStreamRecorderOp::doc_initialize)
-      .def("setup", &VideoStreamRecorderOp::setup, "spec"_a, doc::VideoStreamRecorderOp::doc_setup);
+      .def("setup", &VideoStreamRecorderOp::setup, "spec"_a, doc::VideoStreamRecorderOp::doc_setup)
+      .def_property_readonly("queue_depth",
+                             &VideoStreamRecorderOp::queue_depth,
+                             doc::VideoStreamRecorderOp::doc_queue_depth)
+      .def_property_readonly("bytes_written",
+                             &VideoStreamRecorderOp::bytes_written,
+                             doc::VideoStreamRecorderOp::doc_bytes_written)
+      .def_property_readonly("bytes_per_second",
+                             &VideoStreamRecorderOp::bytes_per_second,
+                             doc::VideoStreamRecorderOp::doc_bytes_per_second)
+      .def_property_readonly("dropped_frames",
+                             &VideoStreamRecorderOp::dropped_frames,
+                             doc::VideoStreamRecorderOp::doc_dropped_frames);
 }  // PYBIND11_MODULE NOLINT
 }  // namespace holoscan::ops
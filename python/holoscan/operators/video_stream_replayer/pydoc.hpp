@@ -59,6 +59,10 @@ count : int, optional
     Number of frame counts to playback. If zero value is specified, it is
     ignored. If the count is less than the number of frames in the video, it
     would finish early. Default value is ``0``.
+read_ahead : int, optional
+    Number of entities to deserialize ahead of playback. If nonzero, the files are
+    memory-mapped and read by a background thread, and playback is paced by an
+    asynchronous condition instead of sleeping in ``compute``. Default value is ``0``.
 name : str, optional (constructor only)
     The name of the operator. Default value is ``"video_stream_replayer"``.
 )doc")
@@ -29,6 +29,7 @@
     holoscan.resources.SerializationBuffer
     holoscan.resources.StdComponentSerializer
     holoscan.resources.StdEntitySerializer
+    holoscan.resources.ThreadPool
     holoscan.resources.Transmitter
     holoscan.resources.UnboundedAllocator
     holoscan.resources.UcxComponentSerializer
@@ -53,6 +54,7 @@ from ._resources import (
     SerializationBuffer,
     StdComponentSerializer,
     StdEntitySerializer,
+    ThreadPool,
     Transmitter,
     UcxComponentSerializer,
     UcxEntitySerializer,
@@ -77,6 +79,7 @@ __all__ = [
     "SerializationBuffer",
     "StdComponentSerializer",
     "StdEntitySerializer",
+    "ThreadPool",
     "Transmitter",
     "UcxComponentSerializer",
     "UcxEntitySerializer",
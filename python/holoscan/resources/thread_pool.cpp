@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <memory>
+#include <vector>
+
+#include "./thread_pool_pydoc.hpp"
+#include "holoscan/core/gxf/gxf_resource.hpp"
+#include "holoscan/core/operator.hpp"
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
+
+using pybind11::literals::operator""_a;
+
+namespace py = pybind11;
+
+namespace holoscan {
+
+void init_thread_pool(py::module_& m) {
+  // Thread pools are created with Fragment.make_thread_pool, so no constructor is exposed
+  py::class_<ThreadPool, gxf::GXFResource, std::shared_ptr<ThreadPool>>(
+      m, "ThreadPool", doc::ThreadPool::doc_ThreadPool)
+      .def("add",
+           py::overload_cast<const std::shared_ptr<Operator>&, bool>(&ThreadPool::add),
+           "op"_a,
+           "pin_operator"_a = true,
+           doc::ThreadPool::doc_add)
+      .def("add",
+           py::overload_cast<const std::vector<std::shared_ptr<Operator>>&, bool>(
+               &ThreadPool::add),
+           "ops"_a,
+           "pin_operator"_a = true)
+      .def_property_readonly("operators", &ThreadPool::operators, doc::ThreadPool::doc_operators)
+      .def(
+          "is_pinned",
+          [](const ThreadPool& pool, const std::shared_ptr<Operator>& op) {
+            return pool.is_pinned(op.get());
+          },
+          "op"_a,
+          doc::ThreadPool::doc_is_pinned)
+      .def_property_readonly(
+          "initial_size", &ThreadPool::initial_size, doc::ThreadPool::doc_initial_size)
+      .def_property_readonly(
+          "gxf_typename", &ThreadPool::gxf_typename, doc::ThreadPool::doc_gxf_typename);
+}
+}  // namespace holoscan
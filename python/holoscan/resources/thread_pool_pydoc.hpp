@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PYHOLOSCAN_RESOURCES_THREAD_POOL_PYDOC_HPP
+#define PYHOLOSCAN_RESOURCES_THREAD_POOL_PYDOC_HPP
+
+#include <string>
+
+#include "../macros.hpp"
+
+namespace holoscan::doc {
+
+namespace ThreadPool {
+
+PYDOC(ThreadPool, R"doc(
+Thread pool resource.
+
+A pool of worker threads of the multi-threaded schedulers (`MultiThreadScheduler` and
+`EventBasedScheduler`). Operators added to the pool with ``pin_operator=True`` always run on a
+dedicated thread of the pool. The threads of pinned operators can be restricted to a set of CPU
+cores or to the CPUs of a NUMA node, and can run with the real-time ``SCHED_FIFO`` policy.
+
+Thread pools are created with `holoscan.core.Fragment.make_thread_pool`.
+)doc")
+
+PYDOC(add, R"doc(
+Add one or more operators to the thread pool.
+
+Parameters
+----------
+op : holoscan.core.Operator or list of holoscan.core.Operator
+    The operator(s) to add.
+pin_operator : bool, optional
+    Whether the operator(s) always run on a dedicated thread of the pool.
+)doc")
+
+PYDOC(operators, R"doc(
+The operators of the thread pool.
+
+Returns
+-------
+list of holoscan.core.Operator
+    The operators added to the pool.
+)doc")
+
+PYDOC(is_pinned, R"doc(
+Whether an operator is pinned to a dedicated thread of the pool.
+
+Parameters
+----------
+op : holoscan.core.Operator
+    The operator.
+
+Returns
+-------
+bool
+    True if the operator is pinned to a thread of the pool.
+)doc")
+
+PYDOC(initial_size, R"doc(
+The number of threads of the pool.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+}  // namespace ThreadPool
+
+}  // namespace holoscan::doc
+
+#endif /* PYHOLOSCAN_RESOURCES_THREAD_POOL_PYDOC_HPP */
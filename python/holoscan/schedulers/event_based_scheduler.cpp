@@ -16,9 +16,11 @@
  */
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>  // needed for py::cast to work with std::optional
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "./event_based_scheduler_pydoc.hpp"
@@ -57,6 +59,7 @@ class PyEventBasedScheduler : public EventBasedScheduler {
                                  int64_t worker_thread_number = 1LL, bool stop_on_deadlock = true,
                                  int64_t max_duration_ms = -1LL,
                                  int64_t stop_on_deadlock_timeout = 0LL,
+                                 std::optional<bool> strict_job_thread_pinning = std::nullopt,
                                  const std::string& name = "event_based_scheduler")
       : EventBasedScheduler(ArgList{Arg{"worker_thread_number", worker_thread_number},
                                     Arg{"stop_on_deadlock", stop_on_deadlock},
@@ -64,6 +67,10 @@ class PyEventBasedScheduler : public EventBasedScheduler {
     // max_duration_ms is an optional argument in GXF. We use a negative value in this constructor
     // to indicate that the argument should not be set.
     if (max_duration_ms >= 0) { this->add_arg(Arg{"max_duration_ms", max_duration_ms}); }
+    // Left unset, strict_job_thread_pinning is enabled for real-time thread pools
+    if (strict_job_thread_pinning.has_value()) {
+      this->add_arg(Arg{"strict_job_thread_pinning", strict_job_thread_pinning.value()});
+    }
     name_ = name;
     fragment_ = fragment;
     if (clock) {
@@ -90,6 +97,7 @@ void init_event_based_scheduler(py::module_& m) {
                     bool,
                     int64_t,
                     int64_t,
+                    std::optional<bool>,
                     const std::string&>(),
            "fragment"_a,
            py::kw_only(),
@@ -98,6 +106,7 @@ void init_event_based_scheduler(py::module_& m) {
            "stop_on_deadlock"_a = true,
            "max_duration_ms"_a = -1LL,
            "stop_on_deadlock_timeout"_a = 0LL,
+           "strict_job_thread_pinning"_a = py::none(),
            "name"_a = "multithread_scheduler"s,
            doc::EventBasedScheduler::doc_EventBasedScheduler_python)
       .def_property_readonly("clock", &EventBasedScheduler::clock)
@@ -106,6 +115,8 @@ void init_event_based_scheduler(py::module_& m) {
       .def_property_readonly("stop_on_deadlock", &EventBasedScheduler::stop_on_deadlock)
       .def_property_readonly("stop_on_deadlock_timeout",
                              &EventBasedScheduler::stop_on_deadlock_timeout)
+      .def_property_readonly("strict_job_thread_pinning",
+                             &EventBasedScheduler::strict_job_thread_pinning)
       .def_property_readonly("gxf_typename",
                              &EventBasedScheduler::gxf_typename,
                              doc::EventBasedScheduler::doc_gxf_typename);
@@ -16,9 +16,11 @@
  */
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>  // needed for py::cast to work with std::optional
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "./multithread_scheduler_pydoc.hpp"
@@ -58,6 +60,7 @@ class PyMultiThreadScheduler : public MultiThreadScheduler {
                                   double check_recession_period_ms = 5.0,
                                   int64_t max_duration_ms = -1LL,
                                   int64_t stop_on_deadlock_timeout = 0LL,
+                                  std::optional<bool> strict_job_thread_pinning = std::nullopt,
                                   const std::string& name = "multithread_scheduler")
       : MultiThreadScheduler(ArgList{Arg{"worker_thread_number", worker_thread_number},
                                      Arg{"stop_on_deadlock", stop_on_deadlock},
@@ -66,6 +69,10 @@ class PyMultiThreadScheduler : public MultiThreadScheduler {
     // max_duration_ms is an optional argument in GXF. We use a negative value in this constructor
     // to indicate that the argument should not be set.
     if (max_duration_ms >= 0) { this->add_arg(Arg{"max_duration_ms", max_duration_ms}); }
+    // Left unset, strict_job_thread_pinning is enabled for real-time thread pools
+    if (strict_job_thread_pinning.has_value()) {
+      this->add_arg(Arg{"strict_job_thread_pinning", strict_job_thread_pinning.value()});
+    }
     name_ = name;
     fragment_ = fragment;
     if (clock) {
@@ -93,6 +100,7 @@ void init_multithread_scheduler(py::module_& m) {
                     double,
                     int64_t,
                     int64_t,
+                    std::optional<bool>,
                     const std::string&>(),
            "fragment"_a,
            py::kw_only(),
@@ -102,6 +110,7 @@ void init_multithread_scheduler(py::module_& m) {
            "check_recession_period_ms"_a = 5.0,
            "max_duration_ms"_a = -1LL,
            "stop_on_deadlock_timeout"_a = 0LL,
+           "strict_job_thread_pinning"_a = py::none(),
            "name"_a = "multithread_scheduler"s,
            doc::MultiThreadScheduler::doc_MultiThreadScheduler_python)
       .def_property_readonly("clock", &MultiThreadScheduler::clock)
@@ -112,6 +121,8 @@ void init_multithread_scheduler(py::module_& m) {
                              &MultiThreadScheduler::check_recession_period_ms)
       .def_property_readonly("stop_on_deadlock_timeout",
                              &MultiThreadScheduler::stop_on_deadlock_timeout)
+      .def_property_readonly("strict_job_thread_pinning",
+                             &MultiThreadScheduler::strict_job_thread_pinning)
       .def_property_readonly("gxf_typename",
                              &MultiThreadScheduler::gxf_typename,
                              doc::MultiThreadScheduler::doc_gxf_typename);
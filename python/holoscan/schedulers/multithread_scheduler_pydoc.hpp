@@ -59,6 +59,11 @@ stop_on_deadlock_timeout : int, optional
     The scheduler will wait this amount of time before determining that it is in deadlock
     and should stop. It will reset if a job comes in during the wait. A negative value means not
     stop on deadlock. This parameter only applies when `stop_on_deadlock=true`",
+strict_job_thread_pinning : bool, optional
+    If enabled, the thread an operator is pinned to (see `Fragment.make_thread_pool`) does not run
+    any other operator. If disabled, another operator can run on the thread while the pinned
+    operator is not ready to execute. If not set, it is enabled when a thread pool runs its
+    pinned operators with a ``sched_priority``, and disabled otherwise.
 name : str, optional
     The name of the scheduler.
 )doc")
@@ -22,9 +22,9 @@ import time
 import pytest
 
 from holoscan.conditions import CountCondition, PeriodicCondition
-from holoscan.core import Application, Operator, OperatorSpec, Tracker
+from holoscan.core import Application, Operator, OperatorSpec, OperatorStatistics, Tracker
 from holoscan.resources import ManualClock, RealtimeClock
-from holoscan.schedulers import GreedyScheduler
+from holoscan.schedulers import EventBasedScheduler, GreedyScheduler, MultiThreadScheduler
 
 
 class ValueData:
@@ -312,6 +312,94 @@ def test_my_tracker_app(ping_config_file, capfd):
     assert f"received message {count + 1}" not in captured.out
 
 
+def test_my_ping_app_operator_metrics(ping_config_file):
+    count = 10
+    app = MyPingApp(count=count)
+    app.config(ping_config_file)
+    app.operator_metrics_log_period = 1
+    app.run()
+
+    metrics = app.operator_metrics()
+    assert set(metrics) == {"tx", "mx", "rx"}
+    for name, stats in metrics.items():
+        assert isinstance(stats, OperatorStatistics)
+        assert stats.tick_count == count, name
+        assert stats.compute_time_max_ms >= stats.compute_time_mean_ms > 0
+        assert sum(bucket_count for _, bucket_count in stats.compute_time_histogram) == count
+    assert metrics["rx"].input_queue_depth_max >= 1
+
+
+class MyPingThreadPoolApp(MyPingApp):
+    def compose(self):
+        super().compose()
+        # assign the operator by name, as done with the kwargs of a YAML config
+        self.pool = self.make_thread_pool("pool", 1, operators=["rx"])
+
+
+def test_my_ping_app_thread_pool(ping_config_file, capfd):
+    count = 10
+    app = MyPingThreadPoolApp(count=count)
+    app.config(ping_config_file)
+    app.scheduler(
+        MultiThreadScheduler(
+            app,
+            worker_thread_number=2,
+            stop_on_deadlock_timeout=100,
+            strict_job_thread_pinning=True,
+            name="multithread_scheduler",
+        )
+    )
+    app.run()
+
+    captured = capfd.readouterr()
+    assert f"received message {count}" in captured.out
+
+    operators = app.pool.operators
+    assert [op.name for op in operators] == ["rx"]
+    assert app.pool.is_pinned(operators[0])
+    assert app.pool.initial_size == 1
+
+
+class MyPingDeadlineApp(MyPingApp):
+    def compose(self):
+        tx = PingTxOp(self, CountCondition(self, self.count), name="tx")
+        tx.period = datetime.timedelta(milliseconds=1)
+        mx = PingMiddleOp(self, self.from_config("mx"), name="mx")
+        # generous deadline: never missed
+        mx.deadline = datetime.timedelta(seconds=10)
+        rx = PingRxOp(self, name="rx")
+        # deadline shorter than any compute() call: always missed
+        rx.deadline = datetime.timedelta(microseconds=1)
+        self.add_flow(tx, mx, {("out1", "in1"), ("out2", "in2")})
+        self.add_flow(mx, rx, {("out1", "receivers"), ("out2", "receivers")})
+        self.ops = {"tx": tx, "mx": mx, "rx": rx}
+
+
+def test_my_ping_app_deadline_scheduling(ping_config_file, capfd):
+    count = 10
+    app = MyPingDeadlineApp(count=count)
+    app.config(ping_config_file)
+    app.deadline_scheduling = True
+    assert app.deadline_scheduling
+    app.scheduler(EventBasedScheduler(app, worker_thread_number=2, name="event_based_scheduler"))
+    app.run()
+
+    captured = capfd.readouterr()
+    assert f"received message {count}" in captured.out
+
+    assert app.ops["tx"].period == datetime.timedelta(milliseconds=1)
+    # the deadline of an operator without one is its period
+    assert app.ops["tx"].deadline == datetime.timedelta(milliseconds=1)
+    assert app.ops["rx"].deadline == datetime.timedelta(microseconds=1)
+    assert not app.ops["rx"].drop_stale_frames
+
+    metrics = app.operator_metrics()
+    assert metrics["mx"].deadline_miss_count == 0
+    assert metrics["rx"].deadline_miss_count == count
+    assert metrics["rx"].max_lateness_ms > 0
+    assert all(stats.dropped_frame_count == 0 for stats in metrics.values())
+
+
 def test_my_tracker_logging_app(ping_config_file, capfd):
     count = 10
     filename = "logfile1.log"
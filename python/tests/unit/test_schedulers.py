@@ -94,6 +94,7 @@ class TestMultiThreadScheduler:
             check_recession_period_ms=2.0,
             max_duration_ms=10000,
             stop_on_deadlock_timeout=10,
+            strict_job_thread_pinning=True,
             name=name,
         )
         assert isinstance(scheduler, GXFScheduler)
@@ -136,6 +137,12 @@ class TestMultiThreadScheduler:
             # value will only be initialized by executor once app.run() is called
             scheduler.stop_on_deadlock_timeout  # noqa: B018
 
+    def test_strict_job_thread_pinning(self, app):
+        scheduler = MultiThreadScheduler(app)
+        with pytest.raises(RuntimeError):
+            # value will only be initialized by executor once app.run() is called
+            scheduler.strict_job_thread_pinning  # noqa: B018
+
 
 class TestEventBasedScheduler:
     def test_default_init(self, app):
@@ -154,6 +161,7 @@ class TestEventBasedScheduler:
             stop_on_deadlock=True,
             max_duration_ms=10000,
             stop_on_deadlock_timeout=10,
+            strict_job_thread_pinning=True,
             name=name,
         )
         assert isinstance(scheduler, GXFScheduler)
@@ -189,3 +197,9 @@ class TestEventBasedScheduler:
         with pytest.raises(RuntimeError):
             # value will only be initialized by executor once app.run() is called
             scheduler.stop_on_deadlock_timeout  # noqa: B018
+
+    def test_strict_job_thread_pinning(self, app):
+        scheduler = EventBasedScheduler(app)
+        with pytest.raises(RuntimeError):
+            # value will only be initialized by executor once app.run() is called
+            scheduler.strict_job_thread_pinning  # noqa: B018
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+SPDX-License-Identifier: Apache-2.0
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+"""  # noqa: E501
+
+import argparse
+import json
+import struct
+import sys
+
+# Must match holoscan/core/dataflow_trace_sink.hpp
+TRACE_FILE_MAGIC = b"HSDFTRC\0"
+TRACE_FILE_VERSION = 1
+RECORD_TYPE_EVENT = 1
+RECORD_TYPE_OPERATOR_NAME = 2
+# message_id, path_hash, operator_id, rec_timestamp, pub_timestamp, path_index, operator_index
+EVENT_STRUCT = struct.Struct("<QQqqqII")
+
+
+def read_trace(filename):
+    """Read a binary data flow trace file.
+
+    Returns a tuple of (operator names indexed by operator ID, list of event dicts).
+    """
+    operator_names = {}
+    events = []
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:8] != TRACE_FILE_MAGIC:
+        raise ValueError(f"'{filename}' is not a Holoscan data flow trace file")
+    version, event_size = struct.unpack_from("<II", data, 8)
+    if version != TRACE_FILE_VERSION:
+        raise ValueError(f"Unsupported trace file version {version}")
+    if event_size != EVENT_STRUCT.size:
+        raise ValueError(f"Unexpected event size {event_size} (expected {EVENT_STRUCT.size})")
+
+    offset = 16
+    while offset + 4 <= len(data):
+        (record_type,) = struct.unpack_from("<I", data, offset)
+        offset += 4
+        if record_type == RECORD_TYPE_EVENT:
+            if offset + event_size > len(data):
+                print("Truncated event at the end of the trace file", file=sys.stderr)
+                break
+            (
+                message_id,
+                path_hash,
+                operator_id,
+                rec_timestamp,
+                pub_timestamp,
+                path_index,
+                operator_index,
+            ) = EVENT_STRUCT.unpack_from(data, offset)
+            offset += event_size
+            events.append(
+                dict(
+                    message_id=message_id,
+                    path_hash=path_hash,
+                    operator_id=operator_id,
+                    rec_timestamp=rec_timestamp,
+                    pub_timestamp=pub_timestamp,
+                    path_index=path_index,
+                    operator_index=operator_index,
+                )
+            )
+        elif record_type == RECORD_TYPE_OPERATOR_NAME:
+            operator_id, name_length = struct.unpack_from("<qI", data, offset)
+            offset += 12
+            operator_names[operator_id] = data[offset : offset + name_length].decode("utf-8")
+            offset += name_length
+        else:
+            raise ValueError(f"Unknown record type {record_type} at offset {offset - 4}")
+    return operator_names, events
+
+
+def to_chrome_trace(operator_names, events):
+    """Convert trace events to the Chrome trace event format (also read by Perfetto).
+
+    Every operator is shown as its own track. Each operator execution on a message path is a
+    complete ('X') event from the receive to the publish timestamp.
+    """
+    trace_events = []
+    for operator_id, name in sorted(operator_names.items()):
+        trace_events.append(
+            dict(name="thread_name", ph="M", pid=1, tid=operator_id, args=dict(name=name))
+        )
+
+    for event in events:
+        operator_id = event["operator_id"]
+        name = operator_names.get(operator_id, f"operator_{operator_id}")
+        # The publish timestamp of an operator is -1 until it publishes (e.g. a root operator
+        # which was traced before its publish timestamp was set)
+        duration = max(0, event["pub_timestamp"] - event["rec_timestamp"])
+        trace_events.append(
+            dict(
+                name=name,
+                cat="dataflow",
+                ph="X",
+                pid=1,
+                tid=operator_id,
+                ts=event["rec_timestamp"],
+                dur=duration,
+                args=dict(
+                    message_id=event["message_id"],
+                    path=f"{event['path_hash']:016x}",
+                    path_index=event["path_index"],
+                    operator_index=event["operator_index"],
+                ),
+            )
+        )
+    return dict(traceEvents=trace_events, displayTimeUnit="ms")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=(
+            "Command line utility for converting a binary data flow trace (written by "
+            "DataFlowTracker::enable_trace) to Chrome trace / Perfetto JSON."
+        )
+    )
+    parser.add_argument("input", help="Binary data flow trace file to read")
+    parser.add_argument(
+        "-o", "--output", default=None, help="Output JSON file (default: standard output)"
+    )
+    args = parser.parse_args()
+
+    operator_names, events = read_trace(args.input)
+    trace = to_chrome_trace(operator_names, events)
+    print(
+        f"Converted {len(events)} events of {len(operator_names)} operators", file=sys.stderr
+    )
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
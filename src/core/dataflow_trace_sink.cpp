@@ -0,0 +1,241 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/dataflow_trace_sink.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+/// The source of unique sink IDs. IDs are never reused so that stale thread-local cache entries
+/// of destroyed sinks can never match a new sink.
+std::atomic<uint64_t> next_sink_id{1};
+
+uint64_t round_up_to_power_of_two(uint64_t value) {
+  uint64_t result = 1;
+  while (result < value) { result <<= 1; }
+  return result;
+}
+
+template <typename T>
+void append_bytes(std::vector<char>& buffer, const T& value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+}  // namespace
+
+DataFlowTraceSink::DataFlowTraceSink(std::string filename, uint64_t ring_capacity,
+                                     uint64_t flush_interval_ms)
+    : sink_id_(next_sink_id.fetch_add(1, std::memory_order_relaxed)),
+      filename_(std::move(filename)),
+      ring_capacity_(round_up_to_power_of_two(std::max<uint64_t>(ring_capacity, 2))),
+      flush_interval_ms_(flush_interval_ms) {
+  ofstream_.open(filename_, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!ofstream_.is_open()) {
+    HOLOSCAN_LOG_ERROR("DataFlowTraceSink: unable to open trace file '{}'", filename_);
+    closed_ = true;
+    return;
+  }
+  ofstream_.write(kTraceFileMagic, sizeof(kTraceFileMagic));
+  ofstream_.write(reinterpret_cast<const char*>(&kTraceFileVersion), sizeof(kTraceFileVersion));
+  const uint32_t event_size = sizeof(DataFlowTraceEvent);
+  ofstream_.write(reinterpret_cast<const char*>(&event_size), sizeof(event_size));
+
+  writer_thread_ = std::thread(&DataFlowTraceSink::writer_loop, this);
+}
+
+DataFlowTraceSink::~DataFlowTraceSink() {
+  close();
+}
+
+void DataFlowTraceSink::register_operator(int64_t operator_id, const std::string& name) {
+  std::scoped_lock lock(operator_names_mutex_);
+  for (const auto& [id, op_name] : operator_names_) {
+    if (id == operator_id) { return; }
+  }
+  operator_names_.emplace_back(operator_id, name);
+}
+
+DataFlowTraceSink::ThreadRings::~ThreadRings() {
+  for (const auto& [sink_id, ring] : rings) {
+    ring->producer_exited.store(true, std::memory_order_release);
+  }
+}
+
+DataFlowTraceSink::ThreadRings& DataFlowTraceSink::thread_rings() {
+  thread_local ThreadRings rings;
+  return rings;
+}
+
+DataFlowTraceSink::Ring* DataFlowTraceSink::thread_ring() {
+  auto& rings = thread_rings().rings;
+  for (const auto& [sink_id, ring] : rings) {
+    if (sink_id == sink_id_) { return ring.get(); }
+  }
+  // First event recorded by this thread: forget the ring buffers of the closed sinks and create
+  // the ring buffer for this sink
+  rings.erase(std::remove_if(rings.begin(),
+                             rings.end(),
+                             [](const auto& entry) {
+                               return entry.second->sink_closed.load(std::memory_order_relaxed);
+                             }),
+              rings.end());
+  std::shared_ptr<Ring> ring;
+  {
+    std::scoped_lock lock(rings_mutex_);
+    ring = std::make_shared<Ring>(ring_capacity_, next_ring_index_++);
+    if (closed_.load(std::memory_order_relaxed)) {
+      ring->sink_closed.store(true, std::memory_order_relaxed);
+    } else {
+      rings_.push_back(ring);
+    }
+  }
+  rings.emplace_back(sink_id_, ring);
+  return ring.get();
+}
+
+uint64_t DataFlowTraceSink::next_message_id() {
+  Ring* ring = thread_ring();
+  constexpr uint64_t sequence_mask = (uint64_t{1} << kTraceMessageSequenceBits) - 1;
+  return (ring->index << kTraceMessageSequenceBits) | (++ring->num_messages & sequence_mask);
+}
+
+size_t DataFlowTraceSink::num_rings() {
+  std::scoped_lock lock(rings_mutex_);
+  return rings_.size();
+}
+
+bool DataFlowTraceSink::record(const DataFlowTraceEvent& event) {
+  if (closed_.load(std::memory_order_relaxed)) { return false; }
+
+  Ring* ring = thread_ring();
+  const uint64_t head = ring->head.load(std::memory_order_relaxed);
+  const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+  if (head - tail >= ring->events.size()) {
+    dropped_events_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  ring->events[head & ring->mask] = event;
+  ring->head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+void DataFlowTraceSink::drain() {
+  write_buffer_.clear();
+
+  // Write the names of newly registered operators before any event which may refer to them
+  {
+    std::scoped_lock lock(operator_names_mutex_);
+    for (; num_written_operator_names_ < operator_names_.size(); num_written_operator_names_++) {
+      const auto& [operator_id, name] = operator_names_[num_written_operator_names_];
+      append_bytes(write_buffer_, DataFlowTraceRecordType::kOperatorName);
+      append_bytes(write_buffer_, operator_id);
+      append_bytes(write_buffer_, static_cast<uint32_t>(name.size()));
+      write_buffer_.insert(write_buffer_.end(), name.begin(), name.end());
+    }
+  }
+
+  std::vector<Ring*> rings;
+  {
+    std::scoped_lock lock(rings_mutex_);
+    rings.reserve(rings_.size());
+    for (auto& ring : rings_) { rings.push_back(ring.get()); }
+  }
+
+  uint64_t num_events = 0;
+  std::vector<Ring*> drained_rings;
+  for (Ring* ring : rings) {
+    // Checked before reading the head: if the producer exited, no event is recorded after it
+    const bool producer_exited = ring->producer_exited.load(std::memory_order_acquire);
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    for (; tail < head; tail++) {
+      append_bytes(write_buffer_, DataFlowTraceRecordType::kEvent);
+      append_bytes(write_buffer_, ring->events[tail & ring->mask]);
+      num_events++;
+    }
+    ring->tail.store(tail, std::memory_order_release);
+    if (producer_exited) { drained_rings.push_back(ring); }
+  }
+
+  // Remove the ring buffers of the exited threads, which will never record events again
+  if (!drained_rings.empty()) {
+    std::scoped_lock lock(rings_mutex_);
+    rings_.erase(std::remove_if(rings_.begin(),
+                                rings_.end(),
+                                [&drained_rings](const auto& ring) {
+                                  return std::find(drained_rings.begin(),
+                                                   drained_rings.end(),
+                                                   ring.get()) != drained_rings.end();
+                                }),
+                 rings_.end());
+  }
+
+  if (!write_buffer_.empty()) {
+    ofstream_.write(write_buffer_.data(), write_buffer_.size());
+    ofstream_.flush();
+    written_events_.fetch_add(num_events, std::memory_order_relaxed);
+  }
+}
+
+void DataFlowTraceSink::writer_loop() {
+  std::unique_lock lock(writer_mutex_);
+  while (!closed_.load(std::memory_order_relaxed)) {
+    writer_cv_.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_), [this] {
+      return closed_.load(std::memory_order_relaxed);
+    });
+    drain();
+  }
+}
+
+void DataFlowTraceSink::close() {
+  {
+    std::scoped_lock lock(writer_mutex_);
+    if (closed_.exchange(true) && !writer_thread_.joinable()) { return; }
+  }
+  writer_cv_.notify_all();
+  if (writer_thread_.joinable()) { writer_thread_.join(); }
+
+  if (ofstream_.is_open()) {
+    // Write the events recorded between the last drain of the writer thread and close()
+    drain();
+    ofstream_.close();
+    if (dropped_events()) {
+      HOLOSCAN_LOG_WARN("DataFlowTraceSink: {} events were dropped because a ring buffer was full",
+                        dropped_events());
+    }
+  }
+
+  // The producer threads forget the ring buffers of this sink when they create a ring buffer for
+  // another sink
+  std::scoped_lock lock(rings_mutex_);
+  for (auto& ring : rings_) { ring->sink_closed.store(true, std::memory_order_relaxed); }
+  rings_.clear();
+}
+
+}  // namespace holoscan
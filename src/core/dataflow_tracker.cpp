@@ -17,26 +17,86 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "holoscan/core/dataflow_tracker.hpp"
+#include "holoscan/core/messagelabel.hpp"
+#include "holoscan/core/operator.hpp"
 #include "holoscan/logger/logger.hpp"
 
 namespace holoscan {
 
+namespace {
+
+/// The hazard pointer of a thread: the trace sink the thread is currently writing to, if any. It
+/// is only written by its own thread and on its own cache line, so that writing to the trace does
+/// not write to any memory shared with other threads.
+struct alignas(64) TraceSinkHazard {
+  std::atomic<DataFlowTraceSink*> trace_sink{nullptr};
+};
+
+/// The hazard pointers of all live threads which have written to a trace.
+struct TraceSinkHazardRegistry {
+  std::mutex mutex;
+  std::vector<TraceSinkHazard*> hazards;
+};
+
+TraceSinkHazardRegistry& trace_sink_hazard_registry() {
+  static TraceSinkHazardRegistry registry;
+  return registry;
+}
+
+/// Registers the hazard pointer of a thread for the lifetime of the thread.
+struct ThreadTraceSinkHazard {
+  ThreadTraceSinkHazard() {
+    auto& registry = trace_sink_hazard_registry();
+    std::scoped_lock lock(registry.mutex);
+    registry.hazards.push_back(&hazard);
+  }
+
+  ~ThreadTraceSinkHazard() {
+    auto& registry = trace_sink_hazard_registry();
+    std::scoped_lock lock(registry.mutex);
+    registry.hazards.erase(std::find(registry.hazards.begin(), registry.hazards.end(), &hazard));
+  }
+
+  TraceSinkHazard hazard;
+};
+
+TraceSinkHazard& thread_trace_sink_hazard() {
+  thread_local ThreadTraceSinkHazard thread_hazard;
+  return thread_hazard.hazard;
+}
+
+/// Return whether any thread is still writing to the given trace sink.
+bool is_trace_sink_in_use(const DataFlowTraceSink* trace_sink) {
+  auto& registry = trace_sink_hazard_registry();
+  std::scoped_lock lock(registry.mutex);
+  return std::any_of(registry.hazards.begin(), registry.hazards.end(), [&](auto* hazard) {
+    return hazard->trace_sink.load() == trace_sink;
+  });
+}
+
+}  // namespace
+
 uint64_t PathMetrics::get_buffer_size() {
   return latency_buffer.size();
 }
 
 DataFlowTracker::~DataFlowTracker() {
   end_logging();
+  end_trace();
 }
 
 void DataFlowTracker::end_logging() {
@@ -48,32 +108,87 @@ void DataFlowTracker::end_logging() {
 }
 
 void DataFlowTracker::print() const {
+  std::shared_lock lock(all_path_metrics_mutex_);
   std::cout << "Data Flow Tracking Results:\n";
   std::cout << "Total paths: " << all_path_metrics_.size() << "\n\n";
   int i = 0;
   for (auto it : all_path_metrics_) {
+    std::scoped_lock path_lock(it.second->mutex);
     std::cout << "Path " << ++i << ": " << it.first << "\n";
     for (auto it2 : it.second->metrics) {
       std::cout << metricToString.at(it2.first) << ": " << it2.second << "\n";
     }
+    if (it.second->latency_histogram.total_count()) {
+      for (auto metric : {DataFlowMetric::kP50E2ELatency,
+                          DataFlowMetric::kP90E2ELatency,
+                          DataFlowMetric::kP99E2ELatency,
+                          DataFlowMetric::kP999E2ELatency}) {
+        std::cout << metricToString.at(metric) << ": "
+                  << it.second->latency_histogram.value_at_percentile(
+                         metricToPercentile.at(metric)) /
+                         1000.0
+                  << "\n";
+      }
+    }
     std::cout << "\n";
   }
 
   std::cout << "Number of source messages [format: source operator->transmitter name: number of "
                "messages]:\n";
+  std::scoped_lock source_lock(source_messages_mutex_);
   for (auto it : source_messages_) { std::cout << it.first << ": " << it.second << "\n"; }
 
   std::cout.flush();  // flush standard output; otherwise output may not be printed
 }
 
+std::shared_ptr<PathMetrics> DataFlowTracker::find_path_metrics(const std::string& pathstring) {
+  std::shared_lock lock(all_path_metrics_mutex_);
+  auto it = all_path_metrics_.find(pathstring);
+  if (it == all_path_metrics_.end()) { return nullptr; }
+  return it->second;
+}
+
+std::shared_ptr<PathMetrics> DataFlowTracker::get_or_create_path_metrics(
+    const std::string& pathstring) {
+  // Fast path: the path is already known, so only a shared lock is needed
+  auto path_metrics = find_path_metrics(pathstring);
+  if (path_metrics) { return path_metrics; }
+
+  std::unique_lock lock(all_path_metrics_mutex_);
+  auto& new_path_metrics = all_path_metrics_[pathstring];
+  // Another thread may have created the path between releasing the shared lock and acquiring the
+  // exclusive lock
+  if (!new_path_metrics) {
+    new_path_metrics = std::make_shared<PathMetrics>();
+    new_path_metrics->path = pathstring;
+  }
+  return new_path_metrics;
+}
+
 void DataFlowTracker::update_latency(std::string pathstring, double current_latency) {
-  std::scoped_lock lock(all_path_metrics_mutex_);
+  update_path_latency(get_or_create_path_metrics(pathstring), current_latency);
+}
 
-  if (all_path_metrics_.find(pathstring) == all_path_metrics_.end()) {
-    all_path_metrics_[pathstring] = std::make_shared<PathMetrics>();
-    all_path_metrics_[pathstring]->path = pathstring;
+void DataFlowTracker::update_latency(const MessageLabel& label, int path_index,
+                                     double current_latency) {
+  const uint64_t path_hash = label.get_path_hash(path_index);
+  std::shared_ptr<PathMetrics> path_metrics;
+  {
+    std::shared_lock lock(all_path_metrics_mutex_);
+    auto it = path_metrics_by_hash_.find(path_hash);
+    if (it != path_metrics_by_hash_.end()) { path_metrics = it->second; }
+  }
+  if (!path_metrics) {
+    // The path name is only built the first time a path is seen
+    path_metrics = get_or_create_path_metrics(label.get_path_name(path_index));
+    std::unique_lock lock(all_path_metrics_mutex_);
+    path_metrics_by_hash_[path_hash] = path_metrics;
   }
+  update_path_latency(path_metrics, current_latency);
+}
 
+void DataFlowTracker::update_path_latency(const std::shared_ptr<PathMetrics>& path_metrics,
+                                          double current_latency) {
   // If the current latency is less than the threshold, then skip this message from latency
   // calculations
   if (current_latency < latency_threshold_) {
@@ -81,63 +196,59 @@ void DataFlowTracker::update_latency(std::string pathstring, double current_late
     return;
   }
 
+  std::scoped_lock lock(path_metrics->mutex);
+  auto& metrics = path_metrics->metrics;
+
   // For a path, if the number of skipped messages at the beginning is less than the
   // num_start_messages_to_skip_, then do not track this message
-  if (all_path_metrics_[pathstring]->num_skipped_messages < num_start_messages_to_skip_) {
-    all_path_metrics_[pathstring]->num_skipped_messages++;
+  if (path_metrics->num_skipped_messages < num_start_messages_to_skip_) {
+    path_metrics->num_skipped_messages++;
     return;
   }
 
   // Push the current latency to the buffer
-  all_path_metrics_[pathstring]->latency_buffer.push(current_latency);
+  path_metrics->latency_buffer.push(current_latency);
 
   // If the size of the buffer in this path has exceeded the num_last_messages_to_discard_, then get
   // the oldest element from the buffer and treat it as current latency
-  if (all_path_metrics_[pathstring]->get_buffer_size() > num_last_messages_to_discard_) {
+  if (path_metrics->get_buffer_size() > num_last_messages_to_discard_) {
     // Get the oldest latency from the buffer
-    current_latency = all_path_metrics_[pathstring]->latency_buffer.front();
+    current_latency = path_metrics->latency_buffer.front();
     // Remove the oldest latency from the buffer
-    all_path_metrics_[pathstring]->latency_buffer.pop();
+    path_metrics->latency_buffer.pop();
     // Sanity check to make sure that the size of the buffer is equal to
     // num_last_messages_to_discard_
-    assert(num_last_messages_to_discard_ == all_path_metrics_[pathstring]->get_buffer_size());
+    assert(num_last_messages_to_discard_ == path_metrics->get_buffer_size());
 
     // Update Max E2E Latency
-    double prev_max_latency =
-        all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency];
-
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency] =
-        std::max(current_latency, prev_max_latency);
+    double prev_max_latency = metrics[DataFlowMetric::kMaxE2ELatency];
+    metrics[DataFlowMetric::kMaxE2ELatency] = std::max(current_latency, prev_max_latency);
 
     // Update Min E2E Latency
-    double prev_min_latency =
-        all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency];
-
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency] =
-        std::min(current_latency, prev_min_latency);
+    double prev_min_latency = metrics[DataFlowMetric::kMinE2ELatency];
+    metrics[DataFlowMetric::kMinE2ELatency] = std::min(current_latency, prev_min_latency);
 
     // Calculate the average latency from total messages and avg latency till now
-    auto tmp_avg_lat = all_path_metrics_[pathstring]->metrics[DataFlowMetric::kAvgE2ELatency];
-
-    auto tmp_tot_messages = all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
-
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kAvgE2ELatency] =
+    auto tmp_avg_lat = metrics[DataFlowMetric::kAvgE2ELatency];
+    auto tmp_tot_messages = metrics[DataFlowMetric::kNumDstMessages];
+    metrics[DataFlowMetric::kAvgE2ELatency] =
         (tmp_avg_lat * tmp_tot_messages + current_latency) / (tmp_tot_messages + 1);
 
     // Update total number of messages
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages] += 1;
+    metrics[DataFlowMetric::kNumDstMessages] += 1;
 
     // Update kMaxMessageID
-    if (all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency] == current_latency) {
-      all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxMessageID] =
-          all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
+    if (metrics[DataFlowMetric::kMaxE2ELatency] == current_latency) {
+      metrics[DataFlowMetric::kMaxMessageID] = metrics[DataFlowMetric::kNumDstMessages];
     }
 
     // Update kMinMessageID
-    if (all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency] == current_latency) {
-      all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinMessageID] =
-          all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
+    if (metrics[DataFlowMetric::kMinE2ELatency] == current_latency) {
+      metrics[DataFlowMetric::kMinMessageID] = metrics[DataFlowMetric::kNumDstMessages];
     }
+
+    // Record the latency (in microseconds) in the histogram for percentile metrics
+    path_metrics->latency_histogram.record(std::llround(current_latency * 1000.0));
   }
 }
 
@@ -147,10 +258,12 @@ void DataFlowTracker::update_source_messages_number(std::string source, uint64_t
 }
 
 int DataFlowTracker::get_num_paths() {
+  std::shared_lock lock(all_path_metrics_mutex_);
   return all_path_metrics_.size();
 }
 
 std::vector<std::string> DataFlowTracker::get_path_strings() {
+  std::shared_lock lock(all_path_metrics_mutex_);
   std::vector<std::string> all_pathstrings;
   all_pathstrings.reserve(all_path_metrics_.size());
   for (auto it : all_path_metrics_) { all_pathstrings.push_back(it.first); }
@@ -161,13 +274,39 @@ double DataFlowTracker::get_metric(std::string pathstring, holoscan::DataFlowMet
   if (metric == DataFlowMetric::kNumSrcMessages) {
     HOLOSCAN_LOG_ERROR("metric with pathstring must not be DataFlowMetric::kNumSrcMessages");
     return -1;
-  } else if (all_path_metrics_.find(pathstring) == all_path_metrics_.end()) {
+  }
+  auto path_metrics = find_path_metrics(pathstring);
+  if (!path_metrics) {
     HOLOSCAN_LOG_ERROR(
         "pathstring not found. make sure messages are not skipped at the beginning or end or with "
         "set_skip_latencies.");
     return -1;
   }
-  return all_path_metrics_[pathstring]->metrics[metric];
+
+  auto percentile = metricToPercentile.find(metric);
+  if (percentile != metricToPercentile.end()) {
+    double latency_us = path_metrics->latency_histogram.value_at_percentile(percentile->second);
+    return latency_us < 0 ? -1 : latency_us / 1000.0;
+  }
+
+  std::scoped_lock lock(path_metrics->mutex);
+  return path_metrics->metrics[metric];
+}
+
+std::vector<std::pair<double, uint64_t>> DataFlowTracker::get_latency_histogram(
+    std::string pathstring) {
+  std::vector<std::pair<double, uint64_t>> histogram;
+  auto path_metrics = find_path_metrics(pathstring);
+  if (!path_metrics) {
+    HOLOSCAN_LOG_ERROR("pathstring '{}' not found.", pathstring);
+    return histogram;
+  }
+  auto buckets = path_metrics->latency_histogram.buckets();
+  histogram.reserve(buckets.size());
+  for (const auto& [upper_bound_us, count] : buckets) {
+    histogram.emplace_back(static_cast<double>(upper_bound_us) / 1000.0, count);
+  }
+  return histogram;
 }
 
 std::map<std::string, uint64_t> DataFlowTracker::get_metric(holoscan::DataFlowMetric metric) {
@@ -175,6 +314,7 @@ std::map<std::string, uint64_t> DataFlowTracker::get_metric(holoscan::DataFlowMe
     HOLOSCAN_LOG_ERROR("metric without pathstring must be DataFlowMetric::kNumSrcMessages");
     return {};
   }
+  std::scoped_lock lock(source_messages_mutex_);
   return source_messages_;
 }
 
@@ -208,4 +348,74 @@ void DataFlowTracker::write_to_logfile(std::string text) {
   }
 }
 
+void DataFlowTracker::enable_trace(std::string filename, uint64_t ring_capacity) {
+  auto trace_sink = std::make_unique<DataFlowTraceSink>(std::move(filename), ring_capacity);
+  // Same lock order as register_operator()
+  std::scoped_lock names_lock(operator_names_mutex_);
+  for (const auto& [operator_id, name] : operator_names_) {
+    trace_sink->register_operator(operator_id, name);
+  }
+  std::scoped_lock sink_lock(trace_sink_mutex_);
+  retire_trace_sink(trace_sink_.exchange(trace_sink.release()));
+}
+
+void DataFlowTracker::end_trace() {
+  std::scoped_lock lock(trace_sink_mutex_);
+  retire_trace_sink(trace_sink_.exchange(nullptr));
+}
+
+void DataFlowTracker::retire_trace_sink(DataFlowTraceSink* trace_sink) {
+  if (!trace_sink) { return; }
+  // The sink is not published anymore, so only the threads which already published it in their
+  // hazard pointer can still be writing to it
+  while (is_trace_sink_in_use(trace_sink)) { std::this_thread::yield(); }
+  delete trace_sink;  // closes the sink
+}
+
+void DataFlowTracker::register_operator(int64_t operator_id, const std::string& name) {
+  std::scoped_lock names_lock(operator_names_mutex_);
+  operator_names_[operator_id] = name;
+  // The sink cannot be retired while trace_sink_mutex_ is held
+  std::scoped_lock sink_lock(trace_sink_mutex_);
+  DataFlowTraceSink* trace_sink = trace_sink_.load();
+  if (trace_sink) { trace_sink->register_operator(operator_id, name); }
+}
+
+void DataFlowTracker::write_to_trace(const MessageLabel& label, int path_index) {
+  DataFlowTraceSink* trace_sink = trace_sink_.load(std::memory_order_acquire);
+  if (!trace_sink) { return; }
+
+  // Publish the sink in the hazard pointer of this thread, then check that it was not replaced in
+  // the meantime: if it was not, it is not destroyed before the hazard pointer is cleared
+  auto& hazard = thread_trace_sink_hazard();
+  while (trace_sink) {
+    hazard.trace_sink.store(trace_sink);
+    DataFlowTraceSink* current_trace_sink = trace_sink_.load();
+    if (current_trace_sink == trace_sink) { break; }
+    trace_sink = current_trace_sink;
+  }
+
+  if (trace_sink) {
+    DataFlowTraceEvent event;
+    event.message_id = trace_sink->next_message_id();
+    const auto& paths = label.paths();
+    const int first_path = path_index < 0 ? 0 : path_index;
+    const int last_path = path_index < 0 ? static_cast<int>(paths.size()) - 1 : path_index;
+    for (int i = first_path; i <= last_path; i++) {
+      event.path_hash = label.get_path_hash(i);
+      event.path_index = static_cast<uint32_t>(i);
+      for (size_t j = 0; j < paths[i].size(); j++) {
+        const auto& oplabel = paths[i][j];
+        event.operator_id = oplabel.operator_ptr ? oplabel.operator_ptr->id() : -1;
+        event.rec_timestamp = oplabel.rec_timestamp;
+        event.pub_timestamp = oplabel.pub_timestamp;
+        event.operator_index = static_cast<uint32_t>(j);
+        trace_sink->record(event);
+      }
+    }
+  }
+
+  hazard.trace_sink.store(nullptr, std::memory_order_release);
+}
+
 }  // namespace holoscan
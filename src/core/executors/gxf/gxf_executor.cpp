@@ -44,10 +44,12 @@
 #include "holoscan/core/domain/tensor.hpp"
 #include "holoscan/core/errors.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "holoscan/core/fused_connection.hpp"
 #include "holoscan/core/graph.hpp"
 #include "holoscan/core/graphs/flow_graph.hpp"
 #include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/gxf/gxf_extension_registrar.hpp"
+#include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/gxf/gxf_network_context.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/gxf/gxf_resource.hpp"
@@ -60,9 +62,16 @@
 #include "holoscan/core/resource.hpp"
 #include "holoscan/core/resources/gxf/annotated_double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/annotated_double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/deadline_scheduling_term.hpp"
 #include "holoscan/core/resources/gxf/dfft_collector.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/fan_out_double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/message_or_event_scheduling_term.hpp"
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
+#include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
 #include "holoscan/core/services/common/forward_op.hpp"
 #include "holoscan/core/services/common/virtual_operator.hpp"
 #include "holoscan/core/signal_handler.hpp"
@@ -701,6 +710,16 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
   }
 
   auto connector = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
+  if (io_spec->fan_out() &&
+      (tx_type == IOSpec::ConnectorType::kUCX || !graph_entity ||
+       (connector && (connector->gxf_cptr() != nullptr)))) {
+    HOLOSCAN_LOG_WARN(
+        "Fan-out is not supported for output port '{}' of operator '{}'. A Broadcast entity will be "
+        "used instead.",
+        tx_name,
+        op->name());
+    io_spec->fan_out(false);
+  }
   if (connector && (connector->gxf_cptr() != nullptr)) {
     auto gxf_transmitter = std::dynamic_pointer_cast<holoscan::gxf::GXFResource>(connector);
     if (gxf_transmitter && graph_entity) {
@@ -717,12 +736,18 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
         if (fragment->data_flow_tracker()) {
           std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx_resource)->track();
         }
+        if (io_spec->fan_out()) {
+          std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx_resource)->fan_out();
+        }
         break;
       case IOSpec::ConnectorType::kDoubleBuffer:
         tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
         if (fragment->data_flow_tracker()) {
           std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx_resource)->track();
         }
+        if (io_spec->fan_out()) {
+          std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx_resource)->fan_out();
+        }
         break;
       case IOSpec::ConnectorType::kUCX:
         tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
@@ -747,6 +772,10 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
       switch (tx_type) {
         case IOSpec::ConnectorType::kDefault:
         case IOSpec::ConnectorType::kDoubleBuffer:
+          if (io_spec->fan_out()) {
+            static_cast<holoscan::FanOutDoubleBufferTransmitter*>(tx_resource->gxf_cptr())->op(op);
+            break;
+          }
           dbl_ptr = reinterpret_cast<holoscan::AnnotatedDoubleBufferTransmitter*>(
               tx_resource->gxf_cptr());
           dbl_ptr->op(op);
@@ -794,6 +823,22 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
         downstream_msg_affordable_condition->spec(std::move(tx_condition_spec));
         // add to the same entity as the operator and initialize
         downstream_msg_affordable_condition->add_to_graph_entity(op);
+
+        // The receivers of a fan-out transmitter are not known to the GXF connection router, so
+        // they are checked by a dedicated scheduling term instead.
+        if (io_spec->fan_out()) {
+          std::string fan_out_cond_name = fmt::format("{}_fan_out", cond_name);
+          auto fan_out_term = graph_entity->add<holoscan::FanOutReceptiveSchedulingTerm>(
+              fan_out_cond_name.c_str(),
+              nvidia::gxf::Arg("min_size", downstream_msg_affordable_condition->min_size()));
+          if (!fan_out_term) {
+            HOLOSCAN_LOG_ERROR("Failed to create fan-out scheduling term for output port '{}'",
+                               tx_name);
+          } else {
+            fan_out_term->transmitter(
+                static_cast<holoscan::FanOutDoubleBufferTransmitter*>(connector->gxf_cptr()));
+          }
+        }
         break;
       }
       case ConditionType::kNone:
@@ -1282,6 +1327,411 @@ void GXFExecutor::create_broadcast_components(holoscan::OperatorGraph::NodeType
   }
 }
 
+void GXFExecutor::collect_fan_out_transmitters(holoscan::OperatorGraph::NodeType op,
+                                               FanOutTransmitterMapType& fan_out_transmitters,
+                                               TargetConnectionsMapType& connections) {
+  for (auto it = connections.begin(); it != connections.end();) {
+    auto& [source_cname, connector_type, target_ports] = it->second;
+    auto& op_io_spec = op->spec()->outputs()[source_cname];
+
+    // A fan-out transmitter can only publish into receivers within this fragment
+    bool can_fan_out = op_io_spec->fan_out() && connector_type != IOSpec::ConnectorType::kUCX;
+    for (const auto& [next_op, target_port] : target_ports) {
+      if (!can_fan_out) { break; }
+      can_fan_out = next_op->operator_type() != Operator::OperatorType::kVirtual &&
+                    next_op->spec()->inputs()[target_port]->connector_type() !=
+                        IOSpec::ConnectorType::kUCX;
+    }
+    if (!can_fan_out) {
+      ++it;
+      continue;
+    }
+
+    auto source_gxf_resource = std::dynamic_pointer_cast<GXFResource>(op_io_spec->connector());
+    fan_out_transmitters[op][source_cname] =
+        static_cast<holoscan::FanOutDoubleBufferTransmitter*>(source_gxf_resource->gxf_cptr());
+    HOLOSCAN_LOG_DEBUG("Using fan-out transmitter for source : {}", source_cname);
+
+    // Neither a Broadcast entity nor a direct GXF connection is needed for this source port
+    it = connections.erase(it);
+  }
+}
+
+void GXFExecutor::connect_fan_out_to_previous_op(
+    const FanOutTransmitterMapType& fan_out_transmitters, holoscan::OperatorGraph::NodeType op,
+    holoscan::OperatorGraph::NodeType prev_op, holoscan::OperatorGraph::EdgeDataType port_map_val) {
+  for (const auto& [port_name, fan_out_transmitter] : fan_out_transmitters.at(prev_op)) {
+    auto port_map_it = port_map_val->find(port_name);
+    if (port_map_it == port_map_val->end()) { continue; }
+
+    for (const auto& target_port : port_map_it->second) {
+      auto target_gxf_resource =
+          std::dynamic_pointer_cast<GXFResource>(op->spec()->inputs()[target_port]->connector());
+      // The current operator's input port holds a (possibly annotated) DoubleBufferReceiver
+      fan_out_transmitter->add_receiver(
+          static_cast<nvidia::gxf::DoubleBufferReceiver*>(target_gxf_resource->gxf_cptr()));
+      HOLOSCAN_LOG_DEBUG("Connected with fan-out source : {} -> target : {}", port_name, target_port);
+    }
+
+    // Now delete the key
+    port_map_val->erase(port_map_it);
+  }
+}
+
+namespace {
+
+/// Whether the port uses the default connector and conditions, which a fused connection replaces.
+bool has_default_connector_and_conditions(const IOSpec& io_spec) {
+  return io_spec.connector_type() == IOSpec::ConnectorType::kDefault && !io_spec.connector() &&
+         io_spec.conditions().empty() && !io_spec.fan_out();
+}
+
+/// Whether `target` can be reached from `source` by following the connections of the graph.
+bool is_reachable(OperatorGraph& graph, const OperatorGraph::NodeType& source,
+                  const OperatorGraph::NodeType& target) {
+  std::deque<OperatorGraph::NodeType> worklist{source};
+  std::unordered_set<OperatorGraph::NodeType> visited{source};
+  while (!worklist.empty()) {
+    auto node = worklist.front();
+    worklist.pop_front();
+    if (node == target) { return true; }
+    for (auto& next_node : graph.get_next_nodes(node)) {
+      if (visited.insert(next_node).second) { worklist.push_back(std::move(next_node)); }
+    }
+  }
+  return false;
+}
+
+/// Whether the operators of a chain would add two components with the same name to the entity.
+bool has_component_name_clash(const std::vector<OperatorGraph::NodeType>& chain) {
+  std::unordered_set<std::string> names;
+  std::unordered_set<Resource*> resources;
+  bool clash = false;
+  auto add_name = [&names, &clash](const std::string& name) {
+    if (!names.insert(name).second) { clash = true; }
+  };
+  for (const auto& op : chain) {
+    add_name(op->name());
+    // A resource shared by several operators is only added to the entity once
+    for (const auto& [_, resource] : op->resources()) {
+      if (resources.insert(resource.get()).second) { add_name(resource->name()); }
+    }
+  }
+  // Only the input ports and conditions of the first operator and the output ports of the last
+  // operator keep their GXF components
+  for (const auto& [name, _] : chain.front()->spec()->inputs()) { add_name(name); }
+  for (const auto& [_, condition] : chain.front()->conditions()) { add_name(condition->name()); }
+  for (const auto& [name, _] : chain.back()->spec()->outputs()) { add_name(name); }
+  return clash;
+}
+
+}  // namespace
+
+void GXFExecutor::initialize_thread_pools(OperatorGraph& graph) {
+  // Clear the assignments of a previous run
+  operator_thread_pools_.clear();
+  for (auto& op : graph.get_nodes()) { op->thread_pool_ = nullptr; }
+
+  for (auto& pool : fragment_->thread_pools()) {
+    if (!pool->gxf_graph_entity()) {
+      const std::string pool_entity_name =
+          fmt::format("{}{}_thread_pool_entity", entity_prefix_, pool->name());
+      auto pool_entity = std::make_shared<nvidia::gxf::GraphEntity>();
+      auto maybe = pool_entity->setup(context_, pool_entity_name.c_str());
+      if (!maybe) {
+        throw std::runtime_error(
+            fmt::format("Failed to create entity for thread pool: '{}'", pool_entity_name));
+      }
+      pool->gxf_context(context_);
+      pool->gxf_eid(pool_entity->eid());
+      pool->gxf_graph_entity(std::move(pool_entity));
+    }
+    // Also adds the operators assigned by name
+    pool->initialize();
+
+    for (auto& op : pool->operators()) {
+      auto [it, inserted] = operator_thread_pools_.emplace(op.get(), pool.get());
+      if (!inserted && it->second != pool.get()) {
+        throw std::runtime_error(
+            fmt::format("Operator '{}' is assigned to more than one thread pool ('{}' and '{}')",
+                        op->name(),
+                        it->second->name(),
+                        pool->name()));
+      }
+    }
+  }
+}
+
+bool GXFExecutor::have_same_thread_pool(Operator* op, Operator* other_op) const {
+  auto pool_it = operator_thread_pools_.find(op);
+  auto other_pool_it = operator_thread_pools_.find(other_op);
+  ThreadPool* pool = pool_it == operator_thread_pools_.end() ? nullptr : pool_it->second;
+  ThreadPool* other_pool =
+      other_pool_it == operator_thread_pools_.end() ? nullptr : other_pool_it->second;
+  if (pool != other_pool) { return false; }
+  return pool == nullptr || pool->is_pinned(op) == pool->is_pinned(other_op);
+}
+
+void GXFExecutor::add_thread_pools_to_entity_groups() {
+  if (operator_thread_pools_.empty()) { return; }
+  if (std::dynamic_pointer_cast<GreedyScheduler>(fragment_->scheduler())) {
+    HOLOSCAN_LOG_WARN(
+        "Thread pools are only used by the MultiThreadScheduler and the EventBasedScheduler. The "
+        "thread pools of fragment '{}' are ignored by the GreedyScheduler.",
+        fragment_->name());
+    return;
+  }
+
+  bool has_realtime_pool = false;
+  for (auto& pool : fragment_->thread_pools()) {
+    if (pool->operators().empty()) { continue; }
+
+    const std::string entity_group_name =
+        fmt::format("{}{}_entity_group", entity_prefix_, pool->name());
+    auto entity_group_gid = ::holoscan::gxf::add_entity_group(context_, entity_group_name);
+    // The ThreadPool is a resource of the entity group
+    HOLOSCAN_GXF_CALL_FATAL(GxfUpdateEntityGroup(context_, entity_group_gid, pool->gxf_eid()));
+
+    std::unordered_set<gxf_uid_t> added_eids;
+    int64_t num_pinned_entities = 0;
+    for (auto& op : pool->operators()) {
+      if (op->has_ucx_connector()) {
+        throw std::runtime_error(
+            fmt::format("Operator '{}' has UCX ports and cannot be assigned to thread pool '{}'",
+                        op->name(),
+                        pool->name()));
+      }
+      op->thread_pool_ = pool.get();
+
+      // The operators of a fused chain share the entity of the first operator
+      auto graph_entity = op->graph_entity();
+      if (!added_eids.insert(graph_entity->eid()).second) { continue; }
+      add_operator_to_entity_group(context_, entity_group_gid, op);
+
+      if (pool->is_pinned(op.get())) {
+        const std::string cpu_thread_name = fmt::format("{}_cpu_thread", op->name());
+        auto cpu_thread = graph_entity->addComponent("nvidia::gxf::CPUThread",
+                                                     cpu_thread_name.c_str(),
+                                                     {nvidia::gxf::Arg("pin_entity", true)});
+        if (cpu_thread.is_null()) {
+          HOLOSCAN_LOG_ERROR(
+              "Failed to pin operator '{}' to thread pool '{}'", op->name(), pool->name());
+          continue;
+        }
+        num_pinned_entities++;
+      }
+    }
+
+    if (num_pinned_entities > pool->initial_size()) {
+      HOLOSCAN_LOG_WARN(
+          "Thread pool '{}' has {} threads for {} pinned operator entities. Consider increasing "
+          "its initial_size so that each pinned operator has a thread of its own.",
+          pool->name(),
+          pool->initial_size(),
+          num_pinned_entities);
+    }
+    if (num_pinned_entities > 0 && pool->sched_priority() > 0) { has_realtime_pool = true; }
+  }
+
+  // Without strict pinning, the scheduler runs other operators on the thread of a pinned operator
+  // while it waits, and these would run with the SCHED_FIFO policy of the pool.
+  if (!has_realtime_pool) { return; }
+  auto scheduler = fragment_->scheduler();
+  bool strict_job_thread_pinning = true;
+  if (auto multithread_scheduler = std::dynamic_pointer_cast<MultiThreadScheduler>(scheduler)) {
+    strict_job_thread_pinning = multithread_scheduler->enable_strict_job_thread_pinning();
+  } else if (auto event_based_scheduler =
+                 std::dynamic_pointer_cast<EventBasedScheduler>(scheduler)) {
+    strict_job_thread_pinning = event_based_scheduler->enable_strict_job_thread_pinning();
+  }
+  if (!strict_job_thread_pinning) {
+    HOLOSCAN_LOG_WARN(
+        "Scheduler '{}' of fragment '{}' has strict_job_thread_pinning disabled: operators that "
+        "are not pinned may run on the SCHED_FIFO threads of real-time thread pools.",
+        scheduler->name(),
+        fragment_->name());
+  }
+}
+
+void GXFExecutor::initialize_deadline_scheduling(OperatorGraph& graph) {
+  deadline_arbiter_.reset();
+
+  auto operators = graph.get_nodes();
+  const bool has_deadlines = std::any_of(operators.begin(), operators.end(), [](const auto& op) {
+    return op->deadline().count() > 0;
+  });
+  for (auto& op : operators) {
+    op->track_frame_release_ = has_deadlines;
+    op->frame_release_ns_ = 0;
+  }
+  if (!fragment_->deadline_scheduling()) { return; }
+  if (!has_deadlines) {
+    HOLOSCAN_LOG_WARN(
+        "Deadline scheduling is enabled for fragment '{}', but none of its operators has a "
+        "deadline.",
+        fragment_->name());
+    return;
+  }
+
+  int64_t worker_count = 1;
+  auto scheduler = fragment_->scheduler();
+  if (auto multithread_scheduler = std::dynamic_pointer_cast<MultiThreadScheduler>(scheduler)) {
+    worker_count = multithread_scheduler->worker_thread_number();
+  } else if (auto event_based_scheduler =
+                 std::dynamic_pointer_cast<EventBasedScheduler>(scheduler)) {
+    worker_count = event_based_scheduler->worker_thread_number();
+  }
+  deadline_arbiter_ = std::make_shared<DeadlineArbiter>(worker_count);
+
+  // The operators of a fused chain share the entity of the first operator of the chain
+  std::unordered_map<Operator*, std::vector<Operator*>> entity_operators;
+  for (auto& op : operators) {
+    if (op->operator_type() != Operator::OperatorType::kNative) { continue; }
+    auto fused_chain_head = fused_chain_heads_.find(op.get());
+    Operator* head = fused_chain_head == fused_chain_heads_.end() ? op.get()
+                                                                  : fused_chain_head->second;
+    entity_operators[head].push_back(op.get());
+  }
+
+  for (auto& [head, entity_ops] : entity_operators) {
+    // Pinned operators do not run on the worker threads of the scheduler
+    if (head->thread_pool() != nullptr && head->thread_pool()->is_pinned(head)) { continue; }
+
+    std::vector<nvidia::gxf::Receiver*> receivers;
+    for (auto& [_, io_spec] : head->spec()->inputs()) {
+      if (io_spec->fused_connection()) { continue; }
+      auto& conditions = io_spec->conditions();
+      const bool has_message_available = std::any_of(
+          conditions.begin(), conditions.end(), [](const auto& condition) {
+            return condition.first == ConditionType::kMessageAvailable;
+          });
+      if (!has_message_available) { continue; }
+      auto receiver = get_gxf_receiver(io_spec.get());
+      if (receiver != nullptr) { receivers.push_back(receiver); }
+    }
+    // Source operators are driven by their own conditions and are never held back
+    if (receivers.empty()) { continue; }
+
+    int64_t relative_deadline_ns = 0;
+    for (auto* op : entity_ops) {
+      const int64_t deadline_ns = op->deadline().count();
+      if (deadline_ns > 0 && (relative_deadline_ns == 0 || deadline_ns < relative_deadline_ns)) {
+        relative_deadline_ns = deadline_ns;
+      }
+    }
+
+    const std::string term_name = fmt::format("{}_deadline", head->name());
+    auto deadline_term =
+        head->graph_entity()->add<holoscan::DeadlineSchedulingTerm>(term_name.c_str());
+    if (!deadline_term) {
+      HOLOSCAN_LOG_ERROR("Failed to create deadline scheduling term for operator '{}'",
+                         head->name());
+      continue;
+    }
+    deadline_term->configure(deadline_arbiter_, std::move(receivers), relative_deadline_ns);
+  }
+}
+
+void GXFExecutor::fuse_operator_chains(OperatorGraph& graph) {
+  auto operators = graph.get_nodes();
+
+  // Clear the fused connections of a previous run
+  fused_chain_heads_.clear();
+  fused_chains_.clear();
+  fusion_candidates_.clear();
+  fusion_candidate_outputs_.clear();
+  pending_fused_outputs_.clear();
+  for (auto& op : operators) {
+    for (auto& [_, io_spec] : op->spec()->inputs()) { io_spec->fused_connection(nullptr); }
+    for (auto& [_, io_spec] : op->spec()->outputs()) { io_spec->fused_connection(nullptr); }
+  }
+  if (!fragment_->fuse_operators()) { return; }
+
+  auto is_fusable_op = [](const OperatorGraph::NodeType& op) {
+    return op->operator_type() == Operator::OperatorType::kNative && !op->has_ucx_connector();
+  };
+
+  // Find the connections that can be fused: the single output port of an operator connected to
+  // the single input port of the next operator, which has no other upstream operator. The ports
+  // may still be configured by the initialize() methods of the operators, so these are only
+  // candidates, decided by fuse_with_previous_operator().
+  for (auto& op : operators) {
+    if (!is_fusable_op(op)) { continue; }
+    auto next_ops = graph.get_next_nodes(op);
+    if (next_ops.size() != 1) { continue; }
+    auto& next_op = next_ops.front();
+    // The scheduler only evaluates the conditions of the first operator of a chain
+    if (!is_fusable_op(next_op) || !next_op->conditions().empty() ||
+        graph.get_previous_nodes(next_op).size() != 1) {
+      continue;
+    }
+
+    auto& outputs = op->spec()->outputs();
+    auto& inputs = next_op->spec()->inputs();
+    if (outputs.size() != 1 || inputs.size() != 1) { continue; }
+    auto port_map = graph.get_port_map(op, next_op);
+    if (!port_map.has_value() || port_map.value()->size() != 1) { continue; }
+    const auto& [source_port, target_ports] = *port_map.value()->begin();
+    if (target_ports.size() != 1 || outputs.begin()->first != source_port ||
+        inputs.begin()->first != *target_ports.begin()) {
+      continue;
+    }
+    if (!has_default_connector_and_conditions(*outputs.begin()->second) ||
+        !has_default_connector_and_conditions(*inputs.begin()->second)) {
+      continue;
+    }
+    // The operators of a cycle are driven by the messages going around the cycle
+    if (is_reachable(graph, next_op, op)) { continue; }
+    // Fused operators share an entity, so they must run on the same threads
+    if (!have_same_thread_pool(op.get(), next_op.get())) { continue; }
+
+    fusion_candidates_[next_op.get()] = op;
+    fusion_candidate_outputs_.insert(outputs.begin()->second.get());
+  }
+}
+
+Operator* GXFExecutor::fuse_with_previous_operator(Operator* op) {
+  auto candidate = fusion_candidates_.find(op);
+  if (candidate == fusion_candidates_.end()) { return nullptr; }
+  auto producer = candidate->second;
+  fusion_candidates_.erase(candidate);
+  auto& output = producer->spec()->outputs().begin()->second;
+  fusion_candidate_outputs_.erase(output.get());
+  // The output port is only pending if the producer is initialized and kept the port unconfigured
+  if (pending_fused_outputs_.erase(output.get()) == 0) { return nullptr; }
+
+  auto fused_chain_head = fused_chain_heads_.find(producer.get());
+  Operator* head = fused_chain_head == fused_chain_heads_.end() ? producer.get()
+                                                                : fused_chain_head->second;
+  auto& chain = fused_chains_[head];
+  if (chain.empty()) { chain.push_back(producer); }
+  chain.push_back(std::shared_ptr<Operator>(op, [](Operator*) {}));
+
+  // The initialize() method of the operator configured its ports before calling this method
+  auto& inputs = op->spec()->inputs();
+  // GraphEntity requires unique component names
+  if (inputs.size() != 1 || !has_default_connector_and_conditions(*inputs.begin()->second) ||
+      !op->conditions().empty() || has_component_name_clash(chain)) {
+    chain.pop_back();
+    // The output port of the producer was not created while its fusion was pending
+    create_output_port(fragment(),
+                       context_,
+                       producer->graph_entity()->eid(),
+                       output.get(),
+                       false,
+                       producer.get());
+    return nullptr;
+  }
+
+  auto& input = inputs.begin()->second;
+  auto connection =
+      std::make_shared<FusedConnection>(producer.get(), output->name(), op, input->name());
+  output->fused_connection(connection);
+  input->fused_connection(std::move(connection));
+  fused_chain_heads_[op] = head;
+  return head;
+}
+
 bool GXFExecutor::initialize_fragment() {
   HOLOSCAN_LOG_DEBUG("Initializing Fragment.");
 
@@ -1306,6 +1756,14 @@ bool GXFExecutor::initialize_fragment() {
   create_virtual_operators_and_connections(fragment_, connection_map, virtual_ops);
   connect_ucx_transmitters_to_virtual_ops(fragment_, virtual_ops);
 
+  // Resolve the thread pool of each operator, which is needed to decide which operators can share
+  // an entity
+  initialize_thread_pools(graph);
+
+  // Find the linear operator chains to fuse (if enabled) before the operators create their
+  // entities. The fusion of each connection is decided when its consumer is initialized.
+  fuse_operator_chains(graph);
+
   auto operators = graph.get_nodes();
 
   // Create a list of nodes in the graph to iterate in topological order
@@ -1322,6 +1780,10 @@ bool GXFExecutor::initialize_fragment() {
   // Each value in the map is indexed by the source port name.
   BroadcastEntityMapType broadcast_entities;
 
+  // Keep the fan-out transmitters of the output ports which publish directly into all of their
+  // target input ports, indexed the same way as broadcast_entities.
+  FanOutTransmitterMapType fan_out_transmitters;
+
   // Initialize the indegrees of all nodes in the graph and add root operators to the worklist.
   for (auto& node : operators) {
     indegrees[node] = graph.get_previous_nodes(node).size();
@@ -1387,6 +1849,12 @@ bool GXFExecutor::initialize_fragment() {
 
       const auto& port_map_val = port_map.value();
 
+      // If an output port of the previous operator is a fan-out port, register the current
+      // operator's input ports as its receivers. Any connected ports are removed from port_map_val.
+      if (fan_out_transmitters.find(prev_op) != fan_out_transmitters.end()) {
+        connect_fan_out_to_previous_op(fan_out_transmitters, op, prev_op, port_map_val);
+      }
+
       // If the previous operator is found to be one that is connected to the current operator via
       // the Broadcast component, then add the connection between the Broadcast component and the
       // current operator's input port.
@@ -1409,6 +1877,9 @@ bool GXFExecutor::initialize_fragment() {
         }
 
         for (const auto& [source_port, target_ports] : *port_map_val) {
+          // Fused connections pass messages directly, without a GXF Connection component
+          if (prev_op->spec()->outputs()[source_port]->fused_connection()) { continue; }
+
           gxf_uid_t source_cid = -1;
           // Only if previous operator is initialized, then source edge cid is valid
           // For cycles, a previous operator may not have been initialized yet
@@ -1473,7 +1944,11 @@ bool GXFExecutor::initialize_fragment() {
           HOLOSCAN_LOG_DEBUG("    Port: {} -> {}", source_port, target_port);
 
           // If current operator's type is virtual operator, we don't need to connect it.
-          if (op_type != Operator::OperatorType::kVirtual) {
+          // Fused connections need neither a GXF Connection nor a Broadcast component.
+          // Pending fused ports are connected when the next operator is initialized.
+          auto& output_spec = op_spec->outputs()[source_port];
+          if (op_type != Operator::OperatorType::kVirtual && !output_spec->fused_connection() &&
+              pending_fused_outputs_.count(output_spec.get()) == 0) {
             auto source_gxf_resource = std::dynamic_pointer_cast<GXFResource>(
                 op_spec->outputs()[source_port]->connector());
             gxf_uid_t source_cid = source_gxf_resource->gxf_cid();
@@ -1501,6 +1976,12 @@ bool GXFExecutor::initialize_fragment() {
             std::move(next_op));  // next_op is moved because get_next_nodes returns a new vector
       }
     }
+    // Fan-out source ports are served by their transmitter directly, so they are removed from the
+    // connections before creating any direct connection or Broadcast component.
+    if (op_type != Operator::OperatorType::kVirtual) {
+      collect_fan_out_transmitters(op, fan_out_transmitters, connections);
+    }
+
     // Iterate through downstream connections and find the direct ones to connect, only if
     // downstream operator is already initialized. This is to handle cycles in the graph.
     for (auto [source_cid, target_info] : connections) {
@@ -1543,6 +2024,9 @@ bool GXFExecutor::initialize_fragment() {
             HOLOSCAN_LOG_ERROR("Could not find port map for {} -> {}", op_name, next_op->name());
             return false;
           }
+          if (fan_out_transmitters.find(op) != fan_out_transmitters.end()) {
+            connect_fan_out_to_previous_op(fan_out_transmitters, next_op, op, port_map.value());
+          }
           if (broadcast_entities.find(op) != broadcast_entities.end()) {
             connect_broadcast_to_previous_op(broadcast_entities, next_op, op, port_map.value());
           }
@@ -1550,6 +2034,15 @@ bool GXFExecutor::initialize_fragment() {
       }
     }
   }
+
+  for (const auto& [_, chain] : fused_chains_) {
+    if (chain.size() < 2) { continue; }
+    std::string chain_names = chain.front()->name();
+    for (size_t index = 1; index < chain.size(); ++index) {
+      chain_names += " -> " + chain[index]->name();
+    }
+    HOLOSCAN_LOG_INFO("Fusing operators {} into a single entity", chain_names);
+  }
   return true;
 }
 
@@ -1574,7 +2067,17 @@ bool GXFExecutor::initialize_operator(Operator* op) {
 
   // op_eid_ should only be nonzero if OperatorWrapper wraps a codelet created by GXF.
   // In that case GXF has already created the entity and we can't create a GraphEntity.
-  gxf_uid_t eid = (op_eid_ == 0) ? op->initialize_graph_entity(context_, entity_prefix_) : op_eid_;
+  gxf_uid_t eid = op_eid_;
+  if (eid == 0) {
+    if (Operator* fused_chain_head = fuse_with_previous_operator(op)) {
+      // A fused operator adds its codelet to the entity of the first operator of its chain, which
+      // is initialized first as the operators are visited in topological order.
+      op->graph_entity_ = fused_chain_head->graph_entity();
+      eid = op->graph_entity_->eid();
+    } else {
+      eid = op->initialize_graph_entity(context_, entity_prefix_);
+    }
+  }
 
   // Create Codelet component if `op_cid_` is 0
   gxf_uid_t codelet_cid = (op_cid_ == 0) ? op->add_codelet_to_graph_entity() : op_cid_;
@@ -1585,12 +2088,21 @@ bool GXFExecutor::initialize_operator(Operator* op) {
   // Create Components for input
   const auto& inputs = spec.inputs();
   for (const auto& [name, io_spec] : inputs) {
+    // Fused ports pass messages directly and have no GXF components
+    if (io_spec->fused_connection()) { continue; }
     gxf::GXFExecutor::create_input_port(fragment(), context_, eid, io_spec.get(), op_eid_ != 0, op);
   }
 
   // Create Components for output
   const auto& outputs = spec.outputs();
   for (const auto& [name, io_spec] : outputs) {
+    if (io_spec->fused_connection()) { continue; }
+    // The port of a fusion candidate is created once the next operator configured its input port
+    if (fusion_candidate_outputs_.count(io_spec.get()) &&
+        has_default_connector_and_conditions(*io_spec)) {
+      pending_fused_outputs_.insert(io_spec.get());
+      continue;
+    }
     gxf::GXFExecutor::create_output_port(
         fragment(), context_, eid, io_spec.get(), op_eid_ != 0, op);
   }
@@ -1710,6 +2222,12 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
       return false;
     }
 
+    // Add the entities of the operators assigned to thread pools to the entity groups of the pools
+    add_thread_pools_to_entity_groups();
+
+    // Track the frames of the operators and dispatch them in deadline order (if enabled)
+    initialize_deadline_scheduling(graph);
+
     // If DFFT is on, then attach the DFFTCollector EntityMonitor to the main entity
     if (fragment_->data_flow_tracker()) {
       auto dft_tracker_handle = util_entity_->add<holoscan::DFFTCollector>("dft_tracker", {});
@@ -1722,6 +2240,8 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
 
       // Identify leaf and root operators and add to the DFFTCollector object
       for (auto op : graph.get_nodes()) {
+        // Register the operator names so that the IDs in the binary trace can be resolved
+        fragment_->data_flow_tracker()->register_operator(op->id(), op->name());
         if (op->is_leaf()) {
           dfft_collector_ptr->add_leaf_op(op.get());
         } else if (op->is_root() || op->is_user_defined_root()) {
@@ -1957,6 +2477,24 @@ void GXFExecutor::register_extensions() {
                                     nvidia::gxf::DoubleBufferTransmitter>(
         "Holoscan's annotated double buffer transmitter", {0x444505a86c014d90, 0xab7503bcd0782877});
 
+    extension_factory.add_component<holoscan::FanOutDoubleBufferTransmitter,
+                                    nvidia::gxf::DoubleBufferTransmitter>(
+        "Holoscan's fan-out double buffer transmitter", {0x7c1e3a5b90d24f68, 0x8b2f4e6a1d3c5b79});
+    extension_factory.add_component<holoscan::FanOutReceptiveSchedulingTerm,
+                                    nvidia::gxf::SchedulingTerm>(
+        "Holoscan's scheduling term for fan-out transmitters",
+        {0x2d9b6f4e18a7430c, 0x9e5d1c7b3a8f6024});
+    extension_factory.add_component<holoscan::DeadlineSchedulingTerm,
+                                    nvidia::gxf::SchedulingTerm>(
+        "Holoscan's earliest-deadline-first scheduling term",
+        {0x5b0e7d2c9a4f4e13, 0xa6c8f1d3e7b2904d});
+    extension_factory.add_component<holoscan::MessageOrEventSchedulingTerm,
+                                    nvidia::gxf::SchedulingTerm>(
+        "Holoscan's scheduling term executing on new messages or on an event",
+        {0x3c7d9e1a5f2b4860, 0x9d4a7e2c1b6f3058});
+    extension_factory.add_type<holoscan::FrameRelease>("Holoscan frame release time",
+                                                       {0x8f3a6c1e2d7b4a05, 0xb9e4d2f7a1c6830e});
+
     extension_factory.add_type<holoscan::MessageLabel>("Holoscan message Label",
                                                        {0x6e09e888ccfa4a32, 0xbc501cd20c8b4337});
 
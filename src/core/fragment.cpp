@@ -24,6 +24,7 @@
 #include <set>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <variant>
@@ -37,6 +38,7 @@
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/gxf/gxf_network_context.hpp"
 #include "holoscan/core/gxf/gxf_scheduler.hpp"
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
 #include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
 
 using std::string_literals::operator""s;
@@ -479,6 +481,13 @@ holoscan::DataFlowTracker& Fragment::track(uint64_t num_start_messages_to_skip,
   return *data_flow_tracker_;
 }
 
+std::unordered_map<std::string, OperatorStatistics> Fragment::operator_metrics() {
+  std::unordered_map<std::string, OperatorStatistics> metrics;
+  if (!graph_) { return metrics; }
+  for (auto& op : graph_->get_nodes()) { metrics[op->name()] = op->metrics().statistics(); }
+  return metrics;
+}
+
 void Fragment::compose_graph() {
   if (is_composed_) {
     HOLOSCAN_LOG_DEBUG("The fragment({}) has already been composed. Skipping...", name());
@@ -538,6 +547,18 @@ FragmentPortMap Fragment::port_info() const {
   return fragment_port_info;
 }
 
+std::shared_ptr<ThreadPool> Fragment::make_thread_pool(const std::string& name,
+                                                       int64_t initial_size) {
+  return make_thread_pool(name, ArgList{Arg("initial_size", initial_size)});
+}
+
+std::shared_ptr<ThreadPool> Fragment::make_thread_pool(const std::string& name,
+                                                       const ArgList& args) {
+  auto pool = make_resource<ThreadPool>(name, args);
+  thread_pools_.push_back(pool);
+  return pool;
+}
+
 void Fragment::reset_graph_entities() {
   // Explicitly clean up graph entities. This is necessary for Python apps, because the Python
   // object lifetime may outlive the Application runtime and these must be released prior to the
@@ -547,6 +568,7 @@ void Fragment::reset_graph_entities() {
   if (gxf_sch) { gxf_sch->reset_graph_entities(); }
   auto gxf_network_context = std::dynamic_pointer_cast<gxf::GXFNetworkContext>(network_context());
   if (gxf_network_context) { gxf_network_context->reset_graph_entities(); }
+  for (auto& pool : thread_pools_) { pool->reset_gxf_graph_entity(); }
 }
 
 }  // namespace holoscan
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/fused_connection.hpp"
+
+#include <fmt/format.h>
+
+#include <string>
+#include <utility>
+
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/operator.hpp"
+
+namespace holoscan {
+
+FusedConnection::FusedConnection(Operator* producer, const std::string& output_name,
+                                 Operator* consumer, const std::string& input_name)
+    : producer_(producer),
+      consumer_(consumer),
+      input_name_(input_name),
+      publisher_name_(fmt::format("{}->{}", producer->name(), output_name)) {}
+
+void FusedConnection::push(std::any data) {
+  Message message{std::move(data), MessageLabel(), false};
+
+  // Same label handling as AnnotatedDoubleBufferTransmitter::publish_abi()
+  if (producer_->fragment()->data_flow_tracker()) {
+    message.label = producer_->get_consolidated_input_label();
+    message.label.update_last_op_publish();
+    message.has_label = true;
+    if (producer_->is_root() || producer_->is_user_defined_root()) {
+      producer_->update_published_messages(publisher_name_);
+    }
+  }
+  messages_.push_back(std::move(message));
+}
+
+std::any FusedConnection::pop() {
+  if (messages_.empty()) {
+    return nullptr;  // to indicate that there is no data
+  }
+  Message message = std::move(messages_.front());
+  messages_.pop_front();
+
+  // Same label handling as AnnotatedDoubleBufferReceiver::receive_abi(). Fused chains never
+  // contain a cycle, so the consumer cannot already be in the paths of the label.
+  if (message.has_label) {
+    message.label.add_new_op_timestamp(OperatorTimestampLabel(consumer_));
+    consumer_->update_input_message_label(input_name_, std::move(message.label));
+  } else if (consumer_->fragment()->data_flow_tracker()) {
+    consumer_->delete_input_message_label(input_name_);
+  }
+  return std::move(message.data);
+}
+
+void FusedConnection::clear() {
+  messages_.clear();
+}
+
+}  // namespace holoscan
@@ -22,31 +22,98 @@
 #include <utility>
 #include <unordered_map>
 #include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/fused_connection.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/gxf/gxf_utils.hpp"
 #include "holoscan/core/message.hpp"
+#include "holoscan/core/resources/gxf/deadline_scheduling_term.hpp"
 
 #include "gxf/std/receiver.hpp"
 #include "gxf/std/transmitter.hpp"
 
 namespace holoscan::gxf {
 
-nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spec) {
-  auto connector = input_spec->connector();
-  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(connector);
+namespace {
+
+/// Resolve the native GXF component pointer of the connector of the given port.
+void* resolve_gxf_connector(IOSpec* io_spec) {
+  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(io_spec->connector());
   if (gxf_resource == nullptr) {
-    HOLOSCAN_LOG_ERROR("Invalid connector type");
-    return nullptr;  // to cause a bad_any_cast
+    HOLOSCAN_LOG_ERROR("Invalid connector type for port '{}'", io_spec->name());
+    return nullptr;
   }
 
-  gxf_tid_t rx_tid{};
+  gxf_tid_t tid{};
   gxf_context_t context = gxf_resource->gxf_context();
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(context, gxf_resource->gxf_typename(), &rx_tid));
-  void* rx_ptr = nullptr;
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(context, gxf_resource->gxf_cid(), rx_tid, &rx_ptr));
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tid));
+  void* ptr = nullptr;
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(context, gxf_resource->gxf_cid(), tid, &ptr));
+  return ptr;
+}
+
+/// Convert emitted data to the value GXFInputContext::receive_impl() returns for it, so that a
+/// fused connection can pass it to the next operator without a GXF message entity.
+std::any to_received_value(std::any data, OutputContext::OutputType out_type) {
+  if (out_type != OutputContext::OutputType::kGXFEntity) { return data; }
+  try {
+    auto gxf_entity = std::any_cast<nvidia::gxf::Entity>(data);
+    auto message = gxf_entity.get<holoscan::Message>();
+    if (message) { return message.value()->value(); }
+    return holoscan::gxf::Entity(gxf_entity);
+  } catch (const std::bad_any_cast& e) {
+    HOLOSCAN_LOG_ERROR("Unable to cast to gxf::Entity: {}", e.what());
+    return nullptr;
+  }
+}
+
+/// Set the release time of the frame of a message, so that the downstream operators measure their
+/// deadlines from it.
+void set_frame_release(nvidia::gxf::Entity& entity, int64_t release_ns) {
+  auto frame_release = entity.get<FrameRelease>();
+  if (!frame_release) { frame_release = entity.add<FrameRelease>("frame_release"); }
+  if (frame_release) { frame_release.value()->time_ns = release_ns; }
+}
+
+}  // namespace
+
+nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spec) {
+  return get_gxf_receiver(input_spec.get());
+}
+
+nvidia::gxf::Receiver* get_gxf_receiver(IOSpec* input_spec) {
+  void* rx_ptr = input_spec->connector_handle();
+  if (rx_ptr == nullptr) {
+    rx_ptr = resolve_gxf_connector(input_spec);
+    input_spec->connector_handle(rx_ptr);
+  }
   return static_cast<nvidia::gxf::Receiver*>(rx_ptr);
 }
 
+nvidia::gxf::Transmitter* get_gxf_transmitter(IOSpec* output_spec) {
+  void* tx_ptr = output_spec->connector_handle();
+  if (tx_ptr == nullptr) {
+    tx_ptr = resolve_gxf_connector(output_spec);
+    output_spec->connector_handle(tx_ptr);
+  }
+  return static_cast<nvidia::gxf::Transmitter*>(tx_ptr);
+}
+
+void cache_gxf_connector_handles(Operator* op) {
+  // Ports whose connector is not (yet) a GXF component are resolved lazily on first use.
+  auto is_resolvable = [](IOSpec* io_spec) {
+    auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(io_spec->connector());
+    return gxf_resource != nullptr && gxf_resource->gxf_cid() != 0;
+  };
+  for (auto& [_, io_spec] : op->spec()->inputs()) {
+    io_spec->connector_handle(nullptr);
+    if (is_resolvable(io_spec.get())) { get_gxf_receiver(io_spec.get()); }
+  }
+  for (auto& [_, io_spec] : op->spec()->outputs()) {
+    io_spec->connector_handle(nullptr);
+    if (is_resolvable(io_spec.get())) { get_gxf_transmitter(io_spec.get()); }
+  }
+}
+
 GXFInputContext::GXFInputContext(ExecutionContext* execution_context, Operator* op)
     : InputContext(execution_context, op) {}
 
@@ -62,7 +129,12 @@ gxf_context_t GXFInputContext::gxf_context() const {
 bool GXFInputContext::empty_impl(const char* name) {
   std::string input_name = holoscan::get_well_formed_name(name, inputs_);
   auto it = inputs_.find(input_name);
-  auto receiver = get_gxf_receiver(it->second);
+  return empty_impl(it->second.get());
+}
+
+bool GXFInputContext::empty_impl(IOSpec* input_spec) {
+  if (auto fused_connection = input_spec->fused_connection()) { return fused_connection->empty(); }
+  auto receiver = get_gxf_receiver(input_spec);
   return receiver->size() == 0;
 }
 
@@ -111,7 +183,12 @@ std::any GXFInputContext::receive_impl(const char* name, bool no_error_message)
     }
   }
 
-  auto receiver = get_gxf_receiver(it->second);
+  return receive_impl(it->second.get());
+}
+
+std::any GXFInputContext::receive_impl(IOSpec* input_spec) {
+  if (auto fused_connection = input_spec->fused_connection()) { return fused_connection->pop(); }
+  auto receiver = get_gxf_receiver(input_spec);
   if (!receiver) {
     return -1;  // to cause a bad_any_cast
   }
@@ -191,21 +268,21 @@ void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out
     }
   }
 
-  const std::unique_ptr<IOSpec>& output_spec = it->second;
-  auto connector = output_spec->connector();
+  emit_impl(std::move(data), it->second.get(), out_type);
+}
 
-  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(connector);
-  if (gxf_resource == nullptr) {
-    HOLOSCAN_LOG_ERROR("Invalid resource type");
+void GXFOutputContext::emit_impl(std::any data, IOSpec* output_spec, OutputType out_type) {
+  if (auto fused_connection = output_spec->fused_connection()) {
+    fused_connection->push(to_received_value(std::move(data), out_type));
     return;
   }
 
-  gxf_tid_t tx_tid;
-  gxf_context_t context = gxf_resource->gxf_context();
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tx_tid));
+  auto transmitter = get_gxf_transmitter(output_spec);
+  if (transmitter == nullptr) { return; }
 
-  void* tx_ptr;
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(context, gxf_resource->gxf_cid(), tx_tid, &tx_ptr));
+  // The release time is only tracked within a fragment
+  const int64_t frame_release_ns =
+      output_spec->connector_type() == IOSpec::ConnectorType::kUCX ? 0 : op_->frame_release_ns();
 
   switch (out_type) {
     case OutputType::kSharedPointer:
@@ -213,19 +290,22 @@ void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out
       // Create an Entity object and add a Message object to it.
       auto gxf_entity = nvidia::gxf::Entity::New(gxf_context());
       auto buffer = gxf_entity.value().add<Message>();
-      // Set the data to the value of the Message object.
-      buffer.value()->set_value(data);
+      // Move the data into the Message object, copying a std::any holding a large value
+      // would allocate.
+      buffer.value()->set_value(std::move(data));
+      if (frame_release_ns != 0) { set_frame_release(gxf_entity.value(), frame_release_ns); }
       // Publish the Entity object.
       // TODO(gbae): Check error message
-      static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity.value()));
+      transmitter->publish(std::move(gxf_entity.value()));
       break;
     }
     case OutputType::kGXFEntity: {
       // Cast to an Entity object and publish it.
       try {
         auto gxf_entity = std::any_cast<nvidia::gxf::Entity>(data);
+        if (frame_release_ns != 0) { set_frame_release(gxf_entity, frame_release_ns); }
         // TODO(gbae): Check error message
-        static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity));
+        transmitter->publish(std::move(gxf_entity));
       } catch (const std::bad_any_cast& e) {
         HOLOSCAN_LOG_ERROR("Unable to cast to gxf::Entity: {}", e.what());
       }
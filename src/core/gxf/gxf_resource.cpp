@@ -97,6 +97,7 @@ void GXFResource::initialize() {
 
   // Set Handler parameters
   for (auto& [key, param_wrap] : spec_->params()) {
+    if (!is_gxf_parameter(key)) { continue; }
     // Issue 4336947: dev_id parameter for allocator needs to be handled manually
     bool dev_id_handled = false;
     if (key.compare(std::string("dev_id")) == 0) {
@@ -17,15 +17,42 @@
 
 #include "holoscan/core/gxf/gxf_wrapper.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
 #include "holoscan/core/common.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "holoscan/core/fused_connection.hpp"
 #include "holoscan/core/gxf/gxf_execution_context.hpp"
+#include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/io_context.hpp"
+#include "holoscan/core/resources/gxf/deadline_scheduling_term.hpp"
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
 
+#include "gxf/std/receiver.hpp"
 #include "gxf/std/transmitter.hpp"
 
 namespace holoscan::gxf {
 
+namespace {
+
+int64_t to_ns(OperatorMetrics::Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+/// Release time of the frame of the message at the front of the receiver, or `default_ns` if the
+/// message has no release time.
+int64_t front_release_ns(nvidia::gxf::Receiver* receiver, int64_t default_ns) {
+  auto message = receiver->peek(0);
+  if (!message) { return default_ns; }
+  auto frame_release = message.value().get<FrameRelease>();
+  return frame_release ? frame_release.value()->time_ns : default_ns;
+}
+
+}  // namespace
+
 gxf_result_t GXFWrapper::initialize() {
   HOLOSCAN_LOG_TRACE("GXFWrapper::initialize()");
   return GXF_SUCCESS;
@@ -50,8 +77,35 @@ gxf_result_t GXFWrapper::start() {
 
   HOLOSCAN_LOG_TRACE("Starting operator: {}", op_->name());
 
+  auto thread_pool = op_->thread_pool();
+  if (thread_pool != nullptr && thread_pool->is_pinned(op_) &&
+      (thread_pool->has_cpu_affinity() || thread_pool->sched_priority() > 0)) {
+    pinned_thread_pool_ = thread_pool;
+  } else {
+    pinned_thread_pool_ = nullptr;
+  }
+  is_thread_configured_ = false;
+  // start() runs on the thread of the pool the entity is pinned to, before the first tick
+  configure_thread();
+
+  op_->frame_release_ns_ = 0;
+  last_tick_ns_ = 0;
+  deadline_term_ = nullptr;
+  if (op_->track_frame_release_ && op_->fragment()->deadline_scheduling()) {
+    auto deadline_term = entity().get<DeadlineSchedulingTerm>();
+    if (deadline_term) { deadline_term_ = deadline_term.value().get(); }
+  }
+
+  auto& metrics = op_->metrics();
+  metrics.reset();
+  metrics.log_period(op_->fragment()->operator_metrics_log_period());
+  const auto start_begin = OperatorMetrics::Clock::now();
   try {
+    // Resolve the GXF receivers/transmitters once instead of on every receive()/emit() call
+    cache_gxf_connector_handles(op_);
+    exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_);
     op_->start();
+    metrics.record_start(start_begin, OperatorMetrics::Clock::now());
   } catch (const std::exception& e) {
     store_exception();
     HOLOSCAN_LOG_ERROR(
@@ -71,11 +125,59 @@ gxf_result_t GXFWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_);
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
+  // The contexts hold no per-tick state, the ones created on start() are reused
+  if (!exec_context_) { exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_); }
+
+  // The thread configured on start() does not change afterwards, unless the scheduler is restarted
+  configure_thread();
+
+  // Number of messages waiting on the input ports, read from the cached receivers
+  uint64_t input_queue_depth = 0;
+  FusedConnection* fused_input = nullptr;
+  for (auto& [_, io_spec] : op_->spec()->inputs()) {
+    if (auto fused_connection = io_spec->fused_connection()) {
+      // A fused operator is ticked with the entity of the first operator of its chain, but only
+      // computes when the previous operator emitted messages in the same entity execution.
+      if (fused_connection->empty()) { return GXF_SUCCESS; }
+      fused_input = fused_connection;
+      input_queue_depth += fused_connection->size();
+      continue;
+    }
+    auto receiver = static_cast<nvidia::gxf::Receiver*>(io_spec->connector_handle());
+    if (receiver != nullptr) { input_queue_depth += receiver->size(); }
+  }
+  if (fused_input == nullptr) { return compute_frame(input_queue_depth); }
+
+  // A fused operator computes once per message the previous operator emitted. Messages the
+  // operator did not receive are left for the next entity execution.
+  for (size_t count = fused_input->size(); count > 0 && !fused_input->empty(); --count) {
+    const gxf_result_t result = compute_frame(fused_input->size());
+    if (result != GXF_SUCCESS) { return result; }
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t GXFWrapper::compute_frame(uint64_t input_queue_depth) {
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+  auto& metrics = op_->metrics();
+  const auto tick_begin = OperatorMetrics::Clock::now();
+  int64_t deadline_ns = 0;
+  if (op_->track_frame_release_) {
+    if (deadline_term_ != nullptr) { deadline_term_->on_started(); }
+    if (!begin_frame(to_ns(tick_begin))) { return GXF_SUCCESS; }
+    deadline_ns = op_->deadline().count();
+  }
   try {
-    op_->compute(*op_input, *op_output, exec_context);
+    op_->compute(*op_input, *op_output, *exec_context_);
+    const auto tick_end = OperatorMetrics::Clock::now();
+    if (metrics.record_tick(tick_begin, tick_end, input_queue_depth)) {
+      HOLOSCAN_LOG_INFO("Operator '{}' metrics - {}", op_->name(), metrics.summary());
+    }
+    if (deadline_ns > 0) {
+      const int64_t lateness_ns = to_ns(tick_end) - (op_->frame_release_ns_ + deadline_ns);
+      if (lateness_ns > 0) { metrics.record_deadline_miss(lateness_ns); }
+    }
   } catch (const std::exception& e) {
     // Note: Rethrowing the exception (using `throw;`) would cause the Python interpreter to exit.
     //       To avoid this, we store the exception and return GXF_FAILURE.
@@ -97,8 +199,10 @@ gxf_result_t GXFWrapper::stop() {
 
   HOLOSCAN_LOG_TRACE("Stopping operator: {}", op_->name());
 
+  const auto stop_begin = OperatorMetrics::Clock::now();
   try {
     op_->stop();
+    op_->metrics().record_stop(stop_begin, OperatorMetrics::Clock::now());
   } catch (const std::exception& e) {
     store_exception();
     HOLOSCAN_LOG_ERROR(
@@ -109,6 +213,92 @@ gxf_result_t GXFWrapper::stop() {
   return GXF_SUCCESS;
 }
 
+void GXFWrapper::configure_thread() {
+  if (pinned_thread_pool_ == nullptr) { return; }
+  const pthread_t thread = pthread_self();
+  if (is_thread_configured_ && pthread_equal(configured_thread_, thread)) { return; }
+  HOLOSCAN_LOG_DEBUG("Configuring the thread of operator '{}' for thread pool '{}'",
+                     op_->name(),
+                     pinned_thread_pool_->name());
+  pinned_thread_pool_->configure_current_thread();
+  configured_thread_ = thread;
+  is_thread_configured_ = true;
+}
+
+bool GXFWrapper::begin_frame(int64_t now_ns) {
+  const int64_t deadline_ns = op_->deadline().count();
+  const bool drop_stale = deadline_ns > 0 && op_->drop_stale_frames();
+  const int64_t stale_before_ns = now_ns - deadline_ns;
+  auto& inputs = op_->spec()->inputs();
+
+  if (inputs.empty()) {
+    // A source releases a frame on every tick. The frame of a periodic source is due one period
+    // after its last tick, so that the time a late tick waited counts towards its deadline.
+    int64_t release_ns = now_ns;
+    const int64_t period_ns = op_->period().count();
+    if (period_ns > 0) {
+      if (last_tick_ns_ != 0 && now_ns - last_tick_ns_ >= period_ns) {
+        release_ns = last_tick_ns_ + period_ns;
+        // Periods missed since the last tick, after the one the frame was due in. If the due
+        // frame is stale, the frames of the missed periods are dropped and the tick computes the
+        // frame of the current period.
+        const int64_t missed_periods = (now_ns - release_ns) / period_ns;
+        if (drop_stale && missed_periods > 0 && release_ns < stale_before_ns) {
+          release_ns += missed_periods * period_ns;
+          op_->metrics().record_dropped_frames(missed_periods);
+        }
+      }
+      last_tick_ns_ = now_ns;
+    }
+    op_->frame_release_ns_ = release_ns;
+    if (drop_stale && release_ns < stale_before_ns) {
+      op_->metrics().record_dropped_frames(1);
+      return false;
+    }
+    return true;
+  }
+
+  // The operator computes the oldest frame of its input messages. If stale frames are dropped and
+  // a port only held stale messages, the frame is incomplete and compute() is skipped.
+  int64_t release_ns = INT64_MAX;
+  uint64_t dropped_count = 0;
+  bool has_emptied_port = false;
+  for (auto& [_, io_spec] : inputs) {
+    if (auto fused_connection = io_spec->fused_connection()) {
+      if (fused_connection->empty()) { continue; }
+      int64_t producer_release_ns = fused_connection->producer()->frame_release_ns();
+      if (producer_release_ns == 0) { producer_release_ns = now_ns; }
+      if (drop_stale && producer_release_ns < stale_before_ns) {
+        dropped_count += fused_connection->size();
+        fused_connection->clear();
+        has_emptied_port = true;
+        continue;
+      }
+      release_ns = std::min(release_ns, producer_release_ns);
+      continue;
+    }
+
+    auto receiver = static_cast<nvidia::gxf::Receiver*>(io_spec->connector_handle());
+    if (receiver == nullptr || receiver->size() == 0) { continue; }
+    if (drop_stale) {
+      while (receiver->size() > 0 && front_release_ns(receiver, now_ns) < stale_before_ns) {
+        receiver->receive();
+        dropped_count++;
+      }
+      if (receiver->size() == 0) {
+        has_emptied_port = true;
+        continue;
+      }
+    }
+    release_ns = std::min(release_ns, front_release_ns(receiver, now_ns));
+  }
+
+  if (dropped_count > 0) { op_->metrics().record_dropped_frames(dropped_count); }
+  if (has_emptied_port) { return false; }
+  op_->frame_release_ns_ = release_ns == INT64_MAX ? now_ns : release_ns;
+  return true;
+}
+
 void GXFWrapper::store_exception() {
   auto stored_exception = std::current_exception();
   if (stored_exception != nullptr) { op_->fragment()->executor().exception(stored_exception); }
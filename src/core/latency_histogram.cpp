@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+size_t LatencyHistogram::bucket_index(uint64_t value) {
+  if (value > kMaxTrackableValue) { value = kMaxTrackableValue; }
+  // Values below 2 * kSubBucketCount are counted exactly.
+  if (value < 2 * kSubBucketCount) { return static_cast<size_t>(value); }
+  // Position of the most significant bit of the value
+  const int msb = 63 - __builtin_clzll(value);
+  // Number of low bits dropped so that (value >> shift) lies in [kSubBucketCount, 2 *
+  // kSubBucketCount)
+  const int shift = msb - kSubBucketBits;
+  return static_cast<size_t>(shift) * kSubBucketCount + static_cast<size_t>(value >> shift);
+}
+
+uint64_t LatencyHistogram::bucket_lower_bound(size_t index) {
+  if (index < 2 * kSubBucketCount) { return index; }
+  const uint64_t shift = index / kSubBucketCount - 1;
+  const uint64_t sub_bucket = index - shift * kSubBucketCount;
+  return sub_bucket << shift;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+  if (index < 2 * kSubBucketCount) { return index; }
+  const uint64_t shift = index / kSubBucketCount - 1;
+  const uint64_t sub_bucket = index - shift * kSubBucketCount;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::reset() {
+  for (auto& count : counts_) { count.store(0, std::memory_order_relaxed); }
+  total_count_.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::value_at_percentile(double percentile) const {
+  // Snapshot the counters so that the total is consistent with the per-bucket counts even if
+  // other threads keep recording.
+  std::vector<uint64_t> snapshot(kNumBuckets);
+  uint64_t total = 0;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    snapshot[i] = counts_[i].load(std::memory_order_relaxed);
+    total += snapshot[i];
+  }
+  if (total == 0) { return -1; }
+
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  const uint64_t target =
+      std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)));
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    cumulative += snapshot[i];
+    if (cumulative >= target) {
+      return (static_cast<double>(bucket_lower_bound(i)) +
+              static_cast<double>(bucket_upper_bound(i))) /
+             2.0;
+    }
+  }
+  return static_cast<double>(bucket_upper_bound(kNumBuckets - 1));
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> LatencyHistogram::buckets() const {
+  std::vector<std::pair<uint64_t, uint64_t>> result;
+  for (size_t i = 0; i < kNumBuckets; i++) {
+    uint64_t count = counts_[i].load(std::memory_order_relaxed);
+    if (count) { result.emplace_back(bucket_upper_bound(i), count); }
+  }
+  return result;
+}
+
+}  // namespace holoscan
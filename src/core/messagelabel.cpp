@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <iterator>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "holoscan/core/messagelabel.hpp"
@@ -42,7 +43,7 @@ int64_t MessageLabel::get_e2e_latency(int index) {
     return -1;
   }
 
-  auto cur_path = message_paths[index];
+  const auto& cur_path = message_paths[index];
 
   return (cur_path.back().pub_timestamp - cur_path.front().rec_timestamp);
 }
@@ -91,17 +92,16 @@ std::vector<std::string> MessageLabel::get_all_path_names() {
 }
 
 void MessageLabel::add_new_op_timestamp(holoscan::OperatorTimestampLabel o_timestamp) {
+  const int64_t op_id = o_timestamp.operator_ptr->id();
   if (message_paths.empty()) {
     // By default, allocate space for DEFAULT_PATH_LENGTH Operators in a path
     TimestampedPath new_path;
     new_path.reserve(DEFAULT_PATH_LENGTH);
 
-    message_paths.push_back(new_path);
+    message_paths.push_back(std::move(new_path));
     message_paths[0].push_back(o_timestamp);
 
-    PathOperators new_path_operators;
-    new_path_operators.insert(o_timestamp.operator_ptr->name());
-    message_path_operators.push_back(new_path_operators);
+    message_path_hashes.push_back(extend_path_hash(kPathHashSeed, op_id));
   } else {
     for (int i = 0; i < num_paths(); i++) {
       // By default, allocate space for DEFAULT_PATH_LENGTH Operators in a path
@@ -109,8 +109,8 @@ void MessageLabel::add_new_op_timestamp(holoscan::OperatorTimestampLabel o_times
         message_paths[i].reserve(DEFAULT_PATH_LENGTH);
       message_paths[i].push_back(o_timestamp);
 
-      // Add the new operator to the set of operators in the path
-      message_path_operators[i].insert(o_timestamp.operator_ptr->name());
+      // Extend the hash of the path with the new operator
+      message_path_hashes[i] = extend_path_hash(message_path_hashes[i], op_id);
     }
   }
 }
@@ -120,19 +120,23 @@ void MessageLabel::update_last_op_publish() {
 }
 
 void MessageLabel::add_new_path(MessageLabel::TimestampedPath path) {
-  message_paths.push_back(path);
-  PathOperators new_path_operators;
-  for (auto& op : path) { new_path_operators.insert(op.operator_ptr->name()); }
-  message_path_operators.push_back(new_path_operators);
+  uint64_t path_hash = kPathHashSeed;
+  for (auto& op : path) { path_hash = extend_path_hash(path_hash, op.operator_ptr->id()); }
+  add_new_path(std::move(path), path_hash);
+}
+
+void MessageLabel::add_new_path(MessageLabel::TimestampedPath path, uint64_t path_hash) {
+  message_paths.push_back(std::move(path));
+  message_path_hashes.push_back(path_hash);
 }
 
 MessageLabel::TimestampedPath MessageLabel::get_path(int index) {
   return message_paths[index];
 }
 
-std::string MessageLabel::get_path_name(int index) {
+std::string MessageLabel::get_path_name(int index) const {
   auto pathstring = fmt::memory_buffer();
-  for (auto oplabel : message_paths[index]) {
+  for (const auto& oplabel : message_paths[index]) {
     if (!oplabel.operator_ptr) {
       HOLOSCAN_LOG_ERROR(
           "MessageLabel::get_path_name - Operator pointer is null. Path until now: {}.",
@@ -162,8 +166,25 @@ std::vector<int> MessageLabel::has_operator(std::string op_name) {
   valid_paths.reserve(DEFAULT_NUM_PATHS);
 
   for (int i = 0; i < num_paths(); i++) {
-    if (message_path_operators[i].find(op_name) != message_path_operators[i].end()) {
-      valid_paths.push_back(i);
+    for (auto& oplabel : message_paths[i]) {
+      if (oplabel.operator_ptr && oplabel.operator_ptr->name() == op_name) {
+        valid_paths.push_back(i);
+        break;
+      }
+    }
+  }
+  return valid_paths;
+}
+
+std::vector<int> MessageLabel::has_operator(const Operator* op) const {
+  std::vector<int> valid_paths;
+
+  for (int i = 0; i < static_cast<int>(message_paths.size()); i++) {
+    for (auto& oplabel : message_paths[i]) {
+      if (oplabel.operator_ptr == op) {
+        valid_paths.push_back(i);
+        break;
+      }
     }
   }
   return valid_paths;
@@ -88,9 +88,11 @@ holoscan::MessageLabel Operator::get_consolidated_input_label() {
 
   if (this->input_message_labels.size()) {
     // Flatten the message_paths in input_message_labels into a single MessageLabel
-    for (auto it : this->input_message_labels) {
-      MessageLabel everyinput = it.second;
-      for (auto p : everyinput.paths()) { m.add_new_path(p); }
+    for (const auto& [input_name, everyinput] : this->input_message_labels) {
+      const auto& paths = everyinput.paths();
+      for (int i = 0; i < static_cast<int>(paths.size()); i++) {
+        m.add_new_path(paths[i], everyinput.get_path_hash(i));
+      }
     }
   } else {  // Root operator
     if (!this->is_root() && !this->is_user_defined_root()) {
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/operator_metrics.hpp"
+
+#include <fmt/format.h>
+
+#include <string>
+
+namespace holoscan {
+
+namespace {
+
+constexpr double kNsPerMs = 1e6;
+
+}  // namespace
+
+void OperatorMetrics::record_start(Clock::time_point begin, Clock::time_point end) {
+  start_ns_.store(to_ns(end) - to_ns(begin), std::memory_order_relaxed);
+}
+
+void OperatorMetrics::record_stop(Clock::time_point begin, Clock::time_point end) {
+  stop_ns_.store(to_ns(end) - to_ns(begin), std::memory_order_relaxed);
+}
+
+void OperatorMetrics::log_period(int64_t period_ms) {
+  log_period_ns_ = period_ms > 0 ? period_ms * 1000000 : 0;
+  next_log_ns_ = to_ns(Clock::now()) + log_period_ns_;
+}
+
+void OperatorMetrics::reset() {
+  tick_count_.store(0, std::memory_order_relaxed);
+  last_tick_ns_.store(0, std::memory_order_relaxed);
+  compute_sum_ns_.store(0, std::memory_order_relaxed);
+  compute_max_ns_.store(0, std::memory_order_relaxed);
+  interval_sum_ns_.store(0, std::memory_order_relaxed);
+  interval_max_ns_.store(0, std::memory_order_relaxed);
+  queue_depth_sum_.store(0, std::memory_order_relaxed);
+  queue_depth_max_.store(0, std::memory_order_relaxed);
+  start_ns_.store(0, std::memory_order_relaxed);
+  stop_ns_.store(0, std::memory_order_relaxed);
+  deadline_miss_count_.store(0, std::memory_order_relaxed);
+  max_lateness_ns_.store(0, std::memory_order_relaxed);
+  dropped_frame_count_.store(0, std::memory_order_relaxed);
+  compute_histogram_.reset();
+}
+
+OperatorStatistics OperatorMetrics::statistics() const {
+  OperatorStatistics stats;
+  stats.tick_count = tick_count_.load(std::memory_order_relaxed);
+  stats.start_time_ms = start_ns_.load(std::memory_order_relaxed) / kNsPerMs;
+  stats.stop_time_ms = stop_ns_.load(std::memory_order_relaxed) / kNsPerMs;
+  stats.deadline_miss_count = deadline_miss_count_.load(std::memory_order_relaxed);
+  stats.max_lateness_ms = max_lateness_ns_.load(std::memory_order_relaxed) / kNsPerMs;
+  stats.dropped_frame_count = dropped_frame_count_.load(std::memory_order_relaxed);
+  if (stats.tick_count == 0) { return stats; }
+
+  const auto ticks = static_cast<double>(stats.tick_count);
+  stats.compute_time_mean_ms = compute_sum_ns_.load(std::memory_order_relaxed) / kNsPerMs / ticks;
+  stats.compute_time_max_ms = compute_max_ns_.load(std::memory_order_relaxed) / kNsPerMs;
+  // The histogram counts microseconds
+  stats.compute_time_p50_ms = compute_histogram_.value_at_percentile(50.0) / 1000.0;
+  stats.compute_time_p99_ms = compute_histogram_.value_at_percentile(99.0) / 1000.0;
+  stats.compute_time_histogram = compute_histogram_.buckets();
+  if (stats.tick_count > 1) {
+    stats.interval_mean_ms =
+        interval_sum_ns_.load(std::memory_order_relaxed) / kNsPerMs / (ticks - 1.0);
+    stats.interval_max_ms = interval_max_ns_.load(std::memory_order_relaxed) / kNsPerMs;
+  }
+  stats.input_queue_depth_mean =
+      static_cast<double>(queue_depth_sum_.load(std::memory_order_relaxed)) / ticks;
+  stats.input_queue_depth_max = queue_depth_max_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+std::string OperatorMetrics::summary() const {
+  const auto stats = statistics();
+  std::string summary = fmt::format(
+      "ticks: {}, compute mean {:.3f} ms, p50 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms, interval "
+      "mean {:.3f} ms, max {:.3f} ms, input queue depth mean {:.2f}, max {}",
+      stats.tick_count,
+      stats.compute_time_mean_ms,
+      stats.compute_time_p50_ms,
+      stats.compute_time_p99_ms,
+      stats.compute_time_max_ms,
+      stats.interval_mean_ms,
+      stats.interval_max_ms,
+      stats.input_queue_depth_mean,
+      stats.input_queue_depth_max);
+  if (stats.deadline_miss_count > 0 || stats.dropped_frame_count > 0) {
+    summary += fmt::format(", deadline misses {} (max lateness {:.3f} ms), dropped frames {}",
+                           stats.deadline_miss_count,
+                           stats.max_lateness_ms,
+                           stats.dropped_frame_count);
+  }
+  return summary;
+}
+
+}  // namespace holoscan
@@ -25,6 +25,8 @@
 
 #include <gxf/std/double_buffer_receiver.hpp>
 
+#include <utility>
+
 namespace holoscan {
 
 gxf_result_t AnnotatedDoubleBufferReceiver::receive_abi(gxf_uid_t* uid) {
@@ -46,10 +48,10 @@ gxf_result_t AnnotatedDoubleBufferReceiver::receive_abi(gxf_uid_t* uid) {
       // Create a new operator timestamp with only receive timestamp
       OperatorTimestampLabel cur_op_timestamp(op());
       // Find whether current operator is already in the paths of message label m
-      auto cyclic_path_indices = m.has_operator(op()->name());
+      auto cyclic_path_indices = m.has_operator(op());
       if (cyclic_path_indices.empty()) {  // No cyclic paths
         m.add_new_op_timestamp(cur_op_timestamp);
-        op()->update_input_message_label(name(), m);
+        op()->update_input_message_label(name(), std::move(m));
       } else {
         // Update the publish timestamp of current operator where the cycle ends, to be the same as
         // the receive timestamp. For cycles, we don't want to include the last operator's
@@ -66,21 +68,21 @@ gxf_result_t AnnotatedDoubleBufferReceiver::receive_abi(gxf_uid_t* uid) {
           if (cycle_index < (int)cyclic_path_indices.size() &&
               i == cyclic_path_indices[cycle_index]) {
             // Update flow tracker here for cyclic paths
-            op()->fragment()->data_flow_tracker()->update_latency(m.get_path_name(i),
-                                                                  m.get_e2e_latency_ms(i));
+            op()->fragment()->data_flow_tracker()->update_latency(m, i, m.get_e2e_latency_ms(i));
             op()->fragment()->data_flow_tracker()->write_to_logfile(
                 MessageLabel::to_string(m.get_path(i)));
+            op()->fragment()->data_flow_tracker()->write_to_trace(m, i);
             cycle_index++;
           } else {
             // For non-cyclic paths, prepare the label_wo_cycles to propagate to the next operator
-            label_wo_cycles.add_new_path(m.get_path(i));
+            label_wo_cycles.add_new_path(m.get_path(i), m.get_path_hash(i));
           }
         }
         if (!label_wo_cycles.num_paths()) {
           // Since there are no paths in label_wo_cycles, add the current operator in a new path
           label_wo_cycles.add_new_op_timestamp(cur_op_timestamp);
         }
-        op()->update_input_message_label(name(), label_wo_cycles);
+        op()->update_input_message_label(name(), std::move(label_wo_cycles));
       }
     }
   } else {
@@ -17,6 +17,9 @@
 
 #include "holoscan/core/resources/gxf/annotated_double_buffer_transmitter.hpp"
 #include <gxf/core/gxf.h>
+
+#include <utility>
+
 #include "holoscan/core/message.hpp"
 #include "holoscan/core/messagelabel.hpp"
 #include "holoscan/core/operator.hpp"
@@ -24,29 +27,36 @@
 
 namespace holoscan {
 
+gxf_result_t AnnotatedDoubleBufferTransmitter::add_message_label(gxf_context_t context,
+                                                                 gxf_uid_t uid,
+                                                                 holoscan::Operator* op) {
+  auto gxf_entity = nvidia::gxf::Entity::Shared(context, uid);
+  gxf_entity->deactivate();  // GXF Entity might be activated by the caller; so deactivate it to
+                             // add MessageLabel
+  auto buffer = gxf_entity.value().add<MessageLabel>("message_label");
+
+  // We do not activate the GXF Entity because these message entities are not supposed to be
+  // activated by default.
+
+  if (!buffer) {
+    // Fail early if we cannot add the MessageLabel
+    HOLOSCAN_LOG_ERROR(GxfResultStr(buffer.error()));
+    return buffer.error();
+  }
+
+  MessageLabel m = op->get_consolidated_input_label();
+  m.update_last_op_publish();
+  *buffer.value() = std::move(m);
+  return GXF_SUCCESS;
+}
+
 gxf_result_t AnnotatedDoubleBufferTransmitter::publish_abi(gxf_uid_t uid) {
   if (!this->op()) {
     HOLOSCAN_LOG_ERROR("Operator is nullptr.");
     return GXF_FAILURE;
   } else {
-    auto gxf_entity = nvidia::gxf::Entity::Shared(context(), uid);
-    gxf_entity->deactivate();  // GXF Entity might be activated by the caller; so deactivate it to
-                               // add MessageLabel
-    auto buffer = gxf_entity.value().add<MessageLabel>("message_label");
-
-    // We do not activate the GXF Entity because these message entities are not supposed to be
-    // activated by default.
-
-    if (!buffer) {
-      // Fail early if we cannot add the MessageLabel
-      HOLOSCAN_LOG_ERROR(GxfResultStr(buffer.error()));
-      return buffer.error();
-    }
-
-    MessageLabel m;
-    m = op()->get_consolidated_input_label();
-    m.update_last_op_publish();
-    *buffer.value() = m;
+    gxf_result_t label_code = add_message_label(context(), uid, op());
+    if (label_code != GXF_SUCCESS) { return label_code; }
   }
 
   // Call the Base class' publish_abi now
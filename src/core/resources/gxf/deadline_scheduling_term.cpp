@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/deadline_scheduling_term.hpp"
+
+#include <gxf/core/registrar.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+namespace {
+
+int64_t steady_clock_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+DeadlineArbiter::DeadlineArbiter(int64_t worker_count)
+    : worker_count_(std::max<int64_t>(worker_count, 1)) {}
+
+size_t DeadlineArbiter::add_entity(gxf_uid_t eid) {
+  std::scoped_lock lock{mutex_};
+  entries_.push_back(Entry{eid});
+  return entries_.size() - 1;
+}
+
+bool DeadlineArbiter::try_dispatch(size_t slot, int64_t now_ns, int64_t deadline_ns,
+                                   int64_t* wait_until_ns) {
+  std::scoped_lock lock{mutex_};
+  auto& entry = entries_[slot];
+  if (entry.state == State::kRunning) { return true; }
+  if (entry.state == State::kIdle || entry.deadline_ns != deadline_ns) {
+    // A new frame is pending
+    entry.since_ns = now_ns;
+  }
+  entry.state = State::kPending;
+  entry.deadline_ns = deadline_ns;
+
+  int64_t busy = 0;
+  int64_t earlier = 0;
+  int64_t wait_until = now_ns + kMaxHoldNs;
+  for (size_t index = 0; index < entries_.size(); ++index) {
+    if (index == slot) { continue; }
+    const auto& other = entries_[index];
+    switch (other.state) {
+      case State::kRunning:
+        busy++;
+        break;
+      case State::kDispatched:
+        if (now_ns - other.since_ns < kMaxHoldNs) {
+          busy++;
+          wait_until = std::min(wait_until, other.since_ns + kMaxHoldNs);
+        }
+        break;
+      case State::kPending: {
+        if (other.deadline_ns >= deadline_ns) { break; }
+        const int64_t hold_until = std::max(other.deadline_ns, other.since_ns + kMaxHoldNs);
+        if (now_ns < hold_until) {
+          earlier++;
+          wait_until = std::min(wait_until, hold_until);
+        }
+        break;
+      }
+      case State::kIdle:
+        break;
+    }
+  }
+
+  if (busy + earlier < worker_count_) {
+    entry.state = State::kDispatched;
+    entry.since_ns = now_ns;
+    return true;
+  }
+  *wait_until_ns = wait_until;
+  return false;
+}
+
+void DeadlineArbiter::set_idle(size_t slot) {
+  std::scoped_lock lock{mutex_};
+  auto& entry = entries_[slot];
+  if (entry.state == State::kRunning) { return; }
+  entry.state = State::kIdle;
+  entry.deadline_ns = kNoDeadline;
+}
+
+void DeadlineArbiter::on_started(size_t slot) {
+  std::scoped_lock lock{mutex_};
+  entries_[slot].state = State::kRunning;
+}
+
+std::vector<gxf_uid_t> DeadlineArbiter::on_executed(size_t slot) {
+  std::vector<gxf_uid_t> held_eids;
+  std::scoped_lock lock{mutex_};
+  auto& entry = entries_[slot];
+  entry.state = State::kIdle;
+  entry.deadline_ns = kNoDeadline;
+  for (const auto& other : entries_) {
+    if (other.state == State::kPending) { held_eids.push_back(other.eid); }
+  }
+  return held_eids;
+}
+
+gxf_result_t DeadlineSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  (void)registrar;
+  return GXF_SUCCESS;
+}
+
+void DeadlineSchedulingTerm::configure(std::shared_ptr<DeadlineArbiter> arbiter,
+                                       std::vector<nvidia::gxf::Receiver*> receivers,
+                                       int64_t relative_deadline_ns) {
+  arbiter_ = std::move(arbiter);
+  slot_ = arbiter_->add_entity(eid());
+  receivers_ = std::move(receivers);
+  relative_deadline_ns_ = relative_deadline_ns;
+}
+
+void DeadlineSchedulingTerm::on_started() {
+  if (arbiter_) { arbiter_->on_started(slot_); }
+}
+
+gxf_result_t DeadlineSchedulingTerm::check_abi(int64_t timestamp,
+                                               nvidia::gxf::SchedulingConditionType* type,
+                                               int64_t* target_timestamp) const {
+  *type = nvidia::gxf::SchedulingConditionType::READY;
+  *target_timestamp = timestamp;
+  if (!arbiter_ || receivers_.empty()) { return GXF_SUCCESS; }
+
+  // The other scheduling terms decide whether the entity is ready when it has no pending frame
+  for (auto* receiver : receivers_) {
+    if (receiver->size() + receiver->back_size() == 0) {
+      arbiter_->set_idle(slot_);
+      return GXF_SUCCESS;
+    }
+  }
+
+  const int64_t now_ns = steady_clock_ns();
+  int64_t deadline_ns = DeadlineArbiter::kNoDeadline;
+  if (relative_deadline_ns_ > 0) {
+    // Messages still in the back stage of a receiver are not visible yet; their frame was
+    // released before now.
+    int64_t release_ns = now_ns;
+    for (auto* receiver : receivers_) {
+      if (receiver->size() == 0) { continue; }
+      auto message = receiver->peek(0);
+      if (!message) { continue; }
+      auto frame_release = message.value().get<FrameRelease>();
+      if (frame_release) { release_ns = std::min(release_ns, frame_release.value()->time_ns); }
+    }
+    deadline_ns = release_ns + relative_deadline_ns_;
+  }
+
+  int64_t wait_until_ns = 0;
+  if (!arbiter_->try_dispatch(slot_, now_ns, deadline_ns, &wait_until_ns)) {
+    // Checked again when another entity finishes executing, or at the latest once the entities
+    // holding this one back stop doing so
+    *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = timestamp + std::max<int64_t>(wait_until_ns - now_ns, 0);
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t DeadlineSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  if (!arbiter_) { return GXF_SUCCESS; }
+  for (gxf_uid_t held_eid : arbiter_->on_executed(slot_)) {
+    GxfEntityNotifyEventType(context(), held_eid, GXF_EVENT_MESSAGE_SYNC);
+  }
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -35,39 +35,43 @@ gxf_result_t DFFTCollector::on_execute_abi(gxf_uid_t eid, uint64_t timestamp, gx
   (void)timestamp;
   (void)code;
 
-  auto codelet = entity->get<nvidia::gxf::Codelet>();
-
-  int64_t codelet_id = -1;
-
-  if (codelet.value()) { codelet_id = codelet.value()->cid(); }
-
-  if (codelet_id < 0) {
-    HOLOSCAN_LOG_ERROR("codelet_id is less than 0 in DFFTCollector.");
-    return GXF_FAILURE;
-  }
+  // The entity of a fused operator chain holds one codelet per operator
+  auto codelets = entity->findAll<nvidia::gxf::Codelet>();
+  if (!codelets) { return ToResultCode(codelets); }
+
+  for (auto& maybe_codelet : codelets.value()) {
+    if (!maybe_codelet) { continue; }
+    auto codelet = maybe_codelet.value();
+    int64_t codelet_id = codelet->cid();
+
+    if (codelet_id < 0) {
+      HOLOSCAN_LOG_ERROR("codelet_id is less than 0 in DFFTCollector.");
+      return GXF_FAILURE;
+    }
 
-  // Sometimes, Entity Monitor is called in GXF without tick, start or stop but just to check
-  // scheduling condition and abort doing anything. getExecutionCount() is tested to check whether a
-  // tick really happened for a leaf operator
-  if (leaf_ops_.find(codelet_id) != leaf_ops_.end() &&
-      codelet.value()->getExecutionCount() > leaf_last_execution_count_[codelet_id]) {
-    leaf_last_execution_count_[codelet_id] = codelet.value()->getExecutionCount();
-    MessageLabel m = leaf_ops_[codelet_id]->get_consolidated_input_label();
-    leaf_ops_[codelet_id]->reset_input_message_labels();
-
-    if (m.num_paths()) {
-      auto all_path_names = m.get_all_path_names();
-      m.update_last_op_publish();
-      for (int i = 0; i < m.num_paths(); i++) {
-        data_flow_tracker_->update_latency(all_path_names[i], m.get_e2e_latency_ms(i));
+    // Sometimes, Entity Monitor is called in GXF without tick, start or stop but just to check
+    // scheduling condition and abort doing anything. getExecutionCount() is tested to check
+    // whether a tick really happened for a leaf operator
+    if (leaf_ops_.find(codelet_id) != leaf_ops_.end() &&
+        codelet->getExecutionCount() > leaf_last_execution_count_[codelet_id]) {
+      leaf_last_execution_count_[codelet_id] = codelet->getExecutionCount();
+      MessageLabel m = leaf_ops_[codelet_id]->get_consolidated_input_label();
+      leaf_ops_[codelet_id]->reset_input_message_labels();
+
+      if (m.num_paths()) {
+        m.update_last_op_publish();
+        for (int i = 0; i < m.num_paths(); i++) {
+          data_flow_tracker_->update_latency(m, i, m.get_e2e_latency_ms(i));
+        }
+        data_flow_tracker_->write_to_logfile(m.to_string());
+        data_flow_tracker_->write_to_trace(m);
       }
-      data_flow_tracker_->write_to_logfile(m.to_string());
-    }
 
-  } else if (root_ops_.find(codelet_id) != root_ops_.end()) {
-    holoscan::Operator* cur_op = root_ops_[codelet_id];
-    for (auto it : cur_op->num_published_messages_map()) {
-      data_flow_tracker_->update_source_messages_number(it.first, it.second);
+    } else if (root_ops_.find(codelet_id) != root_ops_.end()) {
+      holoscan::Operator* cur_op = root_ops_[codelet_id];
+      for (auto it : cur_op->num_published_messages_map()) {
+        data_flow_tracker_->update_source_messages_number(it.first, it.second);
+      }
     }
   }
   return GXF_SUCCESS;
@@ -53,7 +53,9 @@ nvidia::gxf::DoubleBufferTransmitter* DoubleBufferTransmitter::get() const {
 }
 
 const char* DoubleBufferTransmitter::gxf_typename() const {
-  if (tracking_) {
+  if (fan_out_) {
+    return "holoscan::FanOutDoubleBufferTransmitter";
+  } else if (tracking_) {
     return "holoscan::AnnotatedDoubleBufferTransmitter";
   } else {
     return "nvidia::gxf::DoubleBufferTransmitter";
@@ -69,4 +71,8 @@ void DoubleBufferTransmitter::track() {
   tracking_ = true;
 }
 
+void DoubleBufferTransmitter::fan_out() {
+  fan_out_ = true;
+}
+
 }  // namespace holoscan
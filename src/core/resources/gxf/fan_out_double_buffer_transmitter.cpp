@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/fan_out_double_buffer_transmitter.hpp"
+#include <gxf/core/gxf.h>
+#include <gxf/core/registrar.hpp>
+
+#include <algorithm>
+
+#include "holoscan/core/operator.hpp"
+#include "holoscan/core/resources/gxf/annotated_double_buffer_transmitter.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t FanOutDoubleBufferTransmitter::publish_abi(gxf_uid_t uid) {
+  if (op()) {
+    gxf_result_t label_code =
+        AnnotatedDoubleBufferTransmitter::add_message_label(context(), uid, op());
+    if (label_code != GXF_SUCCESS) { return label_code; }
+  }
+
+  gxf_result_t code = GXF_SUCCESS;
+  if (receivers_.empty()) {
+    // Not fanned out: the connection router forwards the message from our own queue
+    code = nvidia::gxf::DoubleBufferTransmitter::publish_abi(uid);
+  } else {
+    for (auto* receiver : receivers_) {
+      // The receiver applies its own capacity and policy (pop, reject or fault) when it is full
+      gxf_result_t push_code = receiver->push_abi(uid);
+      if (push_code != GXF_SUCCESS) {
+        HOLOSCAN_LOG_ERROR("Failed to publish message from '{}' to '{}': {}",
+                           name(),
+                           receiver->name(),
+                           GxfResultStr(push_code));
+        code = push_code;
+        continue;
+      }
+      GxfEntityNotifyEventType(context(), receiver->eid(), GXF_EVENT_MESSAGE_SYNC);
+    }
+  }
+
+  if (op() && (op()->is_root() || op()->is_user_defined_root())) {
+    if (!op_transmitter_name_pair_.size())
+      op_transmitter_name_pair_ = fmt::format("{}->{}", op()->name(), name());
+    op()->update_published_messages(op_transmitter_name_pair_);
+  }
+
+  return code;
+}
+
+void FanOutDoubleBufferTransmitter::add_receiver(nvidia::gxf::Receiver* receiver) {
+  if (receiver == nullptr ||
+      std::find(receivers_.begin(), receivers_.end(), receiver) != receivers_.end()) {
+    return;
+  }
+  receivers_.push_back(receiver);
+}
+
+bool FanOutDoubleBufferTransmitter::is_receptive(uint64_t min_size) {
+  if (receivers_.empty()) { return capacity() - size() - back_size() >= min_size; }
+  return std::all_of(receivers_.begin(), receivers_.end(), [min_size](auto* receiver) {
+    return receiver->capacity() - receiver->size() - receiver->back_size() >= min_size;
+  });
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(min_size_,
+                                 "min_size",
+                                 "Minimum size",
+                                 "The minimum number of free slots in every downstream receiver "
+                                 "to permit execution.",
+                                 1UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::check_abi(int64_t timestamp,
+                                                      nvidia::gxf::SchedulingConditionType* type,
+                                                      int64_t* target_timestamp) const {
+  if (transmitter_ == nullptr || transmitter_->is_receptive(min_size_.get())) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+  } else {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT;
+  }
+  *target_timestamp = timestamp;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::onExecute_abi(int64_t dt) {
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
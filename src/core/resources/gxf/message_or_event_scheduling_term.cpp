@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/message_or_event_scheduling_term.hpp"
+
+#include <gxf/core/registrar.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+gxf_result_t MessageOrEventSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  (void)registrar;
+  return GXF_SUCCESS;
+}
+
+void MessageOrEventSchedulingTerm::receivers(std::vector<nvidia::gxf::Receiver*> receivers) {
+  receivers_ = std::move(receivers);
+}
+
+bool MessageOrEventSchedulingTerm::has_messages() const {
+  if (receivers_.empty()) { return false; }
+  return std::all_of(receivers_.begin(), receivers_.end(), [](auto* receiver) {
+    return receiver->size() + receiver->back_size() > 0;
+  });
+}
+
+void MessageOrEventSchedulingTerm::expect_event(int64_t event_time_ns) {
+  event_time_ns_.store(event_time_ns, std::memory_order_release);
+}
+
+void MessageOrEventSchedulingTerm::notify() {
+  event_signaled_.store(true, std::memory_order_release);
+  GxfEntityNotifyEventType(context(), eid(), GXF_EVENT_MESSAGE_SYNC);
+}
+
+bool MessageOrEventSchedulingTerm::consume_event() {
+  return event_signaled_.exchange(false, std::memory_order_acq_rel);
+}
+
+gxf_result_t MessageOrEventSchedulingTerm::check_abi(int64_t timestamp,
+                                                     nvidia::gxf::SchedulingConditionType* type,
+                                                     int64_t* target_timestamp) const {
+  *target_timestamp = timestamp;
+  if (event_signaled_.load(std::memory_order_acquire) || has_messages()) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    return GXF_SUCCESS;
+  }
+
+  const int64_t event_time_ns = event_time_ns_.load(std::memory_order_acquire);
+  if (event_time_ns == 0) {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT;
+    return GXF_SUCCESS;
+  }
+
+  // Checked again at the expected time of the event if notify() is not handled by the scheduler,
+  // and periodically once it passed until the event is signaled
+  const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+  *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+  *target_timestamp = timestamp + std::max(event_time_ns - now_ns, kRecheckPeriodNs);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t MessageOrEventSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/thread_pool.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/operator.hpp"
+#include "holoscan/core/system/cpu_resource_monitor.hpp"
+#include "holoscan/core/system/topology.hpp"
+
+namespace holoscan {
+
+namespace {
+constexpr int64_t kDefaultInitialSize = 1;
+
+/// Parameters applied by Holoscan rather than by nvidia::gxf::ThreadPool
+const std::unordered_set<std::string> kHoloscanParameters{
+    "cpu_cores", "numa_node", "sched_priority", "operators", "pin_operators"};
+}  // namespace
+
+void ThreadPool::setup(ComponentSpec& spec) {
+  spec.param(initial_size_,
+             "initial_size",
+             "Initial size",
+             "The number of threads of the pool. The pool needs at least one thread per pinned "
+             "operator.",
+             kDefaultInitialSize);
+  spec.param(cpu_cores_,
+             "cpu_cores",
+             "CPU cores",
+             "The CPU cores (as numbered by the OS) that the threads of pinned operators may run on.",
+             ParameterFlag::kOptional);
+  spec.param(numa_node_,
+             "numa_node",
+             "NUMA node",
+             "The NUMA node whose CPUs the threads of pinned operators may run on. Ignored if "
+             "cpu_cores is set.",
+             ParameterFlag::kOptional);
+  spec.param(sched_priority_,
+             "sched_priority",
+             "SCHED_FIFO priority",
+             "If positive, the threads of pinned operators run with the SCHED_FIFO policy and this "
+             "priority (1-99).",
+             0);
+  spec.param(operator_names_,
+             "operators",
+             "Operators",
+             "The names of operators to add to the pool.",
+             ParameterFlag::kOptional);
+  spec.param(pin_operators_,
+             "pin_operators",
+             "Pin operators",
+             "Whether the operators of the operators parameter are pinned to a thread of the pool.",
+             true);
+}
+
+bool ThreadPool::is_gxf_parameter(const std::string& key) const {
+  return kHoloscanParameters.find(key) == kHoloscanParameters.end();
+}
+
+nvidia::gxf::ThreadPool* ThreadPool::get() const {
+  return static_cast<nvidia::gxf::ThreadPool*>(gxf_cptr_);
+}
+
+int64_t ThreadPool::initial_size() {
+  return initial_size_.has_value() ? initial_size_.get() : kDefaultInitialSize;
+}
+
+void ThreadPool::add(const std::shared_ptr<Operator>& op, bool pin_operator) {
+  if (!op) { throw std::invalid_argument(fmt::format("Thread pool '{}': null operator", name())); }
+  if (std::find(operators_.begin(), operators_.end(), op) == operators_.end()) {
+    operators_.push_back(op);
+  }
+  if (pin_operator) {
+    pinned_operators_.insert(op.get());
+  } else {
+    pinned_operators_.erase(op.get());
+  }
+}
+
+void ThreadPool::add(const std::vector<std::shared_ptr<Operator>>& ops, bool pin_operator) {
+  for (const auto& op : ops) { add(op, pin_operator); }
+}
+
+void ThreadPool::initialize() {
+  if (is_initialized_) {
+    HOLOSCAN_LOG_DEBUG("ThreadPool '{}' is already initialized. Skipping...", name());
+    return;
+  }
+  GXFResource::initialize();
+  resolve_holoscan_parameters();
+}
+
+void ThreadPool::resolve_holoscan_parameters() {
+  CPU_ZERO(&cpu_set_);
+  if (cpu_cores_.has_value() && !cpu_cores_.get().empty()) {
+    for (int32_t core : cpu_cores_.get()) {
+      if (core < 0 || core >= CPU_SETSIZE) {
+        throw std::runtime_error(
+            fmt::format("Thread pool '{}': invalid CPU core index {}", name(), core));
+      }
+      CPU_SET(core, &cpu_set_);
+    }
+  } else if (numa_node_.has_value() && numa_node_.get() >= 0) {
+    Topology topology;
+    topology.load();
+    CPUResourceMonitor cpu_resource_monitor(topology.context());
+    const int32_t numa_node = numa_node_.get();
+    const int32_t num_numa_nodes = cpu_resource_monitor.num_numa_nodes();
+    if (numa_node >= num_numa_nodes) {
+      throw std::runtime_error(
+          fmt::format("Thread pool '{}': NUMA node {} does not exist (the system has {} NUMA "
+                      "node(s))",
+                      name(),
+                      numa_node,
+                      num_numa_nodes));
+    }
+    cpu_set_ = cpu_resource_monitor.numa_node_cpu_set(numa_node);
+  }
+
+  if (has_cpu_affinity()) {
+    // Only keep the CPUs this process is allowed to run on
+    cpu_set_t available_cpu_set;
+    if (sched_getaffinity(0, sizeof(available_cpu_set), &available_cpu_set) == 0) {
+      CPU_AND(&cpu_set_, &cpu_set_, &available_cpu_set);
+    }
+    if (!has_cpu_affinity()) {
+      throw std::runtime_error(fmt::format(
+          "Thread pool '{}': none of the requested CPUs is available to the process", name()));
+    }
+  }
+
+  sched_priority_value_ = sched_priority_.has_value() ? sched_priority_.get() : 0;
+  if (sched_priority_value_ > 0) {
+    const int min_priority = sched_get_priority_min(SCHED_FIFO);
+    const int max_priority = sched_get_priority_max(SCHED_FIFO);
+    if (sched_priority_value_ < min_priority || sched_priority_value_ > max_priority) {
+      throw std::runtime_error(
+          fmt::format("Thread pool '{}': SCHED_FIFO priority {} is out of range [{}, {}]",
+                      name(),
+                      sched_priority_value_,
+                      min_priority,
+                      max_priority));
+    }
+  }
+
+  // Add the operators assigned by name
+  if (operator_names_.has_value()) {
+    const bool pin = pin_operators_.has_value() ? pin_operators_.get() : true;
+    auto& graph = fragment()->graph();
+    for (const auto& op_name : operator_names_.get()) {
+      auto op = graph.find_node(op_name);
+      if (!op) {
+        throw std::runtime_error(
+            fmt::format("Thread pool '{}': operator '{}' not found", name(), op_name));
+      }
+      add(op, pin);
+    }
+  }
+}
+
+bool ThreadPool::configure_current_thread() const {
+  bool success = true;
+  const pthread_t thread = pthread_self();
+  if (has_cpu_affinity()) {
+    int result = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpu_set_);
+    if (result != 0) {
+      HOLOSCAN_LOG_ERROR("Thread pool '{}': failed to set the CPU affinity of the thread: {}",
+                         name(),
+                         std::strerror(result));
+      success = false;
+    }
+  }
+  if (sched_priority_value_ > 0) {
+    sched_param param{};
+    param.sched_priority = sched_priority_value_;
+    int result = pthread_setschedparam(thread, SCHED_FIFO, &param);
+    if (result != 0) {
+      HOLOSCAN_LOG_ERROR(
+          "Thread pool '{}': failed to set the SCHED_FIFO policy (priority {}) of the thread: {}",
+          name(),
+          sched_priority_value_,
+          std::strerror(result));
+      success = false;
+    }
+  }
+  return success;
+}
+
+}  // namespace holoscan
@@ -17,6 +17,7 @@
 
 #include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "holoscan/core/component_spec.hpp"
@@ -55,12 +56,43 @@ void EventBasedScheduler::setup(ComponentSpec& spec) {
              "negative value means not stop on deadlock. This parameter only applies when  "
              "stop_on_deadlock=true",
              0L);
+  spec.param(thread_pool_allocation_auto_,
+             "thread_pool_allocation_auto",
+             "Automatic Pool Allocation",
+             "If enabled, only one thread pool will be created. If disabled, user should enumerate "
+             "pools and priorities",
+             true);
+  spec.param(strict_job_thread_pinning_,
+             "strict_job_thread_pinning",
+             "Strict Job-Thread Pinning",
+             "If enabled, the thread an operator is pinned to (see ThreadPool) does not run any "
+             "other operator. If disabled, another operator can run on the thread while the pinned "
+             "operator is not ready to execute. If not set, it is enabled when a thread pool runs "
+             "its pinned operators with a sched_priority.",
+             false);
 }
 
 nvidia::gxf::EventBasedScheduler* EventBasedScheduler::get() const {
   return static_cast<nvidia::gxf::EventBasedScheduler*>(gxf_cptr_);
 }
 
+bool EventBasedScheduler::enable_strict_job_thread_pinning() {
+  if (strict_job_thread_pinning_.has_value() && strict_job_thread_pinning_.get()) { return true; }
+  auto has_arg = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+    return (arg.name() == "strict_job_thread_pinning");
+  });
+  if (has_arg != args().end()) { return false; }
+
+  strict_job_thread_pinning_ = true;
+  if (gxf_cid_ != 0) {
+    HOLOSCAN_GXF_CALL_WARN_MSG(
+        GxfParameterSetBool(gxf_context_, gxf_cid_, "strict_job_thread_pinning", true),
+        "scheduler '{}':: failed to set GXF parameter 'strict_job_thread_pinning'",
+        name());
+  }
+  return true;
+}
+
 void EventBasedScheduler::initialize() {
   // Set up prerequisite parameters before calling Scheduler::initialize()
   auto frag = fragment();
@@ -220,4 +220,31 @@ cpu_set_t CPUResourceMonitor::cpu_set() const {
   return cpu_set_;
 }
 
+int32_t CPUResourceMonitor::num_numa_nodes() const {
+  int32_t count =
+      hwloc_get_nbobjs_by_type(static_cast<hwloc_topology_t>(context_), HWLOC_OBJ_NUMANODE);
+  // hwloc always exposes at least one NUMA node, but be conservative for unloaded topologies
+  return count > 0 ? count : 1;
+}
+
+cpu_set_t CPUResourceMonitor::numa_node_cpu_set(int32_t numa_node) const {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  hwloc_obj_t node = hwloc_get_obj_by_type(topology, HWLOC_OBJ_NUMANODE, numa_node);
+  if (node == nullptr || node->cpuset == nullptr) {
+    HOLOSCAN_LOG_ERROR("NUMA node {} not found", numa_node);
+    return cpu_set;
+  }
+
+  // The bits of hwloc cpusets are the OS indices of the processing units
+  unsigned int index;
+  hwloc_bitmap_foreach_begin(index, node->cpuset) {
+    if (index < CPU_SETSIZE) { CPU_SET(index, &cpu_set); }
+  }
+  hwloc_bitmap_foreach_end();
+  return cpu_set;
+}
+
 }  // namespace holoscan
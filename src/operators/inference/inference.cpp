@@ -17,15 +17,23 @@
 
 #include "holoscan/operators/inference/inference.hpp"
 
+#include <algorithm>
+#include <any>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/fragment.hpp"
 #include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/core/operator_spec.hpp"
 #include "holoscan/core/resources/gxf/allocator.hpp"
+#include "holoscan/core/resources/gxf/message_or_event_scheduling_term.hpp"
+#include "holoscan/core/resources/gxf/receiver.hpp"
 #include "holoscan/utils/holoinfer_utils.hpp"
 
 /**
@@ -156,6 +164,56 @@ void InferenceOp::setup(OperatorSpec& spec) {
   spec.param(transmit_on_cuda_, "transmit_on_cuda", "Transmit message on CUDA", "", true);
 
   spec.param(parallel_inference_, "parallel_inference", "Parallel inference", "", true);
+  spec.param(intra_op_num_threads_,
+             "intra_op_num_threads",
+             "Intra-op threads",
+             "Number of threads used within nodes (onnxrt only).",
+             1);
+  spec.param(inter_op_num_threads_,
+             "inter_op_num_threads",
+             "Inter-op threads",
+             "Number of threads used across nodes (onnxrt only).",
+             1);
+  spec.param(graph_optimization_level_,
+             "graph_optimization_level",
+             "Graph optimization level",
+             "One of disable, basic, extended or all (onnxrt only).",
+             std::string("extended"));
+  spec.param(execution_mode_,
+             "execution_mode",
+             "Execution mode",
+             "Sequential or parallel (onnxrt only).",
+             std::string("sequential"));
+  spec.param(use_global_thread_pool_,
+             "use_global_thread_pool",
+             "Global thread pool",
+             "Share a thread pool across sessions (onnxrt only).",
+             false);
+  spec.param(optimized_model_cache_dir_,
+             "optimized_model_cache_dir",
+             "Optimized model cache",
+             "Directory caching the optimized models (onnxrt only).",
+             std::string(""));
+  spec.param(batch_size_map_,
+             "batch_size_map",
+             "Batch size per model",
+             "Maximum number of frames inferred in one batch (onnxrt only).",
+             DataMap());
+  spec.param(batch_delay_map_,
+             "batch_delay_map",
+             "Batch delay per model",
+             "Longest time in milliseconds a frame waits for its batch.",
+             DataMap());
+  spec.param(skip_threshold_map_,
+             "skip_threshold_map",
+             "Skip threshold per model",
+             "Input difference below which the outputs of the last inference are reused.",
+             DataMap());
+  spec.param(skip_max_frames_map_,
+             "skip_max_frames_map",
+             "Skip frame count per model",
+             "Largest number of consecutive frames reusing the outputs of the last inference.",
+             DataMap());
   spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
   spec.param(transmitter_, "transmitter", "Transmitter", "Transmitter", {&transmitter});
   cuda_stream_handler_.define_params(spec);
@@ -164,7 +222,73 @@ void InferenceOp::setup(OperatorSpec& spec) {
 void InferenceOp::initialize() {
   register_converter<DataMap>();
   register_converter<DataVecMap>();
+
+  uint64_t max_batch_size = 0;
+  for (const auto& [model_name, batch_size] : data_map_arg("batch_size_map").get_map()) {
+    try {
+      max_batch_size = std::max<uint64_t>(max_batch_size, std::stoul(batch_size));
+    } catch (const std::logic_error&) {
+      // reported when the inference context is set up
+    }
+  }
+
+  // The results of a batch are transmitted one message per tick, and those of the batches
+  // inferred by the batch timer of the inference context once it notifies the operator, without
+  // waiting for a new input
+  std::vector<std::string> results_ports;
+  if (max_batch_size > 1) {
+    for (auto& [port_name, io_spec] : spec()->inputs()) {
+      if (!io_spec->conditions().empty()) { continue; }
+      io_spec->condition(ConditionType::kNone);
+      results_ports.push_back(port_name);
+    }
+  }
+
   Operator::initialize();
+
+  if (!results_ports.empty() && graph_entity()) { add_results_term(results_ports); }
+}
+
+InferenceOp::DataMap InferenceOp::data_map_arg(const std::string& name) {
+  auto arg_it = std::find_if(
+      args().begin(), args().end(), [&name](const auto& arg) { return (arg.name() == name); });
+  if (arg_it == args().end() || !arg_it->has_value()) { return DataMap(); }
+
+  // ...try extracting the map through YAML::Node or a DataMap cast
+  DataMap data_map;
+  std::any& any_arg = arg_it->value();
+  try {
+    if (arg_it->arg_type().element_type() == ArgElementType::kYAMLNode) {
+      auto& arg_value = std::any_cast<YAML::Node&>(any_arg);
+      if (!YAML::convert<DataMap>::decode(arg_value, data_map)) { return DataMap(); }
+    } else {
+      data_map = std::any_cast<DataMap>(any_arg);
+    }
+  } catch (const std::bad_any_cast& e) {
+    HOLOSCAN_LOG_ERROR("Could not cast parameter '{}' as 'DataMap': {}", name, e.what());
+    return DataMap();
+  }
+  return data_map;
+}
+
+void InferenceOp::add_results_term(const std::vector<std::string>& port_names) {
+  std::vector<nvidia::gxf::Receiver*> receivers;
+  for (const auto& port_name : port_names) {
+    auto& io_spec = spec()->inputs().at(port_name);
+    auto connector = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
+    if (connector && connector->gxf_cptr() != nullptr) {
+      receivers.push_back(static_cast<nvidia::gxf::Receiver*>(connector->gxf_cptr()));
+    }
+  }
+
+  const std::string term_name = fmt::format("{}_batch_results", name());
+  auto results_term = graph_entity()->add<MessageOrEventSchedulingTerm>(term_name.c_str());
+  if (!results_term) {
+    throw std::runtime_error(fmt::format(
+        "InferenceOp '{}': failed to create the batch results scheduling term", name()));
+  }
+  results_term->receivers(std::move(receivers));
+  results_term_ = results_term.get();
 }
 
 void InferenceOp::start() {
@@ -199,17 +323,52 @@ void InferenceOp::start() {
                                                     enable_fp16_.get(),
                                                     input_on_cuda_.get(),
                                                     output_on_cuda_.get());
+    inference_specs_->onnx_options_.intra_op_num_threads = intra_op_num_threads_.get();
+    inference_specs_->onnx_options_.inter_op_num_threads = inter_op_num_threads_.get();
+    inference_specs_->onnx_options_.graph_optimization_level = graph_optimization_level_.get();
+    inference_specs_->onnx_options_.execution_mode = execution_mode_.get();
+    inference_specs_->onnx_options_.use_global_thread_pool = use_global_thread_pool_.get();
+    inference_specs_->onnx_options_.optimized_model_cache_dir = optimized_model_cache_dir_.get();
+    inference_specs_->batch_size_map_ = batch_size_map_.get().get_map();
+    inference_specs_->batch_delay_map_ = batch_delay_map_.get().get_map();
+    batching_ = !inference_specs_->batch_size_map_.empty();
+    inference_specs_->skip_threshold_map_ = skip_threshold_map_.get().get_map();
+    inference_specs_->skip_max_frames_map_ = skip_max_frames_map_.get().get_map();
+    frame_count_ = 0;
+    frame_timestamps_.clear();
+    frame_enqueue_ns_.clear();
+    batch_delay_ns_ = 0;
+    for (const auto& [model_name, batch_delay] : inference_specs_->batch_delay_map_) {
+      try {
+        const auto delay = std::chrono::duration<double, std::milli>(std::stod(batch_delay));
+        batch_delay_ns_ = std::max<int64_t>(
+            batch_delay_ns_, std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count());
+      } catch (const std::logic_error&) {
+        // reported by the inference context
+      }
+    }
     HOLOSCAN_LOG_INFO("Inference Specifications created");
     // Create holoscan inference context
-    holoscan_infer_context_ = std::make_unique<HoloInfer::InferContext>();
+    auto infer_context = std::make_unique<HoloInfer::InferContext>();
 
     // Set and transfer inference specification to inference context
     // inference specifications are updated with memory allocations
-    status = holoscan_infer_context_->set_inference_params(inference_specs_);
+    status = infer_context->set_inference_params(inference_specs_);
     if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
       status.display_message();
       HoloInfer::raise_error(module_, "Start, Parameters setup, " + status.get_message());
     }
+    if (results_term_) {
+      results_term_->consume_event();
+      results_term_->expect_event(0);
+      auto* results_term = results_term_;
+      infer_context->set_results_callback([results_term]() { results_term->notify(); });
+    }
+    {
+      std::lock_guard<std::mutex> lock(skipped_inferences_mutex_);
+      holoscan_infer_context_ = std::move(infer_context);
+      skipped_inferences_.clear();
+    }
     HOLOSCAN_LOG_INFO("Inference context setup complete");
   } catch (const std::bad_alloc& b_) {
     HoloInfer::raise_error(module_, "Start, Memory allocation, Message: " + std::string(b_.what()));
@@ -220,56 +379,170 @@ void InferenceOp::start() {
 }
 
 void InferenceOp::stop() {
+  if (batching_ && holoscan_infer_context_) {
+    // The results of the batches inferred by the batch timer were transmitted before stopping.
+    // Infer the batches still incomplete, e.g. when the application is interrupted, to report
+    // the frames whose results can no longer be transmitted.
+    auto status = holoscan_infer_context_->flush_inference();
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { status.display_message(); }
+    HoloInfer::DataMap frame_outputs;
+    uint64_t frame_tag = 0;
+    size_t dropped_frames = 0;
+    while (holoscan_infer_context_->dequeue_inference(frame_outputs, frame_tag)) {
+      dropped_frames++;
+    }
+    if (dropped_frames > 0) {
+      HOLOSCAN_LOG_WARN("InferenceOp '{}': results of {} frames queued when stopping were not "
+                        "transmitted",
+                        name(),
+                        dropped_frames);
+    }
+    for (const auto& [model_name, stats] : holoscan_infer_context_->get_batch_stats()) {
+      HOLOSCAN_LOG_INFO(
+          "Model {}: {} batches, average batch size {:.2f}, queue delay average {:.3f} ms, max "
+          "{:.3f} ms",
+          model_name,
+          stats.batches,
+          stats.average_batch_size,
+          stats.average_queue_delay_ms,
+          stats.max_queue_delay_ms);
+    }
+  }
+  std::lock_guard<std::mutex> lock(skipped_inferences_mutex_);
+  if (holoscan_infer_context_ && !skip_threshold_map_.get().get_map().empty()) {
+    skipped_inferences_.clear();
+    for (const auto& [model_name, timing] : holoscan_infer_context_->get_model_timing()) {
+      HOLOSCAN_LOG_INFO("Model {}: {} inferences, {} skipped frames reusing the last outputs",
+                        model_name,
+                        timing.count,
+                        timing.skipped);
+      skipped_inferences_[model_name] = timing.skipped;
+    }
+  }
   holoscan_infer_context_.reset();
 }
 
+std::map<std::string, uint64_t> InferenceOp::skipped_inferences() const {
+  std::lock_guard<std::mutex> lock(skipped_inferences_mutex_);
+  if (!holoscan_infer_context_) { return skipped_inferences_; }
+  std::map<std::string, uint64_t> skipped_inferences;
+  for (const auto& [model_name, timing] : holoscan_infer_context_->get_model_timing()) {
+    skipped_inferences[model_name] = timing.skipped;
+  }
+  return skipped_inferences;
+}
+
 void InferenceOp::compute(InputContext& op_input, OutputContext& op_output,
                           ExecutionContext& context) {
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
   auto allocator =
       nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(), allocator_->gxf_cid());
   auto cont = context.context();
+
+  // Without new input, the operator is executed to transmit the results of the batch timer
+  const bool has_input = results_term_ == nullptr || results_term_->has_messages();
+  if (results_term_) { results_term_->consume_event(); }
+
   try {
-    // Extract relevant data from input GXF Receivers, and update inference specifications
-    gxf_result_t stat = holoscan::utils::get_data_per_model(op_input,
-                                                            in_tensor_names_.get(),
-                                                            inference_specs_->data_per_tensor_,
-                                                            dims_per_tensor_,
-                                                            input_on_cuda_.get(),
-                                                            module_,
-                                                            cont,
-                                                            cuda_stream_handler_);
-
-    if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data extraction"); }
-    // Execute inference and populate output buffer in inference specifications
-    HoloInfer::TimePoint s_time, e_time;
-    HoloInfer::timer_init(s_time);
-    auto status = holoscan_infer_context_->execute_inference(inference_specs_->data_per_tensor_,
-                                                             inference_specs_->output_per_model_);
-    HoloInfer::timer_init(e_time);
-    HoloInfer::timer_check(s_time, e_time, "Inference Operator: Inference execution");
-    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
-      status.display_message();
-      HoloInfer::raise_error(module_, "Tick, Inference execution, " + status.get_message());
+    gxf_result_t stat = GXF_SUCCESS;
+    if (has_input) {
+      // Extract relevant data from input GXF Receivers, and update inference specifications
+      std::optional<nvidia::gxf::Timestamp> timestamp;
+      stat = holoscan::utils::get_data_per_model(op_input,
+                                                 in_tensor_names_.get(),
+                                                 inference_specs_->data_per_tensor_,
+                                                 dims_per_tensor_,
+                                                 input_on_cuda_.get(),
+                                                 module_,
+                                                 cont,
+                                                 cuda_stream_handler_,
+                                                 batching_ ? &timestamp : nullptr);
+
+      if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data extraction"); }
+      // Execute inference and populate output buffer in inference specifications
+      HoloInfer::TimePoint s_time, e_time;
+      HoloInfer::timer_init(s_time);
+      HoloInfer::InferStatus status;
+      if (batching_) {
+        // The frame is queued with its timestamp, its results are transmitted once inferred
+        const uint64_t tag = frame_count_++;
+        if (timestamp) { frame_timestamps_[tag] = timestamp.value(); }
+        frame_enqueue_ns_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+        status = holoscan_infer_context_->enqueue_inference(
+            inference_specs_->data_per_tensor_, inference_specs_->output_per_model_, tag);
+      } else {
+        status = holoscan_infer_context_->execute_inference(inference_specs_->data_per_tensor_,
+                                                            inference_specs_->output_per_model_);
+      }
+      HoloInfer::timer_init(e_time);
+      HoloInfer::timer_check(s_time, e_time, "Inference Operator: Inference execution");
+      if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+        status.display_message();
+        HoloInfer::raise_error(module_, "Tick, Inference execution, " + status.get_message());
+      }
+      HOLOSCAN_LOG_DEBUG(status.get_message());
+
+      // Release the input tensors referenced without copy
+      for (auto& [_, buffer] : inference_specs_->data_per_tensor_) {
+        if (buffer->host_buffer.is_borrowed()) { buffer->host_buffer.clear(); }
+      }
     }
-    HOLOSCAN_LOG_DEBUG(status.get_message());
 
     // Get output dimensions
     auto model_out_dims_map = holoscan_infer_context_->get_output_dimensions();
 
     // Transmit output buffers via a single GXF transmitter
-    stat = holoscan::utils::transmit_data_per_model(cont,
-                                                    inference_map_.get().get_map(),
-                                                    inference_specs_->output_per_model_,
-                                                    op_output,
-                                                    out_tensor_names_.get(),
-                                                    model_out_dims_map,
-                                                    output_on_cuda_.get(),
-                                                    transmit_on_cuda_.get(),
-                                                    allocator.value(),
-                                                    module_,
-                                                    cuda_stream_handler_);
-    if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data Transmission"); }
+    auto transmit = [&](HoloInfer::DataMap& output_data,
+                        const nvidia::gxf::Timestamp* frame_timestamp) {
+      stat = holoscan::utils::transmit_data_per_model(cont,
+                                                      inference_map_.get().get_map(),
+                                                      output_data,
+                                                      op_output,
+                                                      out_tensor_names_.get(),
+                                                      model_out_dims_map,
+                                                      output_on_cuda_.get(),
+                                                      transmit_on_cuda_.get(),
+                                                      allocator.value(),
+                                                      module_,
+                                                      cuda_stream_handler_,
+                                                      frame_timestamp);
+      if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data Transmission"); }
+    };
+
+    if (!batching_) {
+      transmit(inference_specs_->output_per_model_, nullptr);
+      return;
+    }
+
+    // The results of the inferred frames are transmitted in the order the frames were received,
+    // one per tick as the input ports downstream are only known to have room for one message
+    HoloInfer::DataMap frame_outputs;
+    uint64_t frame_tag = 0;
+    while (holoscan_infer_context_->dequeue_inference(frame_outputs, frame_tag)) {
+      if (!frame_enqueue_ns_.empty()) { frame_enqueue_ns_.pop_front(); }
+      std::optional<nvidia::gxf::Timestamp> frame_timestamp;
+      auto timestamp_it = frame_timestamps_.find(frame_tag);
+      if (timestamp_it != frame_timestamps_.end()) {
+        frame_timestamp = timestamp_it->second;
+        frame_timestamps_.erase(timestamp_it);
+      }
+      transmit(frame_outputs, frame_timestamp ? &frame_timestamp.value() : nullptr);
+      frame_outputs.clear();
+      // Executed again for the results of the next frame, if any. Without the scheduling term,
+      // e.g. in a GXF codelet wrapping the operator, they are all transmitted on this tick.
+      if (results_term_) {
+        results_term_->notify();
+        break;
+      }
+    }
+
+    // The oldest queued frame is inferred by the batch timer at the latest once its delay expired
+    if (results_term_) {
+      const bool expect_timer = batch_delay_ns_ > 0 && !frame_enqueue_ns_.empty();
+      results_term_->expect_event(expect_timer ? frame_enqueue_ns_.front() + batch_delay_ns_ : 0);
+    }
   } catch (const std::runtime_error& r_) {
     HoloInfer::raise_error(module_,
                            "Tick, Inference execution, Message->" + std::string(r_.what()));
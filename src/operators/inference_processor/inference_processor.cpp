@@ -126,6 +126,11 @@ void InferenceProcessorOp::setup(OperatorSpec& spec) {
              DataVecMap());
   spec.param(in_tensor_names_, "in_tensor_names", "Input Tensors", "Input tensors", {});
   spec.param(config_path_, "config_path", "Path to config file", "Config File", {});
+  spec.param(fuse_operations_,
+             "fuse_operations",
+             "Fuse operations",
+             "Run the operations of each tensor as a compiled plan.",
+             false);
   spec.param(out_tensor_names_, "out_tensor_names", "Output Tensors", "Output tensors", {});
   spec.param(input_on_cuda_, "input_on_cuda", "Input buffer on CUDA", "", false);
   spec.param(output_on_cuda_, "output_on_cuda", "Output buffer on CUDA", "", false);
@@ -199,7 +204,8 @@ void InferenceProcessorOp::start() {
 
   // Initialize holoscan processing context
   auto status = holoscan_postprocess_context_->initialize(process_operations_.get().get_map(),
-                                                          config_path_.get());
+                                                          config_path_.get(),
+                                                          fuse_operations_.get());
   if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
     status.display_message();
     HoloInfer::raise_error(module_, "Start, Out data setup");
@@ -17,8 +17,16 @@
 
 #include "holoscan/operators/video_stream_recorder/video_stream_recorder.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <string>
+#include <utility>
 
 #include "gxf/core/expected.hpp"
 #include "gxf/serialization/entity_serializer.hpp"
@@ -35,6 +43,118 @@
 
 namespace holoscan::ops {
 
+/**
+ * @brief Write-only endpoint buffering writes into large aligned chunks.
+ *
+ * Full chunks are written with a single `write()` call. With direct I/O, the file is opened with
+ * `O_DIRECT` and only multiples of the alignment are written until the final flush.
+ */
+class ChunkedFileWriter : public nvidia::gxf::Endpoint {
+ public:
+  static constexpr size_t kAlignment = 4096;
+
+  ChunkedFileWriter(std::string path, size_t chunk_size, bool direct_io)
+      : path_(std::move(path)),
+        chunk_size_(std::max(kAlignment, (chunk_size + kAlignment - 1) / kAlignment * kAlignment)),
+        direct_io_(direct_io) {}
+  ~ChunkedFileWriter() override { close(); }
+
+  ChunkedFileWriter(const ChunkedFileWriter&) = delete;
+  ChunkedFileWriter& operator=(const ChunkedFileWriter&) = delete;
+
+  bool open() {
+    void* buffer = nullptr;
+    if (posix_memalign(&buffer, kAlignment, chunk_size_) != 0) { return false; }
+    buffer_ = static_cast<uint8_t*>(buffer);
+
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    if (direct_io_) {
+      fd_ = ::open(path_.c_str(), flags | O_DIRECT, 0644);
+      if (fd_ < 0 && errno == EINVAL) {
+        HOLOSCAN_LOG_WARN("O_DIRECT is not supported for '{}', using buffered writes", path_);
+        direct_io_ = false;
+      }
+    }
+    if (fd_ < 0) { fd_ = ::open(path_.c_str(), flags, 0644); }
+    return fd_ >= 0;
+  }
+
+  void close() {
+    if (fd_ >= 0) {
+      if (!flush(true)) {
+        HOLOSCAN_LOG_ERROR("Failed to flush '{}': {}", path_, std::strerror(errno));
+      }
+      ::close(fd_);
+      fd_ = -1;
+    }
+    std::free(buffer_);
+    buffer_ = nullptr;
+  }
+
+  /// Write the buffered data. Unless `final` is set, direct I/O keeps the unaligned tail buffered.
+  bool flush(bool final) {
+    if (fd_ < 0 || used_ == 0) { return true; }
+    size_t count = used_;
+    if (direct_io_ && !final) { count -= used_ % kAlignment; }
+    if (direct_io_ && final && count % kAlignment != 0) {
+      // The tail cannot be written with O_DIRECT
+      int flags = fcntl(fd_, F_GETFL);
+      if (flags < 0 || fcntl(fd_, F_SETFL, flags & ~O_DIRECT) < 0) { return false; }
+      direct_io_ = false;
+    }
+    if (!write_all(buffer_, count)) { return false; }
+    used_ -= count;
+    if (used_ > 0) { std::memmove(buffer_, buffer_ + count, used_); }
+    return true;
+  }
+
+  gxf_result_t is_write_available_abi() override {
+    return fd_ >= 0 ? GXF_SUCCESS : GXF_FAILURE;
+  }
+  gxf_result_t is_read_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override {
+    if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+    if (fd_ < 0) { return GXF_FAILURE; }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    size_t remaining = size;
+    while (remaining > 0) {
+      const size_t count = std::min(remaining, chunk_size_ - used_);
+      std::memcpy(buffer_ + used_, bytes, count);
+      used_ += count;
+      bytes += count;
+      remaining -= count;
+      if (used_ == chunk_size_) {
+        if (!write_all(buffer_, used_)) { return GXF_FAILURE; }
+        used_ = 0;
+      }
+    }
+    *bytes_written = size;
+    return GXF_SUCCESS;
+  }
+  gxf_result_t read_abi(void*, size_t, size_t*) override { return GXF_FAILURE; }
+
+ private:
+  bool write_all(const uint8_t* data, size_t size) {
+    while (size > 0) {
+      ssize_t result = ::write(fd_, data, size);
+      if (result < 0) {
+        if (errno == EINTR) { continue; }
+        return false;
+      }
+      data += result;
+      size -= static_cast<size_t>(result);
+    }
+    return true;
+  }
+
+  std::string path_;
+  size_t chunk_size_;
+  bool direct_io_;
+  int fd_ = -1;
+  uint8_t* buffer_ = nullptr;
+  size_t used_ = 0;
+};
+
 void VideoStreamRecorderOp::setup(OperatorSpec& spec) {
   auto& input = spec.input<gxf::Entity>("input");
 
@@ -50,6 +170,27 @@ void VideoStreamRecorderOp::setup(OperatorSpec& spec) {
              "Flush on tick",
              "Flushes output buffer on every tick when true",
              false);
+  spec.param(async_queue_size_,
+             "async_queue_size",
+             "Asynchronous queue size",
+             "Number of entities which can be queued for the writer thread. If zero value is "
+             "specified, entities are written in compute() (default: 0).",
+             0UL);
+  spec.param(backpressure_policy_,
+             "backpressure_policy",
+             "Backpressure policy",
+             "Policy when the writer queue is full: 'block' or 'drop' (default: 'block').",
+             std::string("block"));
+  spec.param(write_chunk_size_,
+             "write_chunk_size",
+             "Write chunk size",
+             "Size in bytes of the chunks written by the writer thread (default: 4194304).",
+             4UL * 1024 * 1024);
+  spec.param(direct_io_,
+             "direct_io",
+             "Direct I/O",
+             "Open the entity file with O_DIRECT when writing asynchronously (default: false).",
+             false);
 }
 
 void VideoStreamRecorderOp::initialize() {
@@ -78,6 +219,31 @@ void VideoStreamRecorderOp::initialize() {
     path += receiver_->name();
   }
 
+  if (async_queue_size_ > 0) {
+    if (backpressure_policy_.get() != "block" && backpressure_policy_.get() != "drop") {
+      throw std::runtime_error(fmt::format(
+          "Invalid backpressure_policy '{}' (expected 'block' or 'drop')",
+          backpressure_policy_.get()));
+    }
+    drop_when_full_ = backpressure_policy_.get() == "drop";
+
+    // Index entries are small, so only the entity file uses direct I/O
+    index_writer_ = std::make_unique<ChunkedFileWriter>(
+        path + nvidia::gxf::FileStream::kIndexFileExtension, write_chunk_size_, false);
+    if (!index_writer_->open()) {
+      throw std::runtime_error(
+          fmt::format("Failed to open index file with error: {}", std::strerror(errno)));
+    }
+    binary_writer_ = std::make_unique<ChunkedFileWriter>(
+        path + nvidia::gxf::FileStream::kBinaryFileExtension, write_chunk_size_, direct_io_);
+    if (!binary_writer_->open()) {
+      throw std::runtime_error(
+          fmt::format("Failed to open binary file with error: {}", std::strerror(errno)));
+    }
+    binary_file_offset_ = 0;
+    return;
+  }
+
   // Initialize index file stream as write-only
   index_file_stream_ =
       nvidia::gxf::FileStream("", path + nvidia::gxf::FileStream::kIndexFileExtension);
@@ -99,12 +265,16 @@ void VideoStreamRecorderOp::initialize() {
     auto code = nvidia::gxf::ToResultCode(result);
     throw std::runtime_error(fmt::format("Failed to open binary_file_stream_ with code: {}", code));
   }
+  file_streams_open_ = true;
   binary_file_offset_ = 0;
 }
 
 VideoStreamRecorderOp::~VideoStreamRecorderOp() {
   // for the GXF codelet, this code is in a deinitialize() method
 
+  if (writer_thread_.joinable()) { stop(); }
+  if (!file_streams_open_) { return; }
+
   // Close binary file stream
   nvidia::gxf::Expected<void> result = binary_file_stream_.close();
   if (!result) {
@@ -125,6 +295,25 @@ void VideoStreamRecorderOp::stop() {
   // To guarantee that all results get written even in that case, we can flush the file
   // stream here.
 
+  if (async_queue_size_ > 0) {
+    if (writer_thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        stop_writer_ = true;
+      }
+      writer_cv_.notify_all();
+      writer_thread_.join();
+    }
+    if (!writer_error_.empty()) {
+      HOLOSCAN_LOG_ERROR("Writer thread of '{}' failed: {}", name(), writer_error_);
+    }
+    try {
+      flush_writers(true);
+    } catch (const std::exception& e) { HOLOSCAN_LOG_ERROR("{}", e.what()); }
+    return;
+  }
+  if (!file_streams_open_) { return; }
+
   // Close binary file stream
   nvidia::gxf::Expected<void> result = binary_file_stream_.flush();
   if (!result) {
@@ -140,6 +329,119 @@ void VideoStreamRecorderOp::stop() {
   }
 }
 
+void VideoStreamRecorderOp::start() {
+  if (async_queue_size_ == 0) { return; }
+
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    writer_queue_.clear();
+    stop_writer_ = false;
+    writer_error_.clear();
+  }
+
+  auto context = static_cast<gxf_context_t>(fragment()->executor().context());
+  entity_serializer(context);
+  writer_thread_ = std::thread([this, context] { writer_loop(context); });
+}
+
+size_t VideoStreamRecorderOp::queue_depth() {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  return writer_queue_.size();
+}
+
+double VideoStreamRecorderOp::bytes_per_second() const {
+  const int64_t elapsed_ns = write_last_ns_.load() - write_start_ns_.load();
+  if (elapsed_ns <= 0) { return 0.0; }
+  return static_cast<double>(bytes_written_.load()) * 1e9 / static_cast<double>(elapsed_ns);
+}
+
+nvidia::gxf::EntitySerializer* VideoStreamRecorderOp::entity_serializer(gxf_context_t context) {
+  if (entity_serializer_ptr_ == nullptr) {
+    // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
+    auto vs_serializer =
+        std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
+    // get the Handle to the underlying GXF EntitySerializer
+    auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
+        context, vs_serializer->gxf_cid());
+    if (!entity_serializer) {
+      throw std::runtime_error("Failed to get the GXF EntitySerializer of the recorder");
+    }
+    entity_serializer_ptr_ = entity_serializer.value().get();
+  }
+  return entity_serializer_ptr_;
+}
+
+void VideoStreamRecorderOp::writer_loop(gxf_context_t context) {
+  std::unique_lock<std::mutex> lock(writer_mutex_);
+  while (true) {
+    writer_cv_.wait(lock, [this] { return stop_writer_ || !writer_queue_.empty(); });
+    // Pending entities are still written when stopping
+    if (writer_queue_.empty()) { return; }
+
+    PendingEntity pending = std::move(writer_queue_.front());
+    writer_queue_.pop_front();
+    const bool drained = writer_queue_.empty();
+    lock.unlock();
+    writer_space_cv_.notify_one();
+
+    try {
+      write_entity(context, pending);
+      if (drained && flush_on_tick_) { flush_writers(false); }
+    } catch (const std::exception& e) {
+      lock.lock();
+      writer_error_ = e.what();
+      writer_queue_.clear();
+      lock.unlock();
+      writer_space_cv_.notify_all();
+      return;
+    }
+    // Release the entity before waiting for the next one
+    pending = PendingEntity{};
+    lock.lock();
+  }
+}
+
+void VideoStreamRecorderOp::write_entity(gxf_context_t context, const PendingEntity& pending) {
+  nvidia::gxf::Expected<size_t> size =
+      entity_serializer(context)->serializeEntity(pending.entity, binary_writer_.get());
+  if (!size) {
+    auto code = nvidia::gxf::ToResultCode(size);
+    throw std::runtime_error(fmt::format("Failed to serialize entity with code {}", code));
+  }
+
+  // Create entity index
+  nvidia::gxf::EntityIndex index;
+  index.log_time = pending.log_time;
+  index.data_size = size.value();
+  index.data_offset = binary_file_offset_;
+
+  // Write entity index to index file
+  nvidia::gxf::Expected<size_t> result = index_writer_->writeTrivialType(&index);
+  if (!result) {
+    auto code = nvidia::gxf::ToResultCode(result);
+    throw std::runtime_error(fmt::format("Failed writing to index file with code {}", code));
+  }
+  binary_file_offset_ += size.value();
+
+  // Update statistics
+  const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+  int64_t expected_start = 0;
+  write_start_ns_.compare_exchange_strong(expected_start, now);
+  write_last_ns_ = now;
+  bytes_written_ += size.value();
+}
+
+void VideoStreamRecorderOp::flush_writers(bool final) {
+  if (binary_writer_ && !binary_writer_->flush(final)) {
+    throw std::runtime_error(
+        fmt::format("Failed to flush the binary file with error: {}", std::strerror(errno)));
+  }
+  if (index_writer_ && !index_writer_->flush(final)) {
+    throw std::runtime_error(
+        fmt::format("Failed to flush the index file with error: {}", std::strerror(errno)));
+  }
+}
+
 void VideoStreamRecorderOp::compute(InputContext& op_input, OutputContext& op_output,
                                     ExecutionContext& context) {
   // avoid warning about unused variable
@@ -147,14 +449,29 @@ void VideoStreamRecorderOp::compute(InputContext& op_input, OutputContext& op_ou
 
   auto entity = op_input.receive<gxf::Entity>("input").value();
 
-  // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
-  auto vs_serializer =
-      std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
-  // get the Handle to the underlying GXF EntitySerializer
-  auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
-      context.context(), vs_serializer->gxf_cid());
+  if (async_queue_size_ > 0) {
+    PendingEntity pending{entity, std::chrono::system_clock::now().time_since_epoch().count()};
+    {
+      std::unique_lock<std::mutex> lock(writer_mutex_);
+      if (writer_error_.empty() && writer_queue_.size() >= async_queue_size_) {
+        if (drop_when_full_) {
+          ++dropped_frames_;
+          HOLOSCAN_LOG_DEBUG("Writer queue of '{}' is full. Dropping the entity.", name());
+          return;
+        }
+        writer_space_cv_.wait(lock, [this] {
+          return writer_queue_.size() < async_queue_size_ || !writer_error_.empty();
+        });
+      }
+      if (!writer_error_.empty()) { throw std::runtime_error(writer_error_); }
+      writer_queue_.push_back(std::move(pending));
+    }
+    writer_cv_.notify_one();
+    return;
+  }
+
   nvidia::gxf::Expected<size_t> size =
-      entity_serializer.value()->serializeEntity(entity, &binary_file_stream_);
+      entity_serializer(context.context())->serializeEntity(entity, &binary_file_stream_);
   if (!size) {
     auto code = nvidia::gxf::ToResultCode(size);
     throw std::runtime_error(fmt::format("Failed to serialize entity with code {}", code));
@@ -17,11 +17,22 @@
 
 #include "holoscan/operators/video_stream_replayer/video_stream_replayer.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <any>
+#include <cerrno>
 #include <chrono>
 #include <cinttypes>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "gxf/core/expected.hpp"
 #include "gxf/serialization/entity_serializer.hpp"
@@ -36,6 +47,81 @@
 
 namespace holoscan::ops {
 
+/**
+ * @brief Read-only endpoint reading from a memory-mapped file.
+ *
+ * Reading copies directly from the page cache, without going through stdio buffers.
+ */
+class MappedFileStream : public nvidia::gxf::Endpoint {
+ public:
+  explicit MappedFileStream(std::string path) : path_(std::move(path)) {}
+  ~MappedFileStream() override { close(); }
+
+  MappedFileStream(const MappedFileStream&) = delete;
+  MappedFileStream& operator=(const MappedFileStream&) = delete;
+
+  bool open() {
+    int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { return false; }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0) {
+      ::close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    if (size_ > 0) {
+      void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        return false;
+      }
+      data_ = static_cast<const uint8_t*>(data);
+      // Entities are read in order, so let the kernel read ahead aggressively
+      madvise(const_cast<uint8_t*>(data_), size_, MADV_SEQUENTIAL);
+    }
+    ::close(fd);  // the mapping stays valid after closing the file descriptor
+    offset_ = 0;
+    return true;
+  }
+
+  void close() {
+    if (data_) { munmap(const_cast<uint8_t*>(data_), size_); }
+    data_ = nullptr;
+    size_ = 0;
+    offset_ = 0;
+  }
+
+  void rewind() { offset_ = 0; }
+
+  template <typename T>
+  bool read_trivial(T* value) {
+    if (size_ - offset_ < sizeof(T)) { return false; }
+    std::memcpy(value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  gxf_result_t is_write_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t is_read_available_abi() override {
+    return offset_ < size_ ? GXF_SUCCESS : GXF_FAILURE;
+  }
+  gxf_result_t write_abi(const void*, size_t, size_t*) override { return GXF_FAILURE; }
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override {
+    if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+    const size_t count = std::min(size, size_ - offset_);
+    if (count > 0) { std::memcpy(data, data_ + offset_, count); }
+    offset_ += count;
+    *bytes_read = count;
+    return GXF_SUCCESS;
+  }
+
+ private:
+  std::string path_;
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  size_t offset_ = 0;
+};
+
 void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
   auto& output = spec.output<gxf::Entity>("output");
 
@@ -86,6 +172,17 @@ void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
              "the count "
              "is less than the number of frames in the video, it would be finished early.",
              0UL);
+  spec.param(read_ahead_,
+             "read_ahead",
+             "Read ahead",
+             "Number of entities to deserialize ahead of playback from memory-mapped files in a "
+             "background thread. If zero value is specified, entities are read in compute() "
+             "(default: 0).",
+             0UL);
+  spec.param(async_condition_,
+             "async_condition",
+             "Asynchronous condition",
+             "AsynchronousCondition pacing the playback in read-ahead mode.");
 }
 
 void VideoStreamReplayerOp::initialize() {
@@ -111,9 +208,26 @@ void VideoStreamReplayerOp::initialize() {
     add_arg(boolean_scheduling_term_.get());
   }
 
+  // Create the AsynchronousCondition pacing the read-ahead mode if there is no argument
+  // provided. Without read-ahead, the scheduling of the operator is left unchanged.
+  auto has_async_condition = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+    return (arg.name() == "async_condition");
+  });
+  if (has_async_condition == args().end() && read_ahead_arg() > 0) {
+    async_condition_ = frag->make_condition<holoscan::AsynchronousCondition>("async_condition");
+    add_arg(async_condition_.get());
+  }
+
   // Operator::initialize must occur after all arguments have been added
   Operator::initialize();
 
+  if (read_ahead_ > 0 && !async_condition_.has_value()) {
+    throw std::runtime_error(
+        fmt::format("VideoStreamReplayerOp '{}': the read-ahead mode requires an "
+                    "AsynchronousCondition",
+                    name()));
+  }
+
   // Create path by appending component name to directory path if basename is not provided
   std::string path = directory_.get() + '/';
 
@@ -129,22 +243,37 @@ void VideoStreamReplayerOp::initialize() {
   const std::string index_filename = path + nvidia::gxf::FileStream::kIndexFileExtension;
   const std::string entity_filename = path + nvidia::gxf::FileStream::kBinaryFileExtension;
 
-  // Open index file stream as read-only
-  index_file_stream_ = nvidia::gxf::FileStream(index_filename, "");
-  nvidia::gxf::Expected<void> result = index_file_stream_.open();
-  if (!result) {
-    HOLOSCAN_LOG_WARN("Could not open index file: {}", index_filename);
-    auto code = nvidia::gxf::ToResultCode(result);
-    throw std::runtime_error(fmt::format("File open failed with code: {}", code));
-  }
+  if (read_ahead_ > 0) {
+    // Map index and entity files for the read-ahead thread
+    mapped_index_ = std::make_unique<MappedFileStream>(index_filename);
+    if (!mapped_index_->open()) {
+      HOLOSCAN_LOG_WARN("Could not open index file: {}", index_filename);
+      throw std::runtime_error(fmt::format("File mmap failed: {}", std::strerror(errno)));
+    }
+    mapped_entities_ = std::make_unique<MappedFileStream>(entity_filename);
+    if (!mapped_entities_->open()) {
+      HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
+      throw std::runtime_error(fmt::format("File mmap failed: {}", std::strerror(errno)));
+    }
+  } else {
+    // Open index file stream as read-only
+    index_file_stream_ = nvidia::gxf::FileStream(index_filename, "");
+    nvidia::gxf::Expected<void> result = index_file_stream_.open();
+    if (!result) {
+      HOLOSCAN_LOG_WARN("Could not open index file: {}", index_filename);
+      auto code = nvidia::gxf::ToResultCode(result);
+      throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+    }
 
-  // Open entity file stream as read-only
-  entity_file_stream_ = nvidia::gxf::FileStream(entity_filename, "");
-  result = entity_file_stream_.open();
-  if (!result) {
-    HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
-    auto code = nvidia::gxf::ToResultCode(result);
-    throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+    // Open entity file stream as read-only
+    entity_file_stream_ = nvidia::gxf::FileStream(entity_filename, "");
+    result = entity_file_stream_.open();
+    if (!result) {
+      HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
+      auto code = nvidia::gxf::ToResultCode(result);
+      throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+    }
+    file_streams_open_ = true;
   }
 
   boolean_scheduling_term_->enable_tick();
@@ -161,6 +290,9 @@ void VideoStreamReplayerOp::initialize() {
 VideoStreamReplayerOp::~VideoStreamReplayerOp() {
   // for the GXF codelet, this code is in a deinitialize() method
 
+  if (read_ahead_thread_.joinable()) { stop(); }
+  if (!file_streams_open_) { return; }
+
   // Close binary file stream
   nvidia::gxf::Expected<void> result = entity_file_stream_.close();
   if (!result) {
@@ -176,11 +308,239 @@ VideoStreamReplayerOp::~VideoStreamReplayerOp() {
   }
 }
 
+uint64_t VideoStreamReplayerOp::read_ahead_arg() {
+  auto arg_it = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+    return (arg.name() == "read_ahead");
+  });
+  if (arg_it == args().end() || !arg_it->has_value()) { return 0; }
+
+  // ...try extracting the value through YAML::Node or a cast of the integer types of the argument
+  std::any& any_arg = arg_it->value();
+  uint64_t read_ahead = 0;
+  switch (arg_it->arg_type().element_type()) {
+    case ArgElementType::kYAMLNode: {
+      auto& arg_value = std::any_cast<YAML::Node&>(any_arg);
+      if (!YAML::convert<uint64_t>::decode(arg_value, read_ahead)) {
+        HOLOSCAN_LOG_ERROR("Could not parse YAML parameter 'read_ahead' as a 'uint64_t' type");
+        return 0;
+      }
+      return read_ahead;
+    }
+    case ArgElementType::kUnsigned64:
+      return std::any_cast<uint64_t>(any_arg);
+    case ArgElementType::kUnsigned32:
+      return std::any_cast<uint32_t>(any_arg);
+    case ArgElementType::kInt64:
+      return static_cast<uint64_t>(std::max<int64_t>(std::any_cast<int64_t>(any_arg), 0));
+    case ArgElementType::kInt32:
+      return static_cast<uint64_t>(std::max<int32_t>(std::any_cast<int32_t>(any_arg), 0));
+    default:
+      HOLOSCAN_LOG_ERROR("Could not cast parameter 'read_ahead' as an integer type");
+      return 0;
+  }
+}
+
+nvidia::gxf::EntitySerializer* VideoStreamReplayerOp::entity_serializer(gxf_context_t context) {
+  if (entity_serializer_ptr_ == nullptr) {
+    // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
+    auto vs_serializer =
+        std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
+    // get underlying GXF EntitySerializer
+    auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
+        context, vs_serializer->gxf_cid());
+    if (!entity_serializer) {
+      throw std::runtime_error("Failed to get the GXF EntitySerializer of the replayer");
+    }
+    entity_serializer_ptr_ = entity_serializer.value().get();
+  }
+  return entity_serializer_ptr_;
+}
+
+int64_t VideoStreamReplayerOp::update_playback_offset(uint64_t log_time) {
+  if (playback_count_ == 0) { index_start_timestamp_ = log_time; }
+  // Update last timestamp
+  if (log_time > index_last_timestamp_) {
+    index_last_timestamp_ = log_time;
+    index_frame_count_ = playback_count_ + 1;
+    index_timestamp_duration_ = index_last_timestamp_ - index_start_timestamp_;
+  }
+
+  // Calculate the playback time based on frame rate or timestamps.
+  if (frame_rate_ > 0.f) {
+    return static_cast<int64_t>(1000000000 / frame_rate_) * playback_count_;
+  }
+  return static_cast<int64_t>((log_time - index_start_timestamp_) +
+                              index_timestamp_duration_ * (playback_count_ / index_frame_count_));
+}
+
+void VideoStreamReplayerOp::start() {
+  if (read_ahead_ == 0) { return; }
+
+  {
+    std::lock_guard<std::mutex> lock(read_ahead_mutex_);
+    read_ahead_queue_.clear();
+    waiting_for_frame_ = true;
+    end_of_stream_ = false;
+    stop_read_ahead_ = false;
+    read_ahead_error_.clear();
+    // compute() is not called until the read-ahead thread released the first frame
+    async_condition_->event_state(AsynchronousEventState::EVENT_WAITING);
+  }
+
+  auto context = static_cast<gxf_context_t>(fragment()->executor().context());
+  entity_serializer(context);
+  read_ahead_thread_ = std::thread([this, context] { read_ahead_loop(context); });
+}
+
+void VideoStreamReplayerOp::stop() {
+  if (!read_ahead_thread_.joinable()) { return; }
+  {
+    std::lock_guard<std::mutex> lock(read_ahead_mutex_);
+    stop_read_ahead_ = true;
+  }
+  read_ahead_cv_.notify_all();
+  read_ahead_thread_.join();
+  read_ahead_queue_.clear();
+}
+
+bool VideoStreamReplayerOp::read_next_frame(gxf_context_t context, ReadAheadFrame& frame) {
+  while (true) {
+    if (count_ > 0 && playback_count_ >= count_) { return false; }
+
+    // Read entity index from the mapped index file, rewinding the files if repeating
+    nvidia::gxf::EntityIndex index;
+    if (!mapped_index_->read_trivial(&index)) {
+      if (!repeat_ || playback_index_ == 0) { return false; }
+      mapped_index_->rewind();
+      mapped_entities_->rewind();
+      playback_index_ = 0;
+      continue;
+    }
+
+    // Read entity from the mapped binary file
+    nvidia::gxf::Expected<nvidia::gxf::Entity> entity =
+        entity_serializer(context)->deserializeEntity(context, mapped_entities_.get());
+    if (!entity) {
+      if (ignore_corrupted_entities_) { continue; }
+      auto code = nvidia::gxf::ToResultCode(entity);
+      std::lock_guard<std::mutex> lock(read_ahead_mutex_);
+      read_ahead_error_ =
+          fmt::format("failed reading entity from entity_file_stream with code {}", code);
+      return false;
+    }
+
+    int64_t playback_offset = update_playback_offset(index.log_time);
+    frame.entity = std::move(entity.value());
+    frame.playback_offset_ns = realtime_ ? playback_offset : 0;
+    frame.playback_count = playback_count_;
+
+    // Increment frame counter and index
+    ++playback_count_;
+    ++playback_index_;
+    return true;
+  }
+}
+
+void VideoStreamReplayerOp::read_ahead_loop(gxf_context_t context) {
+  std::unique_lock<std::mutex> lock(read_ahead_mutex_);
+  while (!stop_read_ahead_) {
+    if (waiting_for_frame_) {
+      if (!read_ahead_queue_.empty()) {
+        // Release the next frame to compute() once it is due
+        const auto& frame = read_ahead_queue_.front();
+        auto now = std::chrono::steady_clock::now();
+        if (frame.playback_count == 0) { read_ahead_start_ = now; }
+        auto target = read_ahead_start_ + std::chrono::nanoseconds(frame.playback_offset_ns);
+        if (now >= target) {
+          if (realtime_ && now > target && (frame.playback_count % index_frame_count_ != 0)) {
+            HOLOSCAN_LOG_INFO(
+                fmt::format("Playing video stream is lagging behind (count: {} , delay: {} ns)",
+                            frame.playback_count,
+                            -std::chrono::nanoseconds(now - target).count()));
+          }
+          waiting_for_frame_ = false;
+          async_condition_->event_state(AsynchronousEventState::EVENT_DONE);
+          continue;
+        }
+        if (end_of_stream_ || read_ahead_queue_.size() >= read_ahead_) {
+          // Release the frame right at its due time (not reported as lagging)
+          if (read_ahead_cv_.wait_until(lock, target) == std::cv_status::timeout &&
+              waiting_for_frame_ && !stop_read_ahead_) {
+            waiting_for_frame_ = false;
+            async_condition_->event_state(AsynchronousEventState::EVENT_DONE);
+          }
+          continue;
+        }
+      } else if (end_of_stream_) {
+        // Nothing is left to play
+        waiting_for_frame_ = false;
+        async_condition_->event_state(AsynchronousEventState::EVENT_NEVER);
+        boolean_scheduling_term_->disable_tick();
+        continue;
+      }
+    }
+
+    // Deserialize the next frame while there is room in the queue
+    if (!end_of_stream_ && read_ahead_queue_.size() < read_ahead_) {
+      lock.unlock();
+      ReadAheadFrame frame;
+      bool has_frame = read_next_frame(context, frame);
+      lock.lock();
+      if (has_frame) {
+        read_ahead_queue_.push_back(std::move(frame));
+      } else {
+        HOLOSCAN_LOG_INFO(
+            "Reach end of file or playback count reaches to the limit. Stop reading ahead.");
+        end_of_stream_ = true;
+      }
+      continue;
+    }
+
+    read_ahead_cv_.wait(lock);
+  }
+}
+
 void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_output,
                                     ExecutionContext& context) {
   // avoid warning about unused variable
   (void)op_input;
 
+  if (read_ahead_ > 0) {
+    // Take the frames which are due. The first one was released by the read-ahead thread.
+    std::vector<nvidia::gxf::Entity> entities;
+    {
+      std::lock_guard<std::mutex> lock(read_ahead_mutex_);
+      if (!read_ahead_error_.empty()) { throw std::runtime_error(read_ahead_error_); }
+      auto now = std::chrono::steady_clock::now();
+      while (entities.size() < batch_size_ && !read_ahead_queue_.empty()) {
+        auto& frame = read_ahead_queue_.front();
+        if (!entities.empty() &&
+            read_ahead_start_ + std::chrono::nanoseconds(frame.playback_offset_ns) > now) {
+          break;
+        }
+        entities.push_back(std::move(frame.entity));
+        read_ahead_queue_.pop_front();
+      }
+      if (read_ahead_queue_.empty() && end_of_stream_) {
+        HOLOSCAN_LOG_INFO(
+            "Reach end of file or playback count reaches to the limit. Stop ticking.");
+        async_condition_->event_state(AsynchronousEventState::EVENT_NEVER);
+        boolean_scheduling_term_->disable_tick();
+      } else {
+        waiting_for_frame_ = true;
+        async_condition_->event_state(AsynchronousEventState::EVENT_WAITING);
+      }
+    }
+    read_ahead_cv_.notify_all();
+
+    for (auto& entity : entities) {
+      // emit the entity
+      auto result = gxf::Entity(std::move(entity));
+      op_output.emit(result);
+    }
+    return;
+  }
+
   for (size_t i = 0; i < batch_size_; i++) {
     // Read entity index from index file
     // Break if index not found and clear stream errors
@@ -212,15 +572,10 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
       break;
     }
 
-    // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
-    auto vs_serializer =
-        std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
-    // get underlying GXF EntitySerializer
-    auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
-        context.context(), vs_serializer->gxf_cid());
     // Read entity from binary file
     nvidia::gxf::Expected<nvidia::gxf::Entity> entity =
-        entity_serializer.value()->deserializeEntity(context.context(), &entity_file_stream_);
+        entity_serializer(context.context())
+            ->deserializeEntity(context.context(), &entity_file_stream_);
     if (!entity) {
       if (ignore_corrupted_entities_) {
         continue;
@@ -235,31 +590,14 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
 
     if (playback_count_ == 0) {
       playback_start_timestamp_ = std::chrono::system_clock::now().time_since_epoch().count();
-      index_start_timestamp_ = index.log_time;
-    }
-    // Update last timestamp
-    if (index.log_time > index_last_timestamp_) {
-      index_last_timestamp_ = index.log_time;
-      index_frame_count_ = playback_count_ + 1;
-      index_timestamp_duration_ = index_last_timestamp_ - index_start_timestamp_;
     }
+    int64_t playback_offset = update_playback_offset(index.log_time);
 
     // Delay if realtime is specified
     if (realtime_) {
-      // Calculate the delay time based on frame rate or timestamps.
       uint64_t current_timestamp = std::chrono::system_clock::now().time_since_epoch().count();
       int64_t time_delta = static_cast<int64_t>(current_timestamp - playback_start_timestamp_);
-      if (frame_rate_ > 0.f) {
-        time_to_delay =
-            static_cast<int64_t>(1000000000 / frame_rate_) * playback_count_ - time_delta;
-      } else {
-        // Get timestamp from entity
-        uint64_t timestamp = index.log_time;
-        time_to_delay = static_cast<int64_t>((timestamp - index_start_timestamp_) +
-                                             index_timestamp_duration_ *
-                                                 (playback_count_ / index_frame_count_)) -
-                        time_delta;
-      }
+      time_to_delay = playback_offset - time_delta;
       if (time_to_delay < 0 && (playback_count_ % index_frame_count_ != 0)) {
         HOLOSCAN_LOG_INFO(
             fmt::format("Playing video stream is lagging behind (count: {} , delay: {} ns)",
@@ -33,23 +33,45 @@ namespace HoloInfer = holoscan::inference;
 
 namespace holoscan::utils {
 
+/**
+ * @brief Check if the tensor data is contiguous in row-major order
+ */
+static bool is_contiguous(const nvidia::gxf::Tensor& tensor) {
+  uint64_t expected_stride = tensor.bytes_per_element();
+  for (int i = static_cast<int>(tensor.rank()) - 1; i >= 0; --i) {
+    if (tensor.shape().dimension(i) != 1 && tensor.stride(i) != expected_stride) { return false; }
+    expected_stride *= tensor.shape().dimension(i);
+  }
+  return true;
+}
+
 template <typename T>
 gxf_result_t extract_data(nvidia::gxf::MemoryStorageType to,
                           nvidia::gxf::MemoryStorageType storage_type,
                           HoloInfer::holoinfer_datatype dtype, void* in_tensor_data,
                           HoloInfer::DataMap& data_per_input_tensor,
                           const std::string& current_tensor, size_t buffer_size,
-                          const std::string& module, cudaStream_t cstream) {
+                          const std::string& module, cudaStream_t cstream,
+                          const std::shared_ptr<void>& in_tensor_owner) {
+  // Host tensors with a contiguous layout are referenced, keeping the tensor alive
+  const bool borrow = in_tensor_owner && to == nvidia::gxf::MemoryStorageType::kHost &&
+                      storage_type == nvidia::gxf::MemoryStorageType::kHost;
+
   if (data_per_input_tensor.find(current_tensor) == data_per_input_tensor.end()) {
     auto db = std::make_shared<HoloInfer::DataBuffer>(dtype);
-    db->host_buffer.resize(buffer_size);
+    if (!borrow) { db->host_buffer.resize(buffer_size); }
     db->device_buffer->resize(buffer_size);
 
     data_per_input_tensor.insert({current_tensor, std::move(db)});
+  } else if (borrow) {
+    auto tensor_db = data_per_input_tensor.at(current_tensor);
+    if (tensor_db->device_buffer->size() != buffer_size) {
+      tensor_db->device_buffer->resize(buffer_size);
+    }
   } else {
     // allocate buffer for dynamic tensor size
     auto tensor_db = data_per_input_tensor.at(current_tensor);
-    if (tensor_db->host_buffer.size() != buffer_size) {
+    if (tensor_db->host_buffer.size() != buffer_size || tensor_db->host_buffer.is_borrowed()) {
       tensor_db->host_buffer.resize(buffer_size);
     }
     if (tensor_db->device_buffer->size() != buffer_size) {
@@ -57,7 +79,10 @@ gxf_result_t extract_data(nvidia::gxf::MemoryStorageType to,
     }
   }
 
-  if (to == nvidia::gxf::MemoryStorageType::kHost) {
+  if (borrow) {
+    data_per_input_tensor.at(current_tensor)
+        ->host_buffer.borrow(in_tensor_data, buffer_size, in_tensor_owner);
+  } else if (to == nvidia::gxf::MemoryStorageType::kHost) {
     auto in_tensor_ptr = data_per_input_tensor.at(current_tensor)->host_buffer.data();
 
     if (storage_type == nvidia::gxf::MemoryStorageType::kDevice) {
@@ -109,7 +134,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                 HoloInfer::DataMap& data_per_input_tensor,
                                 std::map<std::string, std::vector<int>>& dims_per_tensor,
                                 bool cuda_buffer_out, const std::string& module,
-                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler) {
+                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler,
+                                std::optional<nvidia::gxf::Timestamp>* timestamp) {
   try {
     HoloInfer::TimePoint s_time, e_time;
     HoloInfer::timer_init(s_time);
@@ -119,6 +145,17 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
     if (cuda_buffer_out) { to = nvidia::gxf::MemoryStorageType::kDevice; }
 
     auto messages = op_input.receive<std::vector<holoscan::gxf::Entity>>("receivers").value();
+    if (timestamp != nullptr) {
+      timestamp->reset();
+      for (const auto& in_message : messages) {
+        auto maybe_timestamp =
+            static_cast<const nvidia::gxf::Entity&>(in_message).get<nvidia::gxf::Timestamp>();
+        if (maybe_timestamp) {
+          *timestamp = *maybe_timestamp.value();
+          break;
+        }
+      }
+    }
     for (unsigned int i = 0; i < in_tensors.size(); ++i) {
       // nvidia::gxf::Handle<nvidia::gxf::Tensor> in_tensor;
       std::shared_ptr<holoscan::Tensor> in_tensor;
@@ -169,6 +206,10 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
       size_t buffer_size = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
       dims_per_tensor[in_tensors[i]] = std::move(dims);
 
+      // the DLPack context references the tensor memory, keeping it alive while borrowed
+      std::shared_ptr<void> in_tensor_owner;
+      if (is_contiguous(in_tensor_gxf)) { in_tensor_owner = in_tensor->dl_ctx(); }
+
       gxf_result_t status = GXF_SUCCESS;
       switch (element_type) {
         case nvidia::gxf::PrimitiveType::kFloat32:
@@ -180,7 +221,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                        in_tensors[i],
                                        buffer_size,
                                        module,
-                                       cstream);
+                                       cstream,
+                                       in_tensor_owner);
           break;
         case nvidia::gxf::PrimitiveType::kInt32:
           status = extract_data<int32_t>(to,
@@ -191,7 +233,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                          in_tensors[i],
                                          buffer_size,
                                          module,
-                                         cstream);
+                                         cstream,
+                                         in_tensor_owner);
           break;
         case nvidia::gxf::PrimitiveType::kInt8:
           status = extract_data<int8_t>(to,
@@ -202,7 +245,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                         in_tensors[i],
                                         buffer_size,
                                         module,
-                                        cstream);
+                                        cstream,
+                                        in_tensor_owner);
           break;
         case nvidia::gxf::PrimitiveType::kInt64:
           status = extract_data<int64_t>(to,
@@ -213,7 +257,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                          in_tensors[i],
                                          buffer_size,
                                          module,
-                                         cstream);
+                                         cstream,
+                                         in_tensor_owner);
           break;
         case nvidia::gxf::PrimitiveType::kUnsigned8:
           status = extract_data<uint8_t>(to,
@@ -224,7 +269,8 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                          in_tensors[i],
                                          buffer_size,
                                          module,
-                                         cstream);
+                                         cstream,
+                                         in_tensor_owner);
           break;
         default: {
           return HoloInfer::report_error(module,
@@ -256,7 +302,27 @@ gxf_result_t transmit_data(nvidia::gxf::MemoryStorageType from, nvidia::gxf::Mem
     return HoloInfer::report_error(module, "Data transmission, Out tensor allocation.");
 
   if (from == nvidia::gxf::MemoryStorageType::kHost) {
-    if (to == nvidia::gxf::MemoryStorageType::kHost) {
+    auto& host_buffer = input_data_map.at(current_tensor)->host_buffer;
+    if (to == nvidia::gxf::MemoryStorageType::kHost &&
+        host_buffer.get_bytes() == buffer_size * sizeof(T)) {
+      // The out tensor shares the host data. The buffer keeps its storage, and thus the address
+      // bound by the inference backends, unless the tensor is still used when the buffer is
+      // written again (see HostBuffer::reclaim)
+      auto data = host_buffer.lend();
+      auto result = out_tensor.value()->wrapMemory(
+          output_shape,
+          nvidia::gxf::PrimitiveTypeTraits<T>::value,
+          sizeof(T),
+          nvidia::gxf::ComputeTrivialStrides(output_shape, sizeof(T)),
+          nvidia::gxf::MemoryStorageType::kHost,
+          data.get(),
+          [data](void*) mutable {
+            data.reset();
+            return nvidia::gxf::Success;
+          });
+      if (!result)
+        return HoloInfer::report_error(module, "Data transmission, Out tensor wrapping.");
+    } else if (to == nvidia::gxf::MemoryStorageType::kHost) {
       out_tensor.value()->reshape<T>(
           output_shape, nvidia::gxf::MemoryStorageType::kHost, allocator_);
       if (!out_tensor.value()->pointer())
@@ -361,7 +427,8 @@ gxf_result_t transmit_data_per_model(gxf_context_t& cont,
                                      bool cuda_buffer_out,
                                      const nvidia::gxf::Handle<nvidia::gxf::Allocator>& allocator_,
                                      const std::string& module,
-                                     CudaStreamHandler& cuda_stream_handler) {
+                                     CudaStreamHandler& cuda_stream_handler,
+                                     const nvidia::gxf::Timestamp* timestamp) {
   HoloInfer::TimePoint s_time, e_time;
   HoloInfer::timer_init(s_time);
   try {
@@ -556,6 +623,14 @@ gxf_result_t transmit_data_per_model(gxf_context_t& cont,
       }
     }
 
+    if (timestamp != nullptr) {
+      auto out_timestamp = out_message.value().add<nvidia::gxf::Timestamp>("timestamp");
+      if (!out_timestamp) {
+        return HoloInfer::report_error(module, "Data Transmission, Timestamp creation failed.");
+      }
+      *out_timestamp.value() = *timestamp;
+    }
+
     // single transmitter used
     auto result = gxf::Entity(std::move(out_message.value()));
     op_output.emit(result);
@@ -100,6 +100,32 @@ TEST(CodecRegistry, TestTypeIndexToNameInvalid) {
   ASSERT_TRUE(err_msg.find("No codec for type") != std::string::npos);
 }
 
+TEST(CodecRegistry, TestCodecId) {
+  auto codec_registry = CodecRegistry::get_instance();
+  double d = 5.0;
+  const auto* entry = codec_registry.find_codec(std::type_index(typeid(d)));
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(entry->name, "double"s);
+  EXPECT_EQ(entry->id, CodecRegistry::codec_id("double"));
+  EXPECT_TRUE(entry->unique_id);
+
+  // the codec is found by its ID
+  EXPECT_EQ(codec_registry.find_codec(entry->id), entry);
+  auto& deserializer = codec_registry.get_deserializer(entry->id);
+  EXPECT_EQ(typeid(deserializer), typeid(holoscan::CodecRegistry::none_deserialize));
+
+  // IDs depend only on the name
+  EXPECT_NE(CodecRegistry::codec_id("float"), CodecRegistry::codec_id("double"));
+  EXPECT_EQ(CodecRegistry::codec_id("float"), CodecRegistry::codec_id("float"s));
+}
+
+TEST(CodecRegistry, TestCodecIdInvalid) {
+  auto codec_registry = CodecRegistry::get_instance();
+  std::set<std::vector<std::complex<float>>> no_codec;
+  EXPECT_EQ(codec_registry.find_codec(std::type_index(typeid(no_codec))), nullptr);
+  EXPECT_EQ(codec_registry.find_codec(CodecRegistry::codec_id("non-existent")), nullptr);
+}
+
 TEST(CodecRegistry, TestGetSerializerFromString) {
   auto codec_registry = CodecRegistry::get_instance();
   auto& s = codec_registry.get_serializer("int16_t"s);
@@ -18,15 +18,25 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../config.hpp"
 #include "../utils.hpp"
 #include "common/assert.hpp"
+#include "holoscan/core/dataflow_trace_sink.hpp"
 #include "holoscan/core/dataflow_tracker.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "holoscan/core/latency_histogram.hpp"
+#include "holoscan/core/messagelabel.hpp"
+#include "holoscan/core/operator.hpp"
 
 namespace holoscan {
 
@@ -34,6 +44,7 @@ class MockDataFlowTracker : public DataFlowTracker {
  public:
   using DataFlowTracker::update_latency;
   using DataFlowTracker::update_source_messages_number;
+  using DataFlowTracker::write_to_trace;
 };
 
 // Test case to check set_skip_starting_messages
@@ -253,4 +264,270 @@ TEST(DataFlowTracker, GetPathStrings) {
   }
 }
 
+TEST(DataFlowTracker, PercentileMetrics) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+
+  std::string pathname = "test";
+
+  // No percentile is available before any message is tracked
+  tracker.update_latency(pathname, -1);
+  ASSERT_EQ(tracker.get_metric(pathname, DataFlowMetric::kP50E2ELatency), -1);
+
+  tracker.set_skip_latencies(0);
+  for (int i = 1; i <= 1000; i++) { tracker.update_latency(pathname, i / 10.0); }
+
+  // Percentiles are within the relative error of the histogram (1/32)
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP50E2ELatency), 50.0, 50.0 / 32);
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP90E2ELatency), 90.0, 90.0 / 32);
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP99E2ELatency), 99.0, 99.0 / 32);
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP999E2ELatency), 99.9, 99.9 / 32);
+  ASSERT_LE(tracker.get_metric(pathname, DataFlowMetric::kP50E2ELatency),
+            tracker.get_metric(pathname, DataFlowMetric::kP99E2ELatency));
+}
+
+TEST(DataFlowTracker, GetLatencyHistogram) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 2, 0);
+
+  std::string pathname = "test";
+
+  ASSERT_TRUE(tracker.get_latency_histogram(pathname).empty());
+
+  for (int i = 0; i < 10; i++) { tracker.update_latency(pathname, 0.01); }
+  for (int i = 0; i < 5; i++) { tracker.update_latency(pathname, 0.02); }
+
+  // The last two messages are discarded
+  auto histogram = tracker.get_latency_histogram(pathname);
+  ASSERT_EQ(histogram.size(), 2);
+  ASSERT_DOUBLE_EQ(histogram[0].first, 0.01);
+  ASSERT_EQ(histogram[0].second, 10);
+  ASSERT_DOUBLE_EQ(histogram[1].first, 0.02);
+  ASSERT_EQ(histogram[1].second, 3);
+}
+
+// The paths of a label are looked up by their hash, but must give the same metrics as the paths
+// looked up by their name
+TEST(DataFlowTracker, HashKeyedPathsMatchStringKeyedPaths) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+  tracker.set_skip_latencies(0);
+
+  auto tx = F.make_operator<Operator>("tx");
+  auto mx = F.make_operator<Operator>("mx");
+  auto rx = F.make_operator<Operator>("rx");
+  tx->id(1);
+  mx->id(2);
+  rx->id(3);
+
+  MessageLabel label;
+  label.add_new_op_timestamp(OperatorTimestampLabel(tx.get(), 0, 0));
+  label.add_new_op_timestamp(OperatorTimestampLabel(mx.get(), 0, 0));
+  label.add_new_op_timestamp(OperatorTimestampLabel(rx.get(), 0, 0));
+  ASSERT_EQ(label.num_paths(), 1);
+  const std::string pathname = label.get_path_name(0);
+  ASSERT_EQ(pathname, "tx,mx,rx");
+
+  // The same latencies, once through the label and once through the name of its path
+  const std::string reference = "reference";
+  for (int i = 1; i <= 100; i++) {
+    tracker.update_latency(label, 0, i / 10.0);
+    tracker.update_latency(reference, i / 10.0);
+  }
+
+  // The path registered through the label is listed under its name
+  ASSERT_EQ(tracker.get_num_paths(), 2);
+  auto paths = tracker.get_path_strings();
+  ASSERT_TRUE(std::find(paths.begin(), paths.end(), pathname) != paths.end());
+
+  for (auto metric : {DataFlowMetric::kNumDstMessages,
+                      DataFlowMetric::kMinE2ELatency,
+                      DataFlowMetric::kMaxE2ELatency,
+                      DataFlowMetric::kAvgE2ELatency,
+                      DataFlowMetric::kP50E2ELatency,
+                      DataFlowMetric::kP99E2ELatency}) {
+    ASSERT_DOUBLE_EQ(tracker.get_metric(pathname, metric), tracker.get_metric(reference, metric));
+  }
+  ASSERT_EQ(tracker.get_latency_histogram(pathname), tracker.get_latency_histogram(reference));
+
+  // Latencies recorded by name are added to the metrics of the hash-keyed path
+  tracker.update_latency(pathname, 20.0);
+  tracker.update_latency(label, 0, 30.0);
+  ASSERT_EQ(tracker.get_metric(pathname, DataFlowMetric::kNumDstMessages), 102);
+  ASSERT_DOUBLE_EQ(tracker.get_metric(pathname, DataFlowMetric::kMaxE2ELatency), 30.0);
+}
+
+TEST(MessageLabel, PathHashDependsOnOperatorSequence) {
+  Fragment F;
+  auto tx = F.make_operator<Operator>("tx");
+  auto rx = F.make_operator<Operator>("rx");
+  tx->id(1);
+  rx->id(2);
+
+  MessageLabel label1;
+  label1.add_new_op_timestamp(OperatorTimestampLabel(tx.get(), 10, 20));
+  label1.add_new_op_timestamp(OperatorTimestampLabel(rx.get(), 30, 40));
+
+  // Same operators with other timestamps, added as a whole path
+  MessageLabel label2;
+  label2.add_new_path({OperatorTimestampLabel(tx.get(), 50, 60),
+                       OperatorTimestampLabel(rx.get(), 70, 80)});
+  ASSERT_EQ(label1.get_path_hash(0), label2.get_path_hash(0));
+
+  // Same operators in the reverse order
+  MessageLabel label3;
+  label3.add_new_path({OperatorTimestampLabel(rx.get(), 0, 0),
+                       OperatorTimestampLabel(tx.get(), 0, 0)});
+  ASSERT_NE(label1.get_path_hash(0), label3.get_path_hash(0));
+}
+
+TEST(MessageLabel, HasOperatorByPointer) {
+  Fragment F;
+  auto tx = F.make_operator<Operator>("tx");
+  auto mx = F.make_operator<Operator>("mx");
+  auto rx = F.make_operator<Operator>("rx");
+  auto other = F.make_operator<Operator>("other");
+
+  MessageLabel label;
+  label.add_new_path({OperatorTimestampLabel(tx.get(), 0, 0),
+                      OperatorTimestampLabel(rx.get(), 0, 0)});
+  label.add_new_path({OperatorTimestampLabel(mx.get(), 0, 0),
+                      OperatorTimestampLabel(rx.get(), 0, 0)});
+
+  ASSERT_EQ(label.has_operator(tx.get()), std::vector<int>({0}));
+  ASSERT_EQ(label.has_operator(mx.get()), std::vector<int>({1}));
+  ASSERT_EQ(label.has_operator(rx.get()), std::vector<int>({0, 1}));
+  ASSERT_TRUE(label.has_operator(other.get()).empty());
+
+  // Same result as the lookup by name
+  for (const auto& op : {tx, mx, rx, other}) {
+    ASSERT_EQ(label.has_operator(op.get()), label.has_operator(op->name()));
+  }
+}
+
+// Replacing the trace sink while other threads write to it must be safe
+TEST(DataFlowTracker, EnableTraceWhileWriting) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+
+  auto tx = F.make_operator<Operator>("tx");
+  auto rx = F.make_operator<Operator>("rx");
+  MessageLabel label;
+  label.add_new_op_timestamp(OperatorTimestampLabel(tx.get(), 0, 0));
+  label.add_new_op_timestamp(OperatorTimestampLabel(rx.get(), 0, 0));
+
+  const std::vector<std::string> filenames = {"dataflow_trace_swap_test1.bin",
+                                              "dataflow_trace_swap_test2.bin"};
+  tracker.enable_trace(filenames[0]);
+
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> writers;
+  for (int i = 0; i < 4; i++) {
+    writers.emplace_back([&]() {
+      while (!stop.load()) { tracker.write_to_trace(label); }
+    });
+  }
+  for (int i = 0; i < 20; i++) { tracker.enable_trace(filenames[i % 2]); }
+  stop = true;
+  for (auto& writer : writers) { writer.join(); }
+  tracker.end_trace();
+
+  for (const auto& filename : filenames) { std::remove(filename.c_str()); }
+}
+
+TEST(LatencyHistogram, BucketBounds) {
+  for (uint64_t value : {uint64_t{0}, uint64_t{63}, uint64_t{64}, uint64_t{1000}, uint64_t{123456},
+                         LatencyHistogram::kMaxTrackableValue}) {
+    size_t index = LatencyHistogram::bucket_index(value);
+    ASSERT_LT(index, LatencyHistogram::kNumBuckets);
+    ASSERT_LE(LatencyHistogram::bucket_lower_bound(index), value);
+    ASSERT_GE(LatencyHistogram::bucket_upper_bound(index), value);
+  }
+  // Values larger than the trackable range are clamped into the last bucket
+  ASSERT_EQ(LatencyHistogram::bucket_index(LatencyHistogram::kMaxTrackableValue * 2),
+            LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogram, Percentiles) {
+  LatencyHistogram histogram;
+  for (int i = 0; i < 100; i++) { histogram.record(10); }
+  for (int i = 0; i < 100; i++) { histogram.record(1000); }
+  ASSERT_EQ(histogram.total_count(), 200);
+  ASSERT_EQ(histogram.value_at_percentile(50), 10);
+  ASSERT_NEAR(histogram.value_at_percentile(99), 1000, 1000.0 / 32);
+}
+
+TEST(LatencyHistogram, SingleWriterRecordMatchesRecord) {
+  LatencyHistogram histogram;
+  LatencyHistogram single_writer_histogram;
+  for (int64_t value : {int64_t{-5}, int64_t{0}, int64_t{10}, int64_t{10}, int64_t{123456}}) {
+    histogram.record(value);
+    single_writer_histogram.record_single_writer(value);
+  }
+  ASSERT_EQ(single_writer_histogram.total_count(), histogram.total_count());
+  ASSERT_EQ(single_writer_histogram.buckets(), histogram.buckets());
+}
+
+TEST(DataFlowTraceSink, RecordAndClose) {
+  std::string filename = "dataflow_trace_sink_test.bin";
+  {
+    DataFlowTraceSink sink(filename, 16);
+    sink.register_operator(1, "tx");
+    sink.register_operator(2, "rx");
+
+    // The ring buffer of this thread can hold all the events even if the writer thread has not
+    // drained any of them yet
+    for (int i = 0; i < 16; i++) {
+      DataFlowTraceEvent event;
+      event.message_id = sink.next_message_id();
+      event.operator_id = 1 + i % 2;
+      ASSERT_TRUE(sink.record(event));
+    }
+    sink.close();
+    ASSERT_EQ(sink.written_events(), 16);
+    ASSERT_EQ(sink.dropped_events(), 0);
+
+    // Events recorded after close() are dropped
+    ASSERT_FALSE(sink.record(DataFlowTraceEvent{}));
+  }
+
+  // Header + 2 operator name records + 16 event records
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  ASSERT_TRUE(file.is_open());
+  size_t expected_size = 16 + 2 * (4 + 8 + 4 + 2) + 16 * (4 + sizeof(DataFlowTraceEvent));
+  ASSERT_EQ(static_cast<size_t>(file.tellg()), expected_size);
+  file.close();
+  std::remove(filename.c_str());
+}
+
+TEST(DataFlowTraceSink, RemoveRingsOfExitedThreads) {
+  std::string filename = "dataflow_trace_sink_rings_test.bin";
+  DataFlowTraceSink sink(filename, 16, 1);
+
+  std::vector<uint64_t> message_ids(4);
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < message_ids.size(); i++) {
+    producers.emplace_back([&sink, &message_ids, i]() {
+      DataFlowTraceEvent event;
+      event.message_id = message_ids[i] = sink.next_message_id();
+      sink.record(event);
+    });
+  }
+  for (auto& producer : producers) { producer.join(); }
+
+  // Message IDs are unique across threads
+  std::sort(message_ids.begin(), message_ids.end());
+  ASSERT_EQ(std::unique(message_ids.begin(), message_ids.end()), message_ids.end());
+
+  // The ring buffers of the exited threads are removed once their events are written
+  for (int i = 0; i < 1000 && sink.num_rings() > 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_EQ(sink.num_rings(), 0);
+  ASSERT_EQ(sink.written_events(), message_ids.size());
+
+  sink.close();
+  std::remove(filename.c_str());
+}
+
 }  // namespace holoscan
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/deadline_scheduling_term.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Times in nanoseconds of std::chrono::steady_clock
+constexpr int64_t kNow = 1000000000;
+constexpr int64_t kMaxHoldNs = DeadlineArbiter::kMaxHoldNs;
+
+}  // namespace
+
+TEST(DeadlineArbiter, TestEarlierDeadlineBlocksLaterOne) {
+  DeadlineArbiter arbiter(1);
+  const size_t running = arbiter.add_entity(1);
+  const size_t early = arbiter.add_entity(2);
+  const size_t late = arbiter.add_entity(3);
+  int64_t wait_until_ns = 0;
+
+  // The only worker is busy: the entity with the earlier deadline is held back and pending
+  arbiter.on_started(running);
+  EXPECT_FALSE(arbiter.try_dispatch(early, kNow, kNow + 10 * kMaxHoldNs, &wait_until_ns));
+  arbiter.on_executed(running);
+
+  // The pending entity with the earlier deadline holds back the later one, until its deadline
+  const int64_t now_ns = kNow + 1;
+  EXPECT_FALSE(arbiter.try_dispatch(late, now_ns, kNow + 20 * kMaxHoldNs, &wait_until_ns));
+  EXPECT_EQ(wait_until_ns, now_ns + kMaxHoldNs);
+  EXPECT_TRUE(arbiter.try_dispatch(early, now_ns, kNow + 10 * kMaxHoldNs, &wait_until_ns));
+
+  // The entity with the later deadline is still pending, but does not hold back an earlier frame
+  arbiter.on_executed(early);
+  EXPECT_TRUE(arbiter.try_dispatch(early, now_ns, kNow + 15 * kMaxHoldNs, &wait_until_ns));
+}
+
+TEST(DeadlineArbiter, TestEntityWithoutDeadlineComesLast) {
+  DeadlineArbiter arbiter(1);
+  const size_t running = arbiter.add_entity(1);
+  const size_t critical = arbiter.add_entity(2);
+  const size_t bulk = arbiter.add_entity(3);
+  int64_t wait_until_ns = 0;
+
+  arbiter.on_started(running);
+  EXPECT_FALSE(arbiter.try_dispatch(critical, kNow, kNow + kMaxHoldNs / 2, &wait_until_ns));
+  arbiter.on_executed(running);
+
+  EXPECT_FALSE(arbiter.try_dispatch(bulk, kNow, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  // Held until the pending entity waited for kMaxHoldNs, as its deadline passes before that
+  EXPECT_EQ(wait_until_ns, kNow + kMaxHoldNs);
+
+  // Once the deadline passed and the entity waited for kMaxHoldNs, it stops holding back others
+  EXPECT_TRUE(
+      arbiter.try_dispatch(bulk, kNow + kMaxHoldNs, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+}
+
+TEST(DeadlineArbiter, TestDispatchedEntityStopsCountingAfterMaxHold) {
+  DeadlineArbiter arbiter(1);
+  const size_t dispatched = arbiter.add_entity(1);
+  const size_t other = arbiter.add_entity(2);
+  int64_t wait_until_ns = 0;
+
+  ASSERT_TRUE(arbiter.try_dispatch(dispatched, kNow, kNow + kMaxHoldNs, &wait_until_ns));
+
+  // The dispatched entity did not start running: it occupies the worker for kMaxHoldNs
+  EXPECT_FALSE(arbiter.try_dispatch(
+      other, kNow + kMaxHoldNs - 1, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  EXPECT_EQ(wait_until_ns, kNow + kMaxHoldNs);
+  EXPECT_TRUE(
+      arbiter.try_dispatch(other, kNow + kMaxHoldNs, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+}
+
+TEST(DeadlineArbiter, TestRunningEntityKeepsCounting) {
+  DeadlineArbiter arbiter(1);
+  const size_t running = arbiter.add_entity(1);
+  const size_t other = arbiter.add_entity(2);
+  int64_t wait_until_ns = 0;
+
+  ASSERT_TRUE(arbiter.try_dispatch(running, kNow, kNow + kMaxHoldNs, &wait_until_ns));
+  arbiter.on_started(running);
+
+  // Unlike a dispatched entity, a running entity occupies the worker until it executed
+  EXPECT_FALSE(arbiter.try_dispatch(
+      other, kNow + 10 * kMaxHoldNs, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  arbiter.on_executed(running);
+  EXPECT_TRUE(arbiter.try_dispatch(
+      other, kNow + 10 * kMaxHoldNs, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+}
+
+TEST(DeadlineArbiter, TestOnExecutedReturnsHeldEntities) {
+  DeadlineArbiter arbiter(1);
+  const size_t running = arbiter.add_entity(10);
+  const size_t held = arbiter.add_entity(20);
+  const size_t other_held = arbiter.add_entity(30);
+  const size_t idle = arbiter.add_entity(40);
+  int64_t wait_until_ns = 0;
+
+  arbiter.on_started(running);
+  EXPECT_FALSE(arbiter.try_dispatch(held, kNow, kNow + kMaxHoldNs, &wait_until_ns));
+  EXPECT_FALSE(
+      arbiter.try_dispatch(other_held, kNow, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  arbiter.set_idle(idle);
+
+  // The held entities are notified to be checked again; idle entities are not
+  EXPECT_EQ(arbiter.on_executed(running), (std::vector<gxf_uid_t>{20, 30}));
+
+  // An entity whose frame was consumed is no longer held
+  arbiter.set_idle(held);
+  EXPECT_TRUE(
+      arbiter.try_dispatch(other_held, kNow, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  arbiter.on_started(other_held);
+  EXPECT_TRUE(arbiter.on_executed(other_held).empty());
+}
+
+TEST(DeadlineArbiter, TestWorkersAreShared) {
+  DeadlineArbiter arbiter(2);
+  const size_t first = arbiter.add_entity(1);
+  const size_t second = arbiter.add_entity(2);
+  const size_t third = arbiter.add_entity(3);
+  int64_t wait_until_ns = 0;
+
+  EXPECT_TRUE(arbiter.try_dispatch(first, kNow, kNow + kMaxHoldNs, &wait_until_ns));
+  arbiter.on_started(first);
+  EXPECT_TRUE(
+      arbiter.try_dispatch(second, kNow, DeadlineArbiter::kNoDeadline, &wait_until_ns));
+  arbiter.on_started(second);
+  EXPECT_FALSE(arbiter.try_dispatch(third, kNow, kNow + kMaxHoldNs, &wait_until_ns));
+}
+
+}  // namespace holoscan
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include <holoscan/holoscan.hpp>
+#include "holoscan/core/gxf/gxf_wrapper.hpp"
+
+namespace holoscan {
+
+namespace ops {
+
+class TickCounterOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(TickCounterOp)
+
+  TickCounterOp() = default;
+
+  void setup(OperatorSpec&) override {}
+
+  void compute(InputContext& op_input, OutputContext& op_output,
+               ExecutionContext& context) override {
+    if (op_input.op() == this && op_output.op() == this && context.input() == &op_input) {
+      count_++;
+    }
+  };
+
+  int64_t count() const { return count_; }
+
+ private:
+  int64_t count_ = 0;
+};
+
+}  // namespace ops
+
+TEST(GXFWrapper, TestTickRecordsMetrics) {
+  Fragment fragment;
+  auto op = fragment.make_operator<ops::TickCounterOp>("tick_counter");
+  fragment.add_operator(op);
+
+  gxf::GXFWrapper wrapper;
+  wrapper.set_operator(op.get());
+  ASSERT_EQ(wrapper.start(), GXF_SUCCESS);
+  for (int i = 0; i < 100; i++) { wrapper.tick(); }
+  EXPECT_EQ(wrapper.stop(), GXF_SUCCESS);
+
+  auto stats = op->metrics().statistics();
+  EXPECT_EQ(stats.tick_count, 100);
+  EXPECT_GE(stats.compute_time_max_ms, stats.compute_time_mean_ms);
+  EXPECT_GE(stats.compute_time_p99_ms, stats.compute_time_p50_ms);
+  EXPECT_EQ(stats.input_queue_depth_max, 0);
+  uint64_t histogram_count = 0;
+  for (const auto& [bound, count] : stats.compute_time_histogram) { histogram_count += count; }
+  EXPECT_EQ(histogram_count, 100);
+
+  auto metrics = fragment.operator_metrics();
+  ASSERT_EQ(metrics.count("tick_counter"), 1);
+  EXPECT_EQ(metrics["tick_counter"].tick_count, 100);
+
+  // Metrics are reset when the operator is started again
+  ASSERT_EQ(wrapper.start(), GXF_SUCCESS);
+  EXPECT_EQ(op->metrics().statistics().tick_count, 0);
+  EXPECT_EQ(wrapper.stop(), GXF_SUCCESS);
+}
+
+}  // namespace holoscan
@@ -161,6 +161,25 @@ TEST(IOSpec, TestIOSpecConnectorNone) {
   }
 }
 
+TEST(IOSpec, TestIOSpecConnectorHandle) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput, &typeid(holoscan::gxf::Entity));
+  EXPECT_EQ(spec.connector_handle(), nullptr);
+
+  int dummy_receiver = 0;
+  spec.connector_handle(&dummy_receiver);
+  EXPECT_EQ(spec.connector_handle(), &dummy_receiver);
+
+  // replacing the connector invalidates the cached handle
+  spec.connector(IOSpec::ConnectorType::kDoubleBuffer);
+  EXPECT_EQ(spec.connector_handle(), nullptr);
+
+  spec.connector_handle(&dummy_receiver);
+  spec.connector(std::make_shared<DoubleBufferReceiver>());
+  EXPECT_EQ(spec.connector_handle(), nullptr);
+}
+
 TEST(IOSpec, TestIOSpecConnectorDoubleBufferReceiver) {
   OperatorSpec op_spec = OperatorSpec();
   IOSpec spec =
@@ -359,6 +378,20 @@ conditions:
   EXPECT_EQ(spec.description(), description);
 }
 
+TEST(IOSpec, TestIOSpecFanOut) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec = IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kOutput);
+  EXPECT_FALSE(spec.fan_out());
+
+  // fan_out returns the IOSpec so that it can be chained with other IOSpec methods
+  IOSpec& ret = spec.fan_out(true);
+  EXPECT_EQ(&ret, &spec);
+  EXPECT_TRUE(spec.fan_out());
+
+  spec.fan_out(false);
+  EXPECT_FALSE(spec.fan_out());
+}
+
 TEST(IOSpec, TestIOSpecInvalidPortName) {
   // "." character is not allowed in IOSPec names
   OperatorSpec op_spec = OperatorSpec();
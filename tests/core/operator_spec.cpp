@@ -72,6 +72,30 @@ TEST(OperatorSpec, TestOperatorSpectOutput) {
   EXPECT_TRUE(log_output.find("already exists") != std::string::npos);
 }
 
+TEST(OperatorSpec, TestOperatorSpecPortHandle) {
+  OperatorSpec spec = OperatorSpec();
+  spec.input<gxf::Entity>("in");
+  spec.output<gxf::Entity>("out");
+
+  PortHandle in_handle = spec.input_handle("in");
+  ASSERT_TRUE(in_handle);
+  EXPECT_EQ(in_handle.io_spec(), spec.inputs()["in"].get());
+  EXPECT_EQ(std::string(in_handle.name()), "in");
+
+  PortHandle out_handle = spec.output_handle("out");
+  ASSERT_TRUE(out_handle);
+  EXPECT_EQ(out_handle.io_spec(), spec.outputs()["out"].get());
+  EXPECT_EQ(std::string(out_handle.name()), "out");
+
+  // non-existent port names give an invalid handle
+  testing::internal::CaptureStderr();
+  EXPECT_FALSE(spec.input_handle("out"));
+  EXPECT_FALSE(spec.output_handle("in"));
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("does not exist") != std::string::npos);
+  EXPECT_EQ(std::string(PortHandle().name()), "");
+}
+
 TEST(OperatorSpec, TestOperatorSpecParam) {
   testing::internal::CaptureStderr();
 
@@ -213,6 +213,32 @@ TEST(SystemResourceManager, TestGetCPUInfo) {
                                                                << log_output << "\n";
 }
 
+TEST(SystemResourceManager, TestGetNUMANodeCPUSet) {
+  holoscan::Topology topology;
+  topology.load();
+  holoscan::CPUResourceMonitor cpu_resource_monitor(topology.context());
+  holoscan::CPUInfo cpu_info = cpu_resource_monitor.cpu_info();
+
+  int32_t num_numa_nodes = cpu_resource_monitor.num_numa_nodes();
+  EXPECT_GT(num_numa_nodes, 0);
+
+  // Every CPU belongs to exactly one NUMA node
+  int num_cpus = 0;
+  for (int32_t node = 0; node < num_numa_nodes; node++) {
+    cpu_set_t cpu_set = cpu_resource_monitor.numa_node_cpu_set(node);
+    num_cpus += CPU_COUNT(&cpu_set);
+  }
+  EXPECT_EQ(num_cpus, cpu_info.num_cpus);
+
+  // Out of range nodes have an empty CPU set
+  testing::internal::CaptureStderr();
+  cpu_set_t cpu_set = cpu_resource_monitor.numa_node_cpu_set(num_numa_nodes);
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_EQ(CPU_COUNT(&cpu_set), 0);
+  EXPECT_TRUE(log_output.find("not found") != std::string::npos) << "Log message:\n"
+                                                                 << log_output << "\n";
+}
+
 TEST(SystemResourceManager, TestGetGPUInfo) {
   // capture output so that we can check that the expected value is present
   testing::internal::CaptureStderr();
@@ -0,0 +1,219 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The global operator new of this test executable counts the heap allocations, so these tests are
+// built separately from the other core tests.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include "holoscan/core/gxf/gxf_wrapper.hpp"
+
+namespace {
+
+// Heap allocations made by the current thread while counting is enabled
+thread_local bool count_allocations = false;
+thread_local uint64_t allocation_count = 0;
+
+void* counted_allocation(std::size_t size) {
+  if (count_allocations) { allocation_count++; }
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  return ptr;
+}
+
+/// Number of heap allocations made by the current thread while calling func
+template <typename FuncT>
+uint64_t allocations_of(FuncT&& func) {
+  const uint64_t start_count = allocation_count;
+  count_allocations = true;
+  func();
+  count_allocations = false;
+  return allocation_count - start_count;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  void* ptr = counted_allocation(size);
+  if (ptr == nullptr) { throw std::bad_alloc(); }
+  return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return counted_allocation(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+namespace holoscan {
+
+namespace {
+
+constexpr int kCount = 1000;
+/// Number of messages, past the first ones, whose allocations are checked
+constexpr size_t kSteadyStateCount = kCount - 10;
+
+class TickCounterOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(TickCounterOp)
+
+  TickCounterOp() = default;
+
+  void setup(OperatorSpec&) override {}
+
+  void compute(InputContext&, OutputContext&, ExecutionContext&) override { count_++; }
+
+  int64_t count() const { return count_; }
+
+ private:
+  int64_t count_ = 0;
+};
+
+/// Emits trivially copyable values, recording the allocations of each emit
+class CountingTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingTxOp)
+
+  CountingTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int64_t>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    const int64_t value = ++index_;
+    emit_allocations_.push_back(allocations_of([&]() { op_output.emit(value, "out"); }));
+  }
+
+  const std::vector<uint64_t>& emit_allocations() const { return emit_allocations_; }
+
+ private:
+  int64_t index_ = 0;
+  std::vector<uint64_t> emit_allocations_;
+};
+
+/// Receives the values, recording the allocations of each receive
+class CountingRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingRxOp)
+
+  CountingRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int64_t>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    int64_t value = 0;
+    receive_allocations_.push_back(
+        allocations_of([&]() { value = op_input.receive<int64_t>("in").value(); }));
+    sum_ += value;
+  }
+
+  const std::vector<uint64_t>& receive_allocations() const { return receive_allocations_; }
+  int64_t sum() const { return sum_; }
+
+ private:
+  std::vector<uint64_t> receive_allocations_;
+  int64_t sum_ = 0;
+};
+
+/// tx -> rx
+class PingApp : public holoscan::Application {
+ public:
+  void compose() override {
+    tx_ = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    rx_ = make_operator<CountingRxOp>("rx");
+    add_flow(tx_, rx_);
+  }
+
+  std::shared_ptr<CountingTxOp> tx_;
+  std::shared_ptr<CountingRxOp> rx_;
+};
+
+/// Allocations of the messages past the first ones, which may set up lazily created state
+std::vector<uint64_t> steady_state(const std::vector<uint64_t>& allocations) {
+  if (allocations.size() < kSteadyStateCount) { return {}; }
+  return std::vector<uint64_t>(allocations.end() - kSteadyStateCount, allocations.end());
+}
+
+}  // namespace
+
+TEST(TickAllocation, TestTickDoesNotAllocate) {
+  Fragment fragment;
+  auto op = fragment.make_operator<TickCounterOp>("tick_counter");
+
+  gxf::GXFWrapper wrapper;
+  wrapper.set_operator(op.get());
+  ASSERT_EQ(wrapper.start(), GXF_SUCCESS);
+
+  // The execution, input and output contexts are created on start() and reused by every tick
+  const uint64_t allocations = allocations_of([&]() {
+    for (int i = 0; i < kCount; i++) { wrapper.tick(); }
+  });
+
+  EXPECT_EQ(allocations, 0);
+  EXPECT_EQ(op->count(), kCount);
+  EXPECT_EQ(wrapper.stop(), GXF_SUCCESS);
+}
+
+TEST(TickAllocation, TestFusedPingDoesNotAllocate) {
+  auto app = make_application<PingApp>();
+  app->fuse_operators(true);
+
+  app->run();
+
+  // Messages of fused operators are passed without a GXF entity
+  EXPECT_EQ(app->rx_->sum(), int64_t{kCount} * (kCount + 1) / 2);
+  const auto emit_allocations = steady_state(app->tx_->emit_allocations());
+  const auto receive_allocations = steady_state(app->rx_->receive_allocations());
+  ASSERT_EQ(emit_allocations.size(), kSteadyStateCount);
+  ASSERT_EQ(receive_allocations.size(), kSteadyStateCount);
+  EXPECT_EQ(*std::max_element(emit_allocations.begin(), emit_allocations.end()), 0);
+  EXPECT_EQ(*std::max_element(receive_allocations.begin(), receive_allocations.end()), 0);
+}
+
+TEST(TickAllocation, TestPingAllocationsPerEmitAreConstant) {
+  auto app = make_application<PingApp>();
+
+  app->run();
+
+  // Each emit allocates the GXF entity and Message component of the message, the count does not
+  // depend on the number of messages sent before
+  EXPECT_EQ(app->rx_->sum(), int64_t{kCount} * (kCount + 1) / 2);
+  const auto emit_allocations = steady_state(app->tx_->emit_allocations());
+  ASSERT_EQ(emit_allocations.size(), kSteadyStateCount);
+  const auto [min_it, max_it] =
+      std::minmax_element(emit_allocations.begin(), emit_allocations.end());
+  EXPECT_EQ(*min_it, *max_it);
+  RecordProperty("allocations_per_emit", static_cast<int>(*max_it));
+}
+
+}  // namespace holoscan
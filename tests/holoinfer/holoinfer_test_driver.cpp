@@ -32,6 +32,8 @@ int main() {
     std::unique_ptr<ProcessingTests> processor_tests = std::make_unique<ProcessingTests>();
     processor_tests->parameter_test();
     processor_tests->parameter_setup_test();
+    processor_tests->kernel_test();
+    processor_tests->plan_test();
 
     holoinfer_tests->print_summary();
     processor_tests->print_summary();
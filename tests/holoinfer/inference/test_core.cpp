@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 void HoloInferTests::holoinfer_assert(const HoloInfer::InferStatus& status,
                                       const std::string& module, unsigned int current_test,
@@ -122,6 +123,11 @@ void HoloInferTests::setup_specifications() {
                                                                  enable_fp16,
                                                                  input_on_cuda,
                                                                  output_on_cuda);
+  inference_specs_->onnx_options_ = onnx_options;
+  inference_specs_->batch_size_map_ = batch_size_map;
+  inference_specs_->batch_delay_map_ = batch_delay_map;
+  inference_specs_->skip_threshold_map_ = skip_threshold_map;
+  inference_specs_->skip_max_frames_map_ = skip_max_frames_map;
 }
 
 HoloInfer::InferStatus HoloInferTests::create_specifications() {
@@ -169,3 +175,34 @@ HoloInfer::InferStatus HoloInferTests::do_inference() {
     return status;
   }
 }
+
+HoloInfer::InferStatus HoloInferTests::enqueue_frames(uint64_t first_tag, uint64_t count) {
+  HoloInfer::InferStatus status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR);
+
+  try {
+    if (!holoscan_infer_context_) { return status; }
+    for (uint64_t tag = first_tag; tag < first_tag + count; tag++) {
+      status = holoscan_infer_context_->enqueue_inference(
+          inference_specs_->data_per_tensor_, inference_specs_->output_per_model_, tag);
+      if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+    }
+    return status;
+  } catch (...) {
+    std::cout << "Exception occurred in batched inference.\n";
+    return status;
+  }
+}
+
+std::vector<uint64_t> HoloInferTests::dequeue_frames() {
+  std::vector<uint64_t> tags;
+  if (!holoscan_infer_context_) { return tags; }
+
+  // Only frames with the results of all models are returned
+  HoloInfer::DataMap frame_outputs;
+  uint64_t tag = 0;
+  while (holoscan_infer_context_->dequeue_inference(frame_outputs, tag)) {
+    if (frame_outputs.size() == out_tensor_names.size()) { tags.push_back(tag); }
+    frame_outputs.clear();
+  }
+  return tags;
+}
@@ -17,6 +17,7 @@
 #ifndef HOLOINFER_INFERENCE_TESTS_HPP
 #define HOLOINFER_INFERENCE_TESTS_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -48,6 +49,8 @@ class HoloInferTests {
   void parameter_setup_test();
   HoloInfer::InferStatus prepare_for_inference();
   HoloInfer::InferStatus do_inference();
+  HoloInfer::InferStatus enqueue_frames(uint64_t first_tag, uint64_t count);
+  std::vector<uint64_t> dequeue_frames();
   void inference_tests();
   void print_summary();
   int get_status();
@@ -86,6 +89,11 @@ class HoloInferTests {
   bool input_on_cuda = true;
   bool output_on_cuda = true;
   bool is_engine_path = false;
+  HoloInfer::OnnxRuntimeOptions onnx_options;
+  std::map<std::string, std::string> batch_size_map;
+  std::map<std::string, std::string> batch_delay_map;
+  std::map<std::string, std::string> skip_threshold_map;
+  std::map<std::string, std::string> skip_max_frames_map;
 
   const std::map<std::string, std::vector<int>> in_tensor_dimensions = {
       {"bmode_pre_proc", {320, 240, 3}},
@@ -165,7 +173,24 @@ class HoloInferTests {
       {28, "TRT backend, Basic parallel inference on multi-GPU"},
       {29, "TRT backend, Parallel inference on multi-GPU with I/O on host"},
       {30, "TRT backend, Parallel inference on multi-GPU with Input on host"},
-      {31, "TRT backend, Parallel inference on multi-GPU with Output on host"}};
+      {31, "TRT backend, Parallel inference on multi-GPU with Output on host"},
+      {32, "TRT backend, Per-model timing of parallel inference"},
+      {33, "ONNX backend, Multi-threaded inference on CPU with global thread pool"},
+      {34, "ONNX backend, Inference after host buffer reallocation"},
+      {35, "ONNX backend, Unsupported execution mode"},
+      {36, "TRT backend, Output buffers allocated from the context memory pool"},
+      {37, "Host buffer, Aligned storage reused within capacity and through the pool"},
+      {38, "Host buffer, Borrowed external memory and detached storage"},
+      {39, "TRT backend, Batching not supported"},
+      {40, "ONNX backend, Inference with a cached optimized model"},
+      {41, "ONNX backend, Outputs reused on identical frames with temporal skipping"},
+      {42, "Host buffer, Lent storage kept once released and replaced while in use"},
+      {43, "ONNX backend, Batch of frames inferred once full"},
+      {44, "ONNX backend, Incomplete batch inferred once the batch delay expired"},
+      {45, "ONNX backend, Incomplete batch inferred on flush"},
+      {46, "ONNX backend, Cached optimized model not reused for another model or level"},
+      {47, "ONNX backend, Changed frame inferred with temporal skipping"},
+      {48, "ONNX backend, Frame inferred once the skip frame count is reached"}};
 };
 
 #endif /* HOLOINFER_INFERENCE_TESTS_HPP */
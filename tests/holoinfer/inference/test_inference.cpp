@@ -17,9 +17,15 @@
 
 #include "test_core.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 void HoloInferTests::inference_tests() {
   std::string test_module = "Inference tests";
@@ -100,6 +106,111 @@ void HoloInferTests::inference_tests() {
   holoinfer_assert(
       status, test_module, 10, test_identifier_infer.at(10), HoloInfer::holoinfer_code::H_SUCCESS);
 
+  // Test: TRT backend, Per-model timing of parallel inference
+  auto model_timing = holoscan_infer_context_->get_model_timing();
+  status = HoloInfer::InferStatus();
+  if (model_timing.size() != model_path_map.size()) {
+    status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+  }
+  for (const auto& [model_name, timing] : model_timing) {
+    if (timing.count == 0 || timing.last_ms <= 0.0 || timing.max_ms < timing.last_ms) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+  }
+  holoinfer_assert(
+      status, test_module, 32, test_identifier_infer.at(32), HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Test: TRT backend, Output buffers allocated from the context memory pool
+  auto memory_stats = holoscan_infer_context_->get_host_memory_stats();
+  status = HoloInfer::InferStatus();
+  if (memory_stats.misses < out_tensor_names.size() || memory_stats.bytes_in_use == 0 ||
+      memory_stats.peak_bytes < memory_stats.bytes_in_use) {
+    status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+  }
+  holoinfer_assert(
+      status, test_module, 36, test_identifier_infer.at(36), HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Test: Host buffer, Aligned storage reused within capacity and through the pool
+  {
+    auto pool = std::make_shared<HoloInfer::HostMemoryPool>();
+    status = HoloInfer::InferStatus();
+    {
+      HoloInfer::HostBuffer buffer(HoloInfer::holoinfer_datatype::h_Float32, pool);
+      buffer.resize(1000);
+      auto data = buffer.data();
+      buffer.resize(10);
+      buffer.resize(1000);
+      if (data != buffer.data() ||
+          reinterpret_cast<uintptr_t>(data) % HoloInfer::HostMemoryPool::kAlignment != 0) {
+        status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+      }
+    }
+    HoloInfer::HostBuffer buffer(HoloInfer::holoinfer_datatype::h_Float32, pool);
+    buffer.resize(1000);
+    auto stats = pool->get_stats();
+    if (stats.hits != 1 || stats.misses != 1 || stats.bytes_cached != 0) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     37,
+                     test_identifier_infer.at(37),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: Host buffer, Borrowed external memory and detached storage
+    status = HoloInfer::InferStatus();
+    auto external = std::make_shared<std::vector<float>>(500, 1.0f);
+    buffer.borrow(external->data(), external->size(), external);
+    if (!buffer.is_borrowed() || buffer.data() != external->data() || buffer.size() != 500) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    buffer.clear();
+    if (buffer.is_borrowed() || external.use_count() != 1) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    buffer.resize(1000);
+    auto owned_data = buffer.data();
+    auto detached = buffer.detach();
+    if (detached.get() != owned_data || buffer.data() == owned_data || buffer.size() != 1000) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     38,
+                     test_identifier_infer.at(38),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: Host buffer, Lent storage kept once released and replaced while in use
+    status = HoloInfer::InferStatus();
+    auto stable_data = buffer.data();
+    {
+      auto lent = buffer.lend();
+      if (lent.get() != stable_data || buffer.lend() != lent) {
+        status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+      }
+    }
+    // The borrower released the data before the buffer is written again
+    buffer.reclaim();
+    if (buffer.data() != stable_data) { status.set_code(HoloInfer::holoinfer_code::H_ERROR); }
+    auto in_use = buffer.lend();
+    static_cast<float*>(in_use.get())[0] = 42.0f;
+    buffer.reclaim();
+    if (buffer.data() == stable_data || in_use.get() != stable_data ||
+        static_cast<float*>(in_use.get())[0] != 42.0f || buffer.size() != 1000) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    const auto bytes_in_use = pool->get_stats().bytes_in_use;
+    in_use.reset();
+    if (pool->get_stats().bytes_in_use >= bytes_in_use) {
+      status.set_code(HoloInfer::holoinfer_code::H_ERROR);
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     42,
+                     test_identifier_infer.at(42),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
   // Test: TRT backend, Basic sequential end-to-end cuda inference
   parallel_inference = false;
   status = prepare_for_inference();
@@ -148,6 +259,13 @@ void HoloInferTests::inference_tests() {
       status, test_module, 16, test_identifier_infer.at(16), HoloInfer::holoinfer_code::H_ERROR);
   inference_specs_->output_per_model_.at("aortic_infer")->host_buffer.resize(dbs);
 
+  // Test: TRT backend, Batching not supported
+  batch_size_map = {{"bmode_perspective", "4"}};
+  status = prepare_for_inference();
+  holoinfer_assert(
+      status, test_module, 39, test_identifier_infer.at(39), HoloInfer::holoinfer_code::H_ERROR);
+  batch_size_map.clear();
+
   if (use_onnxruntime) {
     // Test: ONNX backend, Basic parallel inference on CPU
     input_on_cuda = false;
@@ -172,6 +290,298 @@ void HoloInferTests::inference_tests() {
                      test_identifier_infer.at(18),
                      HoloInfer::holoinfer_code::H_SUCCESS);
 
+    // Test: ONNX backend, Multi-threaded inference on CPU with global thread pool
+    onnx_options.intra_op_num_threads = 4;
+    onnx_options.inter_op_num_threads = 2;
+    onnx_options.execution_mode = "parallel";
+    onnx_options.graph_optimization_level = "all";
+    onnx_options.use_global_thread_pool = true;
+    status = prepare_for_inference();
+    status = do_inference();
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) { status = do_inference(); }
+    holoinfer_assert(status,
+                     test_module,
+                     33,
+                     test_identifier_infer.at(33),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Inference after host buffer reallocation
+    dbs = inference_specs_->data_per_tensor_.at("bmode_pre_proc")->host_buffer.size();
+    inference_specs_->data_per_tensor_.at("bmode_pre_proc")->host_buffer.resize(2 * dbs);
+    inference_specs_->data_per_tensor_.at("bmode_pre_proc")->host_buffer.resize(dbs);
+    status = do_inference();
+    holoinfer_assert(status,
+                     test_module,
+                     34,
+                     test_identifier_infer.at(34),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Unsupported execution mode
+    onnx_options.execution_mode = "unknown";
+    status = prepare_for_inference();
+    holoinfer_assert(status,
+                     test_module,
+                     35,
+                     test_identifier_infer.at(35),
+                     HoloInfer::holoinfer_code::H_ERROR);
+    onnx_options = HoloInfer::OnnxRuntimeOptions();
+
+    // Test: ONNX backend, Inference with a cached optimized model
+    // the first setup optimizes and caches the models, the second one loads the cached models
+    // without writing them again
+    auto cache_dir = std::filesystem::temp_directory_path() / "holoinfer_test_model_cache";
+    std::filesystem::remove_all(cache_dir);
+    onnx_options.optimized_model_cache_dir = cache_dir.string();
+    auto cached_models = [&cache_dir]() {
+      std::map<std::string, std::filesystem::file_time_type> models;
+      std::error_code error;
+      for (const auto& entry : std::filesystem::directory_iterator(cache_dir, error)) {
+        if (entry.path().extension() == ".onnx") {
+          models[entry.path().filename().string()] = entry.last_write_time();
+        }
+      }
+      return models;
+    };
+    status = prepare_for_inference();
+    auto first_cached_models = cached_models();
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS &&
+        first_cached_models.size() != model_path_map.size()) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Optimized models not cached");
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = prepare_for_inference();
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS &&
+        cached_models() != first_cached_models) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Optimized models not loaded from the cache");
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) { status = do_inference(); }
+    holoinfer_assert(status,
+                     test_module,
+                     40,
+                     test_identifier_infer.at(40),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Cached optimized model not reused for another model or level
+    // a model file with the same name but another content, and another optimization level, are
+    // cached under new keys
+    auto model_dir = std::filesystem::temp_directory_path() / "holoinfer_test_cached_model";
+    std::filesystem::remove_all(model_dir);
+    std::filesystem::create_directories(model_dir);
+    const auto original_model_path_map = model_path_map;
+    const auto model_copy = model_dir / "model.onnx";
+    std::filesystem::copy_file(model_path_map.at("bmode_perspective"), model_copy);
+    model_path_map["bmode_perspective"] = model_copy.string();
+    status = prepare_for_inference();
+    size_t expected_cached_models = first_cached_models.size() + 1;
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      std::filesystem::copy_file(original_model_path_map.at("aortic_stenosis"),
+                                 model_copy,
+                                 std::filesystem::copy_options::overwrite_existing);
+      status = prepare_for_inference();
+      expected_cached_models++;
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      onnx_options.graph_optimization_level = "basic";
+      status = prepare_for_inference();
+      expected_cached_models += model_path_map.size();
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS &&
+        cached_models().size() != expected_cached_models) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Cached optimized model reused with another model or level");
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     46,
+                     test_identifier_infer.at(46),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+    model_path_map = original_model_path_map;
+    std::filesystem::remove_all(model_dir);
+    std::filesystem::remove_all(cache_dir);
+    onnx_options = HoloInfer::OnnxRuntimeOptions();
+
+    // Test: ONNX backend, Outputs reused on identical frames with temporal skipping
+    // the first frame is inferred, the next two reuse its outputs
+    skip_threshold_map = {{"bmode_perspective", "0.01"}};
+    status = prepare_for_inference();
+    auto fill_inputs = [this](float value) {
+      for (auto& [_, buffer] : inference_specs_->data_per_tensor_) {
+        auto data = static_cast<float*>(buffer->host_buffer.data());
+        std::fill(data, data + buffer->host_buffer.size(), value);
+      }
+    };
+    auto bmode_output = [this]() {
+      auto& buffer = inference_specs_->output_per_model_.at("bmode_infer")->host_buffer;
+      auto data = static_cast<const uint8_t*>(buffer.data());
+      return std::vector<uint8_t>(data, data + buffer.get_bytes());
+    };
+    // the output buffer is overwritten before each frame, a skipped frame must restore it
+    auto clear_bmode_output = [this]() {
+      auto& buffer = inference_specs_->output_per_model_.at("bmode_infer")->host_buffer;
+      std::fill_n(static_cast<uint8_t*>(buffer.data()), buffer.get_bytes(), uint8_t{0xff});
+    };
+    fill_inputs(0.5f);
+    std::vector<uint8_t> inferred_output;
+    for (int frame = 0; frame < 3; frame++) {
+      if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { break; }
+      if (frame > 0) { clear_bmode_output(); }
+      status = do_inference();
+      if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { break; }
+      if (frame == 0) {
+        inferred_output = bmode_output();
+      } else if (bmode_output() != inferred_output) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Skipped frame outputs differ from the last inference");
+      }
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto timing = holoscan_infer_context_->get_model_timing();
+      if (timing.at("bmode_perspective").count != 1 ||
+          timing.at("bmode_perspective").skipped != 2 ||
+          timing.at("aortic_stenosis").skipped != 0) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Unexpected number of skipped inferences");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     41,
+                     test_identifier_infer.at(41),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Changed frame inferred with temporal skipping
+    // a frame differing from the last inferred one is inferred again
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      fill_inputs(0.9f);
+      clear_bmode_output();
+      status = do_inference();
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto timing = holoscan_infer_context_->get_model_timing();
+      if (timing.at("bmode_perspective").count != 2 ||
+          timing.at("bmode_perspective").skipped != 2) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Changed frame not inferred");
+      } else if (bmode_output() == std::vector<uint8_t>(inferred_output.size(), 0xff)) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Changed frame outputs not written");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     47,
+                     test_identifier_infer.at(47),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Frame inferred once the skip frame count is reached
+    // with at most 2 consecutive skipped frames, 5 identical frames are inferred, skipped twice,
+    // inferred and skipped twice
+    skip_max_frames_map = {{"bmode_perspective", "2"}};
+    status = prepare_for_inference();
+    fill_inputs(0.5f);
+    for (int frame = 0; frame < 5; frame++) {
+      if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) { status = do_inference(); }
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto timing = holoscan_infer_context_->get_model_timing();
+      if (timing.at("bmode_perspective").count != 2 ||
+          timing.at("bmode_perspective").skipped != 3) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Skip frame count not applied");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     48,
+                     test_identifier_infer.at(48),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+    skip_threshold_map.clear();
+    skip_max_frames_map.clear();
+
+    // Test: ONNX backend, Batch of frames inferred once full
+    // the first frame waits for the second one, both are returned in order
+    batch_size_map = {{"bmode_perspective", "2"}};
+    batch_delay_map = {{"bmode_perspective", "10000"}};
+    status = prepare_for_inference();
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = enqueue_frames(0, 1);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS && !dequeue_frames().empty()) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Frame returned before its batch was full");
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = enqueue_frames(1, 1);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto stats = holoscan_infer_context_->get_batch_stats().at("bmode_perspective");
+      if (dequeue_frames() != std::vector<uint64_t>{0, 1} || stats.batches != 1 ||
+          stats.last_batch_size != 2) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Unexpected frames returned by the batch");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     43,
+                     test_identifier_infer.at(43),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Incomplete batch inferred once the batch delay expired
+    // no other frame is queued, the batch is inferred by the batch timer
+    batch_size_map = {{"bmode_perspective", "4"}};
+    batch_delay_map = {{"bmode_perspective", "20"}};
+    status = prepare_for_inference();
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = enqueue_frames(0, 1);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(500));
+      auto stats = holoscan_infer_context_->get_batch_stats().at("bmode_perspective");
+      if (dequeue_frames() != std::vector<uint64_t>{0} || stats.batches != 1 ||
+          stats.last_batch_size != 1 || stats.max_queue_delay_ms < 20.0) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Incomplete batch not inferred after the batch delay");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     44,
+                     test_identifier_infer.at(44),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+
+    // Test: ONNX backend, Incomplete batch inferred on flush
+    batch_delay_map = {{"bmode_perspective", "10000"}};
+    status = prepare_for_inference();
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = enqueue_frames(0, 3);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS && !dequeue_frames().empty()) {
+      status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                      "Frame returned before its batch was full");
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = holoscan_infer_context_->flush_inference();
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto stats = holoscan_infer_context_->get_batch_stats().at("bmode_perspective");
+      if (dequeue_frames() != std::vector<uint64_t>{0, 1, 2} || stats.batches != 1 ||
+          stats.last_batch_size != 3) {
+        status = HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                        "Incomplete batch not inferred on flush");
+      }
+    }
+    holoinfer_assert(status,
+                     test_module,
+                     45,
+                     test_identifier_infer.at(45),
+                     HoloInfer::holoinfer_code::H_SUCCESS);
+    batch_size_map.clear();
+    batch_delay_map.clear();
+
     if (is_x86_64) {
       // Test: ONNX backend, Basic sequential inference on GPU
       infer_on_cpu = false;
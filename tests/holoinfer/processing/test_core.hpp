@@ -41,6 +41,8 @@ class ProcessingTests {
 
   void parameter_test();
   void parameter_setup_test();
+  void kernel_test();
+  void plan_test();
   void print_summary();
   int get_status();
 
@@ -79,7 +81,19 @@ class ProcessingTests {
       {14, "Processing Params, Empty data buffer"},
       {15, "Processing Params, Empty config for generate boxes"},
       {16, "Processing Params, Incorrect config path for generate boxes"},
-      {17, "Processing Params, incorrect tensor for generate boxes"}};
+      {17, "Processing Params, incorrect tensor for generate boxes"},
+      {18, "Processing Kernels, scale_intensity_cpu matches scalar output (small)"},
+      {19, "Processing Kernels, scale_intensity_cpu matches scalar output (large)"},
+      {20, "Processing Kernels, max_per_channel_scaled matches scalar output (small)"},
+      {21, "Processing Kernels, max_per_channel_scaled matches scalar output (large)"},
+      {22, "Processing Kernels, generate_boxes top-K with non-max suppression"},
+      {23, "Processing Plans, compute and print plan matches single operation output"},
+      {24, "Processing Plans, uint8 output of scale_intensity_cpu rejected by float operation"},
+      {25, "Processing Plans, uint8 output of scale_intensity_cpu rejected by print"},
+      {26, "Processing Plans, output rank of max_per_channel_scaled rejected"},
+      {27, "Processing Plans, input data type not supported by the first operation"},
+      {28, "Processing Plans, input dimension not supported by the first operation"},
+      {29, "Processing Plans, output reallocated when the input dimension changes"}};
 };
 
 #endif /* HOLOINFER_PROCESSING_TEST_CORE_HPP */
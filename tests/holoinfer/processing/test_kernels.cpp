@@ -0,0 +1,272 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_core.hpp"
+
+namespace {
+
+/// Reference scalar implementation of scale_intensity_cpu
+std::vector<uint8_t> scale_intensity_reference(const std::vector<float>& input_data) {
+  const size_t dsize = input_data.size();
+  const int channels = 3;
+  std::vector<uint8_t> processed_data(dsize * channels);
+  float max = 0, min = 100000;
+
+  for (size_t index = 0; index < dsize; index++) {
+    float v = input_data[index];
+    if (max < v) { max = v; }
+    if (min > v) { min = v; }
+  }
+
+  std::vector<uint32_t> histogram(256, 0);
+  for (size_t index = 0; index < dsize; index++) {
+    auto value = uint8_t(255 * ((input_data[index] - min) / (max - min)));
+    histogram[value]++;
+  }
+
+  std::vector<uint32_t> cdf_histogram(256);
+  cdf_histogram[0] = histogram[0];
+  for (int i = 1; i < 256; i++) { cdf_histogram[i] = histogram[i] + cdf_histogram[i - 1]; }
+
+  uint32_t cdf_histogram_min = dsize, cdf_histogram_max = 0;
+  for (int i = 0; i < 256; i++) {
+    int32_t count = cdf_histogram[i];
+    if (count < cdf_histogram_min) { cdf_histogram_min = count; }
+    if (count > cdf_histogram_max) { cdf_histogram_max = count; }
+  }
+
+  std::vector<uint32_t> updated_histogram(256);
+  for (int i = 0; i < 256; i++) {
+    updated_histogram[i] =
+        (uint32_t)(255.0 * (cdf_histogram[i] - cdf_histogram_min) / (dsize - cdf_histogram_min));
+  }
+
+  for (size_t index = 0; index < dsize; index++) {
+    auto dm_index = channels * index;
+    auto fvalue = uint32_t(255 * ((input_data[index] - min) / (max - min)));
+    auto value = updated_histogram[fvalue];
+    for (int c = 0; c < channels; c++) { processed_data[dm_index + c] = value; }
+  }
+  return processed_data;
+}
+
+/// Reference scalar implementation of max_per_channel_scaled
+std::vector<float> max_per_channel_reference(const std::vector<float>& input_data, size_t rows,
+                                             size_t cols, size_t out_channels) {
+  std::vector<float> processed_data(2 * out_channels);
+  std::vector<unsigned int> max_x_per_channel(out_channels, 0), max_y_per_channel(out_channels, 0);
+  std::vector<float> maxV(out_channels, -1999);
+
+  for (unsigned int i = 0; i < rows; i++) {
+    for (unsigned int j = 0; j < cols; j++) {
+      for (unsigned int c = 1; c < out_channels; c++) {
+        unsigned int index = i * cols * out_channels + j * out_channels + c;
+        float v1 = input_data[index];
+        if (maxV[c] < v1) {
+          maxV[c] = v1;
+          max_x_per_channel[c] = i;
+          max_y_per_channel[c] = j;
+        }
+      }
+    }
+  }
+
+  for (unsigned int i = 0; i < out_channels; i++) {
+    processed_data[2 * i] = static_cast<float>(max_x_per_channel[i]) / static_cast<float>(rows);
+    processed_data[2 * i + 1] = static_cast<float>(max_y_per_channel[i]) / static_cast<float>(cols);
+  }
+  return processed_data;
+}
+
+/// Runs a single processing operation on the input data and returns the processed data
+HoloInfer::InferStatus run_operation(const std::string& operation,
+                                     const std::vector<float>& input_data,
+                                     const std::vector<int>& dims, std::vector<uint8_t>& output) {
+  const std::string in_tensor = "kernel_in";
+  const std::string out_tensor = "kernel_out";
+  HoloInfer::MultiMappings operations = {{in_tensor, {operation}}};
+  HoloInfer::MultiMappings in_out_map = {{in_tensor, {out_tensor}}};
+
+  auto context = std::make_unique<HoloInfer::ProcessorContext>();
+  auto status = context->initialize(operations, "");
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  HoloInfer::DataMap data_map;
+  auto buffer = std::make_shared<HoloInfer::DataBuffer>();
+  buffer->host_buffer.resize(input_data.size());
+  std::memcpy(buffer->host_buffer.data(), input_data.data(), input_data.size() * sizeof(float));
+  data_map.insert({in_tensor, buffer});
+
+  status = context->process(operations, in_out_map, data_map, {{in_tensor, dims}});
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  auto processed = context->get_processed_data();
+  if (processed.find(out_tensor) == processed.end()) {
+    return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Missing output tensor");
+  }
+  auto& out_buffer = processed.at(out_tensor);
+  auto bytes = static_cast<const uint8_t*>(out_buffer->host_buffer.data());
+  output.assign(bytes,
+                bytes + out_buffer->host_buffer.size() *
+                            HoloInfer::get_element_size(out_buffer->get_datatype()));
+  return status;
+}
+
+/// Compares the outputs byte by byte
+HoloInfer::InferStatus compare_bytes(const std::vector<uint8_t>& output, const void* expected,
+                                     size_t expected_bytes) {
+  if (output.size() != expected_bytes || std::memcmp(output.data(), expected, expected_bytes)) {
+    return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                  "Output differs from the scalar reference");
+  }
+  return HoloInfer::InferStatus();
+}
+
+/// Runs generate_boxes with top_k and nms_threshold on overlapping boxes of the same object
+HoloInfer::InferStatus run_generate_boxes_nms() {
+  auto directory = std::filesystem::temp_directory_path() / "holoinfer_generate_boxes_test";
+  std::filesystem::create_directories(directory);
+  std::ofstream(directory / "labels.txt") << "car\n";
+  std::ofstream(directory / "postprocessing.yaml")
+      << "generate_boxes:\n"
+         "  params:\n"
+         "    label_file: labels.txt\n"
+         "    threshold: 0.5\n"
+         "    top_k: 3\n"
+         "    nms_threshold: 0.5\n"
+         "  objects:\n"
+         "    car: 2\n"
+         "  display:\n"
+         "    width: 1000\n"
+         "    height: 1000\n";
+
+  const std::string tensors = "gb_scores:gb_labels:gb_boxes";
+  HoloInfer::MultiMappings operations = {{tensors, {"generate_boxes"}}};
+  auto context = std::make_unique<HoloInfer::ProcessorContext>();
+  auto status = context->initialize(operations, (directory / "postprocessing.yaml").string());
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  // Label 0 is the default object label, the label file starts at 1.
+  // Only the three best scores are considered, the last score is below the threshold.
+  const std::vector<float> scores = {0.6f, 0.9f, 0.8f, 0.7f, 0.4f};
+  const std::vector<int64_t> labels = {1, 1, 1, 1, 1};
+  const std::vector<float> boxes = {600, 600, 700, 700,  // dropped by top_k
+                                    100, 100, 200, 200,  // kept, highest score
+                                    110, 110, 210, 210,  // suppressed by the second box
+                                    400, 400, 500, 500,  // kept
+                                    800, 800, 900, 900};
+  HoloInfer::DataMap data_map;
+  auto add_tensor = [&data_map](const std::string& name, const void* data, size_t size,
+                                HoloInfer::holoinfer_datatype type) {
+    auto buffer = std::make_shared<HoloInfer::DataBuffer>(type);
+    buffer->host_buffer.resize(size);
+    std::memcpy(buffer->host_buffer.data(), data, buffer->host_buffer.get_bytes());
+    data_map.insert({name, buffer});
+  };
+  add_tensor("gb_scores", scores.data(), scores.size(), HoloInfer::holoinfer_datatype::h_Float32);
+  add_tensor("gb_labels", labels.data(), labels.size(), HoloInfer::holoinfer_datatype::h_Int64);
+  add_tensor("gb_boxes", boxes.data(), boxes.size(), HoloInfer::holoinfer_datatype::h_Float32);
+  std::map<std::string, std::vector<int>> dims = {
+      {"gb_scores", {1, 5}}, {"gb_labels", {1, 5}}, {"gb_boxes", {1, 5, 4}}};
+
+  status = context->process(operations, {}, data_map, dims);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  auto processed = context->get_processed_data();
+  const std::vector<std::pair<std::string, std::vector<float>>> expected = {
+      {"car0", {0.1f, 0.1f, 0.2f, 0.2f}}, {"car1", {0.4f, 0.4f, 0.5f, 0.5f}}};
+  for (const auto& [key, expected_box] : expected) {
+    if (processed.find(key) == processed.end()) {
+      return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Missing box " + key);
+    }
+    auto box = static_cast<const float*>(processed.at(key)->host_buffer.data());
+    if (!std::equal(expected_box.begin(), expected_box.end(), box)) {
+      return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Unexpected box " + key);
+    }
+  }
+  return HoloInfer::InferStatus();
+}
+
+}  // namespace
+
+void ProcessingTests::kernel_test() {
+  std::string test_module = "Kernel test processing";
+  std::mt19937 generator(42);
+
+  // Sizes cover the vector tails (odd widths) and the multithreaded tiles
+  const std::vector<std::vector<int>> scale_dims = {{1, 17, 23}, {1, 720, 1280}};
+  for (size_t i = 0; i < scale_dims.size(); i++) {
+    const auto& dims = scale_dims[i];
+    std::vector<float> input_data(static_cast<size_t>(dims[1]) * dims[2]);
+    std::normal_distribution<float> distribution(0.3f, 2.0f);
+    for (auto& v : input_data) { v = distribution(generator); }
+
+    std::vector<uint8_t> output;
+    auto status = run_operation("scale_intensity_cpu", input_data, dims, output);
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto expected = scale_intensity_reference(input_data);
+      status = compare_bytes(output, expected.data(), expected.size());
+    }
+    processing_assert(status,
+                      test_module,
+                      18 + i,
+                      test_identifier_process.at(18 + i),
+                      HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
+  // Quantized values produce ties, which must resolve to the first occurrence
+  const std::vector<std::vector<int>> max_dims = {{1, 9, 11, 5}, {1, 480, 640, 7}};
+  for (size_t i = 0; i < max_dims.size(); i++) {
+    const auto& dims = max_dims[i];
+    const size_t rows = dims[1], cols = dims[2], channels = dims[3];
+    std::vector<float> input_data(rows * cols * channels);
+    std::uniform_int_distribution<int> distribution(-40, 40);
+    for (auto& v : input_data) { v = static_cast<float>(distribution(generator)) * 0.25f; }
+
+    std::vector<uint8_t> output;
+    auto status = run_operation("max_per_channel_scaled", input_data, dims, output);
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      auto expected = max_per_channel_reference(input_data, rows, cols, channels);
+      status = compare_bytes(output, expected.data(), expected.size() * sizeof(float));
+    }
+    processing_assert(status,
+                      test_module,
+                      20 + i,
+                      test_identifier_process.at(20 + i),
+                      HoloInfer::holoinfer_code::H_SUCCESS);
+  }
+
+  // Test: Processing Kernels, generate_boxes top-K with non-max suppression
+  auto status = run_generate_boxes_nms();
+  processing_assert(status,
+                    test_module,
+                    22,
+                    test_identifier_process.at(22),
+                    HoloInfer::holoinfer_code::H_SUCCESS);
+}
@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_core.hpp"
+
+namespace {
+
+const char kInTensor[] = "plan_in";
+const char kOutTensor[] = "plan_out";
+
+/// Output of a processing context
+struct PlanOutput {
+  std::vector<uint8_t> bytes;
+  std::vector<int64_t> dims;
+};
+
+/// Creates a buffer with the input data
+std::shared_ptr<HoloInfer::DataBuffer> make_input(const std::vector<float>& input_data,
+                                                  HoloInfer::holoinfer_datatype type) {
+  auto buffer = std::make_shared<HoloInfer::DataBuffer>(type);
+  buffer->host_buffer.resize(input_data.size());
+  std::memcpy(buffer->host_buffer.data(), input_data.data(), input_data.size() * sizeof(float));
+  return buffer;
+}
+
+/// Runs the operations of the input tensor and returns the processed data
+HoloInfer::InferStatus run_operations(HoloInfer::ProcessorContext& context,
+                                      const std::vector<std::string>& operations,
+                                      const std::shared_ptr<HoloInfer::DataBuffer>& input,
+                                      const std::vector<int>& dims, PlanOutput& output) {
+  HoloInfer::MultiMappings operation_map = {{kInTensor, operations}};
+  HoloInfer::MultiMappings in_out_map = {{kInTensor, {kOutTensor}}};
+  HoloInfer::DataMap data_map = {{kInTensor, input}};
+
+  auto status = context.process(operation_map, in_out_map, data_map, {{kInTensor, dims}});
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  auto processed = context.get_processed_data();
+  auto processed_dims = context.get_processed_data_dims();
+  if (processed.find(kOutTensor) == processed.end() ||
+      processed_dims.find(kInTensor) == processed_dims.end()) {
+    return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR, "Missing output tensor");
+  }
+  auto& out_buffer = processed.at(kOutTensor);
+  auto bytes = static_cast<const uint8_t*>(out_buffer->host_buffer.data());
+  output.bytes.assign(bytes, bytes + out_buffer->host_buffer.get_bytes());
+  output.dims = processed_dims.at(kInTensor)[0];
+  return status;
+}
+
+/// Initializes a context with compiled plans
+HoloInfer::InferStatus initialize_plan(std::unique_ptr<HoloInfer::ProcessorContext>& context,
+                                       const std::vector<std::string>& operations) {
+  context = std::make_unique<HoloInfer::ProcessorContext>();
+  return context->initialize({{kInTensor, operations}}, "", true);
+}
+
+/// Runs a plan ending with a print operation, and a single operation without plan, on the same
+/// input, and compares their outputs
+HoloInfer::InferStatus compare_plan_output(const std::vector<float>& input_data,
+                                           const std::vector<int>& dims) {
+  auto input = make_input(input_data, HoloInfer::holoinfer_datatype::h_Float32);
+
+  std::unique_ptr<HoloInfer::ProcessorContext> fused;
+  auto status = initialize_plan(fused, {"max_per_channel_scaled", "print"});
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+  PlanOutput fused_output;
+  status = run_operations(*fused, {"max_per_channel_scaled", "print"}, input, dims, fused_output);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  auto unfused = std::make_unique<HoloInfer::ProcessorContext>();
+  status = unfused->initialize({{kInTensor, {"max_per_channel_scaled"}}}, "", false);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+  PlanOutput unfused_output;
+  status = run_operations(*unfused, {"max_per_channel_scaled"}, input, dims, unfused_output);
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  if (fused_output.bytes != unfused_output.bytes || fused_output.dims != unfused_output.dims) {
+    return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                  "Output of the plan differs from the single operation");
+  }
+  return status;
+}
+
+/// Runs a plan on inputs of two dimensions, the output must follow the dimension of the input
+HoloInfer::InferStatus run_plan_with_new_dims() {
+  std::unique_ptr<HoloInfer::ProcessorContext> context;
+  auto status = initialize_plan(context, {"max_per_channel_scaled"});
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+  PlanOutput output;
+  for (int channels : {3, 6}) {
+    const std::vector<int> dims = {1, 8, 8, channels};
+    std::vector<float> input_data(8 * 8 * channels, 0.0f);
+    // The maximum of the last channel is at the last pixel
+    input_data.back() = 1.0f;
+    auto input = make_input(input_data, HoloInfer::holoinfer_datatype::h_Float32);
+    status = run_operations(*context, {"max_per_channel_scaled"}, input, dims, output);
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return status; }
+
+    const auto values = reinterpret_cast<const float*>(output.bytes.data());
+    if (output.dims != std::vector<int64_t>{1, 2 * channels} ||
+        output.bytes.size() != 2 * channels * sizeof(float) ||
+        values[2 * channels - 2] != 7.0f / 8.0f || values[2 * channels - 1] != 7.0f / 8.0f) {
+      return HoloInfer::InferStatus(HoloInfer::holoinfer_code::H_ERROR,
+                                    "Output does not match the dimension of the input");
+    }
+  }
+  return status;
+}
+
+}  // namespace
+
+void ProcessingTests::plan_test() {
+  std::string test_module = "Plan test processing";
+  std::mt19937 generator(11);
+
+  // Test: Processing Plans, compute and print plan matches single operation output
+  std::vector<float> input_data(1 * 9 * 11 * 5);
+  std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+  for (auto& v : input_data) { v = distribution(generator); }
+  auto status = compare_plan_output(input_data, {1, 9, 11, 5});
+  processing_assert(status,
+                    test_module,
+                    23,
+                    test_identifier_process.at(23),
+                    HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Test: Processing Plans, uint8 output of scale_intensity_cpu rejected by a float operation
+  std::unique_ptr<HoloInfer::ProcessorContext> context;
+  status = initialize_plan(context, {"scale_intensity_cpu", "max_per_channel_scaled"});
+  processing_assert(
+      status, test_module, 24, test_identifier_process.at(24), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Test: Processing Plans, uint8 output of scale_intensity_cpu rejected by print
+  status = initialize_plan(context, {"scale_intensity_cpu", "print"});
+  processing_assert(
+      status, test_module, 25, test_identifier_process.at(25), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Test: Processing Plans, output rank of max_per_channel_scaled rejected by scale_intensity_cpu
+  status = initialize_plan(context, {"max_per_channel_scaled", "scale_intensity_cpu"});
+  processing_assert(
+      status, test_module, 26, test_identifier_process.at(26), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Test: Processing Plans, input data type not supported by the first operation
+  PlanOutput output;
+  status = initialize_plan(context, {"max_per_channel_scaled"});
+  if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+    auto input = make_input(input_data, HoloInfer::holoinfer_datatype::h_Int32);
+    status = run_operations(*context, {"max_per_channel_scaled"}, input, {1, 9, 11, 5}, output);
+  }
+  processing_assert(
+      status, test_module, 27, test_identifier_process.at(27), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Test: Processing Plans, input dimension not supported by the first operation
+  status = initialize_plan(context, {"max_per_channel_scaled"});
+  if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+    auto input = make_input(input_data, HoloInfer::holoinfer_datatype::h_Float32);
+    status = run_operations(*context, {"max_per_channel_scaled"}, input, {9, 11, 5}, output);
+  }
+  processing_assert(
+      status, test_module, 28, test_identifier_process.at(28), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Test: Processing Plans, output reallocated when the input dimension changes
+  status = run_plan_with_new_dims();
+  processing_assert(status,
+                    test_module,
+                    29,
+                    test_identifier_process.at(29),
+                    HoloInfer::holoinfer_code::H_SUCCESS);
+}
@@ -160,6 +160,29 @@ TEST_F(OperatorClassesWithGXFContext, TestVideoStreamRecorderOp) {
   EXPECT_TRUE(log_output.find("error") == std::string::npos);
 }
 
+TEST_F(OperatorClassesWithGXFContext, TestVideoStreamRecorderOpAsyncWrite) {
+  const std::string name{"recorder"};
+  ArgList args{
+      Arg{"directory", "/tmp"s},
+      Arg{"basename", "video_out_async"s},
+      Arg{"async_queue_size", static_cast<size_t>(8UL)},
+      Arg{"backpressure_policy", "drop"s},
+      Arg{"write_chunk_size", static_cast<size_t>(1UL << 20)},
+  };
+  testing::internal::CaptureStderr();
+
+  auto op = F.make_operator<ops::VideoStreamRecorderOp>(name, args);
+  EXPECT_EQ(op->name(), name);
+  EXPECT_TRUE(op->description().find("name: " + name) != std::string::npos);
+  EXPECT_EQ(op->queue_depth(), 0);
+  EXPECT_EQ(op->bytes_written(), 0);
+  EXPECT_EQ(op->dropped_frames(), 0);
+  EXPECT_EQ(op->bytes_per_second(), 0.0);
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("error") == std::string::npos);
+}
+
 TEST_F(OperatorClassesWithGXFContext, TestVideoStreamReplayerOp) {
   const std::string name{"replayer"};
   const std::string sample_data_path = std::string(std::getenv("HOLOSCAN_INPUT_PATH"));
@@ -0,0 +1,315 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+using namespace std::chrono_literals;
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+constexpr int kCount = 10;
+
+class CountingTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingTxOp)
+
+  CountingTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(++index_, "out");
+  }
+
+ private:
+  int index_ = 0;
+};
+
+/// Order in which the operators computed the values
+class ComputeLog {
+ public:
+  void add(const std::string& op_name, int value) {
+    std::scoped_lock lock{mutex_};
+    entries_.emplace_back(op_name, value);
+  }
+
+  /// Position of the compute of a value by an operator, or -1 if it was not computed
+  int position(const std::string& op_name, int value) {
+    std::scoped_lock lock{mutex_};
+    auto it = std::find(entries_.begin(), entries_.end(), std::make_pair(op_name, value));
+    return it == entries_.end() ? -1 : static_cast<int>(it - entries_.begin());
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::pair<std::string, int>> entries_;
+};
+
+/// Receives a value and then sleeps for a fixed duration
+class SlowRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SlowRxOp)
+
+  SlowRxOp() = default;
+  explicit SlowRxOp(std::chrono::milliseconds duration, ComputeLog* log = nullptr)
+      : duration_(duration), log_(log) {}
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    const int value = op_input.receive<int>("in").value();
+    if (log_ != nullptr) { log_->add(name(), value); }
+    count_++;
+    std::this_thread::sleep_for(duration_);
+  }
+
+  int count() const { return count_; }
+
+ private:
+  std::chrono::milliseconds duration_{0};
+  ComputeLog* log_ = nullptr;
+  int count_ = 0;
+};
+
+class RelayOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(RelayOp)
+
+  RelayOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in");
+    spec.output<int>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(op_input.receive<int>("in").value(), "out");
+  }
+};
+
+/// Source that ticks late once, computing longer than its period
+class LateSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(LateSourceOp)
+
+  LateSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(++index_, "out");
+    if (index_ == late_index_) { std::this_thread::sleep_for(late_duration_); }
+  }
+
+  int late_index_ = 0;
+  std::chrono::milliseconds late_duration_{0};
+
+ private:
+  int index_ = 0;
+};
+
+/// tx -> critical (short deadline), tx -> bulk (no deadline)
+class DeadlineApp : public holoscan::Application {
+ public:
+  void compose() override {
+    tx_ = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    critical_ = make_operator<SlowRxOp>("critical", critical_duration_);
+    bulk_ = make_operator<SlowRxOp>("bulk", 1ms);
+    add_flow(tx_, critical_);
+    add_flow(tx_, bulk_);
+
+    critical_->deadline(critical_deadline_);
+    critical_->drop_stale_frames(drop_stale_frames_);
+  }
+
+  std::chrono::milliseconds critical_duration_{0};
+  std::chrono::nanoseconds critical_deadline_{1s};
+  bool drop_stale_frames_ = false;
+  std::shared_ptr<CountingTxOp> tx_;
+  std::shared_ptr<SlowRxOp> critical_;
+  std::shared_ptr<SlowRxOp> bulk_;
+};
+
+/**
+ * tx -> critical (deadline), tx -> relay -> bulk (no deadline)
+ *
+ * The frames reach bulk through relay, so that critical is known to have a pending frame when
+ * bulk is ready.
+ */
+class DispatchOrderApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    critical_ = make_operator<SlowRxOp>("critical", 1ms, &log_);
+    auto relay = make_operator<RelayOp>("relay");
+    bulk_ = make_operator<SlowRxOp>("bulk", 1ms, &log_);
+    add_flow(tx, relay);
+    add_flow(relay, bulk_);
+    add_flow(tx, critical_);
+
+    critical_->deadline(1s);
+  }
+
+  ComputeLog log_;
+  std::shared_ptr<SlowRxOp> critical_;
+  std::shared_ptr<SlowRxOp> bulk_;
+};
+
+/// Periodic source -> rx
+class PeriodicSourceApp : public holoscan::Application {
+ public:
+  void compose() override {
+    source_ = make_operator<LateSourceOp>(
+        "source",
+        make_condition<CountCondition>("count", kCount),
+        make_condition<PeriodicCondition>("periodic", kPeriod));
+    source_->period(kPeriod);
+    source_->drop_stale_frames(true);
+    source_->late_index_ = 3;
+    source_->late_duration_ = late_duration_;
+    rx_ = make_operator<SlowRxOp>("rx", 0ms);
+    add_flow(source_, rx_);
+  }
+
+  static constexpr std::chrono::milliseconds kPeriod{10};
+  std::chrono::milliseconds late_duration_{0};
+  std::shared_ptr<LateSourceOp> source_;
+  std::shared_ptr<SlowRxOp> rx_;
+};
+
+void use_event_based_scheduler(Application* app, int64_t worker_thread_number = 2) {
+  app->scheduler(app->make_scheduler<EventBasedScheduler>(
+      "event-based-scheduler",
+      Arg{"worker_thread_number", worker_thread_number},
+      Arg{"stop_on_deadlock_timeout", 100L}));
+}
+
+}  // namespace
+
+TEST(DeadlineSchedulingApp, TestDeadlineMissesAreRecorded) {
+  auto app = make_application<DeadlineApp>();
+  app->critical_duration_ = 5ms;
+  app->critical_deadline_ = 1ms;
+
+  app->run();
+
+  EXPECT_EQ(app->critical_->count(), kCount);
+  auto stats = app->critical_->metrics().statistics();
+  EXPECT_EQ(stats.deadline_miss_count, static_cast<uint64_t>(kCount));
+  EXPECT_GE(stats.max_lateness_ms, 4.0);
+  EXPECT_EQ(stats.dropped_frame_count, 0U);
+
+  // Operators without a deadline never miss one
+  EXPECT_EQ(app->bulk_->metrics().statistics().deadline_miss_count, 0U);
+}
+
+TEST(DeadlineSchedulingApp, TestStaleFramesAreDropped) {
+  auto app = make_application<DeadlineApp>();
+  app->critical_duration_ = 20ms;
+  app->critical_deadline_ = 5ms;
+  app->drop_stale_frames_ = true;
+  // The source emits the next frame while the critical operator is still computing
+  use_event_based_scheduler(app.get());
+
+  app->run();
+
+  auto stats = app->critical_->metrics().statistics();
+  EXPECT_GT(stats.dropped_frame_count, 0U);
+  EXPECT_EQ(app->critical_->count() + static_cast<int>(stats.dropped_frame_count), kCount);
+  EXPECT_EQ(app->bulk_->count(), kCount);
+}
+
+TEST(DeadlineSchedulingApp, TestDeadlineSchedulingRunsToCompletion) {
+  auto app = make_application<DeadlineApp>();
+  app->deadline_scheduling(true);
+  use_event_based_scheduler(app.get());
+
+  app->run();
+
+  EXPECT_TRUE(app->deadline_scheduling());
+  EXPECT_EQ(app->critical_->count(), kCount);
+  EXPECT_EQ(app->bulk_->count(), kCount);
+  EXPECT_EQ(app->critical_->metrics().statistics().deadline_miss_count, 0U);
+}
+
+TEST(DeadlineSchedulingApp, TestEarliestDeadlineIsDispatchedFirst) {
+  auto app = make_application<DispatchOrderApp>();
+  app->deadline_scheduling(true);
+  // With a single worker, the pending frame of critical holds back bulk, which has no deadline
+  use_event_based_scheduler(app.get(), 1);
+
+  app->run();
+
+  ASSERT_EQ(app->critical_->count(), kCount);
+  ASSERT_EQ(app->bulk_->count(), kCount);
+  for (int value = 1; value <= kCount; ++value) {
+    EXPECT_LT(app->log_.position("critical", value), app->log_.position("bulk", value))
+        << "frame " << value;
+  }
+}
+
+TEST(DeadlineSchedulingApp, TestPeriodicSourceOnTimeDropsNoFrames) {
+  auto app = make_application<PeriodicSourceApp>();
+
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->source_->metrics().statistics().dropped_frame_count, 0U);
+}
+
+TEST(DeadlineSchedulingApp, TestLatePeriodicSourceDropsMissedFrames) {
+  auto app = make_application<PeriodicSourceApp>();
+  // The tick after the late one misses a period: its due frame is past the deadline (the period)
+  app->late_duration_ = 2 * PeriodicSourceApp::kPeriod + PeriodicSourceApp::kPeriod / 2;
+
+  app->run();
+
+  // The late tick computes the frame of its current period instead of the missed one
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_GE(app->source_->metrics().statistics().dropped_frame_count, 1U);
+}
+
+TEST(DeadlineSchedulingApp, TestDeadlineSchedulingWithoutDeadlines) {
+  auto app = make_application<DeadlineApp>();
+  app->critical_deadline_ = 0ns;
+  app->deadline_scheduling(true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("none of its operators has a deadline") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  EXPECT_EQ(app->critical_->count(), kCount);
+}
+
+}  // namespace holoscan
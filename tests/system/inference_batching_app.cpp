@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/inference/inference.hpp>
+
+using namespace std::string_literals;
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+/// Fewer frames than the batch size: the batch is only complete once its delay expired
+constexpr int64_t kFrameCount = 3;
+constexpr int64_t kBatchSize = 4;
+constexpr int64_t kBatchDelayMs = 200;
+
+/// Input tensor of the bmode_perspective model of the multiai_ultrasound data
+constexpr int64_t kFrameShape[] = {320, 240, 3};
+
+using Clock = std::chrono::steady_clock;
+
+/// Emits a host float tensor named "bmode_pre_proc" on every tick
+class FrameTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameTxOp)
+
+  FrameTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<TensorMap>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    if (!first_emit_time_) { first_emit_time_ = Clock::now(); }
+    TensorMap tensors;
+    tensors.insert({"bmode_pre_proc", make_host_tensor()});
+    op_output.emit(tensors, "out");
+  }
+
+  std::optional<Clock::time_point> first_emit_time_;
+
+ private:
+  static std::shared_ptr<Tensor> make_host_tensor() {
+    struct HostTensorContext {
+      std::vector<float> data;
+      int64_t shape[3];
+      DLManagedTensor tensor;
+    };
+    auto* ctx = new HostTensorContext{
+        std::vector<float>(kFrameShape[0] * kFrameShape[1] * kFrameShape[2], 0.5F),
+        {kFrameShape[0], kFrameShape[1], kFrameShape[2]},
+        {}};
+    ctx->tensor.dl_tensor.data = ctx->data.data();
+    ctx->tensor.dl_tensor.device = DLDevice{kDLCPU, 0};
+    ctx->tensor.dl_tensor.ndim = 3;
+    ctx->tensor.dl_tensor.dtype = DLDataType{kDLFloat, 32, 1};
+    ctx->tensor.dl_tensor.shape = ctx->shape;
+    ctx->tensor.dl_tensor.strides = nullptr;
+    ctx->tensor.dl_tensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](DLManagedTensor* self) {
+      delete static_cast<HostTensorContext*>(self->manager_ctx);
+    };
+    return std::make_shared<Tensor>(&ctx->tensor);
+  }
+};
+
+/// Records the time the results of each frame are received
+class ResultRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ResultRxOp)
+
+  ResultRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<TensorMap>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto tensors = op_input.receive<TensorMap>("in");
+    if (tensors && tensors.value().find("bmode_infer") != tensors.value().end()) {
+      receive_times_.push_back(Clock::now());
+    }
+  }
+
+  std::vector<Clock::time_point> receive_times_;
+};
+
+/// tx -> inference -> rx
+class BatchingApp : public holoscan::Application {
+ public:
+  void compose() override {
+    ops::InferenceOp::DataMap model_path_map;
+    model_path_map.insert("bmode_perspective",
+                          "../data/multiai_ultrasound/models/bmode_perspective.onnx");
+    ops::InferenceOp::DataVecMap pre_processor_map;
+    pre_processor_map.insert("bmode_perspective", {"bmode_pre_proc"});
+    ops::InferenceOp::DataVecMap inference_map;
+    inference_map.insert("bmode_perspective", {"bmode_infer"});
+    ops::InferenceOp::DataMap batch_size_map;
+    batch_size_map.insert("bmode_perspective", std::to_string(kBatchSize));
+    ops::InferenceOp::DataMap batch_delay_map;
+    batch_delay_map.insert("bmode_perspective", std::to_string(batch_delay_ms_));
+
+    tx_ = make_operator<FrameTxOp>("tx", make_condition<CountCondition>(frame_count_));
+    auto inference = make_operator<ops::InferenceOp>(
+        "inference",
+        Arg("backend", "onnxrt"s),
+        Arg("model_path_map", model_path_map),
+        Arg("pre_processor_map", pre_processor_map),
+        Arg("inference_map", inference_map),
+        Arg("input_on_cuda", false),
+        Arg("output_on_cuda", false),
+        Arg("transmit_on_cuda", false),
+        Arg("allocator", make_resource<UnboundedAllocator>("allocator")));
+    if (skip_threshold_.empty()) {
+      inference->add_arg(Arg("batch_size_map", batch_size_map));
+      inference->add_arg(Arg("batch_delay_map", batch_delay_map));
+    } else {
+      // Skipping cannot be combined with batching
+      ops::InferenceOp::DataMap skip_threshold_map;
+      skip_threshold_map.insert("bmode_perspective", skip_threshold_);
+      inference->add_arg(Arg("skip_threshold_map", skip_threshold_map));
+    }
+    rx_ = make_operator<ResultRxOp>("rx");
+
+    add_flow(tx_, inference, {{"out", "receivers"}});
+    add_flow(inference, rx_, {{"transmitter", "in"}});
+    inference_ = inference;
+  }
+
+  int64_t frame_count_ = kFrameCount;
+  int64_t batch_delay_ms_ = kBatchDelayMs;
+  std::string skip_threshold_;
+  std::shared_ptr<FrameTxOp> tx_;
+  std::shared_ptr<ops::InferenceOp> inference_;
+  std::shared_ptr<ResultRxOp> rx_;
+};
+
+}  // namespace
+
+TEST(InferenceBatchingApp, TestIncompleteBatchTransmittedAfterBatchDelay) {
+  auto app = make_application<BatchingApp>();
+  app->run();
+
+  // The results of the incomplete batch are transmitted once inferred by the batch timer, without
+  // a new input and before the application stops
+  const auto& receive_times = app->rx_->receive_times_;
+  ASSERT_EQ(receive_times.size(), static_cast<size_t>(kFrameCount));
+  ASSERT_TRUE(app->tx_->first_emit_time_.has_value());
+  const auto latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              receive_times.front() - app->tx_->first_emit_time_.value())
+                              .count();
+  EXPECT_GE(latency_ms, kBatchDelayMs);
+  // Inferred when the delay expired rather than when the operator stopped
+  EXPECT_LT(latency_ms, kBatchDelayMs + 5000);
+}
+
+TEST(InferenceBatchingApp, TestResultsOfFullBatchTransmittedOnePerTick) {
+  auto app = make_application<BatchingApp>();
+  // Two full batches, inferred without waiting for the batch delay
+  app->frame_count_ = 2 * kBatchSize;
+  app->batch_delay_ms_ = 60000;
+  app->run();
+
+  // The downstream input port keeps its queue of one message and receives every result
+  EXPECT_EQ(app->rx_->receive_times_.size(), static_cast<size_t>(2 * kBatchSize));
+}
+
+TEST(InferenceBatchingApp, TestSkippedInferencesAvailableAfterRun) {
+  auto app = make_application<BatchingApp>();
+  app->skip_threshold_ = "0.01";
+  app->run();
+
+  // Every frame is identical: only the first one is inferred, the others reuse its outputs
+  EXPECT_EQ(app->rx_->receive_times_.size(), static_cast<size_t>(kFrameCount));
+  const auto skipped_inferences = app->inference_->skipped_inferences();
+  ASSERT_EQ(skipped_inferences.count("bmode_perspective"), 1U);
+  EXPECT_EQ(skipped_inferences.at("bmode_perspective"), static_cast<uint64_t>(kFrameCount - 1));
+}
+
+}  // namespace holoscan
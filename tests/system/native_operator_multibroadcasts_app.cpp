@@ -51,6 +51,48 @@ class NativeMultiBroadcastsApp : public holoscan::Application {
   }
 };
 
+// Same as PingMultiTxOp, but "out1" publishes directly into its receivers without a Broadcast
+class PingFanOutTxOp : public ops::PingMultiTxOp {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS_SUPER(PingFanOutTxOp, ops::PingMultiTxOp)
+
+  PingFanOutTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<int>("out1").fan_out(true);
+    spec.output<int>("out2");
+  }
+};
+
+class NativeMultiFanOutApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<PingFanOutTxOp>("tx", make_condition<CountCondition>(10));
+    auto rx11 = make_operator<ops::PingMultiRxOp>("rx11");
+    auto rx12 = make_operator<ops::PingMultiRxOp>("rx12");
+    auto rx21 = make_operator<ops::PingMultiRxOp>("rx21");
+    auto rx22 = make_operator<ops::PingMultiRxOp>("rx22");
+
+    add_flow(tx, rx11, {{"out1", "receivers"}});
+    add_flow(tx, rx12, {{"out1", "receivers"}});
+
+    add_flow(tx, rx21, {{"out2", "receivers"}});
+    add_flow(tx, rx22, {{"out2", "receivers"}});
+  }
+};
+
+static int count_received_messages(const std::string& log_output) {
+  int count = 0;
+  std::string recv_string{"Rx message received (count: 10, size: 1)"};
+  auto pos = log_output.find(recv_string);
+  while (pos != std::string::npos) {
+    count++;
+    pos = log_output.find(recv_string, pos + recv_string.size());
+  }
+  return count;
+}
+
 TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiBroadcastsApp) {
   auto app = make_application<NativeMultiBroadcastsApp>();
 
@@ -66,14 +108,26 @@ TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiBroadcastsApp) {
 
   // Check if 'log_output' has 'Rx message received (count: 10, size: 1)' four times in it.
   // (from rx11, rx12, rx21, rx22)
-  int count = 0;
-  std::string recv_string{"Rx message received (count: 10, size: 1)"};
-  auto pos = log_output.find(recv_string);
-  while (pos != std::string::npos) {
-    count++;
-    pos = log_output.find(recv_string, pos + recv_string.size());
-  }
-  EXPECT_EQ(count, 4);
+  EXPECT_EQ(count_received_messages(log_output), 4);
+}
+
+TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiFanOutApp) {
+  auto app = make_application<NativeMultiFanOutApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  // Both the fan-out port ("out1") and the broadcast port ("out2") deliver every message to
+  // both of their receivers.
+  EXPECT_EQ(count_received_messages(log_output), 4);
+  EXPECT_TRUE(log_output.find("error") == std::string::npos) << log_output;
 }
 
 }  // namespace holoscan
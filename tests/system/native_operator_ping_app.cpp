@@ -98,6 +98,34 @@ class ForwardTestOpTwoInputs : public Operator {
   }
 };
 
+/// @brief version of ForwardTestOp receiving and emitting through precompiled port handles
+class ForwardTestOpPortHandles : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ForwardTestOpPortHandles)
+
+  ForwardTestOpPortHandles() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("data");
+    spec.output<int>("data");
+  }
+
+  void initialize() override {
+    Operator::initialize();
+    in_handle_ = spec()->input_handle("data");
+    out_handle_ = spec()->output_handle("data");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    auto value = op_input.receive<int>(in_handle_).value();
+    op_output.emit(value, out_handle_);
+  }
+
+ private:
+  PortHandle in_handle_;
+  PortHandle out_handle_;
+};
+
 }  // namespace
 
 class NativeOpApp : public holoscan::Application {
@@ -126,6 +154,21 @@ class NativeForwardOpApp : public holoscan::Application {
   }
 };
 
+/// @brief version of NativeForwardOpApp using port handles in the forwarding operator
+class NativeForwardOpAppPortHandles : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<ops::PingMultiTxOp>("tx", make_condition<CountCondition>(10));
+    auto mx = make_operator<ForwardTestOpPortHandles>("mx");
+    auto rx = make_operator<ops::PingMultiRxOp>("rx");
+
+    add_flow(tx, rx, {{"out1", "receivers"}});
+    add_flow(tx, mx, {{"out2", "data"}});
+    add_flow(mx, rx, {{"data", "receivers"}});
+  }
+};
+
 /// @brief version of NativeForwardOpApp with a dangling (unconnected) output port
 class NativeForwardOpAppDanglingOutput : public holoscan::Application {
  public:
@@ -192,6 +235,22 @@ TEST(NativeOperatorPingApp, TestNativeOperatorForwardApp) {
   EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
 }
 
+TEST(NativeOperatorPingApp, TestNativeOperatorForwardAppPortHandles) {
+  auto app = make_application<NativeForwardOpAppPortHandles>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("value1: 1") != std::string::npos);
+  EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
+}
+
 TEST(NativeOperatorPingApp, TestNativeForwardOpAppDanglingOutput) {
   auto app = make_application<NativeForwardOpAppDanglingOutput>();
 
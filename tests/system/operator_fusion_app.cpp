@@ -0,0 +1,286 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+constexpr int kCount = 10;
+
+class CountingTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingTxOp)
+
+  CountingTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(++index_, "out");
+  }
+
+ private:
+  int index_ = 0;
+};
+
+/// Emits two consecutive values per tick
+class DoubleTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(DoubleTxOp)
+
+  DoubleTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(++index_, "out");
+    op_output.emit(++index_, "out");
+  }
+
+ private:
+  int index_ = 0;
+};
+
+class IncrementOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(IncrementOp)
+
+  IncrementOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in");
+    spec.output<int>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    auto value = op_input.receive<int>("in").value();
+    op_output.emit(value + 1, "out");
+  }
+};
+
+class SumRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SumRxOp)
+
+  SumRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    sum_ += op_input.receive<int>("in").value();
+    count_++;
+  }
+
+  int sum() const { return sum_; }
+  int count() const { return count_; }
+
+ private:
+  int sum_ = 0;
+  int count_ = 0;
+};
+
+/// Receiver whose input port gets its condition in initialize(), once the executor looked for
+/// the connections to fuse
+class ConfiguredRxOp : public SumRxOp {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS_SUPER(ConfiguredRxOp, SumRxOp)
+
+  ConfiguredRxOp() = default;
+
+  void initialize() override {
+    spec()->inputs()["in"]->condition(ConditionType::kMessageAvailable,
+                                      Arg("min_size") = static_cast<uint64_t>(1));
+    SumRxOp::initialize();
+  }
+};
+
+/// tx -> mx1 -> mx2 -> rx
+class LinearChainApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    auto mx1 = make_operator<IncrementOp>("mx1");
+    auto mx2 = make_operator<IncrementOp>("mx2");
+    rx_ = make_operator<SumRxOp>("rx");
+
+    add_flow(tx, mx1);
+    add_flow(mx1, mx2);
+    add_flow(mx2, rx_);
+  }
+
+  std::shared_ptr<SumRxOp> rx_;
+};
+
+/// tx -> mx1 -> rx1 and tx -> rx2
+class BranchApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    auto mx1 = make_operator<IncrementOp>("mx1");
+    rx1_ = make_operator<SumRxOp>("rx1");
+    rx2_ = make_operator<SumRxOp>("rx2");
+
+    add_flow(tx, mx1);
+    add_flow(mx1, rx1_);
+    add_flow(tx, rx2_);
+  }
+
+  std::shared_ptr<SumRxOp> rx1_;
+  std::shared_ptr<SumRxOp> rx2_;
+};
+
+/// tx (two messages per tick) -> mx1 -> rx
+class DoubleTxApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<DoubleTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    auto mx1 = make_operator<IncrementOp>("mx1");
+    rx_ = make_operator<SumRxOp>("rx");
+
+    add_flow(tx, mx1);
+    add_flow(mx1, rx_);
+  }
+
+  std::shared_ptr<SumRxOp> rx_;
+};
+
+/// tx -> mx1 -> rx, where rx configures its input port in initialize()
+class ConfiguredPortApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    auto mx1 = make_operator<IncrementOp>("mx1");
+    rx_ = make_operator<ConfiguredRxOp>("rx");
+
+    add_flow(tx, mx1);
+    add_flow(mx1, rx_);
+  }
+
+  std::shared_ptr<ConfiguredRxOp> rx_;
+};
+
+// Sum of the values 1..kCount
+constexpr int kSum = kCount * (kCount + 1) / 2;
+
+}  // namespace
+
+TEST(OperatorFusionApp, TestFusionIsDisabledByDefault) {
+  auto app = make_application<LinearChainApp>();
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("Fusing operators") == std::string::npos);
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->rx_->sum(), kSum + 2 * kCount);
+}
+
+TEST(OperatorFusionApp, TestLinearChainIsFused) {
+  auto app = make_application<LinearChainApp>();
+  app->fuse_operators(true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("Fusing operators tx -> mx1 -> mx2 -> rx into a single entity") !=
+              std::string::npos);
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->rx_->sum(), kSum + 2 * kCount);
+
+  // Fused operators keep their own metrics
+  auto metrics = app->operator_metrics();
+  for (const auto& name : {"tx", "mx1", "mx2", "rx"}) {
+    ASSERT_EQ(metrics.count(name), 1) << name;
+    EXPECT_EQ(metrics[name].tick_count, kCount) << name;
+  }
+}
+
+TEST(OperatorFusionApp, TestBranchIsNotFused) {
+  auto app = make_application<BranchApp>();
+  app->fuse_operators(true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  // tx has two downstream operators, so only mx1 -> rx1 is fused
+  EXPECT_TRUE(log_output.find("Fusing operators mx1 -> rx1 into a single entity") !=
+              std::string::npos);
+  EXPECT_TRUE(log_output.find("Fusing operators tx") == std::string::npos);
+  EXPECT_EQ(app->rx1_->sum(), kSum + kCount);
+  EXPECT_EQ(app->rx2_->sum(), kSum);
+}
+
+TEST(OperatorFusionApp, TestEveryMessageOfATickIsPassed) {
+  auto app = make_application<DoubleTxApp>();
+  app->fuse_operators(true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("Fusing operators tx -> mx1 -> rx into a single entity") !=
+              std::string::npos);
+  // The downstream operators compute once per message, none of the messages is dropped
+  EXPECT_EQ(app->rx_->count(), 2 * kCount);
+  EXPECT_EQ(app->rx_->sum(), (2 * kCount) * (2 * kCount + 1) / 2 + 2 * kCount);
+}
+
+TEST(OperatorFusionApp, TestPortConfiguredInInitializeIsNotFused) {
+  auto app = make_application<ConfiguredPortApp>();
+  app->fuse_operators(true);
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  // The condition of the input port of rx is only set by its initialize() method
+  EXPECT_TRUE(log_output.find("Fusing operators tx -> mx1 into a single entity") !=
+              std::string::npos);
+  EXPECT_TRUE(log_output.find("-> rx") == std::string::npos);
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->rx_->sum(), kSum + kCount);
+}
+
+TEST(OperatorFusionApp, TestFusedChainDataFlowTracking) {
+  auto app = make_application<LinearChainApp>();
+  app->fuse_operators(true);
+  auto& tracker = app->track(0, 0, 0);
+
+  app->run();
+
+  // The labels are stamped by the fused connections as they would be by the annotated
+  // transmitters and receivers
+  auto paths = tracker.get_path_strings();
+  ASSERT_EQ(paths.size(), 1);
+  EXPECT_EQ(paths[0], "tx,mx1,mx2,rx");
+  EXPECT_EQ(tracker.get_metric(DataFlowMetric::kNumSrcMessages)["tx->out"], kCount);
+  EXPECT_EQ(app->rx_->count(), kCount);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+constexpr int kCount = 10;
+
+class CountingTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingTxOp)
+
+  CountingTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(++index_, "out");
+  }
+
+ private:
+  int index_ = 0;
+};
+
+/// Records the CPU affinity of the thread running compute()
+class AffinityRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(AffinityRxOp)
+
+  AffinityRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    op_input.receive<int>("in").value();
+    count_++;
+    pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set_);
+  }
+
+  int count() const { return count_; }
+  const cpu_set_t& cpu_set() const { return cpu_set_; }
+
+ private:
+  int count_ = 0;
+  cpu_set_t cpu_set_{};
+};
+
+/// Return the index of the first CPU the process can run on
+int first_available_cpu() {
+  cpu_set_t cpu_set;
+  sched_getaffinity(0, sizeof(cpu_set), &cpu_set);
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) { return cpu; }
+  }
+  return 0;
+}
+
+/// tx -> rx, with rx pinned to a thread pool restricted to a single CPU
+class ThreadPoolApp : public holoscan::Application {
+ public:
+  void compose() override {
+    tx_ = make_operator<CountingTxOp>("tx", make_condition<CountCondition>("count", kCount));
+    rx_ = make_operator<AffinityRxOp>("rx");
+    add_flow(tx_, rx_);
+
+    ArgList pool_args{Arg("initial_size", int64_t{1}),
+                      Arg("cpu_cores", std::vector<int32_t>{cpu_})};
+    if (sched_priority_ > 0) { pool_args.add(Arg("sched_priority", sched_priority_)); }
+    if (assign_by_name_) {
+      pool_args.add(Arg("operators", std::vector<std::string>{"rx"}));
+      pool_ = make_thread_pool("pool", pool_args);
+    } else {
+      pool_ = make_thread_pool("pool", pool_args);
+      pool_->add(rx_, true);
+    }
+    if (add_to_second_pool_) { make_thread_pool("second_pool", 1)->add(rx_, true); }
+  }
+
+  bool assign_by_name_ = false;
+  bool add_to_second_pool_ = false;
+  int32_t sched_priority_ = 0;
+  int32_t cpu_ = first_available_cpu();
+  std::shared_ptr<CountingTxOp> tx_;
+  std::shared_ptr<AffinityRxOp> rx_;
+  std::shared_ptr<ThreadPool> pool_;
+};
+
+std::shared_ptr<MultiThreadScheduler> use_multithread_scheduler(Application* app,
+                                                                ArgList extra_args = {}) {
+  auto scheduler = app->make_scheduler<MultiThreadScheduler>(
+      "multithread-scheduler",
+      Arg{"worker_thread_number", int64_t{2}},
+      Arg{"stop_on_deadlock_timeout", 100L});
+  scheduler->add_arg(extra_args);
+  app->scheduler(scheduler);
+  return scheduler;
+}
+
+std::shared_ptr<EventBasedScheduler> use_event_based_scheduler(Application* app,
+                                                               ArgList extra_args = {}) {
+  auto scheduler = app->make_scheduler<EventBasedScheduler>(
+      "event-based-scheduler",
+      Arg{"worker_thread_number", int64_t{2}},
+      Arg{"stop_on_deadlock_timeout", 100L});
+  scheduler->add_arg(extra_args);
+  app->scheduler(scheduler);
+  return scheduler;
+}
+
+}  // namespace
+
+TEST(ThreadPoolApp, TestPinnedOperatorRunsOnPoolCPUs) {
+  auto app = make_application<ThreadPoolApp>();
+  use_multithread_scheduler(app.get());
+
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->rx_->thread_pool(), app->pool_.get());
+  EXPECT_EQ(app->tx_->thread_pool(), nullptr);
+  EXPECT_TRUE(app->pool_->is_pinned(app->rx_.get()));
+
+  // The thread running rx is restricted to the CPU of the pool
+  const cpu_set_t& cpu_set = app->rx_->cpu_set();
+  EXPECT_EQ(CPU_COUNT(&cpu_set), 1);
+  EXPECT_TRUE(CPU_ISSET(app->cpu_, &cpu_set));
+}
+
+TEST(ThreadPoolApp, TestOperatorsAssignedByName) {
+  auto app = make_application<ThreadPoolApp>();
+  app->assign_by_name_ = true;
+  use_multithread_scheduler(app.get());
+
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  ASSERT_EQ(app->pool_->operators().size(), 1);
+  EXPECT_EQ(app->pool_->operators()[0], app->rx_);
+  EXPECT_EQ(app->rx_->thread_pool(), app->pool_.get());
+}
+
+TEST(ThreadPoolApp, TestPoolParametersAreDeclared) {
+  auto app = make_application<ThreadPoolApp>();
+  app->assign_by_name_ = true;
+  app->sched_priority_ = 1;
+  use_multithread_scheduler(app.get());
+
+  app->run();
+
+  // The parameters applied by Holoscan are part of the spec, but are not set on the GXF component
+  auto& params = app->pool_->spec()->params();
+  for (const char* key :
+       {"initial_size", "cpu_cores", "numa_node", "sched_priority", "operators", "pin_operators"}) {
+    EXPECT_EQ(params.count(key), 1) << key;
+  }
+  EXPECT_EQ(app->pool_->sched_priority(), 1);
+  EXPECT_TRUE(app->pool_->has_cpu_affinity());
+  EXPECT_TRUE(app->pool_->is_pinned(app->rx_.get()));
+}
+
+TEST(ThreadPoolApp, TestRealtimePoolEnablesStrictPinning) {
+  auto app = make_application<ThreadPoolApp>();
+  app->sched_priority_ = 1;
+  auto scheduler = use_multithread_scheduler(app.get());
+
+  // Setting SCHED_FIFO may be denied without CAP_SYS_NICE, which only logs an error
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_TRUE(scheduler->strict_job_thread_pinning());
+}
+
+TEST(ThreadPoolApp, TestStrictPinningDisabledWithRealtimePoolWarns) {
+  auto app = make_application<ThreadPoolApp>();
+  app->sched_priority_ = 1;
+  auto scheduler =
+      use_multithread_scheduler(app.get(), ArgList{Arg{"strict_job_thread_pinning", false}});
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("has strict_job_thread_pinning disabled") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_FALSE(scheduler->strict_job_thread_pinning());
+}
+
+TEST(ThreadPoolApp, TestRealtimePoolEnablesStrictPinningOfEventBasedScheduler) {
+  auto app = make_application<ThreadPoolApp>();
+  app->sched_priority_ = 1;
+  auto scheduler = use_event_based_scheduler(app.get());
+
+  // Setting SCHED_FIFO may be denied without CAP_SYS_NICE, which only logs an error
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_TRUE(scheduler->strict_job_thread_pinning());
+}
+
+TEST(ThreadPoolApp, TestStrictPinningOfEventBasedSchedulerDisabledWithRealtimePoolWarns) {
+  auto app = make_application<ThreadPoolApp>();
+  app->sched_priority_ = 1;
+  auto scheduler =
+      use_event_based_scheduler(app.get(), ArgList{Arg{"strict_job_thread_pinning", false}});
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("has strict_job_thread_pinning disabled") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_FALSE(scheduler->strict_job_thread_pinning());
+}
+
+TEST(ThreadPoolApp, TestStrictPinningUnchangedWithoutRealtimePool) {
+  auto app = make_application<ThreadPoolApp>();
+  auto scheduler = use_multithread_scheduler(app.get());
+
+  app->run();
+
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_FALSE(scheduler->strict_job_thread_pinning());
+}
+
+TEST(ThreadPoolApp, TestOperatorInTwoPoolsIsAnError) {
+  auto app = make_application<ThreadPoolApp>();
+  app->add_to_second_pool_ = true;
+  use_multithread_scheduler(app.get());
+
+  EXPECT_THROW(app->run(), std::runtime_error);
+}
+
+TEST(ThreadPoolApp, TestGreedySchedulerIgnoresThreadPools) {
+  auto app = make_application<ThreadPoolApp>();
+
+  testing::internal::CaptureStderr();
+  app->run();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(log_output.find("are ignored by the GreedyScheduler") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  EXPECT_EQ(app->rx_->count(), kCount);
+  EXPECT_EQ(app->rx_->thread_pool(), nullptr);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gxf/serialization/file_stream.hpp>
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/video_stream_recorder/video_stream_recorder.hpp>
+
+using namespace std::string_literals;
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+constexpr int64_t kFrameCount = 20;
+/// Large enough for the writer thread to be much slower than the transmitter
+constexpr int64_t kFrameSize = 4 * 1024 * 1024;
+
+/// Emits a host tensor of kFrameSize bytes on every tick. The content of the tensor depends on
+/// the index of the frame.
+class FrameTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameTxOp)
+
+  FrameTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<TensorMap>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    TensorMap tensors;
+    tensors.insert({"frame", make_host_tensor(index_++)});
+    op_output.emit(tensors, "out");
+  }
+
+ private:
+  static std::shared_ptr<Tensor> make_host_tensor(int64_t index) {
+    struct HostTensorContext {
+      std::vector<uint8_t> data;
+      int64_t shape[1];
+      DLManagedTensor tensor;
+    };
+    auto* ctx = new HostTensorContext{std::vector<uint8_t>(kFrameSize), {kFrameSize}, {}};
+    for (size_t i = 0; i < ctx->data.size(); i += 4096) {
+      ctx->data[i] = static_cast<uint8_t>(index + i / 4096);
+    }
+    ctx->tensor.dl_tensor.data = ctx->data.data();
+    ctx->tensor.dl_tensor.device = DLDevice{kDLCPU, 0};
+    ctx->tensor.dl_tensor.ndim = 1;
+    ctx->tensor.dl_tensor.dtype = DLDataType{kDLUInt, 8, 1};
+    ctx->tensor.dl_tensor.shape = ctx->shape;
+    ctx->tensor.dl_tensor.strides = nullptr;
+    ctx->tensor.dl_tensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](DLManagedTensor* self) {
+      delete static_cast<HostTensorContext*>(self->manager_ctx);
+    };
+    return std::make_shared<Tensor>(&ctx->tensor);
+  }
+
+  int64_t index_ = 0;
+};
+
+/// tx -> recorder
+class RecorderApp : public holoscan::Application {
+ public:
+  void compose() override {
+    auto tx = make_operator<FrameTxOp>("tx", make_condition<CountCondition>(kFrameCount));
+    recorder_ =
+        make_operator<ops::VideoStreamRecorderOp>("recorder",
+                                                  Arg("directory", "/tmp"s),
+                                                  Arg("basename", basename_),
+                                                  Arg("async_queue_size", async_queue_size_),
+                                                  Arg("backpressure_policy", backpressure_policy_));
+    add_flow(tx, recorder_);
+  }
+
+  std::string basename_ = "video_stream_recorder_app";
+  size_t async_queue_size_ = 0;
+  std::string backpressure_policy_ = "block";
+  std::shared_ptr<ops::VideoStreamRecorderOp> recorder_;
+};
+
+std::string recording_path(const std::string& basename) {
+  return "/tmp/" + basename;
+}
+
+std::vector<char> read_file(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::vector<nvidia::gxf::EntityIndex> read_index(const std::string& basename) {
+  const auto bytes =
+      read_file(recording_path(basename) + nvidia::gxf::FileStream::kIndexFileExtension);
+  std::vector<nvidia::gxf::EntityIndex> index(bytes.size() / sizeof(nvidia::gxf::EntityIndex));
+  std::memcpy(index.data(), bytes.data(), index.size() * sizeof(nvidia::gxf::EntityIndex));
+  return index;
+}
+
+void remove_recording(const std::string& basename) {
+  std::remove((recording_path(basename) + nvidia::gxf::FileStream::kIndexFileExtension).c_str());
+  std::remove((recording_path(basename) + nvidia::gxf::FileStream::kBinaryFileExtension).c_str());
+}
+
+}  // namespace
+
+TEST(VideoStreamRecorderApp, TestAsyncRecordingMatchesSyncRecording) {
+  const std::string sync_basename = "video_stream_recorder_app_sync";
+  const std::string async_basename = "video_stream_recorder_app_async";
+
+  auto sync_app = make_application<RecorderApp>();
+  sync_app->basename_ = sync_basename;
+  sync_app->run();
+
+  auto async_app = make_application<RecorderApp>();
+  async_app->basename_ = async_basename;
+  async_app->async_queue_size_ = 2;
+  async_app->run();
+
+  // The blocking policy loses no frame
+  EXPECT_EQ(async_app->recorder_->dropped_frames(), 0U);
+
+  const auto sync_entities =
+      read_file(recording_path(sync_basename) + nvidia::gxf::FileStream::kBinaryFileExtension);
+  const auto async_entities =
+      read_file(recording_path(async_basename) + nvidia::gxf::FileStream::kBinaryFileExtension);
+  ASSERT_FALSE(sync_entities.empty());
+  EXPECT_TRUE(sync_entities == async_entities);
+  EXPECT_EQ(async_app->recorder_->bytes_written(), async_entities.size());
+
+  // The log times of the index entries differ, but not the location of the entities
+  const auto sync_index = read_index(sync_basename);
+  const auto async_index = read_index(async_basename);
+  ASSERT_EQ(sync_index.size(), static_cast<size_t>(kFrameCount));
+  ASSERT_EQ(async_index.size(), sync_index.size());
+  for (size_t i = 0; i < sync_index.size(); ++i) {
+    EXPECT_EQ(async_index[i].data_size, sync_index[i].data_size);
+    EXPECT_EQ(async_index[i].data_offset, sync_index[i].data_offset);
+  }
+
+  remove_recording(sync_basename);
+  remove_recording(async_basename);
+}
+
+TEST(VideoStreamRecorderApp, TestDropPolicyDropsFramesWhenQueueIsFull) {
+  const std::string basename = "video_stream_recorder_app_drop";
+
+  auto app = make_application<RecorderApp>();
+  app->basename_ = basename;
+  app->async_queue_size_ = 1;
+  app->backpressure_policy_ = "drop";
+  app->run();
+
+  // Every frame is either written or counted as dropped
+  const uint64_t dropped_frames = app->recorder_->dropped_frames();
+  EXPECT_GT(dropped_frames, 0U);
+  EXPECT_EQ(read_index(basename).size() + dropped_frames, static_cast<uint64_t>(kFrameCount));
+
+  remove_recording(basename);
+}
+
+TEST(VideoStreamRecorderApp, TestBlockPolicyLosesNoFrameWhenQueueIsFull) {
+  const std::string basename = "video_stream_recorder_app_block";
+
+  auto app = make_application<RecorderApp>();
+  app->basename_ = basename;
+  app->async_queue_size_ = 1;
+  app->backpressure_policy_ = "block";
+  app->run();
+
+  EXPECT_EQ(app->recorder_->dropped_frames(), 0U);
+  EXPECT_EQ(read_index(basename).size(), static_cast<size_t>(kFrameCount));
+  EXPECT_EQ(app->recorder_->queue_depth(), 0U);
+
+  remove_recording(basename);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include <gxf/serialization/file_stream.hpp>
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/video_stream_replayer/video_stream_replayer.hpp>
+
+using namespace std::string_literals;
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+class FrameCounterOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameCounterOp)
+
+  FrameCounterOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<gxf::Entity>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto entity = op_input.receive<gxf::Entity>("in");
+    if (entity) { count_++; }
+  }
+
+  uint64_t count() const { return count_; }
+
+ private:
+  uint64_t count_ = 0;
+};
+
+std::string racerx_directory() {
+  return std::string(std::getenv("HOLOSCAN_INPUT_PATH")) + "/racerx";
+}
+
+/// Return the number of frames of the racerx recording, from the size of its index file
+uint64_t racerx_frame_count() {
+  const std::string index_filename =
+      racerx_directory() + "/racerx" + nvidia::gxf::FileStream::kIndexFileExtension;
+  struct stat index_stat {};
+  if (stat(index_filename.c_str(), &index_stat) != 0) { return 0; }
+  return static_cast<uint64_t>(index_stat.st_size) / sizeof(nvidia::gxf::EntityIndex);
+}
+
+/// replayer -> counter
+class ReplayerApp : public holoscan::Application {
+ public:
+  void compose() override {
+    replayer_ = make_operator<ops::VideoStreamReplayerOp>("replayer",
+                                                          Arg("directory", racerx_directory()),
+                                                          Arg("basename", "racerx"s),
+                                                          Arg("frame_rate", frame_rate_),
+                                                          Arg("realtime", realtime_),
+                                                          Arg("repeat", repeat_),
+                                                          Arg("count", count_),
+                                                          Arg("read_ahead", read_ahead_));
+    counter_ = make_operator<FrameCounterOp>("counter");
+    add_flow(replayer_, counter_);
+  }
+
+  float frame_rate_ = 0.f;
+  bool realtime_ = false;
+  bool repeat_ = false;
+  uint64_t count_ = 0;
+  uint64_t read_ahead_ = 0;
+  std::shared_ptr<ops::VideoStreamReplayerOp> replayer_;
+  std::shared_ptr<FrameCounterOp> counter_;
+};
+
+}  // namespace
+
+TEST(VideoStreamReplayerApp, TestPlaybackWithoutReadAhead) {
+  auto app = make_application<ReplayerApp>();
+  app->count_ = 20;
+
+  app->run();
+
+  EXPECT_EQ(app->counter_->count(), 20U);
+  // The scheduling of the replayer is unchanged without read-ahead
+  EXPECT_EQ(app->replayer_->conditions().count("async_condition"), 0U);
+}
+
+TEST(VideoStreamReplayerApp, TestQueuedPlayback) {
+  auto app = make_application<ReplayerApp>();
+  app->count_ = 20;
+  app->read_ahead_ = 4;
+
+  app->run();
+
+  EXPECT_EQ(app->counter_->count(), 20U);
+  EXPECT_EQ(app->replayer_->conditions().count("async_condition"), 1U);
+}
+
+TEST(VideoStreamReplayerApp, TestQueuedPlaybackOfWholeFile) {
+  const uint64_t frame_count = racerx_frame_count();
+  ASSERT_GT(frame_count, 0U);
+
+  auto app = make_application<ReplayerApp>();
+  app->read_ahead_ = 8;
+
+  app->run();
+
+  EXPECT_EQ(app->counter_->count(), frame_count);
+}
+
+TEST(VideoStreamReplayerApp, TestQueuedPlaybackLoops) {
+  const uint64_t frame_count = racerx_frame_count();
+  ASSERT_GT(frame_count, 0U);
+
+  auto app = make_application<ReplayerApp>();
+  app->repeat_ = true;
+  app->count_ = frame_count + 10;
+  app->read_ahead_ = 4;
+
+  app->run();
+
+  // The playback went past the end of the file and restarted from the first frame
+  EXPECT_EQ(app->counter_->count(), frame_count + 10);
+}
+
+TEST(VideoStreamReplayerApp, TestStopWithFullQueue) {
+  auto app = make_application<ReplayerApp>();
+  // One frame per second: the queue is filled long before the frames are due
+  app->frame_rate_ = 1.f;
+  app->realtime_ = true;
+  app->read_ahead_ = 8;
+  app->scheduler(
+      app->make_scheduler<GreedyScheduler>("greedy-scheduler", Arg("max_duration_ms", 500L)));
+
+  const auto start = std::chrono::steady_clock::now();
+  app->run();
+  const auto duration = std::chrono::steady_clock::now() - start;
+
+  // stop() does not wait for the queued frames to be played
+  EXPECT_LT(duration, std::chrono::seconds(5));
+  EXPECT_EQ(app->counter_->count(), 1U);
+}
+
+}  // namespace holoscan